@@ -0,0 +1,15 @@
+#ifndef PACKED_VERTEX_HLSLI
+#define PACKED_VERTEX_HLSLI
+
+/// @brief 八面体エンコードした法線を戻す（VertexPacker::EncodeOctahedralNormal と対になる）
+/// @param encoded R16G16_SNORM で読んだ値（-1 ～ 1）
+float3 DecodeOctahedralNormal(float2 encoded)
+{
+    float3 normal = float3(encoded.x, encoded.y, 1.0f - abs(encoded.x) - abs(encoded.y));
+    // 下半球（z < 0）は対角線で折り返してある
+    float t = saturate(-normal.z);
+    normal.xy += t * (1.0f - 2.0f * step(0.0f, normal.xy)); // xy >= 0 なら -t、それ以外は +t
+    return normalize(normal);
+}
+
+#endif
@@ -1,22 +1,25 @@
 #include "Object3d.hlsli"
+#include "../Common/PackedVertex.hlsli"
     
 ConstantBuffer<TransformationMatrix> gTransformationMatrix : register(b0);
 
 
 struct VertexShaderInput
 {
-    float32_t4 position : POSITION0;
-    float32_t2 texcoord : TEXCOORD0;
-    float32_t3 normal : NORMAL0;
+    float32_t3 position : POSITION0; // Slot 0
+    float32_t2 normal : NORMAL0;     // Slot 1（八面体エンコード）
+    float32_t2 texcoord : TEXCOORD0; // Slot 1
 };
 
 VertexShaderOutput main(VertexShaderInput input)
 {
     VertexShaderOutput output;
+    float32_t4 position = float32_t4(input.position, 1.0f);
+    float32_t3 normal = DecodeOctahedralNormal(input.normal);
     output.texcoord = input.texcoord;
-    output.position = mul(input.position, gTransformationMatrix.WVP);
-    output.normal = normalize(mul(input.normal, (float32_t3x3)gTransformationMatrix.WorldInversTranspose));
-    output.worldPosition = mul(input.position, gTransformationMatrix.World).xyz;
+    output.position = mul(position, gTransformationMatrix.WVP);
+    output.normal = normalize(mul(normal, (float32_t3x3)gTransformationMatrix.WorldInversTranspose));
+    output.worldPosition = mul(position, gTransformationMatrix.World).xyz;
     
     return output;
 }
\ No newline at end of file
@@ -1,23 +1,30 @@
 #include "Particle.hlsli"
+#include "../Common/PackedVertex.hlsli"
     
 StructuredBuffer<ParticleForGPU> gParticle : register(t0);
+ConstantBuffer<ParticleDrawConstants> gDrawConstants : register(b0);
 
 struct VertexShaderInput
 {
-    float32_t4 position : POSITION0;
-    float32_t2 texcoord : TEXCOORD0;
-    float32_t3 normal : NORMAL0;
+    float32_t3 position : POSITION0; // Slot 0
+    float32_t2 normal : NORMAL0;     // Slot 1（八面体エンコード）
+    float32_t2 texcoord : TEXCOORD0; // Slot 1
 };
 
 VertexShaderOutput main(VertexShaderInput input, uint32_t instanceId : SV_InstanceID)
 {
+    ParticleForGPU particle = gParticle[instanceId];
+    float32_t4 rotation = UnpackRotation(particle.Rotation);
+    float32_t3x3 billboard = (float32_t3x3) gDrawConstants.Billboard;
+
+    // モデルの頂点座標をそのまま使用（ビルボード無効時はBillboardが単位行列）
+    float32_t3 worldPosition = TransformLocal(particle, rotation, billboard, input.position) + particle.Position;
+
     VertexShaderOutput output;
-    
-    // モデルの頂点座標をそのまま使用（ビルボード変換なし）
     output.texcoord = input.texcoord;
-    output.position = mul(input.position, gParticle[instanceId].WVP);
-    output.normal = normalize(mul(input.normal, (float32_t3x3) gParticle[instanceId].World));
-    output.color = gParticle[instanceId].Color;
+    output.position = mul(float32_t4(worldPosition, 1.0f), gDrawConstants.ViewProjection);
+    output.normal = normalize(TransformLocal(particle, rotation, billboard, DecodeOctahedralNormal(input.normal)));
+    output.color = UnpackColor(particle.Color);
     
     return output;
 }
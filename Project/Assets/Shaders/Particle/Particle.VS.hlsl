@@ -1,6 +1,7 @@
 #include "Particle.hlsli"
     
 StructuredBuffer<ParticleForGPU> gParticle : register(t0);
+ConstantBuffer<ParticleDrawConstants> gDrawConstants : register(b0);
 
 struct VertexShaderInput
 {
@@ -11,10 +12,17 @@ struct VertexShaderInput
 
 VertexShaderOutput main(VertexShaderInput input, uint32_t instanceId : SV_InstanceID)
 {
+    ParticleForGPU particle = gParticle[instanceId];
+    float32_t4 rotation = UnpackRotation(particle.Rotation);
+    float32_t3x3 billboard = (float32_t3x3) gDrawConstants.Billboard;
+
+    // ワールド行列はCPUで作らず、ここで位置・回転・スケールから展開する
+    float32_t3 worldPosition = TransformLocal(particle, rotation, billboard, input.position.xyz) + particle.Position;
+
     VertexShaderOutput output;
     output.texcoord = input.texcoord;
-    output.position = mul(input.position, gParticle[instanceId].WVP);
-    output.normal = normalize(mul(input.normal, (float32_t3x3) gParticle[instanceId].World));
-    output.color = gParticle[instanceId].Color;
+    output.position = mul(float32_t4(worldPosition, 1.0f), gDrawConstants.ViewProjection);
+    output.normal = normalize(TransformLocal(particle, rotation, billboard, input.normal));
+    output.color = UnpackColor(particle.Color);
         return output;
-}
\ No newline at end of file
+}
@@ -6,9 +6,52 @@ struct VertexShaderOutput
     float32_t4 color : COLOR0;
 };
 
+// インスタンスごとのデータ（ParticleGPUData.h の ParticleForGPU と同じ36バイトのレイアウト）
 struct ParticleForGPU
 {
-    float32_t4x4 WVP;
-    float32_t4x4 World;
-    float32_t4 Color;
-};
\ No newline at end of file
+    float32_t3 Position;
+    uint32_t Color;         // RGBA8 UNORM
+    float32_t3 Scale;
+    uint32_t2 Rotation;     // クォータニオン xyzw（SNORM16 x4）
+};
+
+// システムごとの描画定数（ルート定数）
+struct ParticleDrawConstants
+{
+    float32_t4x4 ViewProjection;
+    float32_t4x4 Billboard;
+};
+
+/// @brief RGBA8 UNORM を展開
+float32_t4 UnpackColor(uint32_t packed)
+{
+    return float32_t4(
+        packed & 0xFF,
+        (packed >> 8) & 0xFF,
+        (packed >> 16) & 0xFF,
+        packed >> 24) / 255.0f;
+}
+
+/// @brief SNORM16 x4 のクォータニオンを展開（量子化誤差を正規化で補正）
+float32_t4 UnpackRotation(uint32_t2 packed)
+{
+    int32_t4 value = int32_t4(
+        int32_t(packed.x << 16) >> 16,
+        int32_t(packed.x) >> 16,
+        int32_t(packed.y << 16) >> 16,
+        int32_t(packed.y) >> 16);
+    return normalize(max(float32_t4(value) / 32767.0f, -1.0f));
+}
+
+/// @brief クォータニオンでベクトルを回転
+float32_t3 RotateVector(float32_t4 q, float32_t3 v)
+{
+    float32_t3 t = 2.0f * cross(q.xyz, v);
+    return v + q.w * t + cross(q.xyz, t);
+}
+
+/// @brief ローカル座標のベクトルをスケール→回転→ビルボードの順に変換
+float32_t3 TransformLocal(ParticleForGPU particle, float32_t4 rotation, float32_t3x3 billboard, float32_t3 v)
+{
+    return mul(RotateVector(rotation, v * particle.Scale), billboard);
+}
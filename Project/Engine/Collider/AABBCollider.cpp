@@ -31,6 +31,12 @@ bool AABBCollider::CheckCollision(Collider* other) const {
    return false;
 }
 
+BoundingBox AABBCollider::GetBounds() const {
+   Vector3 center = GetPosition();
+   Vector3 halfSize = size_ * 0.5f;
+   return BoundingBox(center - halfSize, center + halfSize);
+}
+
 void AABBCollider::SetSize(const Vector3& size) {
    size_ = size;
 }
@@ -11,6 +11,8 @@ public:
 
    bool CheckCollision(Collider* other) const override;
 
+   BoundingBox GetBounds() const override;
+
    void SetSize(const Vector3& size) override;
 
    /// @brief AABB の最小座標を取得
@@ -1,10 +1,30 @@
 #include "Collider.h"
 #include "Engine/ObjectCommon/GameObject.h"
+#include "Engine/Collider/DynamicAABBTree.h"
+#include "Engine/Utility/Collision/CollisionUtils.h"
+
+BoundingBox Collider::GetBounds() const {
+   Vector3 position = GetPosition();
+   return BoundingBox(position, position);
+}
+
+bool Collider::IntersectRay(const Vector3& origin, const Vector3& direction, float maxDistance, float& outDistance) const {
+   const Vector3 inverseDirection = { 1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z };
+   return DynamicAABBTree::RayIntersects(origin, inverseDirection, GetBounds(), maxDistance, outDistance);
+}
+
+bool Collider::OverlapsSphere(const Vector3& center, float radius) const {
+   return CollisionUtils::IsColliding(CollisionUtils::Sphere{ center, radius }, GetBounds());
+}
+
+bool Collider::OverlapsBox(const BoundingBox& box) const {
+   return DynamicAABBTree::TestOverlap(GetBounds(), box);
+}
 
 Vector3 Collider::GetPosition() const {
-   if (owner_ == nullptr) return Vector3();
+   if (owner_ == nullptr) return offset_;
 
-   return owner_->GetWorldPosition();
+   return owner_->GetWorldPosition() + offset_;
 }
 
 ColliderType Collider::GetType() const {
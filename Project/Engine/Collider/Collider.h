@@ -1,6 +1,7 @@
 #pragma once
 #include "CollisionLayer.h"
 #include "MathCore.h"
+#include "Engine/Math/BoundingBox.h"
 
 enum class ColliderType {
    None,
@@ -16,6 +17,25 @@ public:
 
    virtual bool CheckCollision(Collider* other) const = 0;
 
+   /// @brief ワールド空間の境界ボックスを取得（ブロードフェーズで使用）
+   /// @return 形状を包むAABB（基底クラスでは中心点のみ）
+   virtual BoundingBox GetBounds() const;
+
+   /// @brief レイとの交差判定
+   /// @param origin レイの始点
+   /// @param direction レイの方向（正規化済み）
+   /// @param maxDistance 最大距離
+   /// @param outDistance 交点までの距離（始点が内側の場合は0）
+   /// @return maxDistance 以内で交差する場合true（基底クラスでは境界ボックスで判定）
+   virtual bool IntersectRay(const Vector3& origin, const Vector3& direction, float maxDistance, float& outDistance) const;
+
+   /// @brief 球との重なり判定（基底クラスでは境界ボックスで判定）
+   virtual bool OverlapsSphere(const Vector3& center, float radius) const;
+
+   /// @brief AABBとの重なり判定（基底クラスでは境界ボックスで判定）
+   virtual bool OverlapsBox(const BoundingBox& box) const;
+
+   /// @brief 中心位置を取得（オーナーのワールド座標 + オフセット）
    Vector3 GetPosition() const;
    ColliderType GetType() const;
 
@@ -29,6 +49,10 @@ public:
    void SetOwner(GameObject* owner) { owner_ = owner; }
    GameObject* GetOwner() const { return owner_; }
 
+   /// @brief オーナーからの中心位置のオフセットを設定（オーナーがいない場合はワールド座標として扱う）
+   void SetOffset(const Vector3& offset) { offset_ = offset; }
+   const Vector3& GetOffset() const { return offset_; }
+
    void SetEnabled(bool enabled) { isEnabled_ = enabled; }
    bool IsEnabled() const { return isEnabled_; }
 
@@ -38,6 +62,7 @@ public:
 protected:
    ColliderType type_ = ColliderType::None;
    GameObject* owner_ = nullptr;
+   Vector3 offset_{};
    CollisionLayer layer_ = CollisionLayer::Default;
    bool isEnabled_ = true;
 };
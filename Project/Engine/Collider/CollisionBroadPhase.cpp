@@ -0,0 +1,284 @@
+#include "CollisionBroadPhase.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+   // セル座標は1軸21ビットに収める（±約100万セル）
+   constexpr int32_t kCellCoordBias = 1 << 20;
+   constexpr int32_t kCellCoordMin = -kCellCoordBias;
+   constexpr int32_t kCellCoordMax = kCellCoordBias - 1;
+   constexpr float kMinCellSize = 1.0e-3f;
+
+   /// @brief 2つの境界ボックスが重なるか（接触も含む。CollisionUtils::IsColliding と同じ判定）
+   bool Overlaps(const BoundingBox& a, const BoundingBox& b) {
+      return DynamicAABBTree::TestOverlap(a, b);
+   }
+
+   /// @brief 座標をセル座標に変換
+   int32_t ToCell(float value, float inverseCellSize) {
+      float cell = std::floor(value * inverseCellSize);
+      cell = (std::min)((std::max)(cell, static_cast<float>(kCellCoordMin)), static_cast<float>(kCellCoordMax));
+      return static_cast<int32_t>(cell);
+   }
+
+   /// @brief セル座標を1つのキーにパック
+   uint64_t PackCell(int32_t x, int32_t y, int32_t z) {
+      return (static_cast<uint64_t>(x + kCellCoordBias) << 42) |
+             (static_cast<uint64_t>(y + kCellCoordBias) << 21) |
+             static_cast<uint64_t>(z + kCellCoordBias);
+   }
+
+   /// @brief id の小さい順に並べたペアを作成
+   CollisionBroadPhase::Pair MakeOrderedPair(uint32_t a, uint32_t b) {
+      return (a < b) ? CollisionBroadPhase::Pair(a, b) : CollisionBroadPhase::Pair(b, a);
+   }
+}
+
+void CollisionBroadPhase::SetType(BroadPhaseType type) {
+   if (type_ != type) {
+      Reset();
+   }
+   type_ = type;
+}
+
+void CollisionBroadPhase::Reset() {
+   tree_.Clear();
+   treeEntries_.clear();
+   treeIds_.clear();
+   movedIds_.clear();
+   treePairs_.clear();
+   treeProxyRemoved_ = false;
+   lastMovedProxyCount_ = 0;
+}
+
+void CollisionBroadPhase::FindPairs(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs) {
+   outPairs.clear();
+   // 動的AABBツリーは要素の削除を反映するため、要素が少なくても更新する
+   if (proxies.size() < 2 && type_ != BroadPhaseType::DynamicTree) return;
+
+   switch (type_) {
+   case BroadPhaseType::SpatialHash:   FindPairsSpatialHash(proxies, outPairs); break;
+   case BroadPhaseType::SweepAndPrune: FindPairsSweepAndPrune(proxies, outPairs); break;
+   case BroadPhaseType::DynamicTree:   FindPairsDynamicTree(proxies, outPairs); break;
+   default:                            FindPairsBruteForce(proxies, outPairs); break;
+   }
+
+   // 方式によらず同じ順序でコールバックが呼ばれるよう並べ替える
+   std::sort(outPairs.begin(), outPairs.end());
+}
+
+void CollisionBroadPhase::FindPairsBruteForce(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs) {
+   for (size_t i = 0; i < proxies.size(); ++i) {
+      for (size_t j = i + 1; j < proxies.size(); ++j) {
+         if (Overlaps(proxies[i].bounds, proxies[j].bounds)) {
+            outPairs.push_back(MakeOrderedPair(proxies[i].id, proxies[j].id));
+         }
+      }
+   }
+}
+
+void CollisionBroadPhase::FindPairsSpatialHash(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs) {
+   // セルサイズ未指定の場合は平均的な大きさの2倍（多くの要素が1軸あたり1〜2セルに収まる）
+   float cellSize = cellSize_;
+   if (cellSize <= 0.0f) {
+      double extentSum = 0.0;
+      for (const auto& proxy : proxies) {
+         const Vector3 size = proxy.bounds.GetSize();
+         extentSum += (std::max)({ size.x, size.y, size.z });
+      }
+      cellSize = static_cast<float>(extentSum / static_cast<double>(proxies.size())) * 2.0f;
+   }
+   cellSize = (std::max)(cellSize, kMinCellSize);
+   lastCellSize_ = cellSize;
+   const float inverseCellSize = 1.0f / cellSize;
+
+   // 各要素を重なるすべてのセルに登録
+   cellEntries_.clear();
+   largeProxies_.clear();
+   for (uint32_t index = 0; index < proxies.size(); ++index) {
+      const BoundingBox& bounds = proxies[index].bounds;
+      const int32_t minX = ToCell(bounds.min.x, inverseCellSize);
+      const int32_t minY = ToCell(bounds.min.y, inverseCellSize);
+      const int32_t minZ = ToCell(bounds.min.z, inverseCellSize);
+      const int32_t maxX = ToCell(bounds.max.x, inverseCellSize);
+      const int32_t maxY = ToCell(bounds.max.y, inverseCellSize);
+      const int32_t maxZ = ToCell(bounds.max.z, inverseCellSize);
+
+      const uint64_t cellCount = static_cast<uint64_t>(maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1);
+      if (cellCount > kMaxCellsPerProxy) {
+         largeProxies_.push_back(index);
+         continue;
+      }
+
+      for (int32_t x = minX; x <= maxX; ++x) {
+         for (int32_t y = minY; y <= maxY; ++y) {
+            for (int32_t z = minZ; z <= maxZ; ++z) {
+               cellEntries_.push_back({ PackCell(x, y, z), index });
+            }
+         }
+      }
+   }
+
+   // 同じセルの登録が連続するよう並べ替える
+   std::sort(cellEntries_.begin(), cellEntries_.end(), [](const CellEntry& a, const CellEntry& b) {
+      return a.cellKey < b.cellKey || (a.cellKey == b.cellKey && a.proxyIndex < b.proxyIndex);
+   });
+
+   // セルごとに総当たり
+   // 複数のセルを共有するペアは、重なり領域の最小点を含むセルでのみ出力して重複を防ぐ
+   for (size_t begin = 0; begin < cellEntries_.size();) {
+      const uint64_t cellKey = cellEntries_[begin].cellKey;
+      size_t end = begin + 1;
+      while (end < cellEntries_.size() && cellEntries_[end].cellKey == cellKey) {
+         ++end;
+      }
+
+      for (size_t i = begin; i < end; ++i) {
+         const BroadPhaseProxy& a = proxies[cellEntries_[i].proxyIndex];
+         for (size_t j = i + 1; j < end; ++j) {
+            const BroadPhaseProxy& b = proxies[cellEntries_[j].proxyIndex];
+            if (!Overlaps(a.bounds, b.bounds)) continue;
+
+            const uint64_t ownerCell = PackCell(
+               ToCell((std::max)(a.bounds.min.x, b.bounds.min.x), inverseCellSize),
+               ToCell((std::max)(a.bounds.min.y, b.bounds.min.y), inverseCellSize),
+               ToCell((std::max)(a.bounds.min.z, b.bounds.min.z), inverseCellSize));
+            if (ownerCell == cellKey) {
+               outPairs.push_back(MakeOrderedPair(a.id, b.id));
+            }
+         }
+      }
+
+      begin = end;
+   }
+
+   // グリッドに登録しなかった大きな要素は全要素と判定（大きな要素同士は一度だけ）
+   for (size_t largeIndex = 0; largeIndex < largeProxies_.size(); ++largeIndex) {
+      const uint32_t index = largeProxies_[largeIndex];
+      const BroadPhaseProxy& large = proxies[index];
+      for (uint32_t other = 0; other < proxies.size(); ++other) {
+         if (other == index) continue;
+
+         const bool otherIsLarge = std::binary_search(largeProxies_.begin(), largeProxies_.end(), other);
+         if (otherIsLarge && other < index) continue;
+
+         if (Overlaps(large.bounds, proxies[other].bounds)) {
+            outPairs.push_back(MakeOrderedPair(large.id, proxies[other].id));
+         }
+      }
+   }
+}
+
+void CollisionBroadPhase::FindPairsSweepAndPrune(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs) {
+   // 最小X座標の順に並べる
+   sortedIndices_.resize(proxies.size());
+   for (uint32_t i = 0; i < proxies.size(); ++i) {
+      sortedIndices_[i] = i;
+   }
+   std::sort(sortedIndices_.begin(), sortedIndices_.end(), [&](uint32_t a, uint32_t b) {
+      return proxies[a].bounds.min.x < proxies[b].bounds.min.x;
+   });
+
+   // X区間が重なる範囲だけを走査し、Y・Zで絞り込む
+   for (size_t i = 0; i < sortedIndices_.size(); ++i) {
+      const BroadPhaseProxy& a = proxies[sortedIndices_[i]];
+      for (size_t j = i + 1; j < sortedIndices_.size(); ++j) {
+         const BroadPhaseProxy& b = proxies[sortedIndices_[j]];
+         if (b.bounds.min.x > a.bounds.max.x) break;
+
+         if (a.bounds.min.y <= b.bounds.max.y && a.bounds.max.y >= b.bounds.min.y &&
+             a.bounds.min.z <= b.bounds.max.z && a.bounds.max.z >= b.bounds.min.z) {
+            outPairs.push_back(MakeOrderedPair(a.id, b.id));
+         }
+      }
+   }
+}
+
+void CollisionBroadPhase::UpdateTree(const std::vector<BroadPhaseProxy>& proxies) {
+   ++treeFrame_;
+   // ペアを保持するのは DynamicTree のみ（他の方式では付け替えを記録しない）
+   const bool trackPairs = (type_ == BroadPhaseType::DynamicTree);
+
+   // 新しい要素は木に追加し、既存の要素は太いAABBからはみ出した場合のみ付け替える
+   for (const auto& proxy : proxies) {
+      if (proxy.id >= treeEntries_.size()) {
+         treeEntries_.resize(proxy.id + 1);
+      }
+
+      TreeEntry& entry = treeEntries_[proxy.id];
+      if (entry.proxyId == DynamicAABBTree::kNullNode) {
+         entry.proxyId = tree_.CreateProxy(proxy.bounds, proxy.id);
+         treeIds_.push_back(proxy.id);
+         if (trackPairs) movedIds_.push_back(proxy.id);
+      } else {
+         const Vector3 displacement = proxy.bounds.GetCenter() - entry.bounds.GetCenter();
+         if (tree_.MoveProxy(entry.proxyId, proxy.bounds, displacement) && trackPairs) {
+            movedIds_.push_back(proxy.id);
+         }
+      }
+      entry.bounds = proxy.bounds;
+      entry.lastSeenFrame = treeFrame_;
+   }
+
+   // 今回含まれていなかった要素（無効化・登録解除）を木から削除
+   for (size_t i = 0; i < treeIds_.size();) {
+      TreeEntry& entry = treeEntries_[treeIds_[i]];
+      if (entry.lastSeenFrame == treeFrame_) {
+         ++i;
+         continue;
+      }
+      tree_.DestroyProxy(entry.proxyId);
+      entry.proxyId = DynamicAABBTree::kNullNode;
+      treeIds_[i] = treeIds_.back();
+      treeIds_.pop_back();
+      treeProxyRemoved_ = trackPairs;
+   }
+}
+
+void CollisionBroadPhase::FindPairsDynamicTree(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs) {
+   UpdateTree(proxies);
+   lastMovedProxyCount_ = static_cast<uint32_t>(movedIds_.size());
+
+   // 保持しているペアのうち、削除された要素を含むものと太いAABBが離れたものを外す
+   if (treeProxyRemoved_ || !movedIds_.empty()) {
+      std::erase_if(treePairs_, [&](const Pair& pair) {
+         const TreeEntry& a = treeEntries_[pair.first];
+         const TreeEntry& b = treeEntries_[pair.second];
+         if (a.proxyId == DynamicAABBTree::kNullNode || b.proxyId == DynamicAABBTree::kNullNode) return true;
+         return !Overlaps(tree_.GetFatBounds(a.proxyId), tree_.GetFatBounds(b.proxyId));
+      });
+   }
+
+   // 付け替えた要素だけ木を検索して新しいペアを追加（静止した要素同士のペアは保持したものを使う）
+   if (!movedIds_.empty()) {
+      newTreePairs_.clear();
+      for (uint32_t id : movedIds_) {
+         // 付け替えた後に削除された要素
+         const int32_t proxyId = treeEntries_[id].proxyId;
+         if (proxyId == DynamicAABBTree::kNullNode) continue;
+
+         tree_.Query(tree_.GetFatBounds(proxyId), [&](int32_t otherProxyId) {
+            if (otherProxyId != proxyId) {
+               newTreePairs_.push_back(MakeOrderedPair(id, tree_.GetUserData(otherProxyId)));
+            }
+            return true;
+         });
+      }
+
+      // 両方が付け替えられたペアや既存のペアとの重複を除いてマージ
+      std::sort(newTreePairs_.begin(), newTreePairs_.end());
+      const size_t oldSize = treePairs_.size();
+      treePairs_.insert(treePairs_.end(), newTreePairs_.begin(), newTreePairs_.end());
+      std::inplace_merge(treePairs_.begin(), treePairs_.begin() + oldSize, treePairs_.end());
+      treePairs_.erase(std::unique(treePairs_.begin(), treePairs_.end()), treePairs_.end());
+   }
+   movedIds_.clear();
+   treeProxyRemoved_ = false;
+
+   // 実際の境界ボックスが重なるペアのみ出力
+   for (const auto& pair : treePairs_) {
+      if (Overlaps(treeEntries_[pair.first].bounds, treeEntries_[pair.second].bounds)) {
+         outPairs.push_back(pair);
+      }
+   }
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Engine/Math/BoundingBox.h"
+#include "DynamicAABBTree.h"
+
+/// @brief ブロードフェーズの方式
+enum class BroadPhaseType {
+   BruteForce,     // 総当たり（O(n²)。検証・比較用）
+   SpatialHash,    // 一様グリッドによる空間ハッシュ
+   SweepAndPrune,  // X軸方向のソートと走査
+   DynamicTree,    // 動的AABBツリー（静止・低速な要素が多い場合向け。フレームをまたいで木と候補ペアを保持）
+};
+
+/// @brief ブロードフェーズに渡す境界ボックス
+struct BroadPhaseProxy {
+   BoundingBox bounds;  // ワールド空間のAABB
+   uint32_t id = 0;     // 呼び出し側の識別子（CollisionManagerではコライダーのインデックス）
+};
+
+/// @brief 境界ボックスが重なる候補ペアを列挙するブロードフェーズ
+/// @note 作業バッファは保持して使い回すため、毎フレーム同じインスタンスを使用すること
+class CollisionBroadPhase {
+public:
+   using Pair = std::pair<uint32_t, uint32_t>;
+
+   /// @brief 方式を設定
+   void SetType(BroadPhaseType type);
+   BroadPhaseType GetType() const { return type_; }
+
+   /// @brief 空間ハッシュのセルサイズを設定
+   /// @param cellSize セルの一辺の長さ（0以下の場合は境界ボックスの平均サイズから自動で決める）
+   void SetCellSize(float cellSize) { cellSize_ = cellSize; }
+
+   /// @brief 直近の空間ハッシュで使用したセルサイズを取得
+   float GetLastCellSize() const { return lastCellSize_; }
+
+   /// @brief 境界ボックスが重なるペアを列挙
+   /// @param proxies 境界ボックス
+   /// @param outPairs 出力（first < second の id ペアを昇順に格納。重複なし）
+   /// @note DynamicTree では id をフレーム間で同じ要素を指すキーとして扱う（前回含まれていた id が無い場合は木から削除）
+   void FindPairs(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs);
+
+   /// @brief フレームをまたいで保持している状態（動的AABBツリーと候補ペア）を破棄
+   /// @note id の割り当てが変わる場合（要素の登録し直しなど）に呼ぶ
+   void Reset();
+
+   /// @brief 動的AABBツリーに境界ボックスを反映（ペアは列挙しない）
+   /// @param proxies 境界ボックス（FindPairs と同じく、含まれていない id は木から削除）
+   /// @note DynamicTree では FindPairs が内部で呼ぶ。他の方式ではレイキャストなどの検索用に木を更新する場合に呼ぶ
+   void UpdateTree(const std::vector<BroadPhaseProxy>& proxies);
+
+   /// @brief 動的AABBツリーを取得（葉の userData は id。DynamicTree 以外では UpdateTree を呼んだ時点の内容）
+   const DynamicAABBTree& GetDynamicTree() const { return tree_; }
+
+   /// @brief 直近の FindPairs で動的AABBツリーを付け替えた要素数
+   uint32_t GetLastMovedProxyCount() const { return lastMovedProxyCount_; }
+
+private:
+   void FindPairsBruteForce(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs);
+   void FindPairsSpatialHash(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs);
+   void FindPairsSweepAndPrune(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs);
+   void FindPairsDynamicTree(const std::vector<BroadPhaseProxy>& proxies, std::vector<Pair>& outPairs);
+
+   /// @brief 空間ハッシュの1セルへの登録
+   struct CellEntry {
+      uint64_t cellKey;    // セル座標をパックしたキー
+      uint32_t proxyIndex; // proxies内のインデックス
+   };
+
+   // 1つの境界ボックスが登録できるセル数の上限（超える大きなものは全要素と総当たりで判定）
+   static constexpr uint32_t kMaxCellsPerProxy = 64;
+
+   BroadPhaseType type_ = BroadPhaseType::SpatialHash;
+   float cellSize_ = 0.0f;
+   float lastCellSize_ = 0.0f;
+
+   // 作業バッファ
+   std::vector<CellEntry> cellEntries_;
+   std::vector<uint32_t> largeProxies_;
+   std::vector<uint32_t> sortedIndices_;
+
+   /// @brief 動的AABBツリーに登録した要素（id で引く）
+   struct TreeEntry {
+      int32_t proxyId = DynamicAABBTree::kNullNode;
+      BoundingBox bounds;          // 直近の境界ボックス
+      uint32_t lastSeenFrame = 0;  // 最後に FindPairs に含まれていたフレーム
+   };
+
+   DynamicAABBTree tree_;
+   std::vector<TreeEntry> treeEntries_;
+   std::vector<uint32_t> treeIds_;      // 木に登録中の id
+   std::vector<uint32_t> movedIds_;     // 前回のペア更新以降に付け替えた id（DynamicTree のみ記録）
+   std::vector<Pair> treePairs_;        // 太いAABB同士が重なるペア（昇順。フレームをまたいで保持）
+   std::vector<Pair> newTreePairs_;
+   bool treeProxyRemoved_ = false;      // 前回のペア更新以降に木から削除した要素があるか
+   uint32_t treeFrame_ = 0;
+   uint32_t lastMovedProxyCount_ = 0;
+};
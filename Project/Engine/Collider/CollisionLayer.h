@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 
 /// @brief 衝突判定レイヤー
 /// @note 衝突判定の最適化とゲームロジックの分離に使用
@@ -15,3 +16,16 @@ enum class CollisionLayer {
    Environment,   // 環境オブジェクト（壁など）
    Count          // レイヤー数（列挙の最後に配置）
 };
+
+/// @brief レイヤーの集合（ビットごとに CollisionLayer の有無を表す。レイキャストなどの検索で使用）
+using CollisionLayerMask = uint32_t;
+
+/// @brief 全レイヤーを対象とするマスク
+inline constexpr CollisionLayerMask kAllCollisionLayers = 0xFFFFFFFFu;
+
+/// @brief レイヤーをマスクに変換
+/// @param layer レイヤー
+/// @return そのレイヤーのみを含むマスク（複数のレイヤーは | で結合する）
+inline constexpr CollisionLayerMask ToLayerMask(CollisionLayer layer) {
+   return 1u << static_cast<uint32_t>(layer);
+}
@@ -1,11 +1,32 @@
 #include "CollisionManager.h"
+#include "Engine/Utility/Job/JobSystem.h"
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace {
+   using Clock = std::chrono::steady_clock;
+
    // コライダーペアを一意にするためのヘルパー関数
    std::pair<Collider*, Collider*> MakePair(Collider* a, Collider* b) {
       return (a < b) ? std::make_pair(a, b) : std::make_pair(b, a);
    }
+
+   /// @brief 計測開始時刻からの経過時間（ミリ秒）
+   float ElapsedMilliseconds(Clock::time_point start) {
+      return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+   }
+
+   // 一括レイキャストで1ジョブが処理するレイの数
+   constexpr uint32_t kRaycastGrainSize = 32;
+
+   /// @brief レイの方向を正規化（長さ0の場合はfalse）
+   bool NormalizeDirection(const Vector3& direction, Vector3& outDirection) {
+      const float length = std::sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
+      if (length <= 0.0f) return false;
+      outDirection = direction * (1.0f / length);
+      return true;
+   }
 }
 
 CollisionManager::CollisionManager(CollisionConfig* config)
@@ -17,49 +38,224 @@ void CollisionManager::RegisterCollider(Collider* collider) {
 }
 
 void CollisionManager::CheckAllCollisions() {
-   std::unordered_set<std::pair<Collider*, Collider*>, ColliderPairHash> currentCollisions;
-
-   // すべてのコライダーペアをチェック
-   for (size_t i = 0; i < colliders_.size(); ++i) {
-      for (size_t j = i + 1; j < colliders_.size(); ++j) {
-         Collider* a = colliders_[i];
-         Collider* b = colliders_[j];
-
-         // コライダーが無効化されている場合はスキップ
-         if (!a->IsEnabled() || !b->IsEnabled()) continue;
-
-         // コリジョンマトリクスで判定が無効なら処理しない
-         if (!config_->IsCollisionEnabled(a->GetLayer(), b->GetLayer())) continue;
-
-         auto pair = MakePair(a, b);
-         bool isColliding = a->CheckCollision(b);
-
-         if (isColliding) {
-            currentCollisions.insert(pair);
-
-            // 前フレームで衝突していなかった場合、Enter
-            if (previousCollisions_.find(pair) == previousCollisions_.end()) {
-               a->OnCollisionEnter(b);
-               b->OnCollisionEnter(a);
-            } else {
-               // 前フレームも衝突していた場合、Stay
-               a->OnCollisionStay(b);
-               b->OnCollisionStay(a);
-            }
+   auto start = Clock::now();
+
+   // ブロードフェーズ: 有効なコライダーの境界ボックスから候補ペアを作成
+   BuildProxies();
+   broadPhase_.FindPairs(proxies_, candidatePairs_);
+   // DynamicTree では FindPairs が木を更新済み
+   queryTreeDirty_ = (broadPhase_.GetType() != BroadPhaseType::DynamicTree);
+
+   statistics_.colliderCount = static_cast<uint32_t>(proxies_.size());
+   statistics_.candidatePairCount = static_cast<uint32_t>(candidatePairs_.size());
+   statistics_.broadPhaseMilliseconds = ElapsedMilliseconds(start);
+   start = Clock::now();
+
+   // ナローフェーズ: 候補ペア（登録順）のみ形状で判定
+   ColliderPairSet currentCollisions;
+   uint32_t narrowPhaseTestCount = 0;
+   for (const auto& [indexA, indexB] : candidatePairs_) {
+      Collider* a = colliders_[indexA];
+      Collider* b = colliders_[indexB];
+
+      // コリジョンマトリクスで判定が無効なら処理しない
+      if (!config_->IsCollisionEnabled(a->GetLayer(), b->GetLayer())) continue;
+
+      ++narrowPhaseTestCount;
+      auto pair = MakePair(a, b);
+      bool isColliding = a->CheckCollision(b);
+
+      // 判定済みのペアは前フレームの記録から外し、残りを後でExitとして扱う
+      bool wasColliding = previousCollisions_.erase(pair) > 0;
+
+      if (isColliding) {
+         currentCollisions.insert(pair);
+
+         // 前フレームで衝突していなかった場合、Enter
+         if (!wasColliding) {
+            a->OnCollisionEnter(b);
+            b->OnCollisionEnter(a);
          } else {
-            // 前フレームで衝突していたが今フレームは離れた場合、Exit
-            if (previousCollisions_.find(pair) != previousCollisions_.end()) {
-               a->OnCollisionExit(b);
-               b->OnCollisionExit(a);
-            }
+            // 前フレームも衝突していた場合、Stay
+            a->OnCollisionStay(b);
+            b->OnCollisionStay(a);
          }
+      } else if (wasColliding) {
+         // 前フレームで衝突していたが今フレームは離れた場合、Exit
+         a->OnCollisionExit(b);
+         b->OnCollisionExit(a);
       }
    }
 
+   // 境界ボックスが離れて候補から外れたペアもExit
+   // （無効化されたコライダーやレイヤー設定で除外されたペアは、従来どおりExitを呼ばずに破棄する）
+   for (const auto& [a, b] : previousCollisions_) {
+      if (!a->IsEnabled() || !b->IsEnabled()) continue;
+      if (!config_->IsCollisionEnabled(a->GetLayer(), b->GetLayer())) continue;
+
+      a->OnCollisionExit(b);
+      b->OnCollisionExit(a);
+   }
+
    previousCollisions_ = std::move(currentCollisions);
+
+   statistics_.narrowPhaseTestCount = narrowPhaseTestCount;
+   statistics_.collidingPairCount = static_cast<uint32_t>(previousCollisions_.size());
+   statistics_.narrowPhaseMilliseconds = ElapsedMilliseconds(start);
+}
+
+void CollisionManager::BuildProxies() {
+   proxies_.clear();
+   for (uint32_t i = 0; i < colliders_.size(); ++i) {
+      // コライダーが無効化されている場合はスキップ
+      if (!colliders_[i]->IsEnabled()) continue;
+      proxies_.push_back({ colliders_[i]->GetBounds(), i });
+   }
+}
+
+void CollisionManager::PrepareQueries() {
+   if (!queryTreeDirty_) return;
+
+   broadPhase_.UpdateTree(proxies_);
+   queryTreeDirty_ = false;
+}
+
+void CollisionManager::SyncQueryBounds() {
+   BuildProxies();
+   broadPhase_.UpdateTree(proxies_);
+   queryTreeDirty_ = false;
+}
+
+bool CollisionManager::RaycastClosest(const Vector3& origin, const Vector3& direction, float maxDistance, CollisionLayerMask layerMask, RaycastHit& outHit) const {
+   outHit = RaycastHit{};
+
+   const DynamicAABBTree& tree = broadPhase_.GetDynamicTree();
+   tree.RayCast(origin, direction, maxDistance, [&](int32_t proxyId, float currentMaxDistance) {
+      Collider* collider = colliders_[tree.GetUserData(proxyId)];
+      if (!IsQueryTarget(collider, layerMask)) return currentMaxDistance;
+
+      float distance;
+      if (!collider->IntersectRay(origin, direction, currentMaxDistance, distance)) return currentMaxDistance;
+
+      // 以降はより近いものだけを探す
+      outHit.collider = collider;
+      outHit.distance = distance;
+      return distance;
+   });
+
+   if (!outHit.collider) return false;
+
+   outHit.point = origin + direction * outHit.distance;
+   return true;
+}
+
+bool CollisionManager::Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit, CollisionLayerMask layerMask) {
+   outHit = RaycastHit{};
+
+   Vector3 normalizedDirection;
+   if (!NormalizeDirection(direction, normalizedDirection)) return false;
+
+   PrepareQueries();
+   return RaycastClosest(origin, normalizedDirection, maxDistance, layerMask, outHit);
+}
+
+void CollisionManager::RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, CollisionLayerMask layerMask) {
+   outHits.clear();
+
+   Vector3 normalizedDirection;
+   if (!NormalizeDirection(direction, normalizedDirection)) return;
+
+   PrepareQueries();
+   const DynamicAABBTree& tree = broadPhase_.GetDynamicTree();
+   tree.RayCast(origin, normalizedDirection, maxDistance, [&](int32_t proxyId, float currentMaxDistance) {
+      Collider* collider = colliders_[tree.GetUserData(proxyId)];
+      float distance;
+      if (IsQueryTarget(collider, layerMask) && collider->IntersectRay(origin, normalizedDirection, currentMaxDistance, distance)) {
+         outHits.push_back({ collider, origin + normalizedDirection * distance, distance });
+      }
+      return currentMaxDistance;
+   });
+
+   std::sort(outHits.begin(), outHits.end(), [](const RaycastHit& a, const RaycastHit& b) {
+      return a.distance < b.distance;
+   });
+}
+
+void CollisionManager::SphereOverlap(const Vector3& center, float radius, std::vector<Collider*>& outColliders, CollisionLayerMask layerMask) {
+   outColliders.clear();
+   PrepareQueries();
+
+   const Vector3 extent = { radius, radius, radius };
+   const BoundingBox bounds(center - extent, center + extent);
+   const DynamicAABBTree& tree = broadPhase_.GetDynamicTree();
+   std::vector<uint32_t> indices;
+   tree.Query(bounds, [&](int32_t proxyId) {
+      const uint32_t index = tree.GetUserData(proxyId);
+      Collider* collider = colliders_[index];
+      if (IsQueryTarget(collider, layerMask) && collider->OverlapsSphere(center, radius)) {
+         indices.push_back(index);
+      }
+      return true;
+   });
+
+   // 木の構造によらず登録順で返す
+   std::sort(indices.begin(), indices.end());
+   for (uint32_t index : indices) {
+      outColliders.push_back(colliders_[index]);
+   }
+}
+
+void CollisionManager::BoxOverlap(const BoundingBox& box, std::vector<Collider*>& outColliders, CollisionLayerMask layerMask) {
+   outColliders.clear();
+   PrepareQueries();
+
+   const DynamicAABBTree& tree = broadPhase_.GetDynamicTree();
+   std::vector<uint32_t> indices;
+   tree.Query(box, [&](int32_t proxyId) {
+      const uint32_t index = tree.GetUserData(proxyId);
+      Collider* collider = colliders_[index];
+      if (IsQueryTarget(collider, layerMask) && collider->OverlapsBox(box)) {
+         indices.push_back(index);
+      }
+      return true;
+   });
+
+   // 木の構造によらず登録順で返す
+   std::sort(indices.begin(), indices.end());
+   for (uint32_t index : indices) {
+      outColliders.push_back(colliders_[index]);
+   }
+}
+
+void CollisionManager::RaycastBatch(const std::vector<RaycastQuery>& queries, std::vector<RaycastHit>& outHits, JobSystem* jobSystem) {
+   outHits.assign(queries.size(), RaycastHit{});
+   if (queries.empty()) return;
+
+   // 木の更新は並列実行の前に1回だけ行い、以降は読み取りのみ
+   PrepareQueries();
+
+   auto raycastRange = [&](uint32_t begin, uint32_t end) {
+      for (uint32_t i = begin; i < end; ++i) {
+         const RaycastQuery& query = queries[i];
+         Vector3 direction;
+         if (!NormalizeDirection(query.direction, direction)) continue;
+         RaycastClosest(query.origin, direction, query.maxDistance, query.layerMask, outHits[i]);
+      }
+   };
+
+   const uint32_t count = static_cast<uint32_t>(queries.size());
+   if (jobSystem && count > kRaycastGrainSize) {
+      jobSystem->ParallelFor(count, kRaycastGrainSize, raycastRange);
+   } else {
+      raycastRange(0, count);
+   }
 }
 
 void CollisionManager::Clear() {
    colliders_.clear();
    previousCollisions_.clear();
+   proxies_.clear();
+   candidatePairs_.clear();
+   broadPhase_.Reset();
+   queryTreeDirty_ = false;
 }
@@ -1,13 +1,42 @@
 #pragma once
+#include <cfloat>
 #include <vector>
 #include <unordered_set>
 #include "Collider.h"
 #include "CollisionConfig.h"
+#include "CollisionBroadPhase.h"
+
+class JobSystem;
 
 /// @brief 衝突判定を一括管理するマネージャークラス
-/// @note 登録されたすべてのコライダー間の衝突判定を行い、適切なコールバックを実行
+/// @note ブロードフェーズで境界ボックスが重なるペアに絞り込んでから、各コライダーの形状で判定し、適切なコールバックを実行
 class CollisionManager {
 public:
+   /// @brief 直近の CheckAllCollisions の統計
+   struct Statistics {
+      uint32_t colliderCount = 0;          // 有効なコライダー数
+      uint32_t candidatePairCount = 0;     // ブロードフェーズで残ったペア数
+      uint32_t narrowPhaseTestCount = 0;   // レイヤーで絞り込んだ後に形状判定したペア数
+      uint32_t collidingPairCount = 0;     // 衝突中のペア数
+      float broadPhaseMilliseconds = 0.0f;
+      float narrowPhaseMilliseconds = 0.0f;
+   };
+
+   /// @brief レイキャストの結果
+   struct RaycastHit {
+      Collider* collider = nullptr;  // 命中したコライダー（外れた場合はnullptr）
+      Vector3 point{};               // 交点（始点が内側の場合は始点）
+      float distance = 0.0f;         // 始点からの距離
+   };
+
+   /// @brief 一括レイキャストの1本分
+   struct RaycastQuery {
+      Vector3 origin{};
+      Vector3 direction{ 0.0f, 0.0f, 1.0f };             // 正規化していなくてもよい
+      float maxDistance = FLT_MAX;
+      CollisionLayerMask layerMask = kAllCollisionLayers;
+   };
+
    explicit CollisionManager(CollisionConfig* config);
    ~CollisionManager() = default;
 
@@ -25,16 +54,98 @@ public:
    /// @return コライダーのリスト
    const std::vector<Collider*>& GetAllColliders() const { return colliders_; }
 
+   /// @brief ブロードフェーズの方式を設定
+   /// @param type 方式（既定は空間ハッシュ。静止したコライダーが多いシーンでは DynamicTree が有利）
+   void SetBroadPhaseType(BroadPhaseType type) { broadPhase_.SetType(type); }
+
+   /// @brief ブロードフェーズの方式を取得
+   BroadPhaseType GetBroadPhaseType() const { return broadPhase_.GetType(); }
+
+   /// @brief ブロードフェーズを取得（セルサイズの調整用）
+   CollisionBroadPhase& GetBroadPhase() { return broadPhase_; }
+
+   /// @brief 直近の統計を取得
+   const Statistics& GetStatistics() const { return statistics_; }
+
    struct ColliderPairHash {
       size_t operator()(const std::pair<Collider*, Collider*>& p) const noexcept {
-         return reinterpret_cast<size_t>(p.first) ^ reinterpret_cast<size_t>(p.second);
+         // 2つのアドレスを混ぜる（単純なXORはアライメントにより下位ビットが偏るため）
+         size_t h1 = reinterpret_cast<size_t>(p.first);
+         size_t h2 = reinterpret_cast<size_t>(p.second);
+         return h1 ^ (h2 + 0x9e3779b97f4a7c15ull + (h1 << 6) + (h1 >> 2));
       }
    };
 
+   using ColliderPairSet = std::unordered_set<std::pair<Collider*, Collider*>, ColliderPairHash>;
+
+   /// @brief 現在衝突中のペアを取得（ペアはアドレスの小さい順）
+   const ColliderPairSet& GetCollidingPairs() const { return previousCollisions_; }
+
+   //================================================
+   // 空間検索
+   // 動的AABBツリーで候補を絞り込み、各コライダーの形状で判定する
+   // 木は直前の CheckAllCollisions 時点の位置で作られるため、その後に大きく動かした場合は SyncQueryBounds を呼ぶ
+   // 無効化されたコライダーは対象外
+   //================================================
+
+   /// @brief 最も近いコライダーへのレイキャスト
+   /// @param origin 始点
+   /// @param direction 方向（正規化していなくてもよい）
+   /// @param maxDistance 最大距離
+   /// @param outHit 結果
+   /// @param layerMask 対象とするレイヤー
+   /// @return 命中した場合true
+   bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit, CollisionLayerMask layerMask = kAllCollisionLayers);
+
+   /// @brief レイが交差するすべてのコライダーを取得
+   /// @param outHits 結果（距離の近い順。呼び出し前の内容は消去）
+   void RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, CollisionLayerMask layerMask = kAllCollisionLayers);
+
+   /// @brief 球と重なるコライダーを取得
+   /// @param outColliders 結果（登録順。呼び出し前の内容は消去）
+   void SphereOverlap(const Vector3& center, float radius, std::vector<Collider*>& outColliders, CollisionLayerMask layerMask = kAllCollisionLayers);
+
+   /// @brief AABBと重なるコライダーを取得
+   /// @param outColliders 結果（登録順。呼び出し前の内容は消去）
+   void BoxOverlap(const BoundingBox& box, std::vector<Collider*>& outColliders, CollisionLayerMask layerMask = kAllCollisionLayers);
+
+   /// @brief 複数のレイを一括でレイキャスト（最も近いコライダーのみ）
+   /// @param queries レイ
+   /// @param outHits 結果（queries と同じ順序・要素数。外れた場合は collider が nullptr）
+   /// @param jobSystem 並列実行に使用するジョブシステム（nullptrの場合は逐次実行）
+   void RaycastBatch(const std::vector<RaycastQuery>& queries, std::vector<RaycastHit>& outHits, JobSystem* jobSystem = nullptr);
+
+   /// @brief 空間検索用の木に現在のコライダー位置を反映
+   void SyncQueryBounds();
+
 private:
+   /// @brief 有効なコライダーの境界ボックスを proxies_ に集める
+   void BuildProxies();
+
+   /// @brief 直前の CheckAllCollisions 以降、検索用の木が未更新なら更新
+   void PrepareQueries();
+
+   /// @brief 1本のレイキャスト（木の更新は行わない。複数スレッドから同時に呼び出し可能）
+   bool RaycastClosest(const Vector3& origin, const Vector3& direction, float maxDistance, CollisionLayerMask layerMask, RaycastHit& outHit) const;
+
+   /// @brief 検索の対象になるか（有効かつレイヤーがマスクに含まれる）
+   bool IsQueryTarget(const Collider* collider, CollisionLayerMask layerMask) const {
+      return collider->IsEnabled() && (ToLayerMask(collider->GetLayer()) & layerMask) != 0;
+   }
+
    std::vector<Collider*> colliders_;
    CollisionConfig* config_ = nullptr;
 
    // 前フレームの衝突ペアを記録（Enter/Stay/Exitの判定用）
-   std::unordered_set<std::pair<Collider*, Collider*>, ColliderPairHash> previousCollisions_;
+   ColliderPairSet previousCollisions_;
+
+   // ブロードフェーズと作業バッファ
+   CollisionBroadPhase broadPhase_;
+   std::vector<BroadPhaseProxy> proxies_;
+   std::vector<CollisionBroadPhase::Pair> candidatePairs_;
+
+   // 検索用の木が proxies_ より古いか（DynamicTree 以外では検索時に更新する）
+   bool queryTreeDirty_ = false;
+
+   Statistics statistics_;
 };
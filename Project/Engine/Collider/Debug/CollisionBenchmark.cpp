@@ -0,0 +1,326 @@
+#include "CollisionBenchmark.h"
+#include "Engine/Collider/CollisionManager.h"
+#include "Engine/Collider/SphereCollider.h"
+#include "Engine/Collider/AABBCollider.h"
+#include "Engine/Utility/Job/JobSystem.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <memory>
+#include <random>
+
+namespace {
+   constexpr uint32_t kSeed = 12345;
+   constexpr uint32_t kColliderCounts[] = { 1000, 5000, 20000 };
+   // 総当たりの計測に使うおおよそのペア判定数（フレーム数をこの範囲に収める）
+   constexpr uint64_t kLegacyPairBudget = 20000000;
+   // 1コライダーあたりの空間の体積（密度を一定に保つ）
+   constexpr float kVolumePerCollider = 8.0f;
+   constexpr float kDeltaTime = 1.0f / 60.0f;
+   // 動くコライダーの割合（8個中2個。残りは地形や小物を想定した静止物）
+   constexpr uint32_t kMovingPeriod = 8;
+   constexpr uint32_t kMovingCount = 2;
+
+   using Clock = std::chrono::steady_clock;
+
+   /// @brief ベンチマーク用のシーン（コライダーと移動速度）
+   struct BenchmarkScene {
+      std::vector<std::unique_ptr<Collider>> colliders;
+      std::vector<Vector3> startPositions;
+      std::vector<Vector3> startVelocities;
+      std::vector<Vector3> velocities;
+      float halfExtent = 0.0f;
+
+      /// @brief 全コライダーを初期位置・初速に戻す
+      void Reset() {
+         for (size_t i = 0; i < colliders.size(); ++i) {
+            colliders[i]->SetOffset(startPositions[i]);
+         }
+         velocities = startVelocities;
+      }
+
+      /// @brief 1フレーム分移動（空間の端で反射）
+      void Step() {
+         for (size_t i = 0; i < colliders.size(); ++i) {
+            Vector3 position = colliders[i]->GetOffset() + velocities[i] * kDeltaTime;
+            float* axes[] = { &position.x, &position.y, &position.z };
+            float* speeds[] = { &velocities[i].x, &velocities[i].y, &velocities[i].z };
+            for (int axis = 0; axis < 3; ++axis) {
+               if (*axes[axis] < -halfExtent || *axes[axis] > halfExtent) {
+                  *speeds[axis] = -*speeds[axis];
+               }
+            }
+            colliders[i]->SetOffset(position);
+         }
+      }
+   };
+
+   BenchmarkScene CreateScene(uint32_t colliderCount) {
+      BenchmarkScene scene;
+      scene.halfExtent = std::cbrt(kVolumePerCollider * static_cast<float>(colliderCount)) * 0.5f;
+
+      std::mt19937 engine(kSeed);
+      std::uniform_real_distribution<float> position(-scene.halfExtent, scene.halfExtent);
+      std::uniform_real_distribution<float> speed(-2.0f, 2.0f);
+      std::uniform_real_distribution<float> size(0.25f, 1.0f);
+
+      for (uint32_t i = 0; i < colliderCount; ++i) {
+         if (i % 2 == 0) {
+            scene.colliders.push_back(std::make_unique<SphereCollider>(nullptr, size(engine)));
+         } else {
+            const float width = size(engine) * 2.0f;
+            scene.colliders.push_back(std::make_unique<AABBCollider>(nullptr, Vector3{ width, width, width }));
+         }
+         scene.startPositions.push_back({ position(engine), position(engine), position(engine) });
+         Vector3 velocity = { speed(engine), speed(engine), speed(engine) };
+         if (i % kMovingPeriod >= kMovingCount) {
+            velocity = { 0.0f, 0.0f, 0.0f };
+         }
+         scene.startVelocities.push_back(velocity);
+      }
+      scene.Reset();
+      return scene;
+   }
+
+   /// @brief フレームごとの衝突ペアの要約（順序に依存しない）
+   struct FrameSignature {
+      size_t count = 0;
+      size_t hash = 0;
+
+      bool operator==(const FrameSignature& other) const { return count == other.count && hash == other.hash; }
+   };
+
+   FrameSignature MakeSignature(const CollisionManager::ColliderPairSet& pairs) {
+      FrameSignature signature;
+      signature.count = pairs.size();
+      CollisionManager::ColliderPairHash hasher;
+      for (const auto& pair : pairs) {
+         signature.hash += hasher(pair);
+      }
+      return signature;
+   }
+
+   /// @brief 従来の総当たり判定（比較用。全ペアで仮想関数と前フレームの検索を行う）
+   void LegacyCheckAllCollisions(
+      const std::vector<std::unique_ptr<Collider>>& colliders,
+      const CollisionConfig& config,
+      CollisionManager::ColliderPairSet& previousCollisions
+   ) {
+      CollisionManager::ColliderPairSet currentCollisions;
+      for (size_t i = 0; i < colliders.size(); ++i) {
+         for (size_t j = i + 1; j < colliders.size(); ++j) {
+            Collider* a = colliders[i].get();
+            Collider* b = colliders[j].get();
+            if (!a->IsEnabled() || !b->IsEnabled()) continue;
+            if (!config.IsCollisionEnabled(a->GetLayer(), b->GetLayer())) continue;
+
+            auto pair = (a < b) ? std::make_pair(a, b) : std::make_pair(b, a);
+            if (a->CheckCollision(b)) {
+               currentCollisions.insert(pair);
+               if (previousCollisions.find(pair) == previousCollisions.end()) {
+                  a->OnCollisionEnter(b);
+                  b->OnCollisionEnter(a);
+               } else {
+                  a->OnCollisionStay(b);
+                  b->OnCollisionStay(a);
+               }
+            } else if (previousCollisions.find(pair) != previousCollisions.end()) {
+               a->OnCollisionExit(b);
+               b->OnCollisionExit(a);
+            }
+         }
+      }
+      previousCollisions = std::move(currentCollisions);
+   }
+}
+
+std::vector<CollisionBenchmark::Result> CollisionBenchmark::Run(uint32_t frameCount) {
+   std::vector<Result> results;
+   for (uint32_t colliderCount : kColliderCounts) {
+      results.push_back(Run(colliderCount, frameCount));
+   }
+   return results;
+}
+
+CollisionBenchmark::Result CollisionBenchmark::Run(uint32_t colliderCount, uint32_t frameCount) {
+   Result result;
+   result.colliderCount = colliderCount;
+   result.frameCount = frameCount;
+
+   if (colliderCount < 2 || frameCount == 0) {
+      return result;
+   }
+
+   BenchmarkScene scene = CreateScene(colliderCount);
+
+   // Defaultレイヤー同士の判定を有効化（既定の設定では無効）
+   CollisionConfig config;
+   config.SetCollisionEnabled(CollisionLayer::Default, CollisionLayer::Default, true);
+
+   // 従来の総当たり
+   const uint64_t pairCount = static_cast<uint64_t>(colliderCount) * (colliderCount - 1) / 2;
+   result.legacyFrameCount = static_cast<uint32_t>((std::min)(static_cast<uint64_t>(frameCount), (std::max)(uint64_t{ 1 }, kLegacyPairBudget / pairCount)));
+
+   std::vector<FrameSignature> legacySignatures;
+   CollisionManager::ColliderPairSet legacyPrevious;
+   double legacyTotal = 0.0;
+   scene.Reset();
+   for (uint32_t frame = 0; frame < result.legacyFrameCount; ++frame) {
+      auto start = Clock::now();
+      LegacyCheckAllCollisions(scene.colliders, config, legacyPrevious);
+      legacyTotal += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+      legacySignatures.push_back(MakeSignature(legacyPrevious));
+      scene.Step();
+   }
+   result.legacyMilliseconds = legacyTotal / result.legacyFrameCount;
+
+   // ブロードフェーズごとに同じ動きを再生して計測
+   std::vector<FrameSignature> referenceSignatures;
+   bool resultsMatch = true;
+   auto measure = [&](BroadPhaseType type) {
+      CollisionManager manager(&config);
+      manager.SetBroadPhaseType(type);
+      for (const auto& collider : scene.colliders) {
+         manager.RegisterCollider(collider.get());
+      }
+
+      std::vector<FrameSignature> signatures;
+      double total = 0.0;
+      scene.Reset();
+      for (uint32_t frame = 0; frame < frameCount; ++frame) {
+         auto start = Clock::now();
+         manager.CheckAllCollisions();
+         total += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+         signatures.push_back(MakeSignature(manager.GetCollidingPairs()));
+         scene.Step();
+      }
+
+      // 総当たりの結果（計測した範囲）と、最初に計測した方式の結果に一致するか
+      resultsMatch &= std::equal(legacySignatures.begin(), legacySignatures.end(), signatures.begin());
+      if (referenceSignatures.empty()) {
+         referenceSignatures = signatures;
+         result.candidatePairCount = manager.GetStatistics().candidatePairCount;
+         result.collidingPairCount = manager.GetStatistics().collidingPairCount;
+      } else {
+         resultsMatch &= signatures == referenceSignatures;
+      }
+      return total / frameCount;
+   };
+   result.spatialHashMilliseconds = measure(BroadPhaseType::SpatialHash);
+   result.sweepAndPruneMilliseconds = measure(BroadPhaseType::SweepAndPrune);
+   result.dynamicTreeMilliseconds = measure(BroadPhaseType::DynamicTree);
+   result.resultsMatch = resultsMatch;
+
+   Logger::GetInstance().Log(
+      std::format("CollisionBenchmark: {} colliders | all-pairs {:.3f} ms/frame ({} frames) | spatial hash {:.3f} ms/frame | sweep and prune {:.3f} ms/frame | dynamic tree {:.3f} ms/frame | {} candidates, {} colliding | {}",
+         colliderCount, result.legacyMilliseconds, result.legacyFrameCount, result.spatialHashMilliseconds,
+         result.sweepAndPruneMilliseconds, result.dynamicTreeMilliseconds, result.candidatePairCount, result.collidingPairCount,
+         result.resultsMatch ? "match" : "MISMATCH"),
+      LogLevel::INFO, LogCategory::System);
+
+   return result;
+}
+
+CollisionBenchmark::RaycastResult CollisionBenchmark::RunRaycast(uint32_t colliderCount, uint32_t rayCount, uint32_t threadCount) {
+   RaycastResult result;
+   result.colliderCount = colliderCount;
+   result.rayCount = rayCount;
+
+   if (colliderCount == 0 || rayCount == 0) {
+      return result;
+   }
+
+   BenchmarkScene scene = CreateScene(colliderCount);
+   CollisionConfig config;
+   CollisionManager manager(&config);
+   for (const auto& collider : scene.colliders) {
+      manager.RegisterCollider(collider.get());
+   }
+   manager.SetBroadPhaseType(BroadPhaseType::DynamicTree);
+   manager.CheckAllCollisions();
+
+   // 空間内のランダムな位置からランダムな方向へ、空間の一辺の長さまで飛ばす
+   std::mt19937 engine(kSeed + 1);
+   std::uniform_real_distribution<float> position(-scene.halfExtent, scene.halfExtent);
+   std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+   std::vector<CollisionManager::RaycastQuery> queries(rayCount);
+   for (auto& query : queries) {
+      query.origin = { position(engine), position(engine), position(engine) };
+      query.direction = { direction(engine), direction(engine), direction(engine) };
+      query.maxDistance = scene.halfExtent * 2.0f;
+   }
+
+   auto elapsed = [](Clock::time_point start) {
+      return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+   };
+
+   // 全コライダーを走査して最も近いものを探す
+   std::vector<float> bruteForceDistances(rayCount, -1.0f);
+   auto start = Clock::now();
+   for (uint32_t i = 0; i < rayCount; ++i) {
+      const auto& query = queries[i];
+      const float length = std::sqrt(query.direction.x * query.direction.x + query.direction.y * query.direction.y + query.direction.z * query.direction.z);
+      const Vector3 rayDirection = query.direction * (1.0f / length);
+      float closest = query.maxDistance;
+      bool hit = false;
+      for (Collider* collider : manager.GetAllColliders()) {
+         float distance;
+         if (collider->IntersectRay(query.origin, rayDirection, closest, distance)) {
+            closest = distance;
+            hit = true;
+         }
+      }
+      if (hit) bruteForceDistances[i] = closest;
+   }
+   result.bruteForceMilliseconds = elapsed(start);
+
+   // 1本ずつ
+   std::vector<float> singleDistances(rayCount, -1.0f);
+   start = Clock::now();
+   for (uint32_t i = 0; i < rayCount; ++i) {
+      CollisionManager::RaycastHit hit;
+      if (manager.Raycast(queries[i].origin, queries[i].direction, queries[i].maxDistance, hit)) {
+         singleDistances[i] = hit.distance;
+      }
+   }
+   result.singleMilliseconds = elapsed(start);
+
+   // 一括（逐次・並列）
+   std::vector<CollisionManager::RaycastHit> batchHits;
+   start = Clock::now();
+   manager.RaycastBatch(queries, batchHits);
+   result.batchMilliseconds = elapsed(start);
+
+   JobSystem jobSystem;
+   jobSystem.Initialize(threadCount);
+   result.threadCount = jobSystem.GetThreadCount();
+
+   std::vector<CollisionManager::RaycastHit> parallelHits;
+   start = Clock::now();
+   manager.RaycastBatch(queries, parallelHits, &jobSystem);
+   result.parallelBatchMilliseconds = elapsed(start);
+   jobSystem.Finalize();
+
+   // 同じ距離に複数のコライダーがある場合に備え、コライダーではなく距離で比較する
+   auto distanceOf = [](const CollisionManager::RaycastHit& hit) {
+      return hit.collider ? hit.distance : -1.0f;
+   };
+   bool resultsMatch = true;
+   for (uint32_t i = 0; i < rayCount; ++i) {
+      resultsMatch &= bruteForceDistances[i] == singleDistances[i];
+      resultsMatch &= singleDistances[i] == distanceOf(batchHits[i]);
+      resultsMatch &= singleDistances[i] == distanceOf(parallelHits[i]);
+      if (singleDistances[i] >= 0.0f) ++result.hitCount;
+   }
+   result.resultsMatch = resultsMatch;
+
+   Logger::GetInstance().Log(
+      std::format("CollisionBenchmark: {} rays vs {} colliders | brute force {:.3f} ms | Raycast {:.3f} ms | RaycastBatch {:.3f} ms | RaycastBatch x{} threads {:.3f} ms | {} hits | {}",
+         rayCount, colliderCount, result.bruteForceMilliseconds, result.singleMilliseconds, result.batchMilliseconds,
+         result.threadCount, result.parallelBatchMilliseconds, result.hitCount, result.resultsMatch ? "match" : "MISMATCH"),
+      LogLevel::INFO, LogCategory::System);
+
+   return result;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/// @brief 衝突判定のマイクロベンチマーク（GameObject・GPU不要）
+/// オーナーを持たないコライダー（オフセットをワールド座標として使用）を一定密度で配置して1/4を毎フレーム動かし、
+/// 従来の総当たり判定と各ブロードフェーズの CheckAllCollisions を比較する
+class CollisionBenchmark {
+public:
+   /// @brief 計測結果（コライダー数ごと）
+   struct Result {
+      uint32_t colliderCount = 0;              // コライダー数（球とAABBが半数ずつ）
+      uint32_t frameCount = 0;                 // 計測フレーム数（ブロードフェーズ）
+      uint32_t legacyFrameCount = 0;           // 計測フレーム数（総当たり。数が多いほど少なくする）
+      double legacyMilliseconds = 0.0;         // 1フレームあたりの時間（従来の総当たり）
+      double spatialHashMilliseconds = 0.0;    // 1フレームあたりの時間（空間ハッシュ）
+      double sweepAndPruneMilliseconds = 0.0;  // 1フレームあたりの時間（Sweep and Prune）
+      double dynamicTreeMilliseconds = 0.0;    // 1フレームあたりの時間（動的AABBツリー）
+      uint32_t candidatePairCount = 0;         // 最終フレームの候補ペア数（空間ハッシュ）
+      uint32_t collidingPairCount = 0;         // 最終フレームの衝突ペア数
+      bool resultsMatch = false;               // 全方式で毎フレームの衝突ペアが一致したか
+   };
+
+   /// @brief レイキャストの計測結果
+   struct RaycastResult {
+      uint32_t colliderCount = 0;
+      uint32_t rayCount = 0;
+      uint32_t threadCount = 0;                // 一括実行で使用したスレッド数
+      double bruteForceMilliseconds = 0.0;     // 全コライダーを走査するループ（従来の使い方）
+      double singleMilliseconds = 0.0;         // Raycast を1本ずつ呼び出し
+      double batchMilliseconds = 0.0;          // RaycastBatch（逐次）
+      double parallelBatchMilliseconds = 0.0;  // RaycastBatch（JobSystem）
+      uint32_t hitCount = 0;                   // 命中したレイの数
+      bool resultsMatch = false;               // 全方式で最も近いコライダーの距離が一致したか
+   };
+
+   /// @brief 1k / 5k / 20k コライダーでベンチマークを実行
+   /// @param frameCount 計測するフレーム数
+   /// @return コライダー数ごとの結果（ログにも出力される）
+   static std::vector<Result> Run(uint32_t frameCount = 30);
+
+   /// @brief 指定したコライダー数でベンチマークを実行
+   /// @param colliderCount コライダー数
+   /// @param frameCount 計測するフレーム数
+   /// @return 計測結果（ログにも出力される）
+   static Result Run(uint32_t colliderCount, uint32_t frameCount);
+
+   /// @brief レイキャストのベンチマークを実行（弾の多い場面を想定し、ランダムな方向のレイを一括で飛ばす）
+   /// @param colliderCount コライダー数
+   /// @param rayCount レイの数
+   /// @param threadCount 一括実行のスレッド数（0の場合はハードウェアスレッド数）
+   /// @return 計測結果（ログにも出力される）
+   static RaycastResult RunRaycast(uint32_t colliderCount = 5000, uint32_t rayCount = 1000, uint32_t threadCount = 0);
+};
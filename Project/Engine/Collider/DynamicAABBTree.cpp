@@ -0,0 +1,339 @@
+#include "DynamicAABBTree.h"
+#include <algorithm>
+#include <cassert>
+
+namespace {
+   /// @brief 2つの境界ボックスを包む境界ボックス
+   BoundingBox Combine(const BoundingBox& a, const BoundingBox& b) {
+      return BoundingBox(
+         { (std::min)(a.min.x, b.min.x), (std::min)(a.min.y, b.min.y), (std::min)(a.min.z, b.min.z) },
+         { (std::max)(a.max.x, b.max.x), (std::max)(a.max.y, b.max.y), (std::max)(a.max.z, b.max.z) });
+   }
+
+   /// @brief 表面積（挿入位置のコスト）
+   float SurfaceArea(const BoundingBox& bounds) {
+      const Vector3 size = bounds.GetSize();
+      return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+   }
+
+   /// @brief outer が inner を完全に含むか
+   bool Contains(const BoundingBox& outer, const BoundingBox& inner) {
+      return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+             inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+   }
+
+   /// @brief 各軸を同じ量だけ広げる
+   BoundingBox Expand(const BoundingBox& bounds, float amount) {
+      const Vector3 extent = { amount, amount, amount };
+      return BoundingBox(bounds.min - extent, bounds.max + extent);
+   }
+}
+
+DynamicAABBTree::DynamicAABBTree(float margin)
+   : margin_(margin) {
+}
+
+bool DynamicAABBTree::RayIntersects(const Vector3& origin, const Vector3& inverseDirection, const BoundingBox& bounds, float maxDistance, float& outDistance) {
+   float tMin = 0.0f;
+   float tMax = maxDistance;
+
+   const float origins[] = { origin.x, origin.y, origin.z };
+   const float inverses[] = { inverseDirection.x, inverseDirection.y, inverseDirection.z };
+   const float mins[] = { bounds.min.x, bounds.min.y, bounds.min.z };
+   const float maxs[] = { bounds.max.x, bounds.max.y, bounds.max.z };
+
+   for (int axis = 0; axis < 3; ++axis) {
+      if (std::isinf(inverses[axis])) {
+         // 軸に平行なレイはスラブの内側にある場合のみ交差しうる
+         if (origins[axis] < mins[axis] || origins[axis] > maxs[axis]) return false;
+         continue;
+      }
+
+      float t1 = (mins[axis] - origins[axis]) * inverses[axis];
+      float t2 = (maxs[axis] - origins[axis]) * inverses[axis];
+      if (t1 > t2) std::swap(t1, t2);
+
+      tMin = (std::max)(tMin, t1);
+      tMax = (std::min)(tMax, t2);
+      if (tMin > tMax) return false;
+   }
+
+   outDistance = tMin;
+   return true;
+}
+
+int32_t DynamicAABBTree::AllocateNode() {
+   if (freeList_ == kNullNode) {
+      nodes_.emplace_back();
+      nodes_.back().height = 0;
+      return static_cast<int32_t>(nodes_.size() - 1);
+   }
+
+   const int32_t nodeId = freeList_;
+   Node& node = nodes_[nodeId];
+   freeList_ = node.parent;
+   node = Node{};
+   node.height = 0;
+   return nodeId;
+}
+
+void DynamicAABBTree::FreeNode(int32_t nodeId) {
+   Node& node = nodes_[nodeId];
+   node.parent = freeList_;
+   node.child1 = kNullNode;
+   node.child2 = kNullNode;
+   node.height = -1;
+   freeList_ = nodeId;
+}
+
+int32_t DynamicAABBTree::CreateProxy(const BoundingBox& bounds, uint32_t userData) {
+   const int32_t proxyId = AllocateNode();
+   nodes_[proxyId].bounds = Expand(bounds, margin_);
+   nodes_[proxyId].userData = userData;
+
+   InsertLeaf(proxyId);
+   ++proxyCount_;
+   return proxyId;
+}
+
+void DynamicAABBTree::DestroyProxy(int32_t proxyId) {
+   assert(0 <= proxyId && proxyId < static_cast<int32_t>(nodes_.size()));
+   assert(nodes_[proxyId].IsLeaf());
+
+   RemoveLeaf(proxyId);
+   FreeNode(proxyId);
+   --proxyCount_;
+}
+
+bool DynamicAABBTree::MoveProxy(int32_t proxyId, const BoundingBox& bounds, const Vector3& displacement) {
+   assert(0 <= proxyId && proxyId < static_cast<int32_t>(nodes_.size()));
+   assert(nodes_[proxyId].IsLeaf());
+
+   // 余白を足し、移動方向に伸ばした太いAABB
+   BoundingBox fatBounds = Expand(bounds, margin_);
+   const Vector3 predicted = displacement * kDisplacementMultiplier;
+   (predicted.x < 0.0f ? fatBounds.min.x : fatBounds.max.x) += predicted.x;
+   (predicted.y < 0.0f ? fatBounds.min.y : fatBounds.max.y) += predicted.y;
+   (predicted.z < 0.0f ? fatBounds.min.z : fatBounds.max.z) += predicted.z;
+
+   const BoundingBox& treeBounds = nodes_[proxyId].bounds;
+   if (Contains(treeBounds, bounds)) {
+      // まだ収まっていても、速く動いた後に止まった場合などで太すぎるときは付け替える
+      const BoundingBox hugeBounds = Expand(fatBounds, margin_ * 4.0f);
+      if (Contains(hugeBounds, treeBounds)) {
+         return false;
+      }
+   }
+
+   RemoveLeaf(proxyId);
+   nodes_[proxyId].bounds = fatBounds;
+   InsertLeaf(proxyId);
+   return true;
+}
+
+void DynamicAABBTree::Clear() {
+   nodes_.clear();
+   root_ = kNullNode;
+   freeList_ = kNullNode;
+   proxyCount_ = 0;
+}
+
+void DynamicAABBTree::InsertLeaf(int32_t leaf) {
+   if (root_ == kNullNode) {
+      root_ = leaf;
+      nodes_[root_].parent = kNullNode;
+      return;
+   }
+
+   // 表面積の増加が最も小さくなる兄弟を探す
+   const BoundingBox leafBounds = nodes_[leaf].bounds;
+   int32_t index = root_;
+   while (!nodes_[index].IsLeaf()) {
+      const Node& node = nodes_[index];
+      const float area = SurfaceArea(node.bounds);
+      const float combinedArea = SurfaceArea(Combine(node.bounds, leafBounds));
+
+      // このノードと葉の親を新しく作るコスト
+      const float cost = 2.0f * combinedArea;
+      // さらに下へ降りる場合に、このノードの境界ボックスが広がる分のコスト
+      const float inheritanceCost = 2.0f * (combinedArea - area);
+
+      auto descendCost = [&](int32_t childId) {
+         const Node& child = nodes_[childId];
+         const float childCombinedArea = SurfaceArea(Combine(child.bounds, leafBounds));
+         if (child.IsLeaf()) {
+            return childCombinedArea + inheritanceCost;
+         }
+         return childCombinedArea - SurfaceArea(child.bounds) + inheritanceCost;
+      };
+      const float cost1 = descendCost(node.child1);
+      const float cost2 = descendCost(node.child2);
+
+      if (cost < cost1 && cost < cost2) break;
+      index = (cost1 < cost2) ? node.child1 : node.child2;
+   }
+
+   // 兄弟と葉をまとめる親を作成
+   const int32_t sibling = index;
+   const int32_t oldParent = nodes_[sibling].parent;
+   const int32_t newParent = AllocateNode();
+   nodes_[newParent].parent = oldParent;
+   nodes_[newParent].bounds = Combine(leafBounds, nodes_[sibling].bounds);
+   nodes_[newParent].height = nodes_[sibling].height + 1;
+   nodes_[newParent].child1 = sibling;
+   nodes_[newParent].child2 = leaf;
+   nodes_[sibling].parent = newParent;
+   nodes_[leaf].parent = newParent;
+
+   if (oldParent == kNullNode) {
+      root_ = newParent;
+   } else if (nodes_[oldParent].child1 == sibling) {
+      nodes_[oldParent].child1 = newParent;
+   } else {
+      nodes_[oldParent].child2 = newParent;
+   }
+
+   Refit(nodes_[leaf].parent);
+}
+
+void DynamicAABBTree::RemoveLeaf(int32_t leaf) {
+   if (leaf == root_) {
+      root_ = kNullNode;
+      return;
+   }
+
+   const int32_t parent = nodes_[leaf].parent;
+   const int32_t grandParent = nodes_[parent].parent;
+   const int32_t sibling = (nodes_[parent].child1 == leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+
+   // 親を取り除き、兄弟を祖父母に直接つなぐ
+   if (grandParent == kNullNode) {
+      root_ = sibling;
+      nodes_[sibling].parent = kNullNode;
+      FreeNode(parent);
+      return;
+   }
+
+   if (nodes_[grandParent].child1 == parent) {
+      nodes_[grandParent].child1 = sibling;
+   } else {
+      nodes_[grandParent].child2 = sibling;
+   }
+   nodes_[sibling].parent = grandParent;
+   FreeNode(parent);
+
+   Refit(grandParent);
+}
+
+void DynamicAABBTree::Refit(int32_t nodeId) {
+   while (nodeId != kNullNode) {
+      nodeId = Balance(nodeId);
+
+      Node& node = nodes_[nodeId];
+      const Node& child1 = nodes_[node.child1];
+      const Node& child2 = nodes_[node.child2];
+      node.height = 1 + (std::max)(child1.height, child2.height);
+      node.bounds = Combine(child1.bounds, child2.bounds);
+
+      nodeId = node.parent;
+   }
+}
+
+int32_t DynamicAABBTree::Balance(int32_t iA) {
+   Node& a = nodes_[iA];
+   if (a.IsLeaf() || a.height < 2) {
+      return iA;
+   }
+
+   const int32_t iB = a.child1;
+   const int32_t iC = a.child2;
+   Node& b = nodes_[iB];
+   Node& c = nodes_[iC];
+   const int32_t balance = c.height - b.height;
+
+   // 子の一方を持ち上げて A の位置に置き、その子のうち高い方を持ち上げた側に残す
+   auto rotateUp = [&](int32_t iUp, Node& up, const Node& stay, bool upWasChild2) {
+      const int32_t iF = up.child1;
+      const int32_t iG = up.child2;
+      Node& f = nodes_[iF];
+      Node& g = nodes_[iG];
+
+      up.child1 = iA;
+      up.parent = a.parent;
+      a.parent = iUp;
+
+      if (up.parent == kNullNode) {
+         root_ = iUp;
+      } else if (nodes_[up.parent].child1 == iA) {
+         nodes_[up.parent].child1 = iUp;
+      } else {
+         nodes_[up.parent].child2 = iUp;
+      }
+
+      // 低い方の孫を A に渡す
+      const bool keepF = f.height > g.height;
+      const int32_t iKeep = keepF ? iF : iG;
+      const int32_t iGive = keepF ? iG : iF;
+      Node& keep = nodes_[iKeep];
+      Node& give = nodes_[iGive];
+
+      up.child2 = iKeep;
+      if (upWasChild2) {
+         a.child2 = iGive;
+      } else {
+         a.child1 = iGive;
+      }
+      give.parent = iA;
+
+      a.bounds = Combine(stay.bounds, give.bounds);
+      a.height = 1 + (std::max)(stay.height, give.height);
+      up.bounds = Combine(a.bounds, keep.bounds);
+      up.height = 1 + (std::max)(a.height, keep.height);
+   };
+
+   if (balance > 1) {
+      rotateUp(iC, c, b, true);
+      return iC;
+   }
+   if (balance < -1) {
+      rotateUp(iB, b, c, false);
+      return iB;
+   }
+   return iA;
+}
+
+float DynamicAABBTree::GetAreaRatio() const {
+   if (root_ == kNullNode) return 0.0f;
+
+   const float rootArea = SurfaceArea(nodes_[root_].bounds);
+   if (rootArea <= 0.0f) return 0.0f;
+
+   float totalArea = 0.0f;
+   for (const Node& node : nodes_) {
+      if (node.height < 0) continue;
+      totalArea += SurfaceArea(node.bounds);
+   }
+   return totalArea / rootArea;
+}
+
+bool DynamicAABBTree::Validate() const {
+   if (root_ == kNullNode) return proxyCount_ == 0;
+   if (nodes_[root_].parent != kNullNode) return false;
+   return ValidateNode(root_, kNullNode);
+}
+
+bool DynamicAABBTree::ValidateNode(int32_t nodeId, int32_t parent) const {
+   const Node& node = nodes_[nodeId];
+   if (node.parent != parent) return false;
+
+   if (node.IsLeaf()) {
+      return node.height == 0 && node.child2 == kNullNode;
+   }
+
+   const Node& child1 = nodes_[node.child1];
+   const Node& child2 = nodes_[node.child2];
+   if (node.height != 1 + (std::max)(child1.height, child2.height)) return false;
+   if (!Contains(node.bounds, child1.bounds) || !Contains(node.bounds, child2.bounds)) return false;
+
+   return ValidateNode(node.child1, nodeId) && ValidateNode(node.child2, nodeId);
+}
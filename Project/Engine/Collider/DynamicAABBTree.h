@@ -0,0 +1,203 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "Engine/Math/BoundingBox.h"
+
+/// @brief 動的AABBツリー（Box2D / Bullet の dbvt と同様のバウンディングボリューム階層）
+/// 葉には余白を足した「太いAABB」を格納し、実際の境界ボックスがそこからはみ出した場合のみ付け替える
+/// 挿入・削除・付け替えは表面積ヒューリスティックとAVL回転でバランスを保つため O(log n)
+/// @note 検索（Query / RayCast）は const で内部状態を変更しないため、更新中でなければ複数スレッドから同時に呼び出せる
+class DynamicAABBTree {
+public:
+   static constexpr int32_t kNullNode = -1;
+
+   /// @brief コンストラクタ
+   /// @param margin 太いAABBの余白（この距離以内の移動では付け替えが発生しない）
+   explicit DynamicAABBTree(float margin = 0.1f);
+   ~DynamicAABBTree() = default;
+
+   /// @brief プロキシを作成
+   /// @param bounds 境界ボックス
+   /// @param userData 呼び出し側の識別子
+   /// @return プロキシID
+   int32_t CreateProxy(const BoundingBox& bounds, uint32_t userData);
+
+   /// @brief プロキシを削除
+   /// @param proxyId CreateProxy で取得したID
+   void DestroyProxy(int32_t proxyId);
+
+   /// @brief プロキシを移動
+   /// @param proxyId プロキシID
+   /// @param bounds 新しい境界ボックス
+   /// @param displacement 前回からの移動量（移動方向に太いAABBを伸ばして付け替えを減らす）
+   /// @return 太いAABBからはみ出して付け替えた場合true
+   bool MoveProxy(int32_t proxyId, const BoundingBox& bounds, const Vector3& displacement);
+
+   /// @brief 全プロキシを削除
+   void Clear();
+
+   /// @brief 呼び出し側の識別子を取得
+   uint32_t GetUserData(int32_t proxyId) const { return nodes_[proxyId].userData; }
+
+   /// @brief 太いAABBを取得
+   const BoundingBox& GetFatBounds(int32_t proxyId) const { return nodes_[proxyId].bounds; }
+
+   /// @brief プロキシ数を取得
+   uint32_t GetProxyCount() const { return proxyCount_; }
+
+   /// @brief 木の高さを取得（空の場合は0）
+   int32_t GetHeight() const { return root_ == kNullNode ? 0 : nodes_[root_].height; }
+
+   /// @brief 全ノードの表面積の合計と根の表面積の比（木の質の目安。小さいほど良い）
+   float GetAreaRatio() const;
+
+   /// @brief 木の構造が正しいか検証（親子関係・高さ・境界ボックスの包含）
+   /// @return 正しい場合true
+   bool Validate() const;
+
+   /// @brief 境界ボックスと太いAABBが重なるプロキシを列挙
+   /// @param bounds 検索範囲
+   /// @param callback bool(int32_t proxyId)。falseを返すと検索を打ち切る
+   template <typename Callback>
+   void Query(const BoundingBox& bounds, Callback&& callback) const;
+
+   /// @brief レイと太いAABBが交差するプロキシを列挙
+   /// @param origin レイの始点
+   /// @param direction レイの方向（正規化済み）
+   /// @param maxDistance 最大距離
+   /// @param callback float(int32_t proxyId, float maxDistance)。
+   ///                 新しい最大距離を返す（命中した距離を返すと以降はそれより手前だけを探す。0以下で打ち切り）
+   template <typename Callback>
+   void RayCast(const Vector3& origin, const Vector3& direction, float maxDistance, Callback&& callback) const;
+
+   /// @brief 2つの境界ボックスが重なるか（接触も含む）
+   static bool TestOverlap(const BoundingBox& a, const BoundingBox& b) {
+      return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+             a.min.y <= b.max.y && a.max.y >= b.min.y &&
+             a.min.z <= b.max.z && a.max.z >= b.min.z;
+   }
+
+   /// @brief レイと境界ボックスの交差判定（スラブ法）
+   /// @param origin レイの始点
+   /// @param inverseDirection 方向の各成分の逆数（成分が0の場合は無限大）
+   /// @param bounds 境界ボックス
+   /// @param maxDistance 最大距離
+   /// @param outDistance 入射距離（始点が内側の場合は0）
+   /// @return maxDistance 以内で交差する場合true
+   static bool RayIntersects(const Vector3& origin, const Vector3& inverseDirection, const BoundingBox& bounds, float maxDistance, float& outDistance);
+
+private:
+   /// @brief ノード（葉はプロキシ、内部ノードは子2つを包むAABB）
+   struct Node {
+      BoundingBox bounds;
+      uint32_t userData = 0;
+      int32_t parent = kNullNode;   // 未使用ノードでは空きリストの次の要素
+      int32_t child1 = kNullNode;
+      int32_t child2 = kNullNode;
+      int32_t height = -1;          // 葉は0、未使用は-1
+
+      bool IsLeaf() const { return child1 == kNullNode; }
+   };
+
+   /// @brief 走査用のスタック（浅い木ではヒープ確保しない）
+   class TraversalStack {
+   public:
+      void Push(int32_t node) {
+         if (size_ < kInlineCapacity) {
+            inline_[size_] = node;
+         } else {
+            overflow_.push_back(node);
+         }
+         ++size_;
+      }
+
+      int32_t Pop() {
+         --size_;
+         if (size_ < kInlineCapacity) return inline_[size_];
+         int32_t node = overflow_.back();
+         overflow_.pop_back();
+         return node;
+      }
+
+      bool IsEmpty() const { return size_ == 0; }
+
+   private:
+      static constexpr uint32_t kInlineCapacity = 64;
+      int32_t inline_[kInlineCapacity];
+      std::vector<int32_t> overflow_;
+      uint32_t size_ = 0;
+   };
+
+   int32_t AllocateNode();
+   void FreeNode(int32_t nodeId);
+
+   void InsertLeaf(int32_t leaf);
+   void RemoveLeaf(int32_t leaf);
+
+   /// @brief 高さの差が2以上の場合に回転して、新しく部分木の根になったノードを返す
+   int32_t Balance(int32_t nodeId);
+
+   /// @brief 葉から根まで境界ボックスと高さを更新（途中で回転）
+   void Refit(int32_t nodeId);
+
+   bool ValidateNode(int32_t nodeId, int32_t parent) const;
+
+   // 移動方向に太いAABBを伸ばす倍率
+   static constexpr float kDisplacementMultiplier = 2.0f;
+
+   std::vector<Node> nodes_;
+   int32_t root_ = kNullNode;
+   int32_t freeList_ = kNullNode;
+   uint32_t proxyCount_ = 0;
+   float margin_ = 0.1f;
+};
+
+template <typename Callback>
+void DynamicAABBTree::Query(const BoundingBox& bounds, Callback&& callback) const {
+   TraversalStack stack;
+   stack.Push(root_);
+
+   while (!stack.IsEmpty()) {
+      const int32_t nodeId = stack.Pop();
+      if (nodeId == kNullNode) continue;
+
+      const Node& node = nodes_[nodeId];
+      if (!TestOverlap(node.bounds, bounds)) continue;
+
+      if (node.IsLeaf()) {
+         if (!callback(nodeId)) return;
+      } else {
+         stack.Push(node.child1);
+         stack.Push(node.child2);
+      }
+   }
+}
+
+template <typename Callback>
+void DynamicAABBTree::RayCast(const Vector3& origin, const Vector3& direction, float maxDistance, Callback&& callback) const {
+   const Vector3 inverseDirection = {
+      1.0f / direction.x,
+      1.0f / direction.y,
+      1.0f / direction.z
+   };
+
+   TraversalStack stack;
+   stack.Push(root_);
+
+   while (!stack.IsEmpty() && maxDistance > 0.0f) {
+      const int32_t nodeId = stack.Pop();
+      if (nodeId == kNullNode) continue;
+
+      const Node& node = nodes_[nodeId];
+      float distance;
+      if (!RayIntersects(origin, inverseDirection, node.bounds, maxDistance, distance)) continue;
+
+      if (node.IsLeaf()) {
+         maxDistance = callback(nodeId, maxDistance);
+      } else {
+         stack.Push(node.child1);
+         stack.Push(node.child2);
+      }
+   }
+}
@@ -25,6 +25,37 @@ bool SphereCollider::CheckCollision(Collider* other) const {
    return false;
 }
 
+BoundingBox SphereCollider::GetBounds() const {
+   Vector3 center = GetPosition();
+   Vector3 extent = { radius_, radius_, radius_ };
+   return BoundingBox(center - extent, center + extent);
+}
+
+bool SphereCollider::IntersectRay(const Vector3& origin, const Vector3& direction, float maxDistance, float& outDistance) const {
+   const CollisionUtils::Sphere sphere = { GetPosition(), radius_ };
+
+   // 始点が球の内側にある場合は距離0で命中（RayIntersectSphere は出口を返すため）
+   if (CollisionUtils::IsColliding(origin, sphere)) {
+      outDistance = 0.0f;
+      return true;
+   }
+
+   float distance;
+   if (!CollisionUtils::RayIntersectSphere(CollisionUtils::Ray(origin, direction), sphere, distance)) return false;
+   if (distance > maxDistance) return false;
+
+   outDistance = distance;
+   return true;
+}
+
+bool SphereCollider::OverlapsSphere(const Vector3& center, float radius) const {
+   return CollisionUtils::IsColliding(CollisionUtils::Sphere{ GetPosition(), radius_ }, CollisionUtils::Sphere{ center, radius });
+}
+
+bool SphereCollider::OverlapsBox(const BoundingBox& box) const {
+   return CollisionUtils::IsColliding(CollisionUtils::Sphere{ GetPosition(), radius_ }, box);
+}
+
 void SphereCollider::SetRadius(float radius) {
    radius_ = radius;
 }
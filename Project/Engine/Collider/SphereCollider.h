@@ -7,6 +7,14 @@ public:
 
    bool CheckCollision(Collider* other) const override;
 
+   BoundingBox GetBounds() const override;
+
+   bool IntersectRay(const Vector3& origin, const Vector3& direction, float maxDistance, float& outDistance) const override;
+
+   bool OverlapsSphere(const Vector3& center, float radius) const override;
+
+   bool OverlapsBox(const BoundingBox& box) const override;
+
    void SetRadius(float radius) override;
 
    /// @brief 球の半径を取得
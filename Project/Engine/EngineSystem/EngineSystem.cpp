@@ -19,6 +19,7 @@
 #include "Engine/Graphics/Render/Particle/ParticleRenderer.h"
 #include "Engine/Graphics/Render/Particle/ModelParticleRenderer.h"
 #include "Engine/Graphics/Font/TextRenderer.h"
+#include "Engine/Particle/Core/ParticleInstanceAllocator.h"
 
 // 入力管理
 #include "Engine/Input/InputManager.h"
@@ -28,6 +29,8 @@
 
 #include "ObjectCommon/GameObject.h"
 
+#include <format>
+
 void EngineSystem::Initialize(WinApp* winApp)
 {
 
@@ -45,6 +48,9 @@ void EngineSystem::Initialize(WinApp* winApp)
 	// フレームレート制御（最初に初期化）
 	CreateFrameRateController();
 
+	// ジョブシステム（パーティクル更新などの並列処理用）
+	CreateJobSystem();
+
 	// グラフィックス関連
 	CreateGraphicsComponents();
 
@@ -94,12 +100,20 @@ void EngineSystem::Finalize()
 	imGui_->Finalize();
 #endif // _DEBUG
 
+	// 未完了の非同期読み込みを破棄（仕上げの中でキャッシュに登録されないように先に行う）
+	if (auto* asyncLoader = GetComponent<AsyncLoader>()) {
+		asyncLoader->Finalize();
+	}
+
 	// TextureManagerのキャッシュをクリア
 	TextureManager::GetInstance().Clear();
 
 	// FontManagerの終了処理
 	FontManager::GetInstance().Finalize();
 
+	// パーティクル共有インスタンシングバッファの解放
+	ParticleInstanceAllocator::GetInstance().Finalize();
+
 	componentOwners_.clear();
 
 	// COMの解放
@@ -118,6 +132,19 @@ void EngineSystem::BeginFrame()
 		renderManager->ClearQueue();
 	}
 
+	// 前フレームのアニメーション更新の統計を確定
+	Model::BeginAnimationStatisticsFrame();
+
+	// パーティクル共有インスタンシングバッファのうちGPU処理済みの領域を解放
+	if (auto* dxCommon = GetComponent<DirectXCommon>()) {
+		ParticleInstanceAllocator::GetInstance().BeginFrame(dxCommon->GetSwapChain()->GetCurrentBackBufferIndex());
+	}
+
+	// ワーカーでの読み込みが終わったテクスチャ・モデルのGPUリソースを作成（時間予算の範囲で）
+	if (auto* asyncLoader = GetComponent<AsyncLoader>()) {
+		asyncLoader->Update();
+	}
+
 	// 入力の更新
 	if (auto* inputManager = GetComponent<InputManager>()) {
 		inputManager->Update();
@@ -226,6 +253,27 @@ void EngineSystem::CreateFrameRateController()
 	RegisterComponent(std::move(frameRate));
 }
 
+void EngineSystem::CreateJobSystem()
+{
+	// ジョブシステムを作成・初期化（ハードウェアスレッド数分のスレッドを使用）
+	auto jobSystem = std::make_unique<JobSystem>();
+	jobSystem->Initialize();
+
+	Logger::GetInstance().Log(
+		std::format("JobSystem initialized: {} threads", jobSystem->GetThreadCount()),
+		LogLevel::INFO, LogCategory::System);
+
+	JobSystem* jobSystemPtr = jobSystem.get();
+
+	// ComponentManagerに登録（所有権を移譲）
+	RegisterComponent(std::move(jobSystem));
+
+	// 非同期読み込みの管理クラスを作成・初期化（ワーカー側の処理はジョブシステムで実行する）
+	auto asyncLoader = std::make_unique<AsyncLoader>();
+	asyncLoader->Initialize(jobSystemPtr);
+	RegisterComponent(std::move(asyncLoader));
+}
+
 void EngineSystem::CreateGraphicsComponents()
 {
 	// DirectXCommonの作成と初期化
@@ -234,12 +282,16 @@ void EngineSystem::CreateGraphicsComponents()
 	DirectXCommon* dxPtr = directXCommon.get();
  RegisterComponent(std::move(directXCommon));
 
-	// TextureManagerの初期化（シングルトン）
-	TextureManager::GetInstance().Initialize(dxPtr);
+	// TextureManagerの初期化（シングルトン。焼き込みはジョブシステムで行う）
+	AsyncLoader* asyncLoaderPtr = GetComponent<AsyncLoader>();
+	TextureManager::GetInstance().Initialize(dxPtr, asyncLoaderPtr, GetComponent<JobSystem>());
 
 	// FontManagerの初期化（シングルトン）
 	FontManager::GetInstance().Initialize(dxPtr);
 
+	// パーティクル共有インスタンシングバッファの初期化（シングルトン）
+	ParticleInstanceAllocator::GetInstance().Initialize(dxPtr);
+
 	// ResourceFactoryの作成（コンストラクタで初期化済み）
 	auto resourceFactory = std::make_unique<ResourceFactory>();
 	ResourceFactory* resourcePtr = resourceFactory.get();
@@ -307,7 +359,7 @@ void EngineSystem::CreateGraphicsComponents()
 
 	// ModelManagerの作成と初期化
 	auto modelManager = std::make_unique<ModelManager>();
-	modelManager->Initialize(dxPtr, resourcePtr);
+	modelManager->Initialize(dxPtr, resourcePtr, asyncLoaderPtr);
 	RegisterComponent(std::move(modelManager));
 }
 
@@ -28,6 +28,7 @@ class ConsoleUI; // 前方宣言（デバッグビルドのみ）
 #include "Graphics/Render/RenderManager.h"
 #include "Graphics/Light/LightManager.h"
 #include "Graphics/TextureManager.h"
+#include "Graphics/Resource/AsyncLoader.h"
 #include "Particle/ParticleSystem.h"
 
 // 入力関連
@@ -47,6 +48,7 @@ class ConsoleUI; // 前方宣言（デバッグビルドのみ）
 
 // ユーティリティ
 #include "Utility/Collision/CollisionUtils.h"
+#include "Utility/Job/JobSystem.h"
 
 
 /// @brief エンジンシステム中核システム管理クラス
@@ -86,7 +88,7 @@ public:
 	/// 
 	/// - Input 系: Keyboard / Mouse / Gamepad
 	/// 
-	/// - Audio / Light / FrameRate など
+	/// - Audio / Light / FrameRate / JobSystem など
 	/// 
 	/// @return コンポーネントへのポインタ（登録されていない場合nullptr）
 	template<typename T>
@@ -148,6 +150,7 @@ private:
 	void CreateAudioComponents();
 	void CreateLightComponents();
 	void CreateFrameRateController();
+	void CreateJobSystem();
 
 	// ──────────────────────────────────────────────────────────
 	// コアメンバ変数
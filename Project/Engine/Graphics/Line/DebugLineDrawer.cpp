@@ -128,66 +128,45 @@ void DebugLineDrawer::DrawGrid(LineRendererPipeline* pipeline, const ICamera* ca
 std::vector<Line> DebugLineDrawer::GenerateSphereLines(const Vector3& center, float radius,
     const Vector3& color, float alpha, int segments) {
     std::vector<Line> lines;
+    if (segments <= 0) {
+        return lines;
+    }
 
-    // 緯度線を描画（複数の水平円）
+    // 単位球上の格子点（緯度 segments + 1 本 × 経度 segments 本）を一度だけ計算し、
+    // 中心と半径の変換をまとめて適用する
+    const int longitudeCount = segments;
+    std::vector<Vector3> points(static_cast<size_t>(segments + 1) * longitudeCount);
     for (int lat = 0; lat <= segments; ++lat) {
         float theta = (static_cast<float>(lat) / segments) * std::numbers::pi_v<float>;
         float sinTheta = std::sin(theta);
         float cosTheta = std::cos(theta);
 
-        for (int lon = 0; lon < segments; ++lon) {
-            float phi1 = (static_cast<float>(lon) / segments) * 2.0f * std::numbers::pi_v<float>;
-            float phi2 = (static_cast<float>(lon + 1) / segments) * 2.0f * std::numbers::pi_v<float>;
+        for (int lon = 0; lon < longitudeCount; ++lon) {
+            float phi = (static_cast<float>(lon) / segments) * 2.0f * std::numbers::pi_v<float>;
+            points[lat * longitudeCount + lon] = { sinTheta * std::cos(phi), cosTheta, sinTheta * std::sin(phi) };
+        }
+    }
 
-            float sinPhi1 = std::sin(phi1);
-            float cosPhi1 = std::cos(phi1);
-            float sinPhi2 = std::sin(phi2);
-            float cosPhi2 = std::cos(phi2);
+    const Matrix4x4 sphereMatrix = Matrix::MakeAffine({ radius, radius, radius }, Vector3{ 0.0f, 0.0f, 0.0f }, center);
+    Batch::TransformCoords(points, sphereMatrix, points);
 
-            Vector3 p1 = {
-                center.x + radius * sinTheta * cosPhi1,
-                center.y + radius * cosTheta,
-                center.z + radius * sinTheta * sinPhi1
-            };
+    const auto point = [&](int lat, int lon) -> const Vector3& {
+        return points[lat * longitudeCount + lon % longitudeCount];
+    };
 
-            Vector3 p2 = {
-                center.x + radius * sinTheta * cosPhi2,
-                center.y + radius * cosTheta,
-                center.z + radius * sinTheta * sinPhi2
-            };
+    lines.reserve(static_cast<size_t>(segments + 1) * longitudeCount + static_cast<size_t>(longitudeCount) * segments);
 
-            lines.push_back({ p1, p2, color, alpha });
+    // 緯度線を描画（複数の水平円）
+    for (int lat = 0; lat <= segments; ++lat) {
+        for (int lon = 0; lon < longitudeCount; ++lon) {
+            lines.push_back({ point(lat, lon), point(lat, lon + 1), color, alpha });
         }
     }
 
     // 経度線を描画（縦の線）
-    for (int lon = 0; lon < segments; ++lon) {
-        float phi = (static_cast<float>(lon) / segments) * 2.0f * std::numbers::pi_v<float>;
-        float sinPhi = std::sin(phi);
-        float cosPhi = std::cos(phi);
-
+    for (int lon = 0; lon < longitudeCount; ++lon) {
         for (int lat = 0; lat < segments; ++lat) {
-            float theta1 = (static_cast<float>(lat) / segments) * std::numbers::pi_v<float>;
-            float theta2 = (static_cast<float>(lat + 1) / segments) * std::numbers::pi_v<float>;
-
-            float sinTheta1 = std::sin(theta1);
-            float cosTheta1 = std::cos(theta1);
-            float sinTheta2 = std::sin(theta2);
-            float cosTheta2 = std::cos(theta2);
-
-            Vector3 p1 = {
-                center.x + radius * sinTheta1 * cosPhi,
-                center.y + radius * cosTheta1,
-                center.z + radius * sinTheta1 * sinPhi
-            };
-
-            Vector3 p2 = {
-                center.x + radius * sinTheta2 * cosPhi,
-                center.y + radius * cosTheta2,
-                center.z + radius * sinTheta2 * sinPhi
-            };
-
-            lines.push_back({ p1, p2, color, alpha });
+            lines.push_back({ point(lat, lon), point(lat + 1, lon), color, alpha });
         }
     }
 
@@ -234,6 +213,9 @@ std::vector<Line> DebugLineDrawer::GenerateBoxLines(const Vector3& center, const
 std::vector<Line> DebugLineDrawer::GenerateCircleLines(const Vector3& center, float radius,
     const Vector3& normal, const Vector3& color, float alpha, int segments) {
     std::vector<Line> lines;
+    if (segments <= 0) {
+        return lines;
+    }
 
     Vector3 up = { 0.0f, 1.0f, 0.0f };
     Vector3 right;
@@ -246,23 +228,24 @@ std::vector<Line> DebugLineDrawer::GenerateCircleLines(const Vector3& center, fl
 
     up = Vector::Normalize(Vector::Cross(normal, right));
 
+    // XY平面上の単位円を、right / up を軸とする平面へまとめて変換する
+    std::vector<Vector3> points(segments);
     for (int i = 0; i < segments; ++i) {
-        float angle1 = (static_cast<float>(i) / segments) * 2.0f * std::numbers::pi_v<float>;
-        float angle2 = (static_cast<float>(i + 1) / segments) * 2.0f * std::numbers::pi_v<float>;
-
-        Vector3 p1 = {
-            center.x + radius * (std::cos(angle1) * right.x + std::sin(angle1) * up.x),
-            center.y + radius * (std::cos(angle1) * right.y + std::sin(angle1) * up.y),
-            center.z + radius * (std::cos(angle1) * right.z + std::sin(angle1) * up.z)
-        };
+        float angle = (static_cast<float>(i) / segments) * 2.0f * std::numbers::pi_v<float>;
+        points[i] = { std::cos(angle), std::sin(angle), 0.0f };
+    }
 
-        Vector3 p2 = {
-            center.x + radius * (std::cos(angle2) * right.x + std::sin(angle2) * up.x),
-            center.y + radius * (std::cos(angle2) * right.y + std::sin(angle2) * up.y),
-            center.z + radius * (std::cos(angle2) * right.z + std::sin(angle2) * up.z)
-        };
+    const Matrix4x4 circleMatrix = {
+        right.x * radius, right.y * radius, right.z * radius, 0.0f,
+        up.x * radius, up.y * radius, up.z * radius, 0.0f,
+        normal.x, normal.y, normal.z, 0.0f,
+        center.x, center.y, center.z, 1.0f
+    };
+    Batch::TransformCoords(points, circleMatrix, points);
 
-        lines.push_back({ p1, p2, color, alpha });
+    lines.reserve(segments);
+    for (int i = 0; i < segments; ++i) {
+        lines.push_back({ points[i], points[(i + 1) % segments], color, alpha });
     }
 
     return lines;
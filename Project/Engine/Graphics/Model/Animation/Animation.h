@@ -1,6 +1,8 @@
 #pragma once
 #include "NodeAnimation.h"
+#include "CompressedAnimation.h"
 #include <map>
+#include <memory>
 #include <string>
 
 /// @brief アニメーション全体を表現する構造体
@@ -10,4 +12,7 @@ struct Animation {
     
     // NodeAnimationの集合。Node名でひけるようにしておく
     std::map<std::string, NodeAnimation> nodeAnimations;
+
+    // 圧縮されたデータ（AnimationCompressor で作成。設定されている場合は再生にこちらを使い、nodeAnimations は空でよい）
+    std::shared_ptr<const CompressedAnimation> compressed;
 };
@@ -0,0 +1,41 @@
+#include "AnimationBinding.h"
+
+namespace {
+    /// @brief ジョイントのIndex順に名前でチャンネルを検索（std::mapの要素はアドレスが変わらないので指しておける）
+    /// 子を持つジョイントを先に、末端のジョイントを後にまとめる
+    template<typename Channel>
+    void BindChannels(const Skeleton& skeleton, const std::map<std::string, Channel>& nodeAnimations,
+        AnimationBinding& binding, std::vector<const Channel*>& channels) {
+        binding.jointIndices.reserve(nodeAnimations.size());
+        channels.reserve(nodeAnimations.size());
+
+        const SkeletonHierarchy& hierarchy = *skeleton.hierarchy;
+
+        for (bool leaf : { false, true }) {
+            if (leaf) {
+                binding.leafChannelBegin = channels.size();
+            }
+            for (size_t joint = 0; joint < skeleton.GetJointCount(); ++joint) {
+                if (hierarchy.children[joint].empty() != leaf) {
+                    continue;
+                }
+                auto it = nodeAnimations.find(hierarchy.names[joint]);
+                if (it == nodeAnimations.end()) {
+                    continue;
+                }
+                binding.jointIndices.push_back(static_cast<int32_t>(joint));
+                channels.push_back(&it->second);
+            }
+        }
+    }
+}
+
+AnimationBinding AnimationBinding::Create(const Skeleton& skeleton, const Animation& animation) {
+    AnimationBinding binding;
+    if (animation.compressed) {
+        BindChannels(skeleton, animation.compressed->nodeAnimations, binding, binding.compressedChannels);
+    } else {
+        BindChannels(skeleton, animation.nodeAnimations, binding, binding.channels);
+    }
+    return binding;
+}
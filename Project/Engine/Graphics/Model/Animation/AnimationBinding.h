@@ -0,0 +1,20 @@
+#pragma once
+#include "Animation.h"
+#include "Engine/Graphics/Model/Skeleton/Skeleton.h"
+#include <cstdint>
+#include <vector>
+
+/// @brief アニメーションのチャンネル（NodeAnimation）とスケルトンのジョイントの対応付け
+/// 生成時に1度だけ名前で対応付け、毎フレームの評価ではジョイントのIndexだけを使う（文字列の比較・メモリ確保なし）
+struct AnimationBinding {
+    std::vector<int32_t> jointIndices;          // チャンネルを適用するジョイントのIndex（子を持つジョイント、末端のジョイントの順にそれぞれ昇順）
+    std::vector<const NodeAnimation*> channels; // jointIndices と同じ順のチャンネル（Animation内のデータを指す）
+    std::vector<const CompressedNodeAnimation*> compressedChannels; // 圧縮されたアニメーションの場合はこちら（channels は空）
+    size_t leafChannelBegin = 0;                // 末端のジョイント（子を持たない）のチャンネルの開始位置（LODで省略する場合に使う）
+
+    /// @brief スケルトンとアニメーションを対応付ける
+    /// @param skeleton スケルトン
+    /// @param animation アニメーション（対応付けより長く生存している必要がある）
+    /// @return 対応付けの結果（アニメーションを持たないジョイントは含まれない）
+    static AnimationBinding Create(const Skeleton& skeleton, const Animation& animation);
+};
@@ -1,8 +1,6 @@
 #include "AnimationBlender.h"
 #include "Engine/Graphics/Model/Skeleton/SkeletonAnimator.h"
-#include "Engine/Math/MathCore.h"
-#include "Engine/Utility/Collision/CollisionUtils.h"
-#include <algorithm>
+#include "PoseBlender.h"
 
 AnimationBlender::AnimationBlender(std::unique_ptr<IAnimationController> currentController)
     : currentController_(std::move(currentController)) {
@@ -12,34 +10,35 @@ AnimationBlender::AnimationBlender(std::unique_ptr<IAnimationController> current
 void AnimationBlender::Update(float deltaTime) {
     if (!currentController_) return;
 
-    // 現在のアニメーションを更新
-    currentController_->Update(deltaTime);
-
-    // ブレンド中の処理
-    if (blendTimer_.IsActive() && targetController_) {
-        // タイマーを更新
-        blendTimer_.Update(deltaTime);
+    // ブレンド中でなければ現在のアニメーションを更新するだけ
+    if (!blendTimer_.IsActive() || !targetController_) {
+        currentController_->Update(deltaTime);
+        return;
+    }
 
-        // ターゲットアニメーションも更新
-        targetController_->Update(deltaTime);
+    // タイマーを更新
+    blendTimer_.Update(deltaTime);
 
-        // ブレンドの重み計算（0.0～1.0）
-        float blendWeight = blendTimer_.GetProgress();
+    // ブレンドの重み計算（0.0～1.0）
+    float blendWeight = blendTimer_.GetProgress();
 
-        // スケルトンのブレンド
-        auto* currentSkeletonAnimator = dynamic_cast<SkeletonAnimator*>(currentController_.get());
-        auto* targetSkeletonAnimator = dynamic_cast<SkeletonAnimator*>(targetController_.get());
+    auto* currentSkeletonAnimator = dynamic_cast<SkeletonAnimator*>(currentController_.get());
+    auto* targetSkeletonAnimator = dynamic_cast<SkeletonAnimator*>(targetController_.get());
 
-        if (currentSkeletonAnimator && targetSkeletonAnimator) {
-            const Skeleton& skeleton1 = currentSkeletonAnimator->GetSkeleton();
-            const Skeleton& skeleton2 = targetSkeletonAnimator->GetSkeleton();
-            blendedSkeleton_ = BlendSkeletons(skeleton1, skeleton2, blendWeight);
-        }
+    if (currentSkeletonAnimator && targetSkeletonAnimator && blendedSkeleton_) {
+        // 両方のポーズだけを更新し（それぞれのスケルトンの行列は計算しない）、ブレンド結果から行列を計算
+        currentSkeletonAnimator->UpdatePose(deltaTime);
+        targetSkeletonAnimator->UpdatePose(deltaTime);
+        PoseBlender::Blend(currentSkeletonAnimator->GetPose(), targetSkeletonAnimator->GetPose(), blendWeight, blendedPose_);
+        blendedPose_.ApplyTo(*blendedSkeleton_);
+    } else {
+        currentController_->Update(deltaTime);
+        targetController_->Update(deltaTime);
+    }
 
-        // ブレンド完了チェック
-        if (blendTimer_.IsFinished()) {
-            OnBlendComplete();
-        }
+    // ブレンド完了チェック
+    if (blendTimer_.IsFinished()) {
+        OnBlendComplete();
     }
 }
 
@@ -67,10 +66,39 @@ bool AnimationBlender::IsFinished() const {
     return true;
 }
 
+void AnimationBlender::SetSkipLeafJoints(bool skip) {
+    skipLeafJoints_ = skip;
+    if (currentController_) {
+        currentController_->SetSkipLeafJoints(skip);
+    }
+    if (targetController_) {
+        targetController_->SetSkipLeafJoints(skip);
+    }
+}
+
 void AnimationBlender::StartBlend(std::unique_ptr<IAnimationController> targetController, float blendDuration) {
     if (!targetController) return;
 
     targetController_ = std::move(targetController);
+    targetController_->SetSkipLeafJoints(skipLeafJoints_);
+
+    // ブレンド用のスケルトンとポーズを用意（スケルトンは最初の1回だけコピーし、以降は再利用する）
+    // 両方が SkeletonAnimator でなければブレンドしない（従来どおり）
+    auto* currentSkeletonAnimator = dynamic_cast<SkeletonAnimator*>(currentController_.get());
+    auto* targetSkeletonAnimator = dynamic_cast<SkeletonAnimator*>(targetController_.get());
+    if (currentSkeletonAnimator && targetSkeletonAnimator) {
+        // ブレンド中に呼ばれた場合は直前のブレンド結果をそのまま使う（ブレンド中は現在のスケルトンの行列を更新していない）
+        if (!blendTimer_.IsActive() || !blendedSkeleton_) {
+            const Skeleton& skeleton = currentSkeletonAnimator->GetSkeleton();
+            if (!blendedSkeleton_ || blendedSkeleton_->GetJointCount() != skeleton.GetJointCount()) {
+                blendedSkeleton_ = skeleton;
+            }
+            blendedPose_.Reset(skeleton);
+            blendedPose_.ApplyTo(*blendedSkeleton_);
+        }
+    } else {
+        blendedSkeleton_.reset();
+    }
     
     // ブレンドタイマーを開始
     blendTimer_.Start(blendDuration, false);
@@ -80,7 +108,11 @@ void AnimationBlender::OnBlendComplete() {
     // ターゲットアニメーションに完全に切り替え
     currentController_ = std::move(targetController_);
     targetController_.reset();
-    blendedSkeleton_.reset();
+
+    // ブレンド中はポーズだけを更新していたので、切り替え先のスケルトンの行列を計算しておく
+    if (auto* skeletonAnimator = dynamic_cast<SkeletonAnimator*>(currentController_.get())) {
+        skeletonAnimator->ApplyPoseToSkeleton();
+    }
 }
 
 Skeleton& AnimationBlender::GetSkeleton() {
@@ -116,53 +148,3 @@ const Skeleton& AnimationBlender::GetSkeleton() const {
     static Skeleton emptySkeleton;
     return emptySkeleton;
 }
-
-Skeleton AnimationBlender::BlendSkeletons(const Skeleton& skeleton1, const Skeleton& skeleton2, float weight) {
-    Skeleton result = skeleton1;
-
-    // 各ジョイントをブレンド
-    for (size_t i = 0; i < result.joints.size() && i < skeleton2.joints.size(); ++i) {
-        Joint& joint = result.joints[i];
-        const Joint& joint2 = skeleton2.joints[i];
-
-        // 平行移動の線形補間
-        joint.transform.translate = CollisionUtils::Lerp(
-            joint.transform.translate,
-            joint2.transform.translate,
-            weight
-        );
-
-        // 回転のSlerp（球面線形補間）
-        joint.transform.rotate = MathCore::QuaternionMath::Slerp(
-            joint.transform.rotate,
-            joint2.transform.rotate,
-            weight
-        );
-
-        // スケールの線形補間
-        joint.transform.scale = CollisionUtils::Lerp(
-            joint.transform.scale,
-            joint2.transform.scale,
-            weight
-        );
-
-        // TransformからlocalMatrixを更新
-        joint.localMatrix = MathCore::Matrix::MakeAffine(
-            joint.transform.scale,
-            joint.transform.rotate,
-            joint.transform.translate
-        );
-
-        // 親がいれば親の行列を掛ける
-        if (joint.parent) {
-            joint.skeletonSpaceMatrix = MathCore::Matrix::Multiply(
-                joint.localMatrix,
-                result.joints[*joint.parent].skeletonSpaceMatrix
-            );
-        } else {
-            joint.skeletonSpaceMatrix = joint.localMatrix;
-        }
-    }
-
-    return result;
-}
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "IAnimationController.h"
+#include "AnimationPose.h"
 #include "Engine/Graphics/Model/Skeleton/Skeleton.h"
 #include "Engine/Utility/Timer/GameTimer.h"
 #include <memory>
 #include <optional>
 
 /// @brief 2つのアニメーションをブレンドするコントローラー
+/// 両方の SkeletonAnimator のポーズを PoseBlender で補間し、ブレンド用のスケルトンに書き込む
+/// ブレンド用のバッファはブレンド開始時にだけ用意するので、毎フレームのメモリ確保は発生しない
 class AnimationBlender : public IAnimationController {
 public:
     /// @brief コンストラクタ
@@ -31,6 +34,10 @@ public:
     /// @return アニメーションが終了していればtrue
     bool IsFinished() const override;
 
+    /// @brief 末端のジョイントのアニメーションを省略するか設定（ブレンド中の両方のコントローラーに設定する）
+    /// @param skip 省略するか
+    void SetSkipLeafJoints(bool skip) override;
+
     /// @brief 新しいアニメーションへのブレンドを開始
     /// @param targetController ターゲットアニメーションコントローラー
     /// @param blendDuration ブレンド時間（秒）
@@ -46,13 +53,6 @@ public:
     const Skeleton& GetSkeleton() const;
 
 private:
-    /// @brief 2つのスケルトンをブレンド
-    /// @param skeleton1 スケルトン1
-    /// @param skeleton2 スケルトン2
-    /// @param weight スケルトン2の重み（0.0～1.0）
-    /// @return ブレンドされたスケルトン
-    Skeleton BlendSkeletons(const Skeleton& skeleton1, const Skeleton& skeleton2, float weight);
-
     /// @brief ブレンド完了時のコールバック
     void OnBlendComplete();
 
@@ -62,9 +62,15 @@ private:
     // ターゲットアニメーションコントローラー（ブレンド中のみ）
     std::unique_ptr<IAnimationController> targetController_;
     
-    // ブレンド用のスケルトン（結果を保持）
+    // ブレンドされたポーズ
+    AnimationPose blendedPose_;
+
+    // ブレンド用のスケルトン（結果を保持。最初のブレンド開始時に作成し、以降のブレンドでも再利用する）
     std::optional<Skeleton> blendedSkeleton_;
     
     // ブレンドタイマー
     GameTimer blendTimer_;
+
+    // 末端のジョイントのアニメーションを省略するか（ブレンド先のコントローラーにも引き継ぐ）
+    bool skipLeafJoints_ = false;
 };
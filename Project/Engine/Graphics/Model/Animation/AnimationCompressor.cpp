@@ -0,0 +1,287 @@
+#include "AnimationCompressor.h"
+#include "AnimationUtils.h"
+#include <Math/MathCore.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace {
+    // キーフレーム削減で1区間にまとめる最大のキーフレーム数（削減の計算量を抑える）
+    constexpr size_t kMaxReducedSpan = 512;
+
+    using namespace AnimationQuantization;
+
+    //================================================
+    // 誤差
+    //================================================
+
+    float Vector3Error(const Vector3& a, const Vector3& b) {
+        return MathCore::Vector::Length(a - b);
+    }
+
+    /// @brief 2つのクォータニオンの回転の差（度）
+    /// 差が小さいときに acos(内積) は float の精度が足りないため、4次元での距離 |a - b| = 2sin(θ/4) から求める
+    float QuaternionErrorDegrees(const Quaternion& a, const Quaternion& b) {
+        const float sign = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0f ? -1.0f : 1.0f;
+        const float dx = a.x - sign * b.x;
+        const float dy = a.y - sign * b.y;
+        const float dz = a.z - sign * b.z;
+        const float dw = a.w - sign * b.w;
+        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz + dw * dw);
+        return 4.0f * std::asin((std::min)(distance * 0.5f, 1.0f)) * 180.0f / std::numbers::pi_v<float>;
+    }
+
+    Vector3 Interpolate(const Vector3& a, const Vector3& b, float t) {
+        return a + (b - a) * t;
+    }
+
+    Quaternion Interpolate(const Quaternion& a, const Quaternion& b, float t) {
+        return MathCore::QuaternionMath::Slerp(a, b, t);
+    }
+
+    //================================================
+    // キーフレームの削減
+    //================================================
+
+    /// @brief 前後のキーフレームの補間で許容誤差内に再現できるキーフレームを取り除く
+    /// @param error 2つの値の誤差を返す関数
+    /// @return 残すキーフレームのIndex（昇順）
+    template<typename tValue, typename Error>
+    std::vector<size_t> ReduceKeyframes(const std::vector<Keyframe<tValue>>& keyframes, float tolerance, const Error& error) {
+        std::vector<size_t> kept;
+        if (keyframes.empty()) {
+            return kept;
+        }
+
+        // 全体が一定なら先頭のキーフレームだけ残す
+        kept.push_back(0);
+        const bool isConstant = std::all_of(keyframes.begin(), keyframes.end(),
+            [&](const Keyframe<tValue>& keyframe) { return error(keyframes.front().value, keyframe.value) <= tolerance; });
+        if (isConstant || keyframes.size() == 1) {
+            return kept;
+        }
+
+        // anchor から end までを補間で表せる間は延ばし、表せなくなったら直前のキーフレームを残す
+        size_t anchor = 0;
+        for (size_t end = 2; end < keyframes.size(); ++end) {
+            bool representable = end - anchor <= kMaxReducedSpan;
+            for (size_t i = anchor + 1; representable && i < end; ++i) {
+                const float t = (keyframes[i].time - keyframes[anchor].time) / (keyframes[end].time - keyframes[anchor].time);
+                representable = error(Interpolate(keyframes[anchor].value, keyframes[end].value, t), keyframes[i].value) <= tolerance;
+            }
+            if (!representable) {
+                anchor = end - 1;
+                kept.push_back(anchor);
+            }
+        }
+        kept.push_back(keyframes.size() - 1);
+        return kept;
+    }
+
+    //================================================
+    // 量子化
+    //================================================
+
+    uint16_t Quantize(float value, float min, float step) {
+        if (!(step > 0.0f)) {
+            return 0;
+        }
+        const float quantized = std::round((value - min) / step);
+        return static_cast<uint16_t>(std::clamp(quantized, 0.0f, kMaxQuantizedValue));
+    }
+
+    /// @brief キーフレーム時刻を量子化（クリップの尺を 0 ～ kMaxQuantizedValue に対応させる）
+    uint16_t QuantizeTime(float time, float timeScale) {
+        return static_cast<uint16_t>(std::clamp(std::round(time * timeScale), 0.0f, kMaxQuantizedValue));
+    }
+
+    /// @brief 値の範囲から量子化の範囲を作成
+    QuantizationBounds CreateBounds(const Vector3& min, const Vector3& max) {
+        QuantizationBounds bounds;
+        bounds.min = min;
+        bounds.step = (max - min) * (1.0f / kMaxQuantizedValue);
+        return bounds;
+    }
+
+    void EncodeVector3(const Vector3& value, const QuantizationBounds& bounds, std::vector<uint16_t>& values) {
+        values.push_back(Quantize(value.x, bounds.min.x, bounds.step.x));
+        values.push_back(Quantize(value.y, bounds.min.y, bounds.step.y));
+        values.push_back(Quantize(value.z, bounds.min.z, bounds.step.z));
+    }
+
+    /// @brief クォータニオンを smallest three 形式の48bitに変換
+    /// 絶対値が最大の成分を省き（Indexを2bitで保持）、残り3成分を15bitずつに量子化する
+    void EncodeQuaternion(const Quaternion& value, std::vector<uint16_t>& values) {
+        const Quaternion normalized = MathCore::QuaternionMath::Normalize(value);
+        const float components[4] = { normalized.x, normalized.y, normalized.z, normalized.w };
+
+        uint32_t largestIndex = 0;
+        for (uint32_t i = 1; i < 4; ++i) {
+            if (std::abs(components[i]) > std::abs(components[largestIndex])) {
+                largestIndex = i;
+            }
+        }
+
+        // q と -q は同じ回転なので、省く成分が正になる向きにそろえる
+        const float sign = components[largestIndex] < 0.0f ? -1.0f : 1.0f;
+        uint64_t bits = static_cast<uint64_t>(largestIndex) << 45;
+        for (uint32_t i = 0, slot = 0; i < 4; ++i) {
+            if (i == largestIndex) {
+                continue;
+            }
+            // 最大でない成分は [-1/√2, 1/√2] に収まる
+            const float normalizedComponent = (sign * components[i] * kSqrt2 + 1.0f) * 0.5f;
+            const uint64_t quantized = static_cast<uint64_t>(std::clamp(std::round(normalizedComponent * kMaxQuantizedComponent), 0.0f, kMaxQuantizedComponent));
+            bits |= quantized << (30 - 15 * slot);
+            ++slot;
+        }
+
+        values.push_back(static_cast<uint16_t>(bits >> 32));
+        values.push_back(static_cast<uint16_t>(bits >> 16));
+        values.push_back(static_cast<uint16_t>(bits));
+    }
+
+    /// @brief 全チャンネルのVector3のキーフレームの範囲を求める
+    template<typename Select>
+    QuantizationBounds ComputeBounds(const Animation& animation, const Select& select) {
+        Vector3 min{ 0.0f, 0.0f, 0.0f };
+        Vector3 max{ 0.0f, 0.0f, 0.0f };
+        bool isFirst = true;
+        for (const auto& [name, nodeAnimation] : animation.nodeAnimations) {
+            for (const KeyframeVector3& keyframe : select(nodeAnimation).keyframes) {
+                if (isFirst) {
+                    min = max = keyframe.value;
+                    isFirst = false;
+                    continue;
+                }
+                min = { (std::min)(min.x, keyframe.value.x), (std::min)(min.y, keyframe.value.y), (std::min)(min.z, keyframe.value.z) };
+                max = { (std::max)(max.x, keyframe.value.x), (std::max)(max.y, keyframe.value.y), (std::max)(max.z, keyframe.value.z) };
+            }
+        }
+        return CreateBounds(min, max);
+    }
+
+    CompressedVector3Curve CompressCurve(const AnimationCurve<Vector3>& curve, const QuantizationBounds& bounds, float timeScale, float tolerance) {
+        CompressedVector3Curve compressed;
+        const std::vector<size_t> kept = ReduceKeyframes(curve.keyframes, tolerance, Vector3Error);
+        compressed.times.reserve(kept.size());
+        compressed.values.reserve(kept.size() * 3);
+        for (size_t index : kept) {
+            compressed.times.push_back(QuantizeTime(curve.keyframes[index].time, timeScale));
+            EncodeVector3(curve.keyframes[index].value, bounds, compressed.values);
+        }
+        return compressed;
+    }
+
+    CompressedQuaternionCurve CompressCurve(const AnimationCurve<Quaternion>& curve, float timeScale, float toleranceDegrees) {
+        CompressedQuaternionCurve compressed;
+        const std::vector<size_t> kept = ReduceKeyframes(curve.keyframes, toleranceDegrees, QuaternionErrorDegrees);
+        compressed.times.reserve(kept.size());
+        compressed.values.reserve(kept.size() * 3);
+        for (size_t index : kept) {
+            compressed.times.push_back(QuantizeTime(curve.keyframes[index].time, timeScale));
+            EncodeQuaternion(curve.keyframes[index].value, compressed.values);
+        }
+        return compressed;
+    }
+
+    //================================================
+    // レポート
+    //================================================
+
+    /// @brief キーフレームの時刻とその中間の時刻を列挙（昇順）
+    template<typename tValue>
+    std::vector<float> SampleTimes(const std::vector<Keyframe<tValue>>& keyframes) {
+        std::vector<float> times;
+        times.reserve(keyframes.size() * 2);
+        for (size_t i = 0; i < keyframes.size(); ++i) {
+            times.push_back(keyframes[i].time);
+            if (i + 1 < keyframes.size()) {
+                times.push_back((keyframes[i].time + keyframes[i + 1].time) * 0.5f);
+            }
+        }
+        return times;
+    }
+}
+
+CompressedAnimation AnimationCompressor::Compress(const Animation& animation, const Settings& settings) {
+    CompressedAnimation compressed;
+    compressed.duration = animation.duration;
+
+    // 時刻はクリップの尺（キーフレームが尺を超える場合は最後のキーフレームまで）を16bitに対応させる
+    float timeRange = animation.duration;
+    auto extendTimeRange = [&](const auto& keyframes) {
+        if (!keyframes.empty()) {
+            timeRange = (std::max)(timeRange, keyframes.back().time);
+        }
+    };
+    for (const auto& [name, nodeAnimation] : animation.nodeAnimations) {
+        extendTimeRange(nodeAnimation.translate.keyframes);
+        extendTimeRange(nodeAnimation.rotate.keyframes);
+        extendTimeRange(nodeAnimation.scale.keyframes);
+    }
+    compressed.timeScale = timeRange > 0.0f ? kMaxQuantizedValue / timeRange : 0.0f;
+
+    // 平行移動とスケールはクリップ全体の範囲に対して量子化する
+    compressed.translateBounds = ComputeBounds(animation, [](const NodeAnimation& nodeAnimation) -> const AnimationCurve<Vector3>& { return nodeAnimation.translate; });
+    compressed.scaleBounds = ComputeBounds(animation, [](const NodeAnimation& nodeAnimation) -> const AnimationCurve<Vector3>& { return nodeAnimation.scale; });
+
+    for (const auto& [name, nodeAnimation] : animation.nodeAnimations) {
+        CompressedNodeAnimation& compressedNode = compressed.nodeAnimations[name];
+        compressedNode.translate = CompressCurve(nodeAnimation.translate, compressed.translateBounds, compressed.timeScale, settings.translateTolerance);
+        compressedNode.rotate = CompressCurve(nodeAnimation.rotate, compressed.timeScale, settings.rotateToleranceDegrees);
+        compressedNode.scale = CompressCurve(nodeAnimation.scale, compressed.scaleBounds, compressed.timeScale, settings.scaleTolerance);
+    }
+
+    return compressed;
+}
+
+AnimationCompressor::Report AnimationCompressor::Measure(const Animation& source, const CompressedAnimation& compressed) {
+    Report report;
+
+    for (const auto& [name, nodeAnimation] : source.nodeAnimations) {
+        auto it = compressed.nodeAnimations.find(name);
+        if (it == compressed.nodeAnimations.end()) {
+            continue;
+        }
+        const CompressedNodeAnimation& compressedNode = it->second;
+
+        // キーフレーム数とデータサイズ
+        report.sourceKeyCount += nodeAnimation.translate.keyframes.size() + nodeAnimation.rotate.keyframes.size() + nodeAnimation.scale.keyframes.size();
+        report.compressedKeyCount += compressedNode.translate.times.size() + compressedNode.rotate.times.size() + compressedNode.scale.times.size();
+        report.sourceBytes += (nodeAnimation.translate.keyframes.size() + nodeAnimation.scale.keyframes.size()) * sizeof(KeyframeVector3)
+            + nodeAnimation.rotate.keyframes.size() * sizeof(KeyframeQuaternion);
+        for (const auto* data : { &compressedNode.translate.times, &compressedNode.translate.values, &compressedNode.rotate.times,
+            &compressedNode.rotate.values, &compressedNode.scale.times, &compressedNode.scale.values }) {
+            report.compressedBytes += data->size() * sizeof(uint16_t);
+        }
+
+        // 誤差（サンプリング時刻は昇順なのでカーソルは先頭から進む）
+        if (!nodeAnimation.translate.keyframes.empty()) {
+            AnimationUtils::KeyframeCursor cursor;
+            for (float time : SampleTimes(nodeAnimation.translate.keyframes)) {
+                report.maxTranslateError = (std::max)(report.maxTranslateError, Vector3Error(
+                    AnimationUtils::CalculateVector3(nodeAnimation.translate.keyframes, time),
+                    AnimationUtils::CalculateVector3(compressedNode.translate, compressed.translateBounds, compressed.timeScale, time, cursor)));
+            }
+        }
+        if (!nodeAnimation.rotate.keyframes.empty()) {
+            AnimationUtils::KeyframeCursor cursor;
+            for (float time : SampleTimes(nodeAnimation.rotate.keyframes)) {
+                report.maxRotateErrorDegrees = (std::max)(report.maxRotateErrorDegrees, QuaternionErrorDegrees(
+                    AnimationUtils::CalculateQuaternion(nodeAnimation.rotate.keyframes, time),
+                    AnimationUtils::CalculateQuaternion(compressedNode.rotate, compressed.timeScale, time, cursor)));
+            }
+        }
+        if (!nodeAnimation.scale.keyframes.empty()) {
+            AnimationUtils::KeyframeCursor cursor;
+            for (float time : SampleTimes(nodeAnimation.scale.keyframes)) {
+                report.maxScaleError = (std::max)(report.maxScaleError, Vector3Error(
+                    AnimationUtils::CalculateVector3(nodeAnimation.scale.keyframes, time),
+                    AnimationUtils::CalculateVector3(compressedNode.scale, compressed.scaleBounds, compressed.timeScale, time, cursor)));
+            }
+        }
+    }
+
+    return report;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Animation.h"
+#include "CompressedAnimation.h"
+#include <cstddef>
+
+/// @brief アニメーションの圧縮クラス
+/// 許容誤差内でのキーフレームの削減、smallest three 形式の48bitクォータニオン、
+/// クリップ全体の範囲に対する16bitの平行移動・スケール・時刻の量子化を行う
+class AnimationCompressor {
+public:
+    /// @brief キーフレーム削減の許容誤差
+    struct Settings {
+        float translateTolerance = 0.0005f;   // 平行移動の誤差（長さ）
+        float rotateToleranceDegrees = 0.05f; // 回転の誤差（度）
+        float scaleTolerance = 0.0005f;       // スケールの誤差
+    };
+
+    /// @brief 圧縮結果のレポート
+    struct Report {
+        size_t sourceKeyCount = 0;        // 元のキーフレーム数（全チャンネルの合計）
+        size_t compressedKeyCount = 0;    // 圧縮後のキーフレーム数
+        size_t sourceBytes = 0;           // 元のキーフレームデータのサイズ（バイト）
+        size_t compressedBytes = 0;       // 圧縮後のキーフレームデータのサイズ（バイト）
+        float maxTranslateError = 0.0f;   // 平行移動の最大誤差（長さ）
+        float maxRotateErrorDegrees = 0.0f; // 回転の最大誤差（度）
+        float maxScaleError = 0.0f;       // スケールの最大誤差
+    };
+
+    /// @brief アニメーションを圧縮する
+    /// @param animation 元のアニメーション
+    /// @param settings キーフレーム削減の許容誤差
+    /// @return 圧縮されたアニメーション
+    static CompressedAnimation Compress(const Animation& animation, const Settings& settings);
+
+    /// @brief 元のアニメーションと圧縮したアニメーションを比較してレポートを作成
+    /// キーフレームの時刻とその中間の時刻で両方をサンプリングし、誤差の最大値を求める
+    /// @param source 元のアニメーション
+    /// @param compressed 圧縮されたアニメーション
+    /// @return レポート
+    static Report Measure(const Animation& source, const CompressedAnimation& compressed);
+};
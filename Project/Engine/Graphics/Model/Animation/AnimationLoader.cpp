@@ -1,4 +1,6 @@
 #include "AnimationLoader.h"
+#include "AnimationUtils.h"
+#include "Engine/Graphics/Model/Cooked/CookedModel.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -8,6 +10,12 @@ Animation AnimationLoader::LoadAnimationFile(const std::string& directoryPath, c
 	// ファイルパスを構築
 	std::string filePath = directoryPath + "/" + filename;
 
+	// 焼き込みファイルがあればAssimpを通さずに読む
+	CookedModel cookedModel;
+	if (cookedModel.Open(filePath) && cookedModel.HasAnimation()) {
+		return cookedModel.BuildAnimation();
+	}
+
 	// Assimpでシーンを読み込む（モデルロードと同じフラグを使用）
 	Assimp::Importer importer;
 	const aiScene* scene = importer.ReadFile(
@@ -90,5 +98,10 @@ NodeAnimation AnimationLoader::ConvertNodeAnimation(const aiNodeAnim* aiNodeAnim
 		nodeAnimation.scale.keyframes.push_back(keyframe);
 	}
 
+	// 一定のレートでベイクされたカーブは、サンプリング時に時刻から直接区間を求められるようにする
+	AnimationUtils::DetectKeyInterval(nodeAnimation.translate);
+	AnimationUtils::DetectKeyInterval(nodeAnimation.rotate);
+	AnimationUtils::DetectKeyInterval(nodeAnimation.scale);
+
 	return nodeAnimation;
 }
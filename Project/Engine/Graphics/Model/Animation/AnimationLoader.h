@@ -8,18 +8,19 @@
 class AnimationLoader {
 public:
     /// @brief アニメーションファイルを読み込む
+    /// 焼き込みファイル（ModelCooker）があればそこから読み、なければAssimpで読む
     /// @param directoryPath ディレクトリパス
     /// @param filename ファイル名
-  /// @return 読み込んだアニメーションデータ
+    /// @return 読み込んだアニメーションデータ
     static Animation LoadAnimationFile(const std::string& directoryPath, const std::string& filename);
 
-private:
     /// @brief Assimpシーンからアニメーションを解析
     /// @param scene Assimpシーン
     /// @param animationIndex アニメーションインデックス（デフォルト0）
     /// @return 解析されたアニメーション
     static Animation ParseAnimation(const struct aiScene* scene, unsigned int animationIndex = 0);
 
+private:
     /// @brief AssimpのNodeAnimationをNodeAnimationに変換
     /// @param aiNodeAnim Assimpのノードアニメーション
     /// @return 変換されたNodeAnimation
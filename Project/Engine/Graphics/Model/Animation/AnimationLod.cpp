@@ -0,0 +1,177 @@
+#include "AnimationLod.h"
+#include "PoseBlender.h"
+#include "Engine/Math/MathCore.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+void AnimationLod::SetSettings(const AnimationLodSettings& settings) {
+    settings_ = settings;
+    levelIndex_ = 0;
+    hasEvaluatedPoses_ = false;
+    evaluationRequested_ = true;
+}
+
+void AnimationLod::RequestEvaluation() {
+    evaluationRequested_ = true;
+    settled_ = false;
+    accumulatedTime_ = 0.0f;
+}
+
+void AnimationLod::SubmitView(const Vector3& worldCenter, float worldRadius, const Matrix4x4& viewMatrix, const Matrix4x4& projectionMatrix) {
+    // ビュー空間の境界球（行ベクトル規約・左手系で、+z がカメラの前方）
+    const Vector3 viewCenter = MathCore::CoordinateTransform::TransformCoord(worldCenter, viewMatrix);
+    const float distance = MathCore::Vector::Length(viewCenter);
+
+    bool visible = true;
+    float screenSize = (std::numeric_limits<float>::max)();
+
+    // 透視投影の場合のみ視錐台の判定と画面上の大きさを求める（正射影は常に最も詳細なLOD）
+    if (projectionMatrix.m[2][3] != 0.0f) {
+        const float xScale = projectionMatrix.m[0][0];
+        const float yScale = projectionMatrix.m[1][1];
+        const float z = viewCenter.z;
+
+        // 視錐台の側面（カメラの位置を通る平面）と背面側の判定。遠クリップ面は考慮しない
+        visible = z > -worldRadius
+            && std::abs(viewCenter.x) * xScale - z <= worldRadius * std::sqrt(xScale * xScale + 1.0f)
+            && std::abs(viewCenter.y) * yScale - z <= worldRadius * std::sqrt(yScale * yScale + 1.0f);
+
+        // 直径が画面の高さに占める割合（= 半径 * yScale / z）。カメラが境界球の内側にある場合は最大とする
+        if (z > worldRadius) {
+            screenSize = worldRadius * yScale / z;
+        }
+    }
+
+    // 1フレームに複数回描画された場合は最も詳細になるものを使う
+    if (!viewSubmitted_) {
+        submittedScreenSize_ = screenSize;
+        submittedDistance_ = distance;
+    } else {
+        submittedScreenSize_ = (std::max)(submittedScreenSize_, screenSize);
+        submittedDistance_ = (std::min)(submittedDistance_, distance);
+    }
+    viewSubmitted_ = true;
+    visible_ = visible_ || visible;
+}
+
+AnimationLod::Action AnimationLod::Advance(float deltaTime) {
+    accumulatedTime_ += deltaTime;
+
+    // 前回の Advance 以降に記録した描画の情報を取り出す
+    const bool viewSubmitted = viewSubmitted_;
+    const bool visible = visible_;
+    if (viewSubmitted) {
+        screenSize_ = submittedScreenSize_;
+        distance_ = submittedDistance_;
+    }
+    viewSubmitted_ = false;
+    visible_ = false;
+
+    auto evaluate = [this]() {
+        framesSinceEvaluation_ = 0;
+        hasEvaluated_ = true;
+        evaluationRequested_ = false;
+        return Action::Evaluate;
+    };
+
+    // 1度も評価していなければ、画面外でも初期のポーズを作るために評価する
+    if (!hasEvaluated_) {
+        return evaluate();
+    }
+
+    const bool lodEnabled = settings_.enabled && !settings_.levels.empty();
+    if (lodEnabled) {
+        // 画面外なら停止（画面内に戻ったときに評価し直す）
+        if (settings_.freezeOffscreen && !visible) {
+            evaluationRequested_ = true;
+            hasEvaluatedPoses_ = false;
+            return Action::Freeze;
+        }
+        if (viewSubmitted) {
+            levelIndex_ = SelectLevel(screenSize_, distance_);
+        }
+    }
+
+    // アニメーションの切り替え・リセット直後は必ず評価する
+    if (evaluationRequested_) {
+        return evaluate();
+    }
+
+    // 再生が終了している、または進める時間がなければポーズは変化しない（一時停止中など）
+    if (settled_) {
+        accumulatedTime_ = 0.0f;
+        return Action::Skip;
+    }
+    if (!(accumulatedTime_ > 0.0f)) {
+        return Action::Skip;
+    }
+
+    if (!lodEnabled) {
+        return evaluate();
+    }
+
+    // 評価間隔の途中は、補間するLODなら補間し、そうでなければ何もしない
+    const AnimationLodSettings::Level& level = GetCurrentLevel();
+    ++framesSinceEvaluation_;
+    if (framesSinceEvaluation_ < (std::max)(level.updateInterval, 1u)) {
+        return level.interpolate && hasEvaluatedPoses_ ? Action::Interpolate : Action::Skip;
+    }
+    return evaluate();
+}
+
+float AnimationLod::ConsumeDeltaTime() {
+    return std::exchange(accumulatedTime_, 0.0f);
+}
+
+const AnimationLodSettings::Level& AnimationLod::GetCurrentLevel() const {
+    static const AnimationLodSettings::Level kFullLevel;
+    if (!settings_.enabled || settings_.levels.empty()) {
+        return kFullLevel;
+    }
+    return settings_.levels[(std::min)(static_cast<size_t>(levelIndex_), settings_.levels.size() - 1)];
+}
+
+void AnimationLod::StoreEvaluatedPose(Skeleton& skeleton) {
+    const AnimationLodSettings::Level& level = GetCurrentLevel();
+    if (!level.interpolate || level.updateInterval <= 1) {
+        hasEvaluatedPoses_ = false;
+        return;
+    }
+
+    // 最新の評価結果を記録（配列は入れ替えるだけなのでメモリ確保は発生しない）
+    std::swap(evaluatedPoses_[0], evaluatedPoses_[1]);
+    evaluatedPoses_[1].Reset(skeleton);
+
+    // 1つ前の評価結果がなければ最新の評価結果をそのまま表示する
+    if (!hasEvaluatedPoses_) {
+        evaluatedPoses_[0].transforms.assign(evaluatedPoses_[1].transforms.begin(), evaluatedPoses_[1].transforms.end());
+        hasEvaluatedPoses_ = true;
+        return;
+    }
+
+    // 表示は1つ前の評価結果から始め、次の評価までに最新の評価結果へ補間する
+    evaluatedPoses_[0].ApplyTo(skeleton);
+}
+
+void AnimationLod::ApplyInterpolatedPose(Skeleton& skeleton) {
+    const AnimationLodSettings::Level& level = GetCurrentLevel();
+    const float t = static_cast<float>(framesSinceEvaluation_) / static_cast<float>((std::max)(level.updateInterval, 1u));
+    PoseBlender::Blend(evaluatedPoses_[0], evaluatedPoses_[1], t, interpolatedPose_);
+    interpolatedPose_.ApplyTo(skeleton);
+}
+
+uint32_t AnimationLod::SelectLevel(float screenSize, float distance) const {
+    const size_t levelCount = settings_.levels.size();
+    for (size_t i = 0; i + 1 < levelCount; ++i) {
+        const AnimationLodSettings::Level& level = settings_.levels[i];
+        const bool matches = settings_.metric == AnimationLodSettings::Metric::ScreenSize
+            ? screenSize >= level.threshold
+            : distance <= level.threshold;
+        if (matches) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    return static_cast<uint32_t>(levelCount - 1);
+}
@@ -0,0 +1,132 @@
+#pragma once
+#include "AnimationPose.h"
+#include <Math/Matrix/Matrix4x4.h>
+#include <Math/Vector/Vector3.h>
+#include <cstdint>
+#include <vector>
+
+/// @brief アニメーションLODの設定
+/// 画面上の大きさ（またはカメラからの距離）に応じて、スケルトンを評価する頻度と評価するジョイントを減らす
+struct AnimationLodSettings {
+    /// @brief LODの選択に使う指標
+    enum class Metric {
+        ScreenSize, // 画面上の大きさ（境界球の直径が画面の高さに占める割合）
+        Distance    // カメラからの距離
+    };
+
+    /// @brief LODごとの設定
+    struct Level {
+        float threshold = 0.0f;      // ScreenSize: この大きさ以上で使う / Distance: この距離以下で使う
+        uint32_t updateInterval = 1; // 何フレームに1回ポーズを評価するか（1なら毎フレーム）
+        bool interpolate = false;    // 評価しないフレームで直前の2回の評価結果を補間するか（表示は評価間隔の分だけ遅れる）
+        bool skipLeafJoints = false; // 末端のジョイント（子を持たない）のアニメーションを省略するか
+    };
+
+    bool enabled = false;
+    Metric metric = Metric::ScreenSize;
+
+    // 詳細な順に並べる（どのLODの条件も満たさない場合は最後のLODを使う）
+    std::vector<Level> levels = {
+        { 0.25f, 1, false, false },
+        { 0.10f, 2, true, false },
+        { 0.0f, 4, false, true },
+    };
+
+    bool freezeOffscreen = true; // 画面外（視錐台の外、または描画されなかった）ならポーズを評価しない（時間は蓄積して次の評価で進める）
+    float boundingRadius = 0.0f; // モデル空間の境界球の半径（0ならモデルの頂点から求める）
+};
+
+/// @brief モデル1体分のアニメーションLODの状態
+/// 描画時にカメラから見た境界球を記録し（SubmitView）、次のアニメーション更新でどう更新するかを決める（Advance）
+/// 補間に使うポーズもここで保持する
+class AnimationLod {
+public:
+    /// @brief アニメーション更新で行う処理
+    enum class Action {
+        Evaluate,    // ポーズを評価してパレットを書き込む
+        Interpolate, // ポーズは評価せず、直前の2回の評価結果を補間してパレットを書き込む
+        Skip,        // 何もしない（評価間隔の途中、またはポーズが変化しない）
+        Freeze       // 何もしない（画面外）
+    };
+
+    /// @brief 設定を変更
+    /// @param settings 設定
+    void SetSettings(const AnimationLodSettings& settings);
+
+    /// @brief 設定を取得
+    const AnimationLodSettings& GetSettings() const { return settings_; }
+
+    /// @brief 描画時のカメラから見た境界球を記録（1フレームに複数回描画された場合は最も詳細なものを使う）
+    /// @param worldCenter 境界球の中心（ワールド座標）
+    /// @param worldRadius 境界球の半径（ワールド空間）
+    /// @param viewMatrix ビュー行列
+    /// @param projectionMatrix プロジェクション行列（正射影の場合は常に画面内・最も詳細なLODとして扱う）
+    void SubmitView(const Vector3& worldCenter, float worldRadius, const Matrix4x4& viewMatrix, const Matrix4x4& projectionMatrix);
+
+    /// @brief 1フレーム進めて、アニメーション更新で行う処理を決める
+    /// LODが無効でも、進める時間がなくポーズが変化しない場合は Skip を返す
+    /// @param deltaTime デルタタイム（秒。評価しないフレームの分は蓄積し、次の評価でまとめて進める）
+    /// @return 行う処理
+    Action Advance(float deltaTime);
+
+    /// @brief 次のアニメーション更新で必ず評価させる（アニメーションの切り替え・リセット時。蓄積した時間は破棄する）
+    void RequestEvaluation();
+
+    /// @brief 評価したポーズがこれ以上変化しないか設定（ループしない再生が終了した場合など）
+    /// 設定されている間は評価もパレットの書き込みも行わない（RequestEvaluation で解除される）
+    /// @param settled 変化しないか
+    void SetSettled(bool settled) { settled_ = settled; }
+
+    /// @brief Evaluate のときに進める時間（蓄積したデルタタイム。呼ぶと0に戻る）
+    float ConsumeDeltaTime();
+
+    /// @brief 現在のLODの設定
+    const AnimationLodSettings::Level& GetCurrentLevel() const;
+
+    /// @brief 現在のLODのIndex
+    uint32_t GetCurrentLevelIndex() const { return levelIndex_; }
+
+    /// @brief 最後に記録した画面上の大きさ（境界球の直径が画面の高さに占める割合）
+    float GetScreenSize() const { return screenSize_; }
+
+    /// @brief 最後に記録したカメラからの距離
+    float GetDistance() const { return distance_; }
+
+    /// @brief 評価したスケルトンを記録（Evaluate のとき、スケルトンの行列を更新した後に呼ぶ）
+    /// 補間するLODでは、表示を1評価間隔遅らせるためにスケルトンを1つ前の評価結果に戻す
+    /// @param skeleton 評価したスケルトン
+    void StoreEvaluatedPose(Skeleton& skeleton);
+
+    /// @brief 直前の2回の評価結果を補間してスケルトンに書き込む（Interpolate のとき）
+    /// @param skeleton 書き込み先のスケルトン
+    void ApplyInterpolatedPose(Skeleton& skeleton);
+
+private:
+    /// @brief 画面上の大きさ・距離からLODを選ぶ
+    uint32_t SelectLevel(float screenSize, float distance) const;
+
+    AnimationLodSettings settings_;
+    uint32_t levelIndex_ = 0;
+
+    // 前回の Advance 以降に記録した描画の情報
+    bool viewSubmitted_ = false;
+    bool visible_ = false;
+    float submittedScreenSize_ = 0.0f;
+    float submittedDistance_ = 0.0f;
+
+    // 最後に記録した描画の情報（デバッグ表示用）
+    float screenSize_ = 0.0f;
+    float distance_ = 0.0f;
+
+    // 評価の状態
+    float accumulatedTime_ = 0.0f;
+    uint32_t framesSinceEvaluation_ = 0;
+    bool hasEvaluated_ = false;
+    bool evaluationRequested_ = true;
+    bool settled_ = false;
+
+    // 補間用のポーズ（[0] が1つ前、[1] が最新の評価結果）
+    AnimationPose evaluatedPoses_[2];
+    AnimationPose interpolatedPose_;
+    bool hasEvaluatedPoses_ = false;
+};
@@ -0,0 +1,14 @@
+#include "AnimationPose.h"
+#include <algorithm>
+#include <cassert>
+
+void AnimationPose::Reset(const Skeleton& skeleton) {
+    transforms.assign(skeleton.transforms.begin(), skeleton.transforms.end());
+}
+
+void AnimationPose::ApplyTo(Skeleton& skeleton) const {
+    assert(transforms.size() == skeleton.GetJointCount());
+
+    std::copy(transforms.begin(), transforms.end(), skeleton.transforms.begin());
+    skeleton.UpdateSkeletonSpaceMatrices();
+}
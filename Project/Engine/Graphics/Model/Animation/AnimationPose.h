@@ -0,0 +1,19 @@
+#pragma once
+#include "Engine/Graphics/Model/Skeleton/Skeleton.h"
+#include "Engine/Math/QuaternionTransform.h"
+#include <vector>
+
+/// @brief スケルトンのポーズ（ジョイントごとのローカルの変換を、ジョイントのIndex順に並べた配列）
+/// アニメーションコントローラーはこの配列に書き込み、PoseBlender はポーズ同士を補間する
+/// Skeleton と違い名前や親子関係を持たないので、書き込みや補間でメモリ確保が発生しない
+struct AnimationPose {
+    std::vector<QuaternionTransform> transforms; // ジョイントのIndex順
+
+    /// @brief スケルトンの現在の変換で初期化（確保済みの容量は再利用する）
+    /// @param skeleton スケルトン
+    void Reset(const Skeleton& skeleton);
+
+    /// @brief ポーズをスケルトンに書き込み、ローカル行列とスケルトン空間行列を更新
+    /// @param skeleton 書き込み先のスケルトン（ポーズと同じジョイント数であること）
+    void ApplyTo(Skeleton& skeleton) const;
+};
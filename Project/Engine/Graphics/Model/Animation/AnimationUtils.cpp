@@ -2,6 +2,7 @@
 #include <Math/MathCore.h>
 #include <cassert>
 #include <algorithm>
+#include <cmath>
 
 namespace AnimationUtils {
 
@@ -14,6 +15,137 @@ namespace {
     inline float CalculateInterpolationFactor(float t1, float t2, float currentTime) {
         return (currentTime - t1) / (t2 - t1);
     }
+
+    // カーソルから線形に進める最大のキーフレーム数（超えたら二分探索に切り替える）
+    constexpr uint32_t kMaxCursorSteps = 4;
+    // 等間隔とみなすキーフレーム時刻のずれ（間隔に対する割合）
+    constexpr float kKeyIntervalTolerance = 0.01f;
+
+    /// @brief time を含む区間の開始Indexを二分探索で求める
+    /// @param keyCount キーフレーム数
+    /// @param keyTime Indexからキーフレームの時刻を返す関数
+    /// @return keyTime(index) < time <= keyTime(index + 1) となる index（std::lower_bound と同じ区間）
+    template<typename KeyTime, typename Time>
+    size_t SearchKeyframeIndex(size_t keyCount, const KeyTime& keyTime, Time time) {
+        size_t first = 0;
+        size_t count = keyCount;
+        while (count > 0) {
+            const size_t half = count / 2;
+            if (keyTime(first + half) < time) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        return first - 1;
+    }
+
+    /// @brief 等間隔の間隔（不等間隔ならカーソル）を使って time を含む区間の開始Indexを求める
+    /// 呼び出し側で keyTime(0) < time < keyTime(keyCount - 1) を保証すること
+    /// @param keyCount キーフレーム数
+    /// @param keyTime Indexからキーフレームの時刻を返す関数
+    /// @param keyInterval キーフレームが等間隔の場合の間隔（0なら不等間隔）
+    /// @return keyTime(index) < time <= keyTime(index + 1) となる index（二分探索と同じ区間）
+    template<typename KeyTime, typename Time>
+    size_t FindKeyframeIndex(size_t keyCount, const KeyTime& keyTime, float keyInterval, Time time, KeyframeCursor& cursor) {
+        const size_t lastSegment = keyCount - 2;
+
+        size_t index = 0;
+        if (keyInterval > 0.0f) {
+            // 等間隔なら再生の向きや飛んだ距離によらず時刻から直接求める
+            // （キーは等間隔の位置から間隔の1%以内にあるので、丸め誤差によるずれは前後の比較で補正できる）
+            index = (std::min)(static_cast<size_t>(static_cast<float>(time - keyTime(0)) / keyInterval), lastSegment);
+            while (index > 0 && keyTime(index) >= time) {
+                --index;
+            }
+            while (index < lastSegment && keyTime(index + 1) < time) {
+                ++index;
+            }
+            cursor.index = static_cast<uint32_t>(index);
+            return index;
+        }
+
+        if (cursor.index <= lastSegment && keyTime(cursor.index) < time) {
+            // 時刻が前回の区間より先なら前回の位置から進める
+            index = cursor.index;
+        } else {
+            // シークやループで時刻が戻った場合
+            index = SearchKeyframeIndex(keyCount, keyTime, time);
+        }
+
+        // 次の区間へ線形に進める（大きく飛んだ場合は二分探索）
+        uint32_t steps = 0;
+        while (keyTime(index + 1) < time) {
+            if (++steps > kMaxCursorSteps) {
+                index = SearchKeyframeIndex(keyCount, keyTime, time);
+                break;
+            }
+            ++index;
+        }
+
+        cursor.index = static_cast<uint32_t>(index);
+        return index;
+    }
+
+    /// @brief キーフレーム配列のカーブで time を含む区間の開始Indexを求める
+    template<typename tValue>
+    size_t FindKeyframeIndex(const AnimationCurve<tValue>& curve, float time, KeyframeCursor& cursor) {
+        const auto& keyframes = curve.keyframes;
+        return FindKeyframeIndex(keyframes.size(), [&](size_t i) { return keyframes[i].time; }, curve.keyInterval, time, cursor);
+    }
+
+    /// @brief 圧縮されたカーブの区間と補間係数
+    struct CompressedSegment {
+        size_t index; // 区間の開始キーフレームのIndex（単一キーフレーム・範囲外の場合はそのキーフレーム）
+        float t;      // 補間係数（区間でない場合は0）
+        bool isKey;   // 補間せずキーフレームの値をそのまま使うか
+    };
+
+    /// @brief 圧縮されたカーブで時刻に対応する区間を求める（キーフレーム配列版と同じ規則で範囲外を扱う）
+    inline CompressedSegment FindCompressedSegment(const std::vector<uint16_t>& times, float timeScale, float time, KeyframeCursor& cursor) {
+        assert(!times.empty());
+
+        // 時刻は量子化した単位で比較する
+        const float quantizedTime = time * timeScale;
+        if (times.size() == 1 || quantizedTime <= static_cast<float>(times.front())) {
+            return { 0, 0.0f, true };
+        }
+        if (quantizedTime >= static_cast<float>(times.back())) {
+            return { times.size() - 1, 0.0f, true };
+        }
+
+        // 量子化した時刻は整数なので、times[i] < quantizedTime は times[i] < ceil(quantizedTime) と同じ（整数のまま比較する）
+        const int32_t searchTime = static_cast<int32_t>(std::ceil(quantizedTime));
+        auto keyTime = [&](size_t i) { return static_cast<int32_t>(times[i]); };
+        const size_t index = FindKeyframeIndex(times.size(), keyTime, 0.0f, searchTime, cursor);
+        return { index, CalculateInterpolationFactor(static_cast<float>(times[index]), static_cast<float>(times[index + 1]), quantizedTime), false };
+    }
+
+    template<typename tValue>
+    void DetectKeyIntervalImpl(AnimationCurve<tValue>& curve) {
+        curve.keyInterval = 0.0f;
+
+        const auto& keyframes = curve.keyframes;
+        if (keyframes.size() < 2) {
+            return;
+        }
+
+        const float interval = (keyframes.back().time - keyframes.front().time) / static_cast<float>(keyframes.size() - 1);
+        if (!(interval > 0.0f)) {
+            return;
+        }
+
+        // 全てのキーフレームが等間隔の位置から許容範囲内にあるか
+        for (size_t i = 0; i < keyframes.size(); ++i) {
+            const float expected = keyframes.front().time + interval * static_cast<float>(i);
+            if (std::abs(keyframes[i].time - expected) > interval * kKeyIntervalTolerance) {
+                return;
+            }
+        }
+
+        curve.keyInterval = interval;
+    }
 }
 
 Vector3 CalculateVector3(const std::vector<Keyframe<Vector3>>& keyframes, float time) {
@@ -88,4 +220,86 @@ Quaternion CalculateQuaternion(const std::vector<Keyframe<Quaternion>>& keyframe
     return MathCore::QuaternionMath::Slerp(keyframes[index].value, keyframes[nextIndex].value, t);
 }
 
+Vector3 CalculateVector3(const AnimationCurve<Vector3>& curve, float time, KeyframeCursor& cursor) {
+    const auto& keyframes = curve.keyframes;
+    assert(!keyframes.empty());
+
+    // 単一キーフレームまたは範囲外の場合
+    if (keyframes.size() == 1 || time <= keyframes.front().time) {
+        return keyframes.front().value;
+    }
+    if (time >= keyframes.back().time) {
+        return keyframes.back().value;
+    }
+
+    size_t index = FindKeyframeIndex(curve, time, cursor);
+    size_t nextIndex = index + 1;
+
+    // 線形補間
+    float t = CalculateInterpolationFactor(
+        keyframes[index].time,
+        keyframes[nextIndex].time,
+        time
+    );
+
+    return keyframes[index].value + (keyframes[nextIndex].value - keyframes[index].value) * t;
+}
+
+Quaternion CalculateQuaternion(const AnimationCurve<Quaternion>& curve, float time, KeyframeCursor& cursor) {
+    const auto& keyframes = curve.keyframes;
+    assert(!keyframes.empty());
+
+    // 単一キーフレームまたは範囲外の場合
+    if (keyframes.size() == 1 || time <= keyframes.front().time) {
+        return keyframes.front().value;
+    }
+    if (time >= keyframes.back().time) {
+        return keyframes.back().value;
+    }
+
+    size_t index = FindKeyframeIndex(curve, time, cursor);
+    size_t nextIndex = index + 1;
+
+    // 球面線形補間
+    float t = CalculateInterpolationFactor(
+        keyframes[index].time,
+        keyframes[nextIndex].time,
+        time
+    );
+
+    return MathCore::QuaternionMath::Slerp(keyframes[index].value, keyframes[nextIndex].value, t);
+}
+
+void DetectKeyInterval(AnimationCurve<Vector3>& curve) {
+    DetectKeyIntervalImpl(curve);
+}
+
+void DetectKeyInterval(AnimationCurve<Quaternion>& curve) {
+    DetectKeyIntervalImpl(curve);
+}
+
+Vector3 CalculateVector3(const CompressedVector3Curve& curve, const QuantizationBounds& bounds, float timeScale, float time, KeyframeCursor& cursor) {
+    const CompressedSegment segment = FindCompressedSegment(curve.times, timeScale, time, cursor);
+    const Vector3 value = AnimationQuantization::DecodeVector3(&curve.values[segment.index * 3], bounds);
+    if (segment.isKey) {
+        return value;
+    }
+
+    // 線形補間
+    const Vector3 nextValue = AnimationQuantization::DecodeVector3(&curve.values[(segment.index + 1) * 3], bounds);
+    return value + (nextValue - value) * segment.t;
+}
+
+Quaternion CalculateQuaternion(const CompressedQuaternionCurve& curve, float timeScale, float time, KeyframeCursor& cursor) {
+    const CompressedSegment segment = FindCompressedSegment(curve.times, timeScale, time, cursor);
+    const Quaternion value = AnimationQuantization::DecodeQuaternion(&curve.values[segment.index * 3]);
+    if (segment.isKey) {
+        return value;
+    }
+
+    // 球面線形補間
+    const Quaternion nextValue = AnimationQuantization::DecodeQuaternion(&curve.values[(segment.index + 1) * 3]);
+    return MathCore::QuaternionMath::Slerp(value, nextValue, segment.t);
+}
+
 } // namespace AnimationUtils
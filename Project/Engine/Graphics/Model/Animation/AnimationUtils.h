@@ -2,12 +2,28 @@
 
 #include <Math/Vector/Vector3.h>
 #include <Math/Quaternion/Quaternion.h>
+#include <cstdint>
 #include <vector>
 #include "NodeAnimation.h"
+#include "CompressedAnimation.h"
 
 /// @brief アニメーション補間ユーティリティ
 namespace AnimationUtils {
 
+/// @brief キーフレーム探索のカーソル
+/// 前回サンプリングした区間を覚えておき、再生時刻が進んだ分だけ線形に進める
+/// 状態を持つので、共有される Animation ではなくアニメーターのインスタンスごとに保持する
+struct KeyframeCursor {
+    uint32_t index = 0; // 前回サンプリングした区間の開始キーフレームのIndex
+};
+
+/// @brief NodeAnimation の各チャンネルのカーソル
+struct NodeAnimationCursor {
+    KeyframeCursor translate;
+    KeyframeCursor rotate;
+    KeyframeCursor scale;
+};
+
 /// @brief Vector3のキーフレーム配列から任意の時刻の値を計算
 /// @param keyframes キーフレーム配列
 /// @param time 時刻
@@ -20,4 +36,46 @@ Vector3 CalculateVector3(const std::vector<Keyframe<Vector3>>& keyframes, float
 /// @return 補間された値
 Quaternion CalculateQuaternion(const std::vector<Keyframe<Quaternion>>& keyframes, float time);
 
+/// @brief カーソルを使ってVector3のカーブから任意の時刻の値を計算
+/// 時刻が前回から進んでいれば前回の区間から線形に探索し、戻った場合（シーク・ループ）は二分探索する
+/// 等間隔のカーブ（keyInterval > 0）は時刻から直接区間を求める
+/// @param curve カーブ
+/// @param time 時刻
+/// @param cursor カーソル（探索結果で更新される）
+/// @return 補間された値（キーフレーム配列版と同じ結果）
+Vector3 CalculateVector3(const AnimationCurve<Vector3>& curve, float time, KeyframeCursor& cursor);
+
+/// @brief カーソルを使ってQuaternionのカーブから任意の時刻の値を計算
+/// @param curve カーブ
+/// @param time 時刻
+/// @param cursor カーソル（探索結果で更新される）
+/// @return 補間された値（キーフレーム配列版と同じ結果）
+Quaternion CalculateQuaternion(const AnimationCurve<Quaternion>& curve, float time, KeyframeCursor& cursor);
+
+/// @brief カーソルを使って圧縮されたVector3のカーブから任意の時刻の値を計算（キーフレームをその場で展開する）
+/// @param curve 圧縮されたカーブ
+/// @param bounds クリップの値の範囲（CompressedAnimation::translateBounds / scaleBounds）
+/// @param timeScale 秒を量子化した時刻に変換する係数（CompressedAnimation::timeScale）
+/// @param time 時刻
+/// @param cursor カーソル（探索結果で更新される）
+/// @return 補間された値
+Vector3 CalculateVector3(const CompressedVector3Curve& curve, const QuantizationBounds& bounds, float timeScale, float time, KeyframeCursor& cursor);
+
+/// @brief カーソルを使って圧縮されたQuaternionのカーブから任意の時刻の値を計算（キーフレームをその場で展開する）
+/// @param curve 圧縮されたカーブ
+/// @param timeScale 秒を量子化した時刻に変換する係数（CompressedAnimation::timeScale）
+/// @param time 時刻
+/// @param cursor カーソル（探索結果で更新される）
+/// @return 補間された値
+Quaternion CalculateQuaternion(const CompressedQuaternionCurve& curve, float timeScale, float time, KeyframeCursor& cursor);
+
+/// @brief キーフレームが等間隔に並んでいるか調べ、curve.keyInterval を設定する
+/// 一定のレートでベイクされたカーブでは、サンプリング時に探索せず時刻から区間を求められるようになる
+/// @param curve カーブ
+void DetectKeyInterval(AnimationCurve<Vector3>& curve);
+
+/// @brief キーフレームが等間隔に並んでいるか調べ、curve.keyInterval を設定する
+/// @param curve カーブ
+void DetectKeyInterval(AnimationCurve<Quaternion>& curve);
+
 } // namespace AnimationUtils
@@ -39,17 +39,34 @@ Matrix4x4 Animator::GetNodeLocalMatrix(const std::string& nodeName) const {
         return Mat::Identity();
     }
 
-    auto it = animation_->nodeAnimations.find(nodeName);
-    if (it == animation_->nodeAnimations.end()) {
-        return Mat::Identity();
-    }
+    Vector3 translate;
+    Quaternion rotate;
+    Vector3 scale;
+    if (const CompressedAnimation* compressed = animation_->compressed.get()) {
+        // 圧縮されたアニメーション（呼び出しごとに独立してサンプリングするのでカーソルは使い捨て）
+        auto it = compressed->nodeAnimations.find(nodeName);
+        if (it == compressed->nodeAnimations.end()) {
+            return Mat::Identity();
+        }
 
-    const NodeAnimation& nodeAnimation = it->second;
+        const CompressedNodeAnimation& nodeAnimation = it->second;
+        AnimationUtils::NodeAnimationCursor cursor;
+        translate = AnimationUtils::CalculateVector3(nodeAnimation.translate, compressed->translateBounds, compressed->timeScale, animationTime_, cursor.translate);
+        rotate = AnimationUtils::CalculateQuaternion(nodeAnimation.rotate, compressed->timeScale, animationTime_, cursor.rotate);
+        scale = AnimationUtils::CalculateVector3(nodeAnimation.scale, compressed->scaleBounds, compressed->timeScale, animationTime_, cursor.scale);
+    } else {
+        auto it = animation_->nodeAnimations.find(nodeName);
+        if (it == animation_->nodeAnimations.end()) {
+            return Mat::Identity();
+        }
 
-    // 各チャンネル（translate, rotate, scale）の値を取得
-    Vector3 translate = AnimationUtils::CalculateVector3(nodeAnimation.translate.keyframes, animationTime_);
-    Quaternion rotate = AnimationUtils::CalculateQuaternion(nodeAnimation.rotate.keyframes, animationTime_);
-    Vector3 scale = AnimationUtils::CalculateVector3(nodeAnimation.scale.keyframes, animationTime_);
+        const NodeAnimation& nodeAnimation = it->second;
+
+        // 各チャンネル（translate, rotate, scale）の値を取得
+        translate = AnimationUtils::CalculateVector3(nodeAnimation.translate.keyframes, animationTime_);
+        rotate = AnimationUtils::CalculateQuaternion(nodeAnimation.rotate.keyframes, animationTime_);
+        scale = AnimationUtils::CalculateVector3(nodeAnimation.scale.keyframes, animationTime_);
+    }
 
     // アフィン変換行列を生成（S * R * T）
     return Mat::Multiply(
@@ -0,0 +1,93 @@
+#pragma once
+#include <Math/Vector/Vector3.h>
+#include <Math/Quaternion/Quaternion.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/// @brief 圧縮アニメーションの量子化定数
+namespace AnimationQuantization {
+    constexpr float kMaxQuantizedValue = 65535.0f;   // 16bitの量子化の最大値（時刻・平行移動・スケール）
+    constexpr float kMaxQuantizedComponent = 32767.0f; // smallest three の成分の量子化の最大値（15bit）
+    constexpr float kSqrt2 = 1.41421356f;
+}
+
+/// @brief クリップ全体の値の範囲（16bitの量子化値を元の値に戻すのに使う）
+/// 元の値 = min + 量子化値 * step
+struct QuantizationBounds {
+    Vector3 min;
+    Vector3 step;
+};
+
+/// @brief 圧縮されたVector3のカーブ（平行移動・スケール）
+struct CompressedVector3Curve {
+    std::vector<uint16_t> times;  //!< 量子化したキーフレーム時刻（0 ～ kMaxQuantizedValue がクリップの尺に対応）
+    std::vector<uint16_t> values; //!< キーフレームごとに x, y, z の3要素（クリップの範囲に対する量子化値）
+};
+
+/// @brief 圧縮されたQuaternionのカーブ（smallest three 形式の48bit）
+struct CompressedQuaternionCurve {
+    std::vector<uint16_t> times;  //!< 量子化したキーフレーム時刻
+    std::vector<uint16_t> values; //!< キーフレームごとに3要素（最大成分のIndex 2bit + 残り3成分 15bit ずつ）
+};
+
+/// @brief 圧縮されたノードアニメーション
+struct CompressedNodeAnimation {
+    CompressedVector3Curve translate;
+    CompressedQuaternionCurve rotate;
+    CompressedVector3Curve scale;
+};
+
+/// @brief 圧縮されたアニメーション（AnimationCompressor::Compress で作成）
+/// キーフレームの削減と量子化を行ったもので、サンプリング時にその場で展開する
+struct CompressedAnimation {
+    float duration = 0.0f;  //!< アニメーション全体の尺(単位は秒)
+    float timeScale = 0.0f; //!< 秒を量子化した時刻に変換する係数
+    QuantizationBounds translateBounds; //!< 平行移動の範囲
+    QuantizationBounds scaleBounds;     //!< スケールの範囲
+
+    // CompressedNodeAnimationの集合。Node名でひけるようにしておく
+    std::map<std::string, CompressedNodeAnimation> nodeAnimations;
+};
+
+/// @brief 圧縮されたキーフレームの展開
+namespace AnimationQuantization {
+
+/// @brief 量子化したVector3を展開
+/// @param values 量子化値（3要素）
+/// @param bounds クリップの範囲
+inline Vector3 DecodeVector3(const uint16_t* values, const QuantizationBounds& bounds) {
+    return {
+        bounds.min.x + static_cast<float>(values[0]) * bounds.step.x,
+        bounds.min.y + static_cast<float>(values[1]) * bounds.step.y,
+        bounds.min.z + static_cast<float>(values[2]) * bounds.step.z
+    };
+}
+
+/// @brief smallest three 形式の48bitのクォータニオンを展開
+/// @param values 量子化値（3要素）
+inline Quaternion DecodeQuaternion(const uint16_t* values) {
+    // 15bitの量子化値を [-1/√2, 1/√2] に戻す（除算を避けて乗算と加算で行う）
+    constexpr float kScale = 2.0f / (kMaxQuantizedComponent * kSqrt2);
+    constexpr float kOffset = -1.0f / kSqrt2;
+
+    const uint64_t bits = (static_cast<uint64_t>(values[0]) << 32) | (static_cast<uint64_t>(values[1]) << 16) | values[2];
+    const float a = static_cast<float>(static_cast<uint32_t>(bits >> 30) & 0x7FFF) * kScale + kOffset;
+    const float b = static_cast<float>(static_cast<uint32_t>(bits >> 15) & 0x7FFF) * kScale + kOffset;
+    const float c = static_cast<float>(static_cast<uint32_t>(bits) & 0x7FFF) * kScale + kOffset;
+
+    // 最大成分は単位クォータニオンの条件から復元する（圧縮時に正になるようにしてある）
+    const float largest = std::sqrt((std::max)(0.0f, 1.0f - (a * a + b * b + c * c)));
+
+    switch (static_cast<uint32_t>(bits >> 45) & 0x3) {
+    case 0: return { largest, a, b, c };
+    case 1: return { a, largest, b, c };
+    case 2: return { a, b, largest, c };
+    default: return { a, b, c, largest };
+    }
+}
+
+} // namespace AnimationQuantization
@@ -0,0 +1,765 @@
+#include "AnimationBenchmark.h"
+#include "Engine/Graphics/Model/Animation/AnimationLod.h"
+#include "Engine/Graphics/Model/Animation/AnimationUtils.h"
+#include "Engine/Graphics/Model/Animation/PoseBlender.h"
+#include "Engine/Graphics/Model/Skeleton/SkeletonAnimator.h"
+#include "Engine/Math/MathCore.h"
+#include "Engine/Utility/Collision/CollisionUtils.h"
+#include "Engine/Utility/Job/JobSystem.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <string>
+
+namespace {
+	constexpr uint32_t kSeed = 12345;
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+	// 合成アニメーションの尺（既定値）とキーフレームのサンプリングレート
+	constexpr float kClipDuration = 2.0f;
+	constexpr float kKeyframeRate = 30.0f;
+
+	// 計測の繰り返し回数
+	constexpr uint32_t kRepeatCount = 3;
+
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief frameCount 回の呼び出しにかかった1フレームあたりの時間（ミリ秒）
+	template<typename Function>
+	double MeasureMilliseconds(uint32_t frameCount, Function&& frame) {
+		const auto start = Clock::now();
+		for (uint32_t i = 0; i < frameCount; ++i) {
+			frame();
+		}
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frameCount;
+	}
+
+	//================================================
+	// 変更前の実装（比較用）
+	// ジョイントの配置は現在の Skeleton に合わせてある（配置そのものの比較は RunSkeletonLayout で行う）
+	//================================================
+
+	/// @brief 変更前の SkeletonAnimator::ApplyAnimationAndUpdateMatrices（ジョイントごとに名前でチャンネルを検索）
+	void LegacyApplyAnimation(Skeleton& skeleton, const Animation& animation, float animationTime) {
+		const SkeletonHierarchy& hierarchy = *skeleton.hierarchy;
+		for (size_t joint = 0; joint < skeleton.GetJointCount(); ++joint) {
+			auto it = animation.nodeAnimations.find(hierarchy.names[joint]);
+			if (it != animation.nodeAnimations.end()) {
+				const NodeAnimation& nodeAnimation = it->second;
+				QuaternionTransform& transform = skeleton.transforms[joint];
+				transform.translate = AnimationUtils::CalculateVector3(nodeAnimation.translate.keyframes, animationTime);
+				transform.rotate = AnimationUtils::CalculateQuaternion(nodeAnimation.rotate.keyframes, animationTime);
+				transform.scale = AnimationUtils::CalculateVector3(nodeAnimation.scale.keyframes, animationTime);
+			}
+		}
+		skeleton.UpdateSkeletonSpaceMatrices();
+	}
+
+	/// @brief 変更前の SkeletonAnimator::ApplyAnimationAndUpdateMatrices（対応付け済みだが、毎回キーフレームを二分探索）
+	void LegacyApplyAnimation(Skeleton& skeleton, const AnimationBinding& binding, float animationTime) {
+		for (size_t i = 0; i < binding.channels.size(); ++i) {
+			const NodeAnimation& nodeAnimation = *binding.channels[i];
+			QuaternionTransform& transform = skeleton.transforms[binding.jointIndices[i]];
+			transform.translate = AnimationUtils::CalculateVector3(nodeAnimation.translate.keyframes, animationTime);
+			transform.rotate = AnimationUtils::CalculateQuaternion(nodeAnimation.rotate.keyframes, animationTime);
+			transform.scale = AnimationUtils::CalculateVector3(nodeAnimation.scale.keyframes, animationTime);
+		}
+		skeleton.UpdateSkeletonSpaceMatrices();
+	}
+
+	/// @brief 変更前の AnimationBlender::BlendSkeletons（結果のスケルトンを値で返すので、配列を毎回コピーする）
+	Skeleton LegacyBlendSkeletons(const Skeleton& skeleton1, const Skeleton& skeleton2, float weight) {
+		Skeleton result = skeleton1;
+		const size_t jointCount = (std::min)(result.GetJointCount(), skeleton2.GetJointCount());
+		for (size_t i = 0; i < jointCount; ++i) {
+			QuaternionTransform& transform = result.transforms[i];
+			const QuaternionTransform& transform2 = skeleton2.transforms[i];
+			transform.translate = CollisionUtils::Lerp(transform.translate, transform2.translate, weight);
+			transform.rotate = MathCore::QuaternionMath::Slerp(transform.rotate, transform2.rotate, weight);
+			transform.scale = CollisionUtils::Lerp(transform.scale, transform2.scale, weight);
+		}
+		result.UpdateSkeletonSpaceMatrices();
+		return result;
+	}
+
+	/// @brief 変更前の Joint 構造体（名前・子のリストと、評価で使う変換・行列を1つにまとめていた）
+	struct LegacyJoint {
+		QuaternionTransform transform;
+		Matrix4x4 localMatrix;
+		Matrix4x4 skeletonSpaceMatrix;
+		std::string name;
+		std::vector<int32_t> children;
+		int32_t index;
+		std::optional<int32_t> parent;
+	};
+
+	/// @brief 変更前の Skeleton 構造体
+	struct LegacySkeleton {
+		int32_t root;
+		std::map<std::string, int32_t> jointMap;
+		std::vector<LegacyJoint> joints;
+	};
+
+	/// @brief 現在の Skeleton を変更前の配置に変換
+	LegacySkeleton ToLegacySkeleton(const Skeleton& skeleton) {
+		LegacySkeleton legacy;
+		legacy.root = 0;
+		legacy.jointMap = skeleton.hierarchy->jointMap;
+		legacy.joints.resize(skeleton.GetJointCount());
+		for (size_t i = 0; i < skeleton.GetJointCount(); ++i) {
+			LegacyJoint& joint = legacy.joints[i];
+			joint.transform = skeleton.transforms[i];
+			joint.localMatrix = MathCore::Matrix::Identity();
+			joint.skeletonSpaceMatrix = skeleton.skeletonSpaceMatrices[i];
+			joint.name = skeleton.hierarchy->names[i];
+			joint.children = skeleton.hierarchy->children[i];
+			joint.index = static_cast<int32_t>(i);
+			if (skeleton.parents[i] >= 0) {
+				joint.parent = skeleton.parents[i];
+			}
+		}
+		return legacy;
+	}
+
+	/// @brief 変更前の AnimationPose::ApplyTo（ジョイントごとに変換を書き込み、親の有無で分岐して行列を更新）
+	void LegacyApplyPose(const AnimationPose& pose, LegacySkeleton& skeleton) {
+		for (size_t i = 0; i < skeleton.joints.size(); ++i) {
+			LegacyJoint& joint = skeleton.joints[i];
+			joint.transform = pose.transforms[i];
+			joint.localMatrix = MathCore::Matrix::MakeAffine(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+			if (joint.parent) {
+				joint.skeletonSpaceMatrix = MathCore::Matrix::Multiply(joint.localMatrix, skeleton.joints[*joint.parent].skeletonSpaceMatrix);
+			} else {
+				joint.skeletonSpaceMatrix = joint.localMatrix;
+			}
+		}
+	}
+
+	//================================================
+	// 入力データ
+	//================================================
+
+	/// @brief 二分木状のスケルトンを作成（親は必ず子より前に並ぶ）
+	/// 名前はDCCツールから読み込んだモデルに近い長さにして、文字列比較の負荷を実際に近づける
+	Skeleton CreateSkeleton(uint32_t jointCount) {
+		Skeleton skeleton;
+		auto hierarchy = std::make_shared<SkeletonHierarchy>();
+		skeleton.parents.resize(jointCount);
+		skeleton.transforms.resize(jointCount);
+		skeleton.skeletonSpaceMatrices.resize(jointCount, MathCore::Matrix::Identity());
+		hierarchy->names.resize(jointCount);
+		hierarchy->children.resize(jointCount);
+		for (uint32_t i = 0; i < jointCount; ++i) {
+			const int32_t index = static_cast<int32_t>(i);
+			hierarchy->names[i] = std::format("mixamorig:Joint_{:03}", i);
+			skeleton.transforms[i].scale = { 1.0f, 1.0f, 1.0f };
+			skeleton.transforms[i].rotate = MathCore::QuaternionMath::Identity();
+			skeleton.transforms[i].translate = { 0.0f, 0.1f, 0.0f };
+			skeleton.parents[i] = i > 0 ? static_cast<int32_t>((i - 1) / 2) : -1;
+			if (i > 0) {
+				hierarchy->children[skeleton.parents[i]].push_back(index);
+			}
+			hierarchy->jointMap.emplace(hierarchy->names[i], index);
+		}
+		skeleton.hierarchy = std::move(hierarchy);
+		return skeleton;
+	}
+
+	/// @brief スケルトンのジョイントを動かすアニメーションを作成
+	/// 末端のジョイントの一部はアニメーションを持たない（実際のモデルのエンドサイトなどを想定）
+	/// @param duration 尺（秒）
+	/// @param uniform true ならキーフレームを等間隔に、false なら間隔をばらつかせて並べる
+	/// @param seed 乱数の種（ブレンドの入力のように別の動きが必要な場合に変える）
+	Animation CreateAnimation(const Skeleton& skeleton, float duration = kClipDuration, bool uniform = true, uint32_t seed = kSeed) {
+		std::mt19937 engine(seed);
+		std::uniform_real_distribution<float> angle(-0.5f, 0.5f);
+		std::uniform_real_distribution<float> offset(-0.05f, 0.05f);
+		std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+
+		Animation animation;
+		animation.duration = duration;
+		const uint32_t keyframeCount = static_cast<uint32_t>(duration * kKeyframeRate) + 1;
+		for (size_t joint = 0; joint < skeleton.GetJointCount(); ++joint) {
+			if (joint % 8 == 7) {
+				continue;
+			}
+			NodeAnimation nodeAnimation;
+			for (uint32_t key = 0; key < keyframeCount; ++key) {
+				const bool isEnd = key == 0 || key + 1 == keyframeCount;
+				const float time = (key + (uniform || isEnd ? 0.0f : jitter(engine))) / kKeyframeRate;
+				const Vector3 axis = MathCore::Vector::Normalize({ angle(engine), 1.0f, angle(engine) });
+				nodeAnimation.translate.keyframes.push_back({ time, { offset(engine), 0.1f + offset(engine), offset(engine) } });
+				nodeAnimation.rotate.keyframes.push_back({ time, MathCore::QuaternionMath::MakeRotateAxisAngle(axis, angle(engine)) });
+				nodeAnimation.scale.keyframes.push_back({ time, { 1.0f, 1.0f, 1.0f } });
+			}
+			AnimationUtils::DetectKeyInterval(nodeAnimation.translate);
+			AnimationUtils::DetectKeyInterval(nodeAnimation.rotate);
+			AnimationUtils::DetectKeyInterval(nodeAnimation.scale);
+			animation.nodeAnimations.emplace(skeleton.hierarchy->names[joint], std::move(nodeAnimation));
+		}
+		return animation;
+	}
+
+	/// @brief ジョイントが周期的に揺れる滑らかなアニメーションを作成（一定のレートでベイクしたクリップを想定）
+	/// @param noise キーフレームごとに加える回転の揺らぎ（ラジアン。モーションキャプチャのノイズを想定）
+	Animation CreateSmoothAnimation(const Skeleton& skeleton, float duration, float noise) {
+		std::mt19937 engine(kSeed);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> frequency(0.2f, 1.5f);
+
+		Animation animation;
+		animation.duration = duration;
+		const uint32_t keyframeCount = static_cast<uint32_t>(duration * kKeyframeRate) + 1;
+		for (size_t joint = 0; joint < skeleton.GetJointCount(); ++joint) {
+			if (joint % 8 == 7) {
+				continue;
+			}
+			const Vector3 axis = MathCore::Vector::Normalize({ unit(engine), 1.0f, unit(engine) });
+			const float angularFrequency = frequency(engine) * 2.0f * std::numbers::pi_v<float>;
+			const float phase = unit(engine) * std::numbers::pi_v<float>;
+			// 根のジョイントだけ大きく移動させる（平行移動の範囲はクリップ全体で共有される）
+			const float travel = joint == 0 ? 5.0f : 0.0f;
+
+			NodeAnimation nodeAnimation;
+			for (uint32_t key = 0; key < keyframeCount; ++key) {
+				const float time = key / kKeyframeRate;
+				const float wave = std::sin(angularFrequency * time + phase);
+				const float angle = 0.6f * wave + noise * unit(engine);
+				nodeAnimation.translate.keyframes.push_back({ time, { travel * time / duration, 0.1f + 0.02f * wave, 0.0f } });
+				nodeAnimation.rotate.keyframes.push_back({ time, MathCore::QuaternionMath::MakeRotateAxisAngle(axis, angle) });
+				nodeAnimation.scale.keyframes.push_back({ time, { 1.0f, 1.0f, 1.0f } });
+			}
+			AnimationUtils::DetectKeyInterval(nodeAnimation.translate);
+			AnimationUtils::DetectKeyInterval(nodeAnimation.rotate);
+			AnimationUtils::DetectKeyInterval(nodeAnimation.scale);
+			animation.nodeAnimations.emplace(skeleton.hierarchy->names[joint], std::move(nodeAnimation));
+		}
+		return animation;
+	}
+
+	/// @brief スケルトン空間行列の要素ごとの差の最大値
+	float Difference(const Skeleton& a, const Skeleton& b) {
+		float maxError = 0.0f;
+		for (size_t joint = 0; joint < a.GetJointCount(); ++joint) {
+			const float* lhs = &a.skeletonSpaceMatrices[joint].m[0][0];
+			const float* rhs = &b.skeletonSpaceMatrices[joint].m[0][0];
+			for (int i = 0; i < 16; ++i) {
+				maxError = (std::max)(maxError, std::abs(lhs[i] - rhs[i]));
+			}
+		}
+		return maxError;
+	}
+
+	/// @brief スキニングのパレット（SkinCluster のCPU側。マップしたパレットは配列で代用し、逆バインドポーズは単位行列）
+	struct CpuSkinCluster {
+		std::vector<Matrix4x4> inverseBindPoseMatrices;
+		std::vector<Matrix4x4> skeletonSpaceMatrices;
+		std::vector<Matrix4x4> skeletonSpaceInverseTransposeMatrices;
+		std::vector<Matrix4x4> palette; // WellForGPU と同じく位置用・法線用の行列を交互に並べる
+
+		explicit CpuSkinCluster(uint32_t jointCount)
+			: inverseBindPoseMatrices(jointCount, MathCore::Matrix::Identity()),
+			skeletonSpaceMatrices(jointCount),
+			skeletonSpaceInverseTransposeMatrices(jointCount),
+			palette(jointCount * 2) {
+		}
+	};
+
+	/// @brief SkinClusterGenerator::Update と同じ手順でパレットを書き込む
+	void UpdatePalette(CpuSkinCluster& skinCluster, const Skeleton& skeleton) {
+		const size_t jointCount = skinCluster.skeletonSpaceMatrices.size();
+		for (size_t joint = 0; joint < jointCount; ++joint) {
+			skinCluster.skeletonSpaceMatrices[joint] = skeleton.skeletonSpaceMatrices[joint];
+		}
+		MathCore::Batch::MultiplyMatrices(skinCluster.inverseBindPoseMatrices, skinCluster.skeletonSpaceMatrices, skinCluster.skeletonSpaceMatrices);
+		MathCore::Batch::InverseTransposes(skinCluster.skeletonSpaceMatrices, skinCluster.skeletonSpaceInverseTransposeMatrices);
+		for (size_t joint = 0; joint < jointCount; ++joint) {
+			skinCluster.palette[joint * 2] = skinCluster.skeletonSpaceMatrices[joint];
+			skinCluster.palette[joint * 2 + 1] = skinCluster.skeletonSpaceInverseTransposeMatrices[joint];
+		}
+	}
+
+	/// @brief 変更前の実装と現在の実装を交互に複数回計測して最短の時間を採用する（実行順やクロック変動の影響を減らす）
+	template<typename LegacyFrame, typename CurrentFrame>
+	void MeasureBest(AnimationBenchmark::Result& result, uint32_t frameCount, LegacyFrame& legacyFrame, CurrentFrame& currentFrame) {
+		result.legacyMilliseconds = (std::numeric_limits<double>::max)();
+		result.currentMilliseconds = (std::numeric_limits<double>::max)();
+		for (uint32_t repeat = 0; repeat < kRepeatCount; ++repeat) {
+			result.legacyMilliseconds = (std::min)(result.legacyMilliseconds, MeasureMilliseconds(frameCount, legacyFrame));
+			result.currentMilliseconds = (std::min)(result.currentMilliseconds, MeasureMilliseconds(frameCount, currentFrame));
+		}
+	}
+
+	/// @brief 計測結果をログに出力
+	void LogResult(const AnimationBenchmark::Result& result) {
+		Logger::GetInstance().Log(
+			std::format("AnimationBenchmark: {} | legacy {:.3f} ms | current {:.3f} ms per frame | x{:.2f} | max error {:.2e}",
+				result.name, result.legacyMilliseconds, result.currentMilliseconds,
+				result.legacyMilliseconds / (std::max)(result.currentMilliseconds, 1e-9), result.maxError),
+			LogLevel::INFO, LogCategory::System);
+	}
+
+	/// @brief 変更前の実装と現在の SkeletonAnimator で同じアニメーションを再生して比較
+	/// @param legacyApply 変更前の実装（スケルトンと再生時刻を受け取って行列まで更新する）
+	template<typename LegacyApply>
+	AnimationBenchmark::Result Compare(std::string name, const Skeleton& skeleton, const Animation& animation,
+		uint32_t skeletonCount, uint32_t frameCount, LegacyApply&& legacyApply) {
+		AnimationBenchmark::Result result;
+		result.name = std::move(name);
+
+		// キャラクターごとに再生位置をずらす
+		std::vector<float> startTimes(skeletonCount);
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			startTimes[i] = animation.duration * i / skeletonCount;
+		}
+
+		// 変更前の実装（再生時刻の進め方は SkeletonAnimator::Update と同じ）
+		std::vector<Skeleton> legacySkeletons(skeletonCount, skeleton);
+		std::vector<float> legacyTimes = startTimes;
+		auto legacyFrame = [&]() {
+			for (uint32_t i = 0; i < skeletonCount; ++i) {
+				legacyTimes[i] = std::fmod(legacyTimes[i] + kDeltaTime, animation.duration);
+				legacyApply(legacySkeletons[i], legacyTimes[i]);
+			}
+		};
+
+		// 現在の SkeletonAnimator（対応付けは生成時に行うので計測に含めない）
+		std::vector<std::unique_ptr<SkeletonAnimator>> animators;
+		animators.reserve(skeletonCount);
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			auto animator = std::make_unique<SkeletonAnimator>(skeleton, animation);
+			animator->Update(startTimes[i]);
+			animators.push_back(std::move(animator));
+		}
+		auto currentFrame = [&]() {
+			for (auto& animator : animators) {
+				animator->Update(kDeltaTime);
+			}
+		};
+
+		MeasureBest(result, frameCount, legacyFrame, currentFrame);
+
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			result.maxError = (std::max)(result.maxError, Difference(legacySkeletons[i], animators[i]->GetSkeleton()));
+		}
+
+		LogResult(result);
+		return result;
+	}
+}
+
+AnimationBenchmark::Result AnimationBenchmark::RunChannelBinding(uint32_t skeletonCount, uint32_t jointCount, uint32_t frameCount) {
+	std::string name = std::format("Channel binding {} skeletons x {} joints (vs name lookup)", skeletonCount, jointCount);
+	if (skeletonCount == 0 || jointCount == 0 || frameCount == 0) {
+		return { std::move(name) };
+	}
+
+	const Skeleton skeleton = CreateSkeleton(jointCount);
+	const Animation animation = CreateAnimation(skeleton);
+	return Compare(std::move(name), skeleton, animation, skeletonCount, frameCount,
+		[&](Skeleton& target, float time) { LegacyApplyAnimation(target, animation, time); });
+}
+
+std::vector<AnimationBenchmark::Result> AnimationBenchmark::RunKeyframeCursor(uint32_t skeletonCount, uint32_t jointCount, float clipDuration, uint32_t frameCount) {
+	std::vector<Result> results;
+	if (skeletonCount == 0 || jointCount == 0 || frameCount == 0 || !(clipDuration > 0.0f)) {
+		return results;
+	}
+
+	const Skeleton skeleton = CreateSkeleton(jointCount);
+	const uint32_t keyframeCount = static_cast<uint32_t>(clipDuration * kKeyframeRate) + 1;
+
+	// 等間隔（一定レートでベイク）と不等間隔（カーソルの線形探索のみ）のカーブ
+	for (bool uniform : { true, false }) {
+		const Animation animation = CreateAnimation(skeleton, clipDuration, uniform);
+		const AnimationBinding binding = AnimationBinding::Create(skeleton, animation);
+		results.push_back(Compare(
+			std::format("Keyframe cursor {} {} keys, {} skeletons x {} joints (vs binary search)",
+				uniform ? "uniform" : "non-uniform", keyframeCount, skeletonCount, jointCount),
+			skeleton, animation, skeletonCount, frameCount,
+			[&](Skeleton& target, float time) { LegacyApplyAnimation(target, binding, time); }));
+	}
+
+	return results;
+}
+
+std::vector<AnimationBenchmark::CompressionResult> AnimationBenchmark::RunCompression(uint32_t skeletonCount, uint32_t jointCount, float clipDuration, uint32_t frameCount) {
+	std::vector<CompressionResult> results;
+	if (skeletonCount == 0 || jointCount == 0 || frameCount == 0 || !(clipDuration > 0.0f)) {
+		return results;
+	}
+
+	const Skeleton skeleton = CreateSkeleton(jointCount);
+
+	for (float noise : { 0.0f, 0.002f }) {
+		CompressionResult result;
+		result.name = std::format("{} {:.0f} s clip, {} joints", noise > 0.0f ? "noisy" : "smooth", clipDuration, jointCount);
+
+		// 圧縮前と圧縮後（元のキーフレームを持たない）のアニメーション
+		const Animation source = CreateSmoothAnimation(skeleton, clipDuration, noise);
+		Animation compressed;
+		compressed.duration = source.duration;
+		compressed.compressed = std::make_shared<CompressedAnimation>(AnimationCompressor::Compress(source, AnimationCompressor::Settings{}));
+		result.report = AnimationCompressor::Measure(source, *compressed.compressed);
+
+		// 同じ再生位置から両方を再生
+		std::vector<std::unique_ptr<SkeletonAnimator>> sourceAnimators;
+		std::vector<std::unique_ptr<SkeletonAnimator>> compressedAnimators;
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			const float startTime = clipDuration * i / skeletonCount;
+			sourceAnimators.push_back(std::make_unique<SkeletonAnimator>(skeleton, source));
+			sourceAnimators.back()->Update(startTime);
+			compressedAnimators.push_back(std::make_unique<SkeletonAnimator>(skeleton, compressed));
+			compressedAnimators.back()->Update(startTime);
+		}
+		auto playFrame = [](std::vector<std::unique_ptr<SkeletonAnimator>>& animators) {
+			return [&animators]() {
+				for (auto& animator : animators) {
+					animator->Update(kDeltaTime);
+				}
+			};
+		};
+
+		result.sourceMilliseconds = (std::numeric_limits<double>::max)();
+		result.compressedMilliseconds = (std::numeric_limits<double>::max)();
+		for (uint32_t repeat = 0; repeat < kRepeatCount; ++repeat) {
+			result.sourceMilliseconds = (std::min)(result.sourceMilliseconds, MeasureMilliseconds(frameCount, playFrame(sourceAnimators)));
+			result.compressedMilliseconds = (std::min)(result.compressedMilliseconds, MeasureMilliseconds(frameCount, playFrame(compressedAnimators)));
+		}
+
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			result.maxMatrixError = (std::max)(result.maxMatrixError, Difference(sourceAnimators[i]->GetSkeleton(), compressedAnimators[i]->GetSkeleton()));
+		}
+
+		const AnimationCompressor::Report& report = result.report;
+		Logger::GetInstance().Log(
+			std::format("AnimationBenchmark: compression {} | keys {} -> {} | {} -> {} bytes ({:.1f}%) | max error translate {:.2e}, rotate {:.3f} deg, scale {:.2e}, matrix {:.2e} | playback {:.3f} -> {:.3f} ms per frame",
+				result.name, report.sourceKeyCount, report.compressedKeyCount, report.sourceBytes, report.compressedBytes,
+				report.sourceBytes > 0 ? 100.0 * report.compressedBytes / report.sourceBytes : 0.0,
+				report.maxTranslateError, report.maxRotateErrorDegrees, report.maxScaleError, result.maxMatrixError,
+				result.sourceMilliseconds, result.compressedMilliseconds),
+			LogLevel::INFO, LogCategory::System);
+
+		results.push_back(std::move(result));
+	}
+
+	return results;
+}
+
+std::vector<AnimationBenchmark::Result> AnimationBenchmark::RunPoseBlend(uint32_t skeletonCount, uint32_t jointCount, uint32_t frameCount) {
+	std::vector<Result> results;
+	if (skeletonCount == 0 || jointCount == 0 || frameCount == 0) {
+		return results;
+	}
+
+	const Skeleton skeleton = CreateSkeleton(jointCount);
+
+	// 入力の数ごとの重み（合計は1）
+	const std::vector<std::vector<float>> weightSets = { { 0.7f, 0.3f }, { 0.4f, 0.3f, 0.2f, 0.1f } };
+	for (const std::vector<float>& weights : weightSets) {
+		const size_t inputCount = weights.size();
+		Result result;
+		result.name = std::format("Pose blend {} inputs, {} skeletons x {} joints (vs Skeleton copies)", inputCount, skeletonCount, jointCount);
+
+		// 入力ごとに別の動きのアニメーション
+		std::vector<Animation> animations;
+		for (size_t input = 0; input < inputCount; ++input) {
+			animations.push_back(CreateAnimation(skeleton, kClipDuration, true, kSeed + static_cast<uint32_t>(input)));
+		}
+
+		// キャラクターごと・入力ごとのアニメーター（変更前と現在で同じ再生位置から始める）
+		auto createAnimators = [&]() {
+			std::vector<std::vector<std::unique_ptr<SkeletonAnimator>>> animators(skeletonCount);
+			for (uint32_t i = 0; i < skeletonCount; ++i) {
+				for (const Animation& animation : animations) {
+					animators[i].push_back(std::make_unique<SkeletonAnimator>(skeleton, animation));
+					animators[i].back()->Update(kClipDuration * i / skeletonCount);
+				}
+			}
+			return animators;
+		};
+
+		// 変更前の実装（入力ごとにスケルトンの行列まで更新し、スケルトンを連鎖してブレンドする）
+		auto legacyAnimators = createAnimators();
+		std::vector<Skeleton> legacySkeletons(skeletonCount, skeleton);
+		auto legacyFrame = [&]() {
+			for (uint32_t i = 0; i < skeletonCount; ++i) {
+				for (auto& animator : legacyAnimators[i]) {
+					animator->Update(kDeltaTime);
+				}
+				float totalWeight = weights[0] + weights[1];
+				legacySkeletons[i] = LegacyBlendSkeletons(legacyAnimators[i][0]->GetSkeleton(), legacyAnimators[i][1]->GetSkeleton(), weights[1] / totalWeight);
+				for (size_t input = 2; input < inputCount; ++input) {
+					totalWeight += weights[input];
+					legacySkeletons[i] = LegacyBlendSkeletons(legacySkeletons[i], legacyAnimators[i][input]->GetSkeleton(), weights[input] / totalWeight);
+				}
+			}
+		};
+
+		// 現在の実装（入力はポーズだけを更新し、ポーズバッファ同士をブレンドしてから行列を計算）
+		auto currentAnimators = createAnimators();
+		std::vector<Skeleton> currentSkeletons(skeletonCount, skeleton);
+		std::vector<AnimationPose> blendedPoses(skeletonCount);
+		std::vector<std::vector<PoseBlender::WeightedPose>> blendInputs(skeletonCount);
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			blendedPoses[i].Reset(skeleton);
+			for (size_t input = 0; input < inputCount; ++input) {
+				blendInputs[i].push_back({ &currentAnimators[i][input]->GetPose(), weights[input] });
+			}
+		}
+		auto currentFrame = [&]() {
+			for (uint32_t i = 0; i < skeletonCount; ++i) {
+				for (auto& animator : currentAnimators[i]) {
+					animator->UpdatePose(kDeltaTime);
+				}
+				PoseBlender::Blend(blendInputs[i], blendedPoses[i]);
+				blendedPoses[i].ApplyTo(currentSkeletons[i]);
+			}
+		};
+
+		MeasureBest(result, frameCount, legacyFrame, currentFrame);
+
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			result.maxError = (std::max)(result.maxError, Difference(legacySkeletons[i], currentSkeletons[i]));
+		}
+
+		LogResult(result);
+		results.push_back(std::move(result));
+	}
+
+	return results;
+}
+
+AnimationBenchmark::Result AnimationBenchmark::RunAnimationLod(uint32_t skeletonCount, uint32_t jointCount, uint32_t frameCount) {
+	Result result;
+	result.name = std::format("Animation LOD {} skeletons x {} joints (vs every frame)", skeletonCount, jointCount);
+	if (skeletonCount == 0 || jointCount == 0 || frameCount == 0) {
+		return result;
+	}
+
+	const Skeleton skeleton = CreateSkeleton(jointCount);
+	const Animation animation = CreateAnimation(skeleton);
+
+	// 原点から +z を向くカメラ
+	const Matrix4x4 viewMatrix = MathCore::Matrix::Identity();
+	const Matrix4x4 projectionMatrix = MathCore::Rendering::PerspectiveFov(0.45f, 16.0f / 9.0f, 0.1f, 1000.0f);
+	constexpr float kBoundingRadius = 1.0f;
+
+	// スキニングのパレット（1スレッドで処理するので全キャラクターで共有する）
+	CpuSkinCluster skinCluster(jointCount);
+
+	// キャラクターを距離 2 ～ 80 に並べ、4体に1体はカメラの後ろに置く
+	struct Character {
+		Vector3 position;
+		std::unique_ptr<SkeletonAnimator> fullAnimator; // 毎フレーム評価する
+		std::unique_ptr<SkeletonAnimator> lodAnimator;  // アニメーションLODで評価する
+		AnimationLod lod;
+		Skeleton displayed; // LODで表示されるスケルトン（Model::skeleton_ に相当）
+	};
+	AnimationLodSettings settings;
+	settings.enabled = true;
+	std::vector<Character> characters(skeletonCount);
+	for (uint32_t i = 0; i < skeletonCount; ++i) {
+		Character& character = characters[i];
+		const float distance = 2.0f + 78.0f * i / skeletonCount;
+		character.position = { 0.0f, 0.0f, i % 4 == 3 ? -distance : distance };
+		character.fullAnimator = std::make_unique<SkeletonAnimator>(skeleton, animation);
+		character.lodAnimator = std::make_unique<SkeletonAnimator>(skeleton, animation);
+		character.lod.SetSettings(settings);
+		character.displayed = skeleton;
+	}
+
+	// 毎フレームの評価とパレット計算（変更前）
+	auto fullFrame = [&]() {
+		for (Character& character : characters) {
+			character.fullAnimator->Update(kDeltaTime);
+			UpdatePalette(skinCluster, character.fullAnimator->GetSkeleton());
+		}
+	};
+
+	// アニメーションLOD（Model::Draw と Model::UpdateAnimation の処理）
+	uint64_t updatedCount = 0;
+	uint64_t lodFrameCount = 0;
+	auto lodFrame = [&]() {
+		for (Character& character : characters) {
+			character.lod.SubmitView(character.position, kBoundingRadius, viewMatrix, projectionMatrix);
+			switch (character.lod.Advance(kDeltaTime)) {
+			case AnimationLod::Action::Evaluate:
+				character.lodAnimator->SetSkipLeafJoints(character.lod.GetCurrentLevel().skipLeafJoints);
+				character.lodAnimator->Update(character.lod.ConsumeDeltaTime());
+				for (uint32_t joint = 0; joint < jointCount; ++joint) {
+					character.displayed.skeletonSpaceMatrices[joint] = character.lodAnimator->GetSkeleton().skeletonSpaceMatrices[joint];
+					character.displayed.transforms[joint] = character.lodAnimator->GetSkeleton().transforms[joint];
+				}
+				character.lod.StoreEvaluatedPose(character.displayed);
+				UpdatePalette(skinCluster, character.displayed);
+				++updatedCount;
+				break;
+			case AnimationLod::Action::Interpolate:
+				character.lod.ApplyInterpolatedPose(character.displayed);
+				UpdatePalette(skinCluster, character.displayed);
+				++updatedCount;
+				break;
+			default:
+				break;
+			}
+		}
+		++lodFrameCount;
+	};
+
+	MeasureBest(result, frameCount, fullFrame, lodFrame);
+
+	// 両方の再生時刻を揃えてから、画面内のキャラクターの表示されるスケルトンを比較する
+	// （最後の評価からのフレーム数はキャラクターごとに異なるので、全体の最大誤差は間引きの遅れを含む）
+	float nearestLevelError = 0.0f;
+	for (Character& character : characters) {
+		if (character.position.z < 0.0f) {
+			continue;
+		}
+		const float error = Difference(character.fullAnimator->GetSkeleton(), character.displayed);
+		result.maxError = (std::max)(result.maxError, error);
+		if (character.lod.GetCurrentLevelIndex() == 0) {
+			nearestLevelError = (std::max)(nearestLevelError, error);
+		}
+	}
+
+	const double averageUpdated = lodFrameCount > 0 ? static_cast<double>(updatedCount) / lodFrameCount : 0.0;
+	result.name = std::format("Animation LOD {} skeletons x {} joints ({:.1f} updated per frame)", skeletonCount, jointCount, averageUpdated);
+	LogResult(result);
+	Logger::GetInstance().Log(
+		std::format("AnimationBenchmark: animation LOD | {:.1f} / {} skeletons updated per frame | max error at LOD 0 {:.2e}",
+			averageUpdated, skeletonCount, nearestLevelError),
+		LogLevel::INFO, LogCategory::System);
+
+	return result;
+}
+
+std::vector<AnimationBenchmark::Result> AnimationBenchmark::RunParallelEvaluation(uint32_t jointCount, uint32_t frameCount) {
+	std::vector<Result> results;
+	if (jointCount == 0 || frameCount == 0) {
+		return results;
+	}
+
+	const Skeleton skeleton = CreateSkeleton(jointCount);
+	const Animation animation = CreateAnimation(skeleton);
+
+	JobSystem jobSystem;
+	jobSystem.Initialize();
+
+	/// @brief 1体分の更新対象（Model のうちアニメーション更新に必要な部分のみ）
+	struct Character {
+		std::unique_ptr<SkeletonAnimator> animator;
+		CpuSkinCluster skinCluster;
+	};
+
+	for (uint32_t characterCount : { 50u, 200u, 1000u }) {
+		Result result;
+		result.name = std::format("Parallel evaluation {} characters x {} joints ({} threads vs 1)",
+			characterCount, jointCount, jobSystem.GetThreadCount());
+
+		// 再生時刻をずらした同じキャラクターを2組用意する
+		auto createCharacters = [&]() {
+			std::vector<Character> characters;
+			characters.reserve(characterCount);
+			for (uint32_t i = 0; i < characterCount; ++i) {
+				characters.push_back({ std::make_unique<SkeletonAnimator>(skeleton, animation), CpuSkinCluster(jointCount) });
+				characters.back().animator->Update(kClipDuration * i / characterCount);
+			}
+			return characters;
+		};
+		std::vector<Character> serialCharacters = createCharacters();
+		std::vector<Character> parallelCharacters = createCharacters();
+
+		auto updateCharacter = [](Character& character) {
+			character.animator->Update(kDeltaTime);
+			UpdatePalette(character.skinCluster, character.animator->GetSkeleton());
+		};
+
+		// 1スレッドで順に処理（変更前）
+		auto serialFrame = [&]() {
+			for (Character& character : serialCharacters) {
+				updateCharacter(character);
+			}
+		};
+
+		// Model::UpdateAnimationsAll と同じく、キャラクター単位でジョブに分散して全体の完了を待つ
+		auto parallelFrame = [&]() {
+			jobSystem.ParallelFor(characterCount, 1, [&](uint32_t begin, uint32_t end) {
+				for (uint32_t i = begin; i < end; ++i) {
+					updateCharacter(parallelCharacters[i]);
+				}
+			});
+		};
+
+		MeasureBest(result, frameCount, serialFrame, parallelFrame);
+
+		// 実行順序によらず結果が同じになること
+		for (uint32_t i = 0; i < characterCount; ++i) {
+			result.maxError = (std::max)(result.maxError,
+				Difference(serialCharacters[i].animator->GetSkeleton(), parallelCharacters[i].animator->GetSkeleton()));
+		}
+
+		LogResult(result);
+		results.push_back(std::move(result));
+	}
+
+	jobSystem.Finalize();
+	return results;
+}
+
+AnimationBenchmark::Result AnimationBenchmark::RunSkeletonLayout(uint32_t skeletonCount, uint32_t jointCount, uint32_t frameCount) {
+	Result result;
+	result.name = std::format("Skeleton layout {} skeletons x {} joints (vs Joint array)", skeletonCount, jointCount);
+	if (skeletonCount == 0 || jointCount == 0 || frameCount == 0) {
+		return result;
+	}
+
+	const Skeleton skeleton = CreateSkeleton(jointCount);
+	const Animation animation = CreateAnimation(skeleton);
+
+	// キャラクターごとに再生位置をずらしたポーズ（サンプリングは計測に含めない）
+	std::vector<AnimationPose> poses(skeletonCount);
+	for (uint32_t i = 0; i < skeletonCount; ++i) {
+		SkeletonAnimator animator(skeleton, animation);
+		animator.UpdatePose(kClipDuration * i / skeletonCount);
+		poses[i] = animator.GetPose();
+	}
+
+	// 変更前の配置（Joint の配列）
+	std::vector<LegacySkeleton> legacySkeletons(skeletonCount, ToLegacySkeleton(skeleton));
+	auto legacyFrame = [&]() {
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			LegacyApplyPose(poses[i], legacySkeletons[i]);
+		}
+	};
+
+	// 現在の配置（親のIndex・変換・行列のそれぞれの配列）
+	std::vector<Skeleton> skeletons(skeletonCount, skeleton);
+	auto currentFrame = [&]() {
+		for (uint32_t i = 0; i < skeletonCount; ++i) {
+			poses[i].ApplyTo(skeletons[i]);
+		}
+	};
+
+	MeasureBest(result, frameCount, legacyFrame, currentFrame);
+
+	for (uint32_t i = 0; i < skeletonCount; ++i) {
+		for (uint32_t joint = 0; joint < jointCount; ++joint) {
+			const float* lhs = &legacySkeletons[i].joints[joint].skeletonSpaceMatrix.m[0][0];
+			const float* rhs = &skeletons[i].skeletonSpaceMatrices[joint].m[0][0];
+			for (int element = 0; element < 16; ++element) {
+				result.maxError = (std::max)(result.maxError, std::abs(lhs[element] - rhs[element]));
+			}
+		}
+	}
+
+	LogResult(result);
+	return result;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Engine/Graphics/Model/Animation/AnimationCompressor.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief スケルトンアニメーション評価のベンチマーク（GPU不要）
+/// 合成したスケルトンとアニメーションを多数のキャラクター分再生し、
+/// 変更前の実装（比較用にベンチマーク内へ保持）と現在の SkeletonAnimator を1フレームあたりの時間で比較する
+class AnimationBenchmark {
+public:
+	/// @brief 計測結果
+	struct Result {
+		std::string name;               // 計測内容
+		double legacyMilliseconds = 0;  // 1フレームあたりの時間（変更前の実装）
+		double currentMilliseconds = 0; // 1フレームあたりの時間（現在の実装）
+		float maxError = 0.0f;          // 最終フレームのスケルトン空間行列の要素ごとの差の最大値
+	};
+
+	/// @brief 圧縮アニメーションの計測結果
+	struct CompressionResult {
+		std::string name;                 // クリップの内容
+		AnimationCompressor::Report report; // 圧縮のレポート（キーフレーム数・サイズ・カーブの最大誤差）
+		double sourceMilliseconds = 0;    // 1フレームあたりの再生時間（圧縮前）
+		double compressedMilliseconds = 0;// 1フレームあたりの再生時間（圧縮後）
+		float maxMatrixError = 0.0f;      // スケルトン空間行列の要素ごとの差の最大値
+	};
+
+	/// @brief チャンネルの対応付け（名前の検索 → ジョイントのIndex）のベンチマークを実行
+	/// @param skeletonCount 再生するスケルトンの数
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param frameCount 計測するフレーム数
+	/// @return 計測結果（ログにも出力される）
+	static Result RunChannelBinding(uint32_t skeletonCount = 500, uint32_t jointCount = 64, uint32_t frameCount = 60);
+
+	/// @brief キーフレーム探索のカーソル（二分探索 → 前回の区間から線形に探索）のベンチマークを実行
+	/// キーフレームが等間隔のカーブと不等間隔のカーブでそれぞれ計測する
+	/// @param skeletonCount 再生するスケルトンの数
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param clipDuration アニメーションの尺（秒。キーフレームは30fps）
+	/// @param frameCount 計測するフレーム数
+	/// @return カーブの種類ごとの計測結果（ログにも出力される）
+	static std::vector<Result> RunKeyframeCursor(uint32_t skeletonCount = 200, uint32_t jointCount = 64, float clipDuration = 120.0f, uint32_t frameCount = 60);
+
+	/// @brief アニメーションの圧縮（キーフレームの削減と量子化）のベンチマークを実行
+	/// 滑らかなクリップとノイズを含むクリップ（モーションキャプチャ相当）を圧縮し、サイズ・誤差と再生時間を比較する
+	/// @param skeletonCount 再生するスケルトンの数
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param clipDuration アニメーションの尺（秒。キーフレームは30fps）
+	/// @param frameCount 計測するフレーム数
+	/// @return クリップごとの計測結果（ログにも出力される）
+	static std::vector<CompressionResult> RunCompression(uint32_t skeletonCount = 200, uint32_t jointCount = 64, float clipDuration = 10.0f, uint32_t frameCount = 60);
+
+	/// @brief ポーズのブレンド（Skeleton のコピー → ポーズバッファへの書き込み）のベンチマークを実行
+	/// 2つのアニメーションのブレンド（クロスフェード）と4つのアニメーションのブレンド（ブレンドツリー相当）を計測する
+	/// 変更前の実装で3つ以上をブレンドする場合は、BlendSkeletons を連鎖させる
+	/// @param skeletonCount 再生するスケルトンの数
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param frameCount 計測するフレーム数
+	/// @return 入力の数ごとの計測結果（ログにも出力される）
+	static std::vector<Result> RunPoseBlend(uint32_t skeletonCount = 200, uint32_t jointCount = 64, uint32_t frameCount = 60);
+
+	/// @brief アニメーションLOD（AnimationLodSettings の既定値）のベンチマークを実行
+	/// カメラからの距離を変えて並べたキャラクター（一部は画面外）を、毎フレームの評価・パレット計算と比較する
+	/// 最大誤差は画面内のキャラクターの表示されるスケルトンの差（間引き・補間の遅れ・末端のジョイントの省略を含む）
+	/// @param skeletonCount 再生するスケルトンの数
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param frameCount 計測するフレーム数
+	/// @return 計測結果（1フレームあたりの平均の更新数はログに出力される）
+	static Result RunAnimationLod(uint32_t skeletonCount = 200, uint32_t jointCount = 64, uint32_t frameCount = 60);
+
+	/// @brief スケルトンの評価とパレットの書き込み（Model::UpdateAnimationsAll）の並列化のベンチマークを実行
+	/// 50 / 200 / 1000 体について、1スレッドで順に処理する場合と JobSystem（ハードウェアスレッド数）に分散する場合を比較する
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param frameCount 計測するフレーム数
+	/// @return キャラクター数ごとの計測結果（ログにも出力される）
+	static std::vector<Result> RunParallelEvaluation(uint32_t jointCount = 64, uint32_t frameCount = 60);
+
+	/// @brief スケルトンのジョイントの配置（Joint の配列 → 親のIndex・変換・行列のそれぞれの配列）のベンチマークを実行
+	/// サンプリング済みのポーズをスケルトンに書き込み、スケルトン空間行列を更新する処理（AnimationPose::ApplyTo）を比較する
+	/// @param skeletonCount スケルトンの数
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param frameCount 計測するフレーム数
+	/// @return 計測結果（ログにも出力される）
+	static Result RunSkeletonLayout(uint32_t skeletonCount = 200, uint32_t jointCount = 64, uint32_t frameCount = 60);
+};
@@ -23,4 +23,9 @@ public:
     /// @brief アニメーションが終了したか確認
     /// @return アニメーションが終了していればtrue
     virtual bool IsFinished() const = 0;
+
+    /// @brief 末端のジョイント（子を持たない）のアニメーションを省略するか設定（アニメーションLOD用）
+    /// スケルトンを持たないコントローラーでは何もしない
+    /// @param skip 省略するか
+    virtual void SetSkipLeafJoints(bool skip) { (void)skip; }
 };
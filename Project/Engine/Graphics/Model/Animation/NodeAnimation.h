@@ -5,6 +5,7 @@
 template<typename tValue>
 struct AnimationCurve {
 	std::vector<Keyframe<tValue>> keyframes; //!< キーフレームの配列
+	float keyInterval = 0.0f;                //!< キーフレームが等間隔の場合の間隔(秒)。0なら不等間隔（AnimationUtils::DetectKeyIntervalで設定）
 };
 
 struct NodeAnimation {
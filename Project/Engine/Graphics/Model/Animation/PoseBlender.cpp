@@ -0,0 +1,48 @@
+#include "PoseBlender.h"
+#include "Engine/Math/MathCore.h"
+#include "Engine/Utility/Collision/CollisionUtils.h"
+#include <algorithm>
+
+void PoseBlender::Blend(const AnimationPose& pose1, const AnimationPose& pose2, float weight, AnimationPose& result) {
+    // ジョイント数が揃っていれば resize は何もしない（メモリ確保なし）
+    const size_t jointCount = (std::min)(pose1.transforms.size(), pose2.transforms.size());
+    result.transforms.resize(jointCount);
+
+    for (size_t i = 0; i < jointCount; ++i) {
+        const QuaternionTransform& transform1 = pose1.transforms[i];
+        const QuaternionTransform& transform2 = pose2.transforms[i];
+        QuaternionTransform& blended = result.transforms[i];
+
+        // 平行移動の線形補間
+        blended.translate = CollisionUtils::Lerp(transform1.translate, transform2.translate, weight);
+
+        // 回転のSlerp（球面線形補間）
+        blended.rotate = MathCore::QuaternionMath::Slerp(transform1.rotate, transform2.rotate, weight);
+
+        // スケールの線形補間
+        blended.scale = CollisionUtils::Lerp(transform1.scale, transform2.scale, weight);
+    }
+}
+
+void PoseBlender::Blend(std::span<const WeightedPose> inputs, AnimationPose& result) {
+    float totalWeight = 0.0f;
+    bool hasResult = false;
+    for (const WeightedPose& input : inputs) {
+        if (!input.pose || !(input.weight > 0.0f)) {
+            continue;
+        }
+
+        totalWeight += input.weight;
+        if (!hasResult) {
+            // 最初の有効な入力はそのままコピー（同じバッファなら何もしない）
+            if (input.pose != &result) {
+                result.transforms.assign(input.pose->transforms.begin(), input.pose->transforms.end());
+            }
+            hasResult = true;
+            continue;
+        }
+
+        // これまでの結果（重み totalWeight - weight）と今回の入力を補間する
+        Blend(result, *input.pose, input.weight / totalWeight, result);
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "AnimationPose.h"
+#include <span>
+
+/// @brief ポーズのブレンド（平行移動・スケールは線形補間、回転は球面線形補間）
+/// 結果は呼び出し側が用意したポーズに書き込むので、毎フレームのメモリ確保は発生しない
+namespace PoseBlender {
+
+/// @brief 重み付きの入力ポーズ
+struct WeightedPose {
+    const AnimationPose* pose = nullptr;
+    float weight = 0.0f;
+};
+
+/// @brief 2つのポーズをブレンド
+/// @param pose1 ポーズ1
+/// @param pose2 ポーズ2
+/// @param weight ポーズ2の重み（0.0～1.0）
+/// @param result 結果の書き込み先（pose1 または pose2 と同じでもよい）
+void Blend(const AnimationPose& pose1, const AnimationPose& pose2, float weight, AnimationPose& result);
+
+/// @brief 任意の数のポーズを重みに応じてブレンド（ブレンドツリー用）
+/// 入力を順に累積し、各入力はそれまでの重みの合計に対する割合で補間する
+/// 2入力の場合は Blend(pose1, pose2, weight) と同じ結果になる。重みの合計は1でなくてよい
+/// @param inputs 入力（重みが0以下のものは無視する。有効な入力がなければ result は変更しない）
+/// @param result 結果の書き込み先（最初の入力と同じでもよいが、2番目以降の入力とは別にすること）
+void Blend(std::span<const WeightedPose> inputs, AnimationPose& result);
+
+} // namespace PoseBlender
@@ -0,0 +1,220 @@
+#include "CookedModel.h"
+
+using namespace CookedModelFormat;
+
+namespace {
+
+/// @brief セクションの要素のサイズ（SectionType の順）
+constexpr size_t kElementSizes[kSectionCount] = {
+	sizeof(VertexData),
+	sizeof(int32_t),
+	sizeof(char),
+	sizeof(CookedNode),
+	sizeof(CookedJointWeight),
+	sizeof(VertexWeightData),
+	sizeof(CookedChannel),
+	sizeof(KeyframeVector3),
+	sizeof(KeyframeQuaternion),
+	sizeof(KeyframeVector3),
+};
+
+/// @brief 範囲が配列に収まっているか
+bool IsInRange(uint64_t first, uint64_t count, size_t size) {
+	return first <= size && count <= size - first;
+}
+
+template<typename tValue>
+void BuildCurve(AnimationCurve<tValue>& curve, std::span<const Keyframe<tValue>> keys, const KeyRange& range) {
+	const auto begin = keys.begin() + range.first;
+	curve.keyframes.assign(begin, begin + range.count);
+	curve.keyInterval = range.keyInterval;
+}
+
+} // namespace
+
+bool CookedModel::Open(const std::string& sourcePath)
+{
+	Close();
+
+	if (!file_.Open(GetCookedPath(sourcePath)) || !Attach(file_.GetData(), file_.GetSize())) {
+		Close();
+		return false;
+	}
+
+	// 元ファイルが焼き込み後に更新されていたら使わない
+	SourceStamp source;
+	if (ReadSourceStamp(sourcePath, source) &&
+		(source.size != header_->source.size || source.writeTime != header_->source.writeTime)) {
+		Close();
+		return false;
+	}
+	return true;
+}
+
+bool CookedModel::OpenMemory(const std::byte* data, size_t size)
+{
+	Close();
+	return Attach(data, size);
+}
+
+void CookedModel::Close()
+{
+	header_ = nullptr;
+	data_ = nullptr;
+	size_ = 0;
+	file_.Close();
+}
+
+MaterialData CookedModel::BuildMaterial() const
+{
+	MaterialData material;
+	material.textureFilePath = GetString(header_->textureFilePath);
+	return material;
+}
+
+Node CookedModel::BuildRootNode() const
+{
+	const std::span<const CookedNode> nodes = GetSection<CookedNode>(SectionType::Nodes);
+	if (nodes.empty()) {
+		return {};
+	}
+	size_t index = 0;
+	return BuildNode(nodes, index);
+}
+
+std::map<std::string, JointWeightData> CookedModel::BuildSkinClusterData() const
+{
+	const std::span<const VertexWeightData> vertexWeights = GetSection<VertexWeightData>(SectionType::VertexWeights);
+
+	std::map<std::string, JointWeightData> skinClusterData;
+	for (const CookedJointWeight& joint : GetSection<CookedJointWeight>(SectionType::Joints)) {
+		JointWeightData& jointWeightData = skinClusterData[std::string(GetString(joint.name))];
+		jointWeightData.inverseBindPoseMatrix = joint.inverseBindPoseMatrix;
+		jointWeightData.vertexWeights.assign(
+			vertexWeights.begin() + joint.firstWeight,
+			vertexWeights.begin() + joint.firstWeight + joint.weightCount);
+	}
+	return skinClusterData;
+}
+
+Animation CookedModel::BuildAnimation() const
+{
+	const std::span<const KeyframeVector3> translateKeys = GetSection<KeyframeVector3>(SectionType::TranslateKeys);
+	const std::span<const KeyframeQuaternion> rotateKeys = GetSection<KeyframeQuaternion>(SectionType::RotateKeys);
+	const std::span<const KeyframeVector3> scaleKeys = GetSection<KeyframeVector3>(SectionType::ScaleKeys);
+
+	Animation animation{};
+	animation.duration = header_->animationDuration;
+	for (const CookedChannel& channel : GetSection<CookedChannel>(SectionType::Channels)) {
+		NodeAnimation& nodeAnimation = animation.nodeAnimations[std::string(GetString(channel.nodeName))];
+		BuildCurve(nodeAnimation.translate, translateKeys, channel.translate);
+		BuildCurve(nodeAnimation.rotate, rotateKeys, channel.rotate);
+		BuildCurve(nodeAnimation.scale, scaleKeys, channel.scale);
+	}
+	return animation;
+}
+
+bool CookedModel::Attach(const std::byte* data, size_t size)
+{
+	if (!data || size < sizeof(Header)) {
+		return false;
+	}
+	data_ = data;
+	size_ = size;
+	header_ = reinterpret_cast<const Header*>(data);
+
+	if (!Validate()) {
+		header_ = nullptr;
+		data_ = nullptr;
+		size_ = 0;
+		return false;
+	}
+	return true;
+}
+
+std::string_view CookedModel::GetString(const StringRef& ref) const
+{
+	const std::span<const char> strings = GetSection<char>(SectionType::Strings);
+	return { strings.data() + ref.offset, ref.length };
+}
+
+Node CookedModel::BuildNode(std::span<const CookedNode> nodes, size_t& index) const
+{
+	const CookedNode& cookedNode = nodes[index++];
+
+	Node node;
+	node.transform = cookedNode.transform;
+	node.localMatrix = cookedNode.localMatrix;
+	node.name = GetString(cookedNode.name);
+	node.children.resize(cookedNode.childCount);
+	for (Node& child : node.children) {
+		child = BuildNode(nodes, index);
+	}
+	return node;
+}
+
+bool CookedModel::Validate() const
+{
+	if (header_->magic != kMagic || header_->version != kVersion || header_->vertexStride != sizeof(VertexData)) {
+		return false;
+	}
+
+	// セクションがファイルに収まっていて、要素の境界が合っているか
+	for (uint32_t index = 0; index < kSectionCount; ++index) {
+		const Section& section = header_->sections[index];
+		if (section.offset % kSectionAlignment != 0 || section.offset < sizeof(Header) ||
+			!IsInRange(section.offset, section.size, size_) || section.size % kElementSizes[index] != 0) {
+			return false;
+		}
+	}
+
+	// セクション間の参照が範囲内か（壊れたファイルで範囲外を読まないように、開く時に一度だけ確認する）
+	const size_t stringSize = GetSection<char>(SectionType::Strings).size();
+	auto isValidString = [stringSize](const StringRef& ref) { return IsInRange(ref.offset, ref.length, stringSize); };
+	if (!isValidString(header_->textureFilePath)) {
+		return false;
+	}
+
+	// Nodeは行きがけ順で、各Nodeの子の部分木が配列の残りに収まっていること
+	const std::span<const CookedNode> nodes = GetSection<CookedNode>(SectionType::Nodes);
+	size_t pendingNodeCount = nodes.empty() ? 0 : 1; // まだ現れていないNodeの数（根から数える）
+	for (const CookedNode& node : nodes) {
+		if (pendingNodeCount == 0 || !isValidString(node.name)) {
+			return false;
+		}
+		pendingNodeCount = pendingNodeCount - 1 + node.childCount;
+		if (pendingNodeCount > nodes.size()) {
+			return false;
+		}
+	}
+	if (pendingNodeCount != 0) {
+		return false;
+	}
+
+	const size_t vertexCount = GetVertices().size();
+	const size_t vertexWeightCount = GetSection<VertexWeightData>(SectionType::VertexWeights).size();
+	for (const CookedJointWeight& joint : GetSection<CookedJointWeight>(SectionType::Joints)) {
+		if (!isValidString(joint.name) || !IsInRange(joint.firstWeight, joint.weightCount, vertexWeightCount)) {
+			return false;
+		}
+	}
+	// ウェイトの頂点IndexはCPUでの書き込み先になるので確認する（インデックスはGPUへ渡すだけなので確認しない）
+	for (const VertexWeightData& vertexWeight : GetSection<VertexWeightData>(SectionType::VertexWeights)) {
+		if (vertexWeight.vertexIndex >= vertexCount) {
+			return false;
+		}
+	}
+
+	const size_t translateKeyCount = GetSection<KeyframeVector3>(SectionType::TranslateKeys).size();
+	const size_t rotateKeyCount = GetSection<KeyframeQuaternion>(SectionType::RotateKeys).size();
+	const size_t scaleKeyCount = GetSection<KeyframeVector3>(SectionType::ScaleKeys).size();
+	for (const CookedChannel& channel : GetSection<CookedChannel>(SectionType::Channels)) {
+		if (!isValidString(channel.nodeName) ||
+			!IsInRange(channel.translate.first, channel.translate.count, translateKeyCount) ||
+			!IsInRange(channel.rotate.first, channel.rotate.count, rotateKeyCount) ||
+			!IsInRange(channel.scale.first, channel.scale.count, scaleKeyCount)) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "CookedModelFormat.h"
+#include "Engine/Graphics/Structs/ModelData.h"
+#include "Engine/Graphics/Model/Animation/Animation.h"
+#include "Engine/Utility/MappedFile/MappedFile.h"
+
+/// @brief 焼き込みモデルファイル（CookedModelFormat）を読むクラス
+/// ファイルをメモリマップし、頂点・インデックスはマップしたメモリをそのまま span で返す
+/// Node階層・スキン情報・アニメーションは、エンジンの構造体（std::map など）に組み立てて返す
+/// span は CookedModel を破棄するか Close するまで有効
+class CookedModel {
+public:
+	/// @brief 焼き込みファイルを開く
+	/// 形式やバージョンが違う場合、元ファイルが焼き込み後に更新されている場合は失敗する
+	/// 元ファイルがない場合（焼き込みファイルだけを配布する場合）はそのまま使う
+	/// @param sourcePath 元のモデルファイルのパス（焼き込みファイルはこの隣にあるもの）
+	/// @return 使えるファイルを開けたらtrue
+	bool Open(const std::string& sourcePath);
+
+	/// @brief メモリ上の焼き込みデータを開く（ファイルを使わない。ベンチマーク・確認用）
+	/// @param data 焼き込みデータ（CookedModel より長く生存すること）
+	/// @param size サイズ（バイト）
+	/// @return 形式が正しければtrue
+	bool OpenMemory(const std::byte* data, size_t size);
+
+	/// @brief ファイルを閉じる
+	void Close();
+
+	/// @brief 開いているか
+	bool IsOpen() const { return header_ != nullptr; }
+
+	/// @brief 焼き込みファイルのサイズ（バイト）
+	size_t GetSize() const { return size_; }
+
+	/// @brief 頂点データ（マップしたメモリを直接指す）
+	std::span<const VertexData> GetVertices() const { return GetSection<VertexData>(CookedModelFormat::SectionType::Vertices); }
+
+	/// @brief インデックスデータ（マップしたメモリを直接指す）
+	std::span<const int32_t> GetIndices() const { return GetSection<int32_t>(CookedModelFormat::SectionType::Indices); }
+
+	/// @brief マテリアルデータを作成
+	MaterialData BuildMaterial() const;
+
+	/// @brief Node階層を作成
+	Node BuildRootNode() const;
+
+	/// @brief スキンクラスター（ジョイントと頂点のウェイト情報）を作成
+	std::map<std::string, JointWeightData> BuildSkinClusterData() const;
+
+	/// @brief アニメーションを含んでいるか
+	bool HasAnimation() const { return header_ && (header_->flags & CookedModelFormat::kHasAnimation); }
+
+	/// @brief アニメーションを作成（HasAnimation が true の場合のみ）
+	Animation BuildAnimation() const;
+
+private:
+	/// @brief セクションを要素の配列として取得
+	template<typename T>
+	std::span<const T> GetSection(CookedModelFormat::SectionType type) const {
+		if (!header_) {
+			return {};
+		}
+		const CookedModelFormat::Section& section = header_->sections[static_cast<uint32_t>(type)];
+		return { reinterpret_cast<const T*>(data_ + section.offset), static_cast<size_t>(section.size / sizeof(T)) };
+	}
+
+	/// @brief Strings セクションの文字列を取得
+	std::string_view GetString(const CookedModelFormat::StringRef& ref) const;
+
+	/// @brief 行きがけ順のNode配列から部分木を作成
+	/// @param index 作成するNodeのIndex（作成後は次の部分木の先頭を指す）
+	Node BuildNode(std::span<const CookedModelFormat::CookedNode> nodes, size_t& index) const;
+
+	/// @brief 焼き込みデータを設定して確認する
+	bool Attach(const std::byte* data, size_t size);
+
+	/// @brief ヘッダーとセクション表を確認
+	bool Validate() const;
+
+	MappedFile file_;
+	const std::byte* data_ = nullptr;
+	size_t size_ = 0;
+	const CookedModelFormat::Header* header_ = nullptr;
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+
+#include "Engine/Graphics/Structs/ModelData.h"
+#include "Engine/Graphics/Structs/VertexData.h"
+#include "Engine/Graphics/Model/Animation/Keyframe.h"
+
+/// @brief 焼き込みモデルファイル（.cooked）の形式
+/// ModelCooker が書き出し、CookedModel がメモリマップして読む
+/// ファイルは Header と、Header のセクション表が指すセクションで構成される
+/// 各セクションは同じ型の要素の配列で、そのままポインタを向けて使えるように16バイト境界に置く
+/// 構造体はエンジンのメモリレイアウトのまま書き出すので、別のプラットフォーム・コンパイラとの互換性はない
+namespace CookedModelFormat {
+
+constexpr uint32_t kMagic = 0x4C444D43;     // "CMDL"
+constexpr uint32_t kVersion = 2;            // 形式・中身を変えたら上げる（古いファイルは作り直される。2: MeshOptimizer で最適化した頂点・インデックス）
+constexpr uint64_t kSectionAlignment = 16;  // セクションの先頭の境界
+constexpr const char* kExtension = ".cooked";
+
+/// @brief Header のフラグ
+enum HeaderFlags : uint32_t {
+	kHasAnimation = 1u << 0, // 最初のアニメーションを含む
+};
+
+/// @brief セクションの種類（セクション表のIndex）
+enum class SectionType : uint32_t {
+	Vertices,          // VertexData
+	Indices,           // int32_t
+	Strings,           // char（名前・パスの文字列をつなげたもの。StringRef で参照する）
+	Nodes,             // CookedNode（Node階層を行きがけ順に並べたもの）
+	Joints,            // CookedJointWeight
+	VertexWeights,     // VertexWeightData（CookedJointWeight から範囲で参照する）
+	Channels,          // CookedChannel
+	TranslateKeys,     // KeyframeVector3
+	RotateKeys,        // KeyframeQuaternion
+	ScaleKeys,         // KeyframeVector3
+	Count
+};
+
+constexpr uint32_t kSectionCount = static_cast<uint32_t>(SectionType::Count);
+
+/// @brief ファイル内の範囲
+struct Section {
+	uint64_t offset = 0; // ファイル先頭からのオフセット（バイト）
+	uint64_t size = 0;   // サイズ（バイト）
+};
+
+/// @brief Strings セクション内の文字列
+struct StringRef {
+	uint32_t offset = 0;
+	uint32_t length = 0;
+};
+
+/// @brief 元のモデルファイルの情報（元ファイルが更新されたら焼き込みファイルを作り直す）
+struct SourceStamp {
+	uint64_t size = 0;       // ファイルサイズ
+	int64_t writeTime = 0;   // 最終更新時刻（std::filesystem::file_time_type のカウント）
+};
+
+/// @brief ファイルの先頭
+struct Header {
+	uint32_t magic = kMagic;
+	uint32_t version = kVersion;
+	uint32_t vertexStride = sizeof(VertexData); // 頂点のレイアウトが変わっていないかの確認用
+	uint32_t flags = 0;                         // HeaderFlags
+	SourceStamp source;                         // 焼き込んだ時の元ファイルの情報
+	StringRef textureFilePath;                  // マテリアルのテクスチャパス
+	float animationDuration = 0.0f;             // アニメーションの尺（秒）
+	uint32_t reserved = 0;
+	Section sections[kSectionCount];
+};
+
+/// @brief Node（子は直後に childCount 個の部分木として並ぶ）
+struct CookedNode {
+	QuaternionTransform transform;
+	Matrix4x4 localMatrix;
+	StringRef name;
+	uint32_t childCount = 0;
+};
+
+/// @brief ジョイントのスキン情報
+struct CookedJointWeight {
+	Matrix4x4 inverseBindPoseMatrix;
+	StringRef name;
+	uint32_t firstWeight = 0; // VertexWeights セクションの開始Index
+	uint32_t weightCount = 0;
+};
+
+/// @brief キーフレームの範囲
+struct KeyRange {
+	uint32_t first = 0;
+	uint32_t count = 0;
+	float keyInterval = 0.0f; // AnimationCurve::keyInterval
+};
+
+/// @brief ノードアニメーション
+struct CookedChannel {
+	StringRef nodeName;
+	KeyRange translate; // TranslateKeys セクションの範囲
+	KeyRange rotate;    // RotateKeys セクションの範囲
+	KeyRange scale;     // ScaleKeys セクションの範囲
+};
+
+static_assert(std::is_trivially_copyable_v<VertexData>);
+static_assert(std::is_trivially_copyable_v<VertexWeightData>);
+static_assert(std::is_trivially_copyable_v<KeyframeVector3>);
+static_assert(std::is_trivially_copyable_v<KeyframeQuaternion>);
+static_assert(std::is_trivially_copyable_v<CookedNode>);
+static_assert(sizeof(Header) % kSectionAlignment == 0);
+
+/// @brief 焼き込みファイルのパス（元ファイルの隣に置く）
+/// @param sourcePath 元のモデルファイルのパス
+inline std::string GetCookedPath(const std::string& sourcePath) {
+	return sourcePath + kExtension;
+}
+
+/// @brief 元ファイルの情報を取得
+/// @param sourcePath 元のモデルファイルのパス
+/// @param outStamp 取得した情報
+/// @return 元ファイルが存在すればtrue
+inline bool ReadSourceStamp(const std::string& sourcePath, SourceStamp& outStamp) {
+	std::error_code error;
+	const std::filesystem::path path(sourcePath);
+	const uint64_t size = std::filesystem::file_size(path, error);
+	if (error) {
+		return false;
+	}
+	const auto writeTime = std::filesystem::last_write_time(path, error);
+	if (error) {
+		return false;
+	}
+	outStamp.size = size;
+	outStamp.writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+	return true;
+}
+
+} // namespace CookedModelFormat
@@ -0,0 +1,158 @@
+#include "ModelCooker.h"
+#include "Engine/Utility/Logger/Logger.h"
+
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+using namespace CookedModelFormat;
+
+namespace {
+
+/// @brief セクションごとの配列を組み立てる
+struct CookedSections {
+	std::string strings;
+	std::vector<CookedNode> nodes;
+	std::vector<CookedJointWeight> joints;
+	std::vector<VertexWeightData> vertexWeights;
+	std::vector<CookedChannel> channels;
+	std::vector<KeyframeVector3> translateKeys;
+	std::vector<KeyframeQuaternion> rotateKeys;
+	std::vector<KeyframeVector3> scaleKeys;
+
+	StringRef AddString(const std::string& text) {
+		const StringRef ref{ static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(text.size()) };
+		strings += text;
+		return ref;
+	}
+
+	/// @brief Nodeを行きがけ順に追加（子は親の直後に並ぶ）
+	void AddNode(const Node& node) {
+		CookedNode cookedNode{};
+		cookedNode.transform = node.transform;
+		cookedNode.localMatrix = node.localMatrix;
+		cookedNode.name = AddString(node.name);
+		cookedNode.childCount = static_cast<uint32_t>(node.children.size());
+		nodes.push_back(cookedNode);
+
+		for (const Node& child : node.children) {
+			AddNode(child);
+		}
+	}
+
+	template<typename tValue>
+	static KeyRange AddKeys(const AnimationCurve<tValue>& curve, std::vector<Keyframe<tValue>>& keys) {
+		const KeyRange range{ static_cast<uint32_t>(keys.size()), static_cast<uint32_t>(curve.keyframes.size()), curve.keyInterval };
+		keys.insert(keys.end(), curve.keyframes.begin(), curve.keyframes.end());
+		return range;
+	}
+};
+
+uint64_t AlignUp(uint64_t value) {
+	return (value + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+}
+
+} // namespace
+
+std::vector<std::byte> ModelCooker::Serialize(const ModelData& modelData, const Animation* animation, const SourceStamp& source)
+{
+	CookedSections sections;
+	Header header{};
+	header.source = source;
+	header.textureFilePath = sections.AddString(modelData.material.textureFilePath);
+
+	sections.AddNode(modelData.rootNode);
+
+	for (const auto& [jointName, jointWeight] : modelData.skinClusterData) {
+		CookedJointWeight joint{};
+		joint.inverseBindPoseMatrix = jointWeight.inverseBindPoseMatrix;
+		joint.name = sections.AddString(jointName);
+		joint.firstWeight = static_cast<uint32_t>(sections.vertexWeights.size());
+		joint.weightCount = static_cast<uint32_t>(jointWeight.vertexWeights.size());
+		sections.joints.push_back(joint);
+		sections.vertexWeights.insert(sections.vertexWeights.end(), jointWeight.vertexWeights.begin(), jointWeight.vertexWeights.end());
+	}
+
+	if (animation) {
+		header.flags |= kHasAnimation;
+		header.animationDuration = animation->duration;
+		for (const auto& [nodeName, nodeAnimation] : animation->nodeAnimations) {
+			CookedChannel channel{};
+			channel.nodeName = sections.AddString(nodeName);
+			channel.translate = CookedSections::AddKeys(nodeAnimation.translate, sections.translateKeys);
+			channel.rotate = CookedSections::AddKeys(nodeAnimation.rotate, sections.rotateKeys);
+			channel.scale = CookedSections::AddKeys(nodeAnimation.scale, sections.scaleKeys);
+			sections.channels.push_back(channel);
+		}
+	}
+
+	// セクションの配置を決める
+	struct SectionSource {
+		const void* data;
+		size_t size;
+	};
+	const SectionSource sources[kSectionCount] = {
+		{ modelData.vertices.data(), modelData.vertices.size() * sizeof(VertexData) },
+		{ modelData.indices.data(), modelData.indices.size() * sizeof(int32_t) },
+		{ sections.strings.data(), sections.strings.size() },
+		{ sections.nodes.data(), sections.nodes.size() * sizeof(CookedNode) },
+		{ sections.joints.data(), sections.joints.size() * sizeof(CookedJointWeight) },
+		{ sections.vertexWeights.data(), sections.vertexWeights.size() * sizeof(VertexWeightData) },
+		{ sections.channels.data(), sections.channels.size() * sizeof(CookedChannel) },
+		{ sections.translateKeys.data(), sections.translateKeys.size() * sizeof(KeyframeVector3) },
+		{ sections.rotateKeys.data(), sections.rotateKeys.size() * sizeof(KeyframeQuaternion) },
+		{ sections.scaleKeys.data(), sections.scaleKeys.size() * sizeof(KeyframeVector3) },
+	};
+
+	uint64_t fileSize = sizeof(Header);
+	for (uint32_t index = 0; index < kSectionCount; ++index) {
+		header.sections[index].offset = AlignUp(fileSize);
+		header.sections[index].size = sources[index].size;
+		fileSize = header.sections[index].offset + header.sections[index].size;
+	}
+
+	// 書き込み（境界合わせの隙間は0で埋める）
+	std::vector<std::byte> bytes(static_cast<size_t>(fileSize));
+	std::memcpy(bytes.data(), &header, sizeof(Header));
+	for (uint32_t index = 0; index < kSectionCount; ++index) {
+		if (sources[index].size > 0) {
+			std::memcpy(bytes.data() + header.sections[index].offset, sources[index].data, sources[index].size);
+		}
+	}
+	return bytes;
+}
+
+bool ModelCooker::Write(const std::string& sourcePath, const ModelData& modelData, const Animation* animation)
+{
+	SourceStamp source;
+	if (!ReadSourceStamp(sourcePath, source)) {
+		return false;
+	}
+
+	const std::vector<std::byte> bytes = Serialize(modelData, animation, source);
+	const std::string cookedPath = GetCookedPath(sourcePath);
+	const std::string temporaryPath = cookedPath + ".tmp";
+
+	{
+		std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		if (file) {
+			file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		}
+		if (!file) {
+			Logger::GetInstance().Log(std::format("Failed to write cooked model: {}", temporaryPath), LogLevel::WARNING, LogCategory::Resource);
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPath, cookedPath, error);
+	if (error) {
+		std::filesystem::remove(temporaryPath, error);
+		Logger::GetInstance().Log(std::format("Failed to replace cooked model: {}", cookedPath), LogLevel::WARNING, LogCategory::Resource);
+		return false;
+	}
+
+	Logger::GetInstance().Log(std::format("Model cooked: {} ({} bytes)", cookedPath, bytes.size()), LogLevel::INFO, LogCategory::Resource);
+	return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "CookedModelFormat.h"
+#include "Engine/Graphics/Structs/ModelData.h"
+#include "Engine/Graphics/Model/Animation/Animation.h"
+
+/// @brief モデルデータを焼き込みファイル（CookedModelFormat）に書き出すクラス
+/// Assimp で読み込んだ結果を保存しておき、次回からは CookedModel で Assimp を通さずに読み込む
+class ModelCooker {
+public:
+	/// @brief 焼き込みデータを作成
+	/// @param modelData モデルデータ
+	/// @param animation 一緒に保存するアニメーション（nullptrなら保存しない。圧縮済みのデータは保存しない）
+	/// @param source 元ファイルの情報
+	/// @return ファイルの中身
+	static std::vector<std::byte> Serialize(const ModelData& modelData, const Animation* animation, const CookedModelFormat::SourceStamp& source);
+
+	/// @brief 焼き込みファイルを書き出す
+	/// 一時ファイルに書いてから置き換えるので、書き込み途中のファイルが読まれることはない
+	/// @param sourcePath 元のモデルファイルのパス（焼き込みファイルはこの隣に作る）
+	/// @param modelData モデルデータ
+	/// @param animation 一緒に保存するアニメーション（nullptrなら保存しない）
+	/// @return 成功したらtrue
+	static bool Write(const std::string& sourcePath, const ModelData& modelData, const Animation* animation);
+};
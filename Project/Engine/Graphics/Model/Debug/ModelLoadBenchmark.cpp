@@ -0,0 +1,260 @@
+#include "ModelLoadBenchmark.h"
+#include "Engine/Graphics/Model/ModelLoader.h"
+#include "Engine/Graphics/Model/Cooked/CookedModel.h"
+#include "Engine/Graphics/Model/Cooked/ModelCooker.h"
+#include "Engine/Utility/Logger/Logger.h"
+
+#include <Windows.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <limits>
+#include <optional>
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief 計測するモデル（SampleAssets のうち Assimp で読めるもの。walk.fbx は walk.gltf と同じ内容なので除く）
+	struct SampleModel {
+		const char* directory;
+		const char* filename;
+	};
+
+	constexpr SampleModel kSampleModels[] = {
+		{ "Assets/SampleAssets/Plane", "plane.obj" },
+		{ "Assets/SampleAssets/Ground", "ground.obj" },
+		{ "Assets/SampleAssets/Axis", "axis.obj" },
+		{ "Assets/SampleAssets/fence", "fence.obj" },
+		{ "Assets/SampleAssets/Sphere", "sphere.obj" },
+		{ "Assets/SampleAssets/terrain", "terrain.obj" },
+		{ "Assets/SampleAssets/AnimatedCube", "AnimatedCube.gltf" },
+		{ "Assets/SampleAssets/simpleSkin", "simpleSkin.gltf" },
+		{ "Assets/SampleAssets/human", "walk.gltf" },
+		{ "Assets/SampleAssets/human", "sneakWalk.gltf" },
+	};
+
+	template<typename Function>
+	double MeasureMilliseconds(Function&& function) {
+		const auto start = Clock::now();
+		function();
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	/// @brief キャッシュを使わない指定でファイルを開いて閉じ、OSのファイルキャッシュから追い出す
+	void EvictFromFileCache(const std::filesystem::path& path) {
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			nullptr, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+		if (file != INVALID_HANDLE_VALUE) {
+			CloseHandle(file);
+		}
+	}
+
+	/// @brief ディレクトリ内のファイル（glTF が参照する .bin などを含む）をまとめて追い出す
+	void EvictDirectoryFromFileCache(const std::string& directoryPath) {
+		std::error_code error;
+		for (const auto& entry : std::filesystem::directory_iterator(directoryPath, error)) {
+			if (entry.is_regular_file(error)) {
+				EvictFromFileCache(entry.path());
+			}
+		}
+	}
+
+	/// @brief 焼き込みファイルから読み込んだデータ
+	struct CookedLoadResult {
+		ModelData modelData;                // 頂点・インデックスは空（uploadBuffer にコピーする）
+		std::optional<Animation> animation;
+		std::vector<std::byte> uploadBuffer; // GPUの転送用バッファの代わり（頂点 → インデックスの順）
+	};
+
+	/// @brief 焼き込みファイルから読み込む（ModelResource::LoadFromFile と AnimationLoader と同じ処理）
+	bool LoadCooked(const std::string& sourcePath, CookedLoadResult& result) {
+		CookedModel cookedModel;
+		if (!cookedModel.Open(sourcePath)) {
+			return false;
+		}
+
+		result.modelData.skinClusterData = cookedModel.BuildSkinClusterData();
+		result.modelData.material = cookedModel.BuildMaterial();
+		result.modelData.rootNode = cookedModel.BuildRootNode();
+		result.animation = cookedModel.HasAnimation() ? std::optional<Animation>(cookedModel.BuildAnimation()) : std::nullopt;
+
+		const std::span<const VertexData> vertices = cookedModel.GetVertices();
+		const std::span<const int32_t> indices = cookedModel.GetIndices();
+		result.uploadBuffer.resize(vertices.size_bytes() + indices.size_bytes());
+		std::memcpy(result.uploadBuffer.data(), vertices.data(), vertices.size_bytes());
+		std::memcpy(result.uploadBuffer.data() + vertices.size_bytes(), indices.data(), indices.size_bytes());
+		return true;
+	}
+
+	template<typename T>
+	bool IsSameBytes(const T& a, const T& b) {
+		return std::memcmp(&a, &b, sizeof(T)) == 0;
+	}
+
+	template<typename T>
+	bool IsSameArray(const std::vector<T>& a, const std::vector<T>& b) {
+		return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+	}
+
+	bool IsSameNode(const Node& a, const Node& b) {
+		if (a.name != b.name || !IsSameBytes(a.transform, b.transform) || !IsSameBytes(a.localMatrix, b.localMatrix) ||
+			a.children.size() != b.children.size()) {
+			return false;
+		}
+		for (size_t index = 0; index < a.children.size(); ++index) {
+			if (!IsSameNode(a.children[index], b.children[index])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename tValue>
+	bool IsSameCurve(const AnimationCurve<tValue>& a, const AnimationCurve<tValue>& b) {
+		return a.keyInterval == b.keyInterval && IsSameArray(a.keyframes, b.keyframes);
+	}
+
+	bool IsSameAnimation(const std::optional<Animation>& a, const std::optional<Animation>& b) {
+		if (!a || !b) {
+			return !a && !b;
+		}
+		if (a->duration != b->duration || a->nodeAnimations.size() != b->nodeAnimations.size()) {
+			return false;
+		}
+		return std::equal(a->nodeAnimations.begin(), a->nodeAnimations.end(), b->nodeAnimations.begin(),
+			[](const auto& x, const auto& y) {
+				return x.first == y.first && IsSameCurve(x.second.translate, y.second.translate) &&
+					IsSameCurve(x.second.rotate, y.second.rotate) && IsSameCurve(x.second.scale, y.second.scale);
+			});
+	}
+
+	/// @brief 焼き込みファイルから読んだデータが Assimp の結果と一致するか
+	bool IsSameModel(const ModelData& source, const std::optional<Animation>& sourceAnimation, const CookedLoadResult& cooked) {
+		const size_t vertexBytes = source.vertices.size() * sizeof(VertexData);
+		const size_t indexBytes = source.indices.size() * sizeof(int32_t);
+		if (cooked.uploadBuffer.size() != vertexBytes + indexBytes ||
+			(vertexBytes > 0 && std::memcmp(cooked.uploadBuffer.data(), source.vertices.data(), vertexBytes) != 0) ||
+			(indexBytes > 0 && std::memcmp(cooked.uploadBuffer.data() + vertexBytes, source.indices.data(), indexBytes) != 0)) {
+			return false;
+		}
+
+		const auto& skin = cooked.modelData.skinClusterData;
+		const bool isSameSkin = skin.size() == source.skinClusterData.size() &&
+			std::equal(skin.begin(), skin.end(), source.skinClusterData.begin(), [](const auto& x, const auto& y) {
+				return x.first == y.first && IsSameBytes(x.second.inverseBindPoseMatrix, y.second.inverseBindPoseMatrix) &&
+					IsSameArray(x.second.vertexWeights, y.second.vertexWeights);
+			});
+
+		return isSameSkin &&
+			cooked.modelData.material.textureFilePath == source.material.textureFilePath &&
+			IsSameNode(cooked.modelData.rootNode, source.rootNode) &&
+			IsSameAnimation(cooked.animation, sourceAnimation);
+	}
+
+	uint64_t GetFileSize(const std::string& path) {
+		std::error_code error;
+		const uint64_t size = std::filesystem::file_size(path, error);
+		return error ? 0 : size;
+	}
+
+	void LogResult(const ModelLoadBenchmark::Result& result) {
+		Logger::GetInstance().Log(
+			std::format("[ModelLoadBenchmark] {}: assimp cold {:.3f} ms / warm {:.3f} ms | cook {:.3f} ms | cooked cold {:.3f} ms / warm {:.3f} ms (x{:.1f}) | {} -> {} bytes | identical {}",
+				result.name, result.assimpColdMilliseconds, result.assimpWarmMilliseconds, result.cookMilliseconds,
+				result.cookedColdMilliseconds, result.cookedWarmMilliseconds,
+				result.cookedWarmMilliseconds > 0.0 ? result.assimpWarmMilliseconds / result.cookedWarmMilliseconds : 0.0,
+				result.sourceBytes, result.cookedBytes, result.identical),
+			LogLevel::INFO, LogCategory::System);
+
+		const MeshOptimizer::Report& report = result.meshOptimizeReport;
+		Logger::GetInstance().Log(
+			std::format("[ModelLoadBenchmark] {}: vertices {} -> {} | ACMR {:.3f} -> {:.3f} | ATVR {:.3f} -> {:.3f} (cache size {})",
+				result.name, report.source.vertexCount, report.optimized.vertexCount,
+				report.source.GetAcmr(), report.optimized.GetAcmr(), report.source.GetAtvr(), report.optimized.GetAtvr(),
+				MeshOptimizer::kCacheSize),
+			LogLevel::INFO, LogCategory::System);
+	}
+
+} // namespace
+
+std::vector<ModelLoadBenchmark::Result> ModelLoadBenchmark::Run(uint32_t warmIterationCount)
+{
+	std::vector<Result> results;
+	Result total;
+	total.name = "合計（シーン）";
+	total.identical = true;
+
+	for (const SampleModel& model : kSampleModels) {
+		const std::string sourcePath = std::format("{}/{}", model.directory, model.filename);
+		if (!std::filesystem::exists(sourcePath)) {
+			continue;
+		}
+
+		Result result;
+		result.name = model.filename;
+
+		// Assimp（モデルと最初のアニメーション）
+		std::optional<ModelData> loadedModelData;
+		std::optional<Animation> animation;
+		EvictDirectoryFromFileCache(model.directory);
+		result.assimpColdMilliseconds = MeasureMilliseconds([&]() {
+			loadedModelData = ModelLoader::LoadModelFile(model.directory, model.filename, &animation, &result.meshOptimizeReport);
+		});
+		if (!loadedModelData) {
+			continue; // 読み込めないモデルは計測しない（エラーはログに出ている）
+		}
+		const ModelData& modelData = *loadedModelData;
+		result.assimpWarmMilliseconds = (std::numeric_limits<double>::max)();
+		for (uint32_t iteration = 0; iteration < warmIterationCount; ++iteration) {
+			std::optional<Animation> warmAnimation;
+			result.assimpWarmMilliseconds = (std::min)(result.assimpWarmMilliseconds, MeasureMilliseconds([&]() {
+				ModelLoader::LoadModelFile(model.directory, model.filename, &warmAnimation);
+			}));
+		}
+
+		// 焼き込み
+		result.cookMilliseconds = MeasureMilliseconds([&]() {
+			ModelCooker::Write(sourcePath, modelData, animation ? &*animation : nullptr);
+		});
+
+		// 焼き込みファイル
+		CookedLoadResult cooked;
+		bool isLoaded = false;
+		EvictFromFileCache(CookedModelFormat::GetCookedPath(sourcePath));
+		result.cookedColdMilliseconds = MeasureMilliseconds([&]() {
+			isLoaded = LoadCooked(sourcePath, cooked);
+		});
+		result.cookedWarmMilliseconds = (std::numeric_limits<double>::max)();
+		for (uint32_t iteration = 0; iteration < warmIterationCount; ++iteration) {
+			CookedLoadResult warmCooked;
+			result.cookedWarmMilliseconds = (std::min)(result.cookedWarmMilliseconds, MeasureMilliseconds([&]() {
+				LoadCooked(sourcePath, warmCooked);
+			}));
+		}
+
+		result.sourceBytes = GetFileSize(sourcePath);
+		result.cookedBytes = GetFileSize(CookedModelFormat::GetCookedPath(sourcePath));
+		result.identical = isLoaded && IsSameModel(modelData, animation, cooked);
+		LogResult(result);
+
+		total.assimpColdMilliseconds += result.assimpColdMilliseconds;
+		total.assimpWarmMilliseconds += result.assimpWarmMilliseconds;
+		total.cookMilliseconds += result.cookMilliseconds;
+		total.cookedColdMilliseconds += result.cookedColdMilliseconds;
+		total.cookedWarmMilliseconds += result.cookedWarmMilliseconds;
+		total.sourceBytes += result.sourceBytes;
+		total.cookedBytes += result.cookedBytes;
+		total.identical = total.identical && result.identical;
+		total.meshOptimizeReport.source += result.meshOptimizeReport.source;
+		total.meshOptimizeReport.optimized += result.meshOptimizeReport.optimized;
+		total.meshOptimizeReport.clusterCount += result.meshOptimizeReport.clusterCount;
+		results.push_back(result);
+	}
+
+	LogResult(total);
+	results.push_back(total);
+	return results;
+}
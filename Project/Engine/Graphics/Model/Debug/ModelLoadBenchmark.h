@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Graphics/Model/MeshOptimizer.h"
+
+/// @brief モデル読み込み（Assimp → 焼き込みファイル）のベンチマーク（GPU不要）
+/// SampleAssets のモデルを Assimp（ModelLoader）と焼き込みファイル（CookedModel）でそれぞれ読み込み、
+/// ファイルキャッシュが冷えた状態（初回）と温まった状態（2回目以降の最小値）の時間を比較する
+/// 冷えた状態は、計測前にファイルをキャッシュを使わない指定で開き直し、OSのファイルキャッシュから追い出して作る
+/// （ベストエフォート。シーンで使用中のファイルは追い出せない場合がある）
+/// GPUへの転送は計測に含めず、頂点・インデックスを転送用のメモリへコピーするところまでを計測する
+/// あわせて、読み込み時のメッシュ最適化（MeshOptimizer）による ACMR / ATVR の変化を記録する
+class ModelLoadBenchmark {
+public:
+	/// @brief モデルごとの計測結果
+	struct Result {
+		std::string name;                   // モデル（最後の行はシーン全体の合計）
+		double assimpColdMilliseconds = 0;  // Assimp での読み込み（キャッシュが冷えた状態）
+		double assimpWarmMilliseconds = 0;  // Assimp での読み込み（キャッシュが温まった状態）
+		double cookMilliseconds = 0;        // 焼き込みファイルの書き出し（初回の読み込み時だけかかる）
+		double cookedColdMilliseconds = 0;  // 焼き込みファイルの読み込み（キャッシュが冷えた状態）
+		double cookedWarmMilliseconds = 0;  // 焼き込みファイルの読み込み（キャッシュが温まった状態）
+		uint64_t sourceBytes = 0;           // 元ファイルのサイズ（同じディレクトリの .bin などは含まない）
+		uint64_t cookedBytes = 0;           // 焼き込みファイルのサイズ
+		bool identical = false;             // 焼き込みファイルから読んだデータが Assimp の結果と一致するか
+		MeshOptimizer::Report meshOptimizeReport; // メッシュ最適化の前後の頂点キャッシュの計測結果
+	};
+
+	/// @brief SampleAssets のモデルでベンチマークを実行
+	/// @param warmIterationCount キャッシュが温まった状態での読み込み回数（最小値を採用）
+	/// @return モデルごとの結果と合計（ログにも出力される）
+	static std::vector<Result> Run(uint32_t warmIterationCount = 5);
+};
@@ -0,0 +1,315 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+namespace {
+
+	constexpr uint32_t kInvalidIndex = (std::numeric_limits<uint32_t>::max)();
+
+	/// @brief 頂点に影響するジョイント（skinClusterData の順番）とウェイト
+	struct Influence {
+		uint32_t joint;
+		float weight;
+
+		bool operator==(const Influence& other) const { return joint == other.joint && weight == other.weight; }
+		bool operator<(const Influence& other) const { return joint != other.joint ? joint < other.joint : weight < other.weight; }
+	};
+
+	/// @brief 三角形の重心と法線（頂点法線の和）を足し込む
+	void AccumulateTriangle(std::span<const VertexData> vertices, const int32_t* triangle, Vector3& centroid, Vector3& normal) {
+		for (uint32_t corner = 0; corner < 3; ++corner) {
+			const VertexData& vertex = vertices[triangle[corner]];
+			centroid.x += vertex.position.x / 3.0f;
+			centroid.y += vertex.position.y / 3.0f;
+			centroid.z += vertex.position.z / 3.0f;
+			normal.x += vertex.normal.x;
+			normal.y += vertex.normal.y;
+			normal.z += vertex.normal.z;
+		}
+	}
+
+} // namespace
+
+MeshOptimizer::Report MeshOptimizer::Optimize(ModelData& modelData)
+{
+	Report report;
+	report.source = AnalyzeVertexCache(modelData.indices, modelData.vertices.size());
+
+	// 1. 一致する頂点を統合する（インデックスだけを付け替え、使われなくなった頂点は 4. で捨てる）
+	const std::vector<uint32_t> weldRemap = WeldVertices(modelData);
+	for (int32_t& index : modelData.indices) {
+		index = static_cast<int32_t>(weldRemap[index]);
+	}
+
+	// 2. 頂点キャッシュ最適化、3. オーバードローの削減
+	const std::vector<uint32_t> clusterStarts = OptimizeVertexCache(modelData.indices, modelData.vertices.size());
+	OptimizeOverdraw(modelData.indices, modelData.vertices, clusterStarts);
+	report.clusterCount = static_cast<uint32_t>(clusterStarts.size());
+
+	// 4. 頂点フェッチ最適化
+	OptimizeVertexFetch(modelData);
+
+	report.optimized = AnalyzeVertexCache(modelData.indices, modelData.vertices.size());
+	return report;
+}
+
+MeshOptimizer::CacheStatistics MeshOptimizer::AnalyzeVertexCache(std::span<const int32_t> indices, size_t vertexCount, uint32_t cacheSize)
+{
+	CacheStatistics statistics;
+	statistics.triangleCount = indices.size() / 3;
+
+	// キャッシュミスの回数を時刻として使い、入ってから cacheSize 回のミスの間はキャッシュに残っているとみなす
+	constexpr uint64_t kNotCached = (std::numeric_limits<uint64_t>::max)();
+	std::vector<uint64_t> cachedAt(vertexCount, kNotCached);
+	for (const int32_t index : indices) {
+		uint64_t& time = cachedAt[index];
+		if (time == kNotCached) {
+			++statistics.vertexCount;
+		}
+		if (time == kNotCached || statistics.cacheMissCount - time >= cacheSize) {
+			time = statistics.cacheMissCount;
+			++statistics.cacheMissCount;
+		}
+	}
+	return statistics;
+}
+
+std::vector<uint32_t> MeshOptimizer::WeldVertices(const ModelData& modelData)
+{
+	const std::vector<VertexData>& vertices = modelData.vertices;
+
+	// スキンのウェイトが違う頂点はまとめない
+	std::vector<std::vector<Influence>> influences(vertices.size());
+	uint32_t jointIndex = 0;
+	for (const auto& [name, jointWeight] : modelData.skinClusterData) {
+		for (const VertexWeightData& vertexWeight : jointWeight.vertexWeights) {
+			if (vertexWeight.vertexIndex < vertices.size()) {
+				influences[vertexWeight.vertexIndex].push_back({ jointIndex, vertexWeight.weight });
+			}
+		}
+		++jointIndex;
+	}
+	for (std::vector<Influence>& influence : influences) {
+		std::sort(influence.begin(), influence.end());
+	}
+
+	// 頂点をバイト列で並べ、同じものが続く範囲を最も番号が小さい頂点にまとめる
+	std::vector<uint32_t> order(vertices.size());
+	std::iota(order.begin(), order.end(), 0u);
+	auto compare = [&](uint32_t a, uint32_t b) {
+		const int result = std::memcmp(&vertices[a], &vertices[b], sizeof(VertexData));
+		if (result != 0) {
+			return result < 0;
+		}
+		if (influences[a] != influences[b]) {
+			return influences[a] < influences[b];
+		}
+		return a < b;
+	};
+	std::sort(order.begin(), order.end(), compare);
+
+	std::vector<uint32_t> remap(vertices.size());
+	for (size_t begin = 0; begin < order.size();) {
+		const uint32_t representative = order[begin];
+		size_t end = begin;
+		while (end < order.size() &&
+			std::memcmp(&vertices[order[end]], &vertices[representative], sizeof(VertexData)) == 0 &&
+			influences[order[end]] == influences[representative]) {
+			remap[order[end]] = representative;
+			++end;
+		}
+		begin = end;
+	}
+	return remap;
+}
+
+std::vector<uint32_t> MeshOptimizer::OptimizeVertexCache(std::vector<int32_t>& indices, size_t vertexCount, uint32_t cacheSize)
+{
+	const size_t triangleCount = indices.size() / 3;
+	std::vector<uint32_t> clusterStarts;
+	if (triangleCount == 0) {
+		return clusterStarts;
+	}
+
+	// 頂点から三角形への隣接リスト（CSR形式）と、まだ出力していない三角形の数
+	std::vector<uint32_t> liveCount(vertexCount, 0);
+	for (const int32_t index : indices) {
+		++liveCount[index];
+	}
+	std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+	for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+		adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + liveCount[vertex];
+	}
+	std::vector<uint32_t> adjacency(indices.size());
+	std::vector<uint32_t> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+	for (size_t corner = 0; corner < indices.size(); ++corner) {
+		adjacency[fillOffsets[indices[corner]]++] = static_cast<uint32_t>(corner / 3);
+	}
+
+	std::vector<uint32_t> cacheTime(vertexCount, 0); // 最後にキャッシュへ入った時刻
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<uint32_t> deadEnds;                   // 出力した頂点（行き止まりになった時の戻り先）
+	std::vector<uint32_t> candidates;                 // 直前に出力した三角形の頂点（次の扇の中心の候補）
+	std::vector<int32_t> output;
+	output.reserve(indices.size());
+
+	uint32_t time = cacheSize + 1;
+	uint32_t scanCursor = 0;
+	uint32_t fanning = static_cast<uint32_t>(indices[0]);
+	clusterStarts.push_back(0);
+
+	auto isCached = [&](uint32_t vertex) { return time - cacheTime[vertex] <= cacheSize; };
+
+	while (fanning != kInvalidIndex) {
+		// fanning を囲む三角形をまとめて出力する
+		candidates.clear();
+		for (uint32_t offset = adjacencyOffsets[fanning]; offset < adjacencyOffsets[fanning + 1]; ++offset) {
+			const uint32_t triangle = adjacency[offset];
+			if (emitted[triangle]) {
+				continue;
+			}
+			emitted[triangle] = true;
+			for (uint32_t corner = 0; corner < 3; ++corner) {
+				const uint32_t vertex = indices[triangle * 3 + corner];
+				output.push_back(static_cast<int32_t>(vertex));
+				deadEnds.push_back(vertex);
+				candidates.push_back(vertex);
+				--liveCount[vertex];
+				if (!isCached(vertex)) {
+					cacheTime[vertex] = time++;
+				}
+			}
+		}
+
+		// 次の扇の中心: 候補のうち、扇を出力してもキャッシュに残っている中で最も古く入ったもの
+		uint32_t next = kInvalidIndex;
+		uint32_t bestPriority = 0;
+		bool hasPriority = false;
+		for (const uint32_t vertex : candidates) {
+			if (liveCount[vertex] == 0) {
+				continue;
+			}
+			uint32_t priority = 0;
+			if (time - cacheTime[vertex] + 2 * liveCount[vertex] <= cacheSize) {
+				priority = time - cacheTime[vertex];
+			}
+			if (!hasPriority || priority > bestPriority) {
+				hasPriority = true;
+				bestPriority = priority;
+				next = vertex;
+			}
+		}
+
+		if (next == kInvalidIndex) {
+			// 行き止まり: 最近出力した頂点へ戻り、それもなければ先頭から未出力の頂点を探す
+			while (!deadEnds.empty() && next == kInvalidIndex) {
+				const uint32_t vertex = deadEnds.back();
+				deadEnds.pop_back();
+				if (liveCount[vertex] > 0) {
+					next = vertex;
+				}
+			}
+			while (next == kInvalidIndex && scanCursor < vertexCount) {
+				if (liveCount[scanCursor] > 0) {
+					next = scanCursor;
+				}
+				++scanCursor;
+			}
+
+			// キャッシュから外れた頂点から再開する場合は、そこでクラスタを区切る
+			if (next != kInvalidIndex && !isCached(next)) {
+				clusterStarts.push_back(static_cast<uint32_t>(output.size() / 3));
+			}
+		}
+		fanning = next;
+	}
+
+	indices = std::move(output);
+	return clusterStarts;
+}
+
+void MeshOptimizer::OptimizeOverdraw(std::vector<int32_t>& indices, std::span<const VertexData> vertices, std::span<const uint32_t> clusterStarts)
+{
+	const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+	if (clusterStarts.size() <= 1) {
+		return;
+	}
+
+	// メッシュ全体の重心
+	Vector3 meshCentroid = { 0.0f, 0.0f, 0.0f };
+	Vector3 unusedNormal = { 0.0f, 0.0f, 0.0f };
+	for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+		AccumulateTriangle(vertices, &indices[triangle * 3], meshCentroid, unusedNormal);
+	}
+	const float triangleCountF = static_cast<float>(triangleCount);
+	meshCentroid = { meshCentroid.x / triangleCountF, meshCentroid.y / triangleCountF, meshCentroid.z / triangleCountF };
+
+	// クラスタがどれだけ外側を向いているか（重心から見た位置と法線の内積）
+	struct Cluster {
+		uint32_t begin;
+		uint32_t end;
+		float outwardness;
+	};
+	std::vector<Cluster> clusters;
+	clusters.reserve(clusterStarts.size());
+	for (size_t index = 0; index < clusterStarts.size(); ++index) {
+		Cluster cluster{ clusterStarts[index], index + 1 < clusterStarts.size() ? clusterStarts[index + 1] : triangleCount, 0.0f };
+		Vector3 centroid = { 0.0f, 0.0f, 0.0f };
+		Vector3 normal = { 0.0f, 0.0f, 0.0f };
+		for (uint32_t triangle = cluster.begin; triangle < cluster.end; ++triangle) {
+			AccumulateTriangle(vertices, &indices[triangle * 3], centroid, normal);
+		}
+		const float count = static_cast<float>(cluster.end - cluster.begin);
+		const float normalLength = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+		if (count > 0.0f && normalLength > 0.0f) {
+			cluster.outwardness =
+				((centroid.x / count - meshCentroid.x) * normal.x +
+				(centroid.y / count - meshCentroid.y) * normal.y +
+				(centroid.z / count - meshCentroid.z) * normal.z) / normalLength;
+		}
+		clusters.push_back(cluster);
+	}
+
+	// 外側を向いたクラスタ（手前で他を隠しやすいもの）から描く
+	std::stable_sort(clusters.begin(), clusters.end(),
+		[](const Cluster& a, const Cluster& b) { return a.outwardness > b.outwardness; });
+
+	std::vector<int32_t> sorted;
+	sorted.reserve(indices.size());
+	for (const Cluster& cluster : clusters) {
+		sorted.insert(sorted.end(), indices.begin() + cluster.begin * 3, indices.begin() + cluster.end * 3);
+	}
+	indices = std::move(sorted);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(ModelData& modelData)
+{
+	std::vector<uint32_t> remap(modelData.vertices.size(), kInvalidIndex);
+	std::vector<VertexData> vertices;
+	vertices.reserve(modelData.vertices.size());
+	for (int32_t& index : modelData.indices) {
+		uint32_t& newIndex = remap[index];
+		if (newIndex == kInvalidIndex) {
+			newIndex = static_cast<uint32_t>(vertices.size());
+			vertices.push_back(modelData.vertices[index]);
+		}
+		index = static_cast<int32_t>(newIndex);
+	}
+	modelData.vertices = std::move(vertices);
+
+	// ウェイトを付け替える（統合された頂点・使われない頂点のウェイトは、まとめた先の頂点と同じなので捨てる）
+	for (auto& [name, jointWeight] : modelData.skinClusterData) {
+		std::vector<VertexWeightData> vertexWeights;
+		vertexWeights.reserve(jointWeight.vertexWeights.size());
+		for (const VertexWeightData& vertexWeight : jointWeight.vertexWeights) {
+			if (vertexWeight.vertexIndex < remap.size() && remap[vertexWeight.vertexIndex] != kInvalidIndex) {
+				vertexWeights.push_back({ vertexWeight.weight, remap[vertexWeight.vertexIndex] });
+			}
+		}
+		jointWeight.vertexWeights = std::move(vertexWeights);
+	}
+}
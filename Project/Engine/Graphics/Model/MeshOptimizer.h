@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Engine/Graphics/Structs/ModelData.h"
+
+/// @brief 読み込み時にメッシュの頂点・インデックスを並べ替えるクラス
+/// ModelLoader が Assimp の結果に対して実行し、焼き込みファイルには最適化後のデータが入る
+/// 1. 頂点の統合: 全メンバーとスキンのウェイトが完全に一致する頂点を1つにまとめる（Assimp は OBJ の面ごとに頂点を作るため）
+/// 2. 頂点キャッシュ最適化: Tipsify（Sander et al. 2007）で三角形を並べ替え、変換済み頂点の再利用を増やす
+/// 3. オーバードローの削減: Tipsify が途切れた位置で三角形をクラスタに分け、外側を向いたクラスタから描くように並べる
+///    クラスタの中の順序は変えないので、頂点キャッシュの効率はほぼそのまま
+/// 4. 頂点フェッチ最適化: 頂点をインデックスで最初に使われる順に並べ直す（使われない頂点は捨てる）
+/// 頂点の番号が変わるので、JointWeightData::vertexWeights も合わせて付け替える
+class MeshOptimizer {
+public:
+	/// @brief 最適化と計測で想定する頂点キャッシュ（FIFO）のサイズ
+	static constexpr uint32_t kCacheSize = 16;
+
+	/// @brief 頂点キャッシュの計測結果
+	struct CacheStatistics {
+		uint64_t cacheMissCount = 0; // キャッシュミス（頂点シェーダーの実行回数）
+		uint64_t triangleCount = 0;  // 三角形の数
+		uint64_t vertexCount = 0;    // インデックスから参照される頂点の数
+
+		/// @brief ACMR（三角形あたりのキャッシュミス。0.5 ～ 3.0 で、小さいほど良い）
+		float GetAcmr() const { return triangleCount > 0 ? static_cast<float>(cacheMissCount) / static_cast<float>(triangleCount) : 0.0f; }
+
+		/// @brief ATVR（頂点あたりのキャッシュミス。1.0 が理想）
+		float GetAtvr() const { return vertexCount > 0 ? static_cast<float>(cacheMissCount) / static_cast<float>(vertexCount) : 0.0f; }
+
+		CacheStatistics& operator+=(const CacheStatistics& other) {
+			cacheMissCount += other.cacheMissCount;
+			triangleCount += other.triangleCount;
+			vertexCount += other.vertexCount;
+			return *this;
+		}
+	};
+
+	/// @brief 最適化の前後の計測結果
+	struct Report {
+		CacheStatistics source;    // 最適化前（Assimp の結果そのまま）
+		CacheStatistics optimized; // 最適化後
+		uint32_t clusterCount = 0; // オーバードロー削減で並べ替えたクラスタの数
+	};
+
+	/// @brief 全ての最適化を順に実行する
+	/// @param modelData 頂点・インデックス・スキンクラスターを書き換えるモデルデータ
+	/// @return 前後の計測結果
+	static Report Optimize(ModelData& modelData);
+
+	/// @brief 頂点キャッシュ（FIFO）をシミュレーションして計測する
+	/// @param indices インデックス
+	/// @param vertexCount 頂点数
+	/// @param cacheSize キャッシュのサイズ
+	static CacheStatistics AnalyzeVertexCache(std::span<const int32_t> indices, size_t vertexCount, uint32_t cacheSize = kCacheSize);
+
+	/// @brief 一致する頂点を統合した時の付け替え先を求める（頂点配列は変えない）
+	/// @param modelData モデルデータ
+	/// @return 頂点ごとの付け替え先（同じ頂点のうち最も番号が小さいもの）
+	static std::vector<uint32_t> WeldVertices(const ModelData& modelData);
+
+	/// @brief Tipsify で三角形を並べ替える
+	/// @param indices インデックス（並べ替える）
+	/// @param vertexCount 頂点数
+	/// @param cacheSize キャッシュのサイズ
+	/// @return クラスタの先頭の三角形番号（Tipsify が途切れた位置。先頭は0）
+	static std::vector<uint32_t> OptimizeVertexCache(std::vector<int32_t>& indices, size_t vertexCount, uint32_t cacheSize = kCacheSize);
+
+	/// @brief クラスタを外側を向いた順に並べ替える
+	/// @param indices インデックス（並べ替える）
+	/// @param vertices 頂点
+	/// @param clusterStarts クラスタの先頭の三角形番号（OptimizeVertexCache の結果）
+	static void OptimizeOverdraw(std::vector<int32_t>& indices, std::span<const VertexData> vertices, std::span<const uint32_t> clusterStarts);
+
+	/// @brief 頂点をインデックスで最初に使われる順に並べ直す
+	/// @param modelData 頂点・インデックス・スキンクラスターを書き換えるモデルデータ
+	static void OptimizeVertexFetch(ModelData& modelData);
+};
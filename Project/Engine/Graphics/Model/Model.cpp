@@ -7,13 +7,90 @@
 #include "Engine/Graphics/Model/Skeleton/SkeletonAnimator.h"
 #include "Engine/Graphics/Model/Skeleton/SkinClusterGenerator.h"
 #include "Engine/Graphics/Model/Animation/AnimationBlender.h"
+#include "Engine/Utility/Job/JobSystem.h"
 #include "Engine/Utility/Logger/Logger.h"
 
+#include <algorithm>
 #include <cassert>
 
 namespace {
 	DirectXCommon* sDxCommon_ = nullptr;
 	ResourceFactory* sResourceFactory_ = nullptr;
+
+	// アニメーション更新の統計（集計中のフレームと直前のフレーム）
+	Model::AnimationStatistics sAnimationStatistics;
+	Model::AnimationStatistics sLastAnimationStatistics;
+
+	// アニメーション更新を予約したモデル（UpdateAnimationsAll でまとめて実行する）
+	std::vector<Model*> sPendingAnimationModels;
+
+	/// @brief アニメーション結果のスケルトンから、ジョイントの変換と行列だけをコピー
+	/// 構造（親子関係）は同じなので、Skeleton ごとのコピー（配列の再確保）を避ける
+	void CopyJointPose(const Skeleton& source, std::optional<Skeleton>& destination) {
+		if (!destination || destination->GetJointCount() != source.GetJointCount()) {
+			destination = source;
+			return;
+		}
+		std::copy(source.transforms.begin(), source.transforms.end(), destination->transforms.begin());
+		std::copy(source.skeletonSpaceMatrices.begin(), source.skeletonSpaceMatrices.end(), destination->skeletonSpaceMatrices.begin());
+	}
+
+	/// @brief コントローラーを更新してもポーズがこれ以上変化しないか（ループしない再生が終了している）
+	bool IsAnimationSettled(const IAnimationController* controller) {
+		if (dynamic_cast<const SkeletonAnimator*>(controller)) {
+			return controller->IsFinished();
+		}
+		if (auto* blender = dynamic_cast<const AnimationBlender*>(controller)) {
+			return !blender->IsBlending() && blender->IsFinished();
+		}
+		return false;
+	}
+
+	/// @brief コントローラーのアニメーション結果のスケルトン（SkeletonAnimator・AnimationBlender 以外は nullptr）
+	const Skeleton* FindAnimatedSkeleton(IAnimationController* controller) {
+		if (auto* skeletonAnimator = dynamic_cast<SkeletonAnimator*>(controller)) {
+			return &skeletonAnimator->GetSkeleton();
+		}
+		if (auto* blender = dynamic_cast<AnimationBlender*>(controller)) {
+			return &blender->GetSkeleton();
+		}
+		return nullptr;
+	}
+}
+
+Model::~Model() {
+	// 予約リストに残っていれば外す（評価中に破棄されることはない）
+	if (animationUpdatePending_) {
+		RemovePendingAnimation();
+	}
+}
+
+void Model::UpdateAnimationsAll(JobSystem* jobSystem) {
+	// 評価中に予約リストが変化しないよう取り出してから実行する
+	std::vector<Model*> models = std::move(sPendingAnimationModels);
+	sPendingAnimationModels.clear();
+
+	if (!jobSystem) {
+		for (Model* model : models) {
+			model->EvaluatePendingAnimation();
+		}
+		return;
+	}
+
+	jobSystem->ParallelFor(static_cast<uint32_t>(models.size()), 1, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			models[i]->EvaluatePendingAnimation();
+		}
+	});
+}
+
+void Model::BeginAnimationStatisticsFrame() {
+	sLastAnimationStatistics = sAnimationStatistics;
+	sAnimationStatistics = {};
+}
+
+const Model::AnimationStatistics& Model::GetAnimationStatistics() {
+	return sLastAnimationStatistics;
 }
 
 void Model::Initialize(DirectXCommon* dxCommon, ResourceFactory* factory) {
@@ -46,7 +123,8 @@ void Model::Initialize(ModelResource* resource) {
 			skinCluster_ = SkinClusterGenerator::CreateSkinCluster(
 				sDxCommon_->GetDevice(),
 				*skeleton_,
-				modelData,
+				modelData.skinClusterData,
+				resource_->GetVertices().size(),
 				sDxCommon_->GetDescriptorManager()
 			);
 		}
@@ -85,7 +163,7 @@ void Model::UpdateTransformationMatrix(const WorldTransform& transform, const IC
 	wvpResource_->Map(0, nullptr, reinterpret_cast<void**>(&mappedData));
 	mappedData->world = worldMatrix;
 	mappedData->WVP = worldViewProjectionMatrix;
-	mappedData->worldInverseTranspose = MathCore::Matrix::Transpose(MathCore::Matrix::Inverse(worldMatrix));
+	mappedData->worldInverseTranspose = MathCore::Matrix::InverseTranspose(worldMatrix);
 	wvpResource_->Unmap(0, nullptr);
 }
 
@@ -98,9 +176,24 @@ void Model::Draw(const WorldTransform& transform, const ICamera* camera,
 	ID3D12GraphicsCommandList* cmdList = sDxCommon_->GetCommandList();
 	assert(cmdList);
 
+	// 予約したアニメーション更新が UpdateAnimationsAll で実行されていなければ、ここで実行する
+	ResolvePendingAnimation();
+
 	// WVP行列を更新（共通処理）
 	UpdateTransformationMatrix(transform, camera);
 
+	// アニメーションLODのためにカメラから見た境界球を記録（次のアニメーション更新で使う）
+	if (animationController_ && animationLod_.GetSettings().enabled) {
+		const Matrix4x4 worldMatrix = transform.GetWorldMatrix();
+		const Vector3 worldCenter = { worldMatrix.m[3][0], worldMatrix.m[3][1], worldMatrix.m[3][2] };
+		float maxScale = 0.0f;
+		for (int axis = 0; axis < 3; ++axis) {
+			maxScale = (std::max)(maxScale, MathCore::Vector::Length({ worldMatrix.m[axis][0], worldMatrix.m[axis][1], worldMatrix.m[axis][2] }));
+		}
+		animationLod_.SubmitView(worldCenter, animationBoundingRadius_ * maxScale,
+			camera->GetViewMatrix(), camera->GetProjectionMatrix());
+	}
+
 	// スキンクラスターの有無で描画方法を自動判別
 	if (HasSkinCluster()) {
 		SetupSkinningDrawCommands(cmdList, textureHandle);
@@ -115,8 +208,12 @@ void Model::Draw(const WorldTransform& transform, const ICamera* camera,
 void Model::SetupNormalDrawCommands(ID3D12GraphicsCommandList* cmdList,
 	D3D12_GPU_DESCRIPTOR_HANDLE textureHandle) {
 	
-	// 頂点バッファを設定
-	cmdList->IASetVertexBuffers(0, 1, &resource_->vertexBufferView_);
+	// 頂点バッファを2つ設定（位置と法線・UV）
+	D3D12_VERTEX_BUFFER_VIEW vbvs[2] = {
+		resource_->positionBufferView_,  // Slot 0: 位置
+		resource_->attributeBufferView_  // Slot 1: 法線・UV
+	};
+	cmdList->IASetVertexBuffers(0, 2, vbvs);
 	
 	// インデックスバッファを設定
 	cmdList->IASetIndexBuffer(&resource_->indexBufferView_);
@@ -144,12 +241,13 @@ void Model::SetupSkinningDrawCommands(ID3D12GraphicsCommandList* cmdList,
 	
 	assert(skinCluster_.has_value());
 
-	// 頂点バッファを2つ設定（通常の頂点データとInfluenceデータ）
-	D3D12_VERTEX_BUFFER_VIEW vbvs[2] = {
-		resource_->vertexBufferView_,      // Slot 0: VertexData
-		skinCluster_->influenceBufferView  // Slot 1: VertexInfluence
+	// 頂点バッファを3つ設定（位置、法線・UV、Influenceデータ）
+	D3D12_VERTEX_BUFFER_VIEW vbvs[3] = {
+		resource_->positionBufferView_,    // Slot 0: 位置
+		resource_->attributeBufferView_,   // Slot 1: 法線・UV
+		skinCluster_->influenceBufferView  // Slot 2: VertexInfluence
 	};
-	cmdList->IASetVertexBuffers(0, 2, vbvs);
+	cmdList->IASetVertexBuffers(0, 3, vbvs);
 	
 	// インデックスバッファを設定
 	cmdList->IASetIndexBuffer(&resource_->indexBufferView_);
@@ -194,32 +292,109 @@ Matrix4x4 Model::GetUVTransform() const {
 void Model::UpdateAnimation(float deltaTime) {
 	if (!animationController_) return;
 
-	// アニメーションの時間を進める
-	animationController_->Update(deltaTime);
-	
-	// SkeletonAnimatorの場合は、スケルトンとスキンクラスターを同期
-	if (auto* skeletonAnimator = dynamic_cast<SkeletonAnimator*>(animationController_.get())) {
-		skeleton_ = skeletonAnimator->GetSkeleton();
+	// 同じフレームに2回呼ばれた場合は、先に前回の分を実行する
+	ResolvePendingAnimation();
+
+	// アニメーションLODで今フレームの処理を決める（LODが無効なら、ポーズが変化しない場合を除いて毎フレーム評価する）
+	const AnimationLod::Action action = animationLod_.Advance(deltaTime);
+	switch (action) {
+	case AnimationLod::Action::Evaluate:
+		// 評価しなかったフレームの分もまとめて時間を進める
+		pendingAnimationDeltaTime_ = animationLod_.ConsumeDeltaTime();
+		if (FindAnimatedSkeleton(animationController_.get())) {
+			++sAnimationStatistics.evaluatedCount;
+		}
+		break;
+	case AnimationLod::Action::Interpolate:
+		if (!skeleton_) return;
+		++sAnimationStatistics.interpolatedCount;
+		break;
+	case AnimationLod::Action::Freeze:
+		if (skeleton_) {
+			++sAnimationStatistics.frozenCount;
+		}
+		return;
+	default:
+		if (skeleton_) {
+			++sAnimationStatistics.skippedCount;
+		}
+		return;
+	}
+
+	// ポーズの評価とパレットの書き込みは UpdateAnimationsAll でまとめて行う
+	pendingAnimationAction_ = action;
+	pendingAnimationIndex_ = sPendingAnimationModels.size();
+	sPendingAnimationModels.push_back(this);
+	animationUpdatePending_ = true;
+}
+
+void Model::EvaluatePendingAnimation() {
+	animationUpdatePending_ = false;
+
+	if (pendingAnimationAction_ == AnimationLod::Action::Interpolate) {
+		// 直前の2回の評価結果を補間してパレットを書き込む
+		animationLod_.ApplyInterpolatedPose(*skeleton_);
 		UpdateSkinCluster();
+		return;
 	}
-	// AnimationBlenderの場合も、スケルトンとスキンクラスターを同期
-	else if (auto* blender = dynamic_cast<AnimationBlender*>(animationController_.get())) {
-		skeleton_ = blender->GetSkeleton();
+
+	animationController_->SetSkipLeafJoints(animationLod_.GetCurrentLevel().skipLeafJoints);
+	animationController_->Update(pendingAnimationDeltaTime_);
+	animationLod_.SetSettled(IsAnimationSettled(animationController_.get()));
+
+	// SkeletonAnimator・AnimationBlenderの場合は、スケルトンとスキンクラスターを同期
+	if (const Skeleton* animatedSkeleton = FindAnimatedSkeleton(animationController_.get())) {
+		CopyJointPose(*animatedSkeleton, skeleton_);
+		animationLod_.StoreEvaluatedPose(*skeleton_);
 		UpdateSkinCluster();
 	}
 }
 
+void Model::ResolvePendingAnimation() {
+	if (!animationUpdatePending_) return;
+
+	RemovePendingAnimation();
+	EvaluatePendingAnimation();
+}
+
+void Model::RemovePendingAnimation() {
+	// 末尾と入れ替えて外す
+	Model* last = sPendingAnimationModels.back();
+	sPendingAnimationModels[pendingAnimationIndex_] = last;
+	last->pendingAnimationIndex_ = pendingAnimationIndex_;
+	sPendingAnimationModels.pop_back();
+	animationUpdatePending_ = false;
+}
+
 void Model::ResetAnimation() {
 	if (animationController_) {
+		ResolvePendingAnimation();
 		animationController_->Reset();
+		animationLod_.RequestEvaluation();
 	}
 }
 
-float Model::GetAnimationTime() const {
+void Model::SetAnimationLod(const AnimationLodSettings& settings) {
+	ResolvePendingAnimation();
+	animationLod_.SetSettings(settings);
+
+	// 境界球の半径（指定がなければモデル空間の原点から最も遠い頂点までの距離）
+	animationBoundingRadius_ = settings.boundingRadius;
+	if (animationBoundingRadius_ <= 0.0f && resource_) {
+		for (const VertexData& vertex : resource_->GetVertices()) {
+			animationBoundingRadius_ = (std::max)(animationBoundingRadius_,
+				MathCore::Vector::Length({ vertex.position.x, vertex.position.y, vertex.position.z }));
+		}
+	}
+}
+
+float Model::GetAnimationTime() {
+	ResolvePendingAnimation();
 	return animationController_ ? animationController_->GetAnimationTime() : 0.0f;
 }
 
-bool Model::IsAnimationFinished() const {
+bool Model::IsAnimationFinished() {
+	ResolvePendingAnimation();
 	return animationController_ ? animationController_->IsFinished() : true;
 }
 
@@ -244,6 +419,9 @@ bool Model::SwitchAnimation(const std::string& animationName, bool loop) {
 		return false;
 	}
 
+	// 予約中の更新は切り替え前のコントローラーで実行する
+	ResolvePendingAnimation();
+
 	// SkeletonAnimatorの場合のみアニメーション切り替えが可能
 	auto* skeletonAnimator = dynamic_cast<SkeletonAnimator*>(animationController_.get());
 	if (!skeletonAnimator) {
@@ -255,6 +433,7 @@ bool Model::SwitchAnimation(const std::string& animationName, bool loop) {
 	// 現在のスケルトン状態を保持したまま、新しいアニメーションコントローラーを作成
 	Skeleton currentSkeleton = skeletonAnimator->GetSkeleton();
 	animationController_ = std::make_unique<SkeletonAnimator>(currentSkeleton, *newAnimation, loop);
+	animationLod_.RequestEvaluation();
 	
 	Logger::GetInstance().Log("Switched to animation: " + animationName, 
 		LogLevel::INFO, LogCategory::Graphics);
@@ -278,6 +457,9 @@ bool Model::SwitchAnimationWithBlend(const std::string& animationName, float ble
 		return false;
 	}
 
+	// 予約中の更新は切り替え前のコントローラーで実行する
+	ResolvePendingAnimation();
+
 	// AnimationBlenderとして動作している場合
 	auto* blender = dynamic_cast<AnimationBlender*>(animationController_.get());
 	if (blender) {
@@ -285,6 +467,7 @@ bool Model::SwitchAnimationWithBlend(const std::string& animationName, float ble
 		Skeleton currentSkeleton = blender->GetSkeleton();
 		auto newAnimator = std::make_unique<SkeletonAnimator>(currentSkeleton, *newAnimation, loop);
 		blender->StartBlend(std::move(newAnimator), blendDuration);
+		animationLod_.RequestEvaluation();
 		
 		Logger::GetInstance().Log("Started blend to animation: " + animationName, 
 			LogLevel::INFO, LogCategory::Graphics);
@@ -305,6 +488,7 @@ bool Model::SwitchAnimationWithBlend(const std::string& animationName, float ble
 		auto blenderController = std::make_unique<AnimationBlender>(std::move(currentAnimator));
 		blenderController->StartBlend(std::move(newAnimator), blendDuration);
 		animationController_ = std::move(blenderController);
+		animationLod_.RequestEvaluation();
 
 		Logger::GetInstance().Log("Started blend to animation: " + animationName, 
 			LogLevel::INFO, LogCategory::Graphics);
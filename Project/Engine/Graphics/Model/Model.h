@@ -12,12 +12,14 @@
 #include "Engine/Graphics/Structs/TransformationMatrix.h"
 #include "Engine/Graphics/Structs/SkinCluster.h"
 #include "Animation/IAnimationController.h"
+#include "Animation/AnimationLod.h"
 #include "Skeleton/Skeleton.h"
 
 class ICamera;
 class DirectXCommon;
 class ResourceFactory;
 class LightBase;
+class JobSystem;
 
 /// @brief 配置された3Dモデルのインスタンスクラス
 /// ModelResourceへの参照と、個別のトランスフォーム・マテリアルを持つ
@@ -29,17 +31,41 @@ public:
 		Skinning  // スキニングモデル
 	};
 
+	/// @brief アニメーション更新の統計（1フレーム分。スケルトンを持つモデルのみ数える）
+	struct AnimationStatistics {
+		uint32_t evaluatedCount = 0;    // ポーズを評価してパレットを書き込んだ数
+		uint32_t interpolatedCount = 0; // ポーズを評価せず、直前の評価結果を補間してパレットを書き込んだ数
+		uint32_t skippedCount = 0;      // 評価間隔の途中・ポーズが変化しないため何もしなかった数
+		uint32_t frozenCount = 0;       // 画面外のため何もしなかった数
+
+		/// @brief スケルトンを更新した（パレットを書き込んだ）数
+		uint32_t GetUpdatedCount() const { return evaluatedCount + interpolatedCount; }
+	};
+
 	/// @brief デフォルトコンストラクタ
 	Model() = default;
 
-	/// @brief デストラクタ
-	~Model() = default;
+	/// @brief デストラクタ（予約中のアニメーション更新を取り消す）
+	~Model();
 
 	/// @brief 静的初期化（全Modelインスタンス共通のリソースを初期化）
 	/// @param dxCommon DirectXCommonのポインタ
 	/// @param factory リソースファクトリのポインタ
 	static void Initialize(DirectXCommon* dxCommon, ResourceFactory* factory);
 
+	/// @brief アニメーション更新の統計をフレームの区切りで確定する（EngineSystem::BeginFrame から呼ぶ）
+	static void BeginAnimationStatisticsFrame();
+
+	/// @brief 直前のフレームのアニメーション更新の統計を取得
+	/// @return 統計
+	static const AnimationStatistics& GetAnimationStatistics();
+
+	/// @brief UpdateAnimation で予約した全モデルのポーズの評価とパレットの書き込みをまとめて実行し、全モデルの完了を待つ
+	/// モデル単位でジョブに分散する（スケルトン内のジョイントは親から順に1スレッドで評価する）
+	/// 各モデルは自身のコントローラー・スケルトン・パレットのみを書き換えるため、実行順序によらず結果は同じになる
+	/// @param jobSystem ジョブシステム（nullptrの場合は呼び出し元で順に実行）
+	static void UpdateAnimationsAll(JobSystem* jobSystem);
+
 	/// @brief 初期化（アニメーションコントローラーなし）
 	/// @param resource 共有するModelResourceのポインタ
 	void Initialize(ModelResource* resource);
@@ -74,8 +100,9 @@ public:
 	Matrix4x4 GetUVTransform() const;
 
 	/// @brief Skeletonを取得（スケルトンアニメーションから同期）
+	/// 予約中のアニメーション更新があれば先に実行する
 	/// @return Skeleton（存在しない場合はnullopt）
-	const std::optional<Skeleton>& GetSkeleton() const { return skeleton_; }
+	const std::optional<Skeleton>& GetSkeleton() { ResolvePendingAnimation(); return skeleton_; }
 
 	/// @brief SkinClusterを持っているか確認
 	/// @return SkinClusterがあればtrue
@@ -85,20 +112,31 @@ public:
 	/// @return コントローラーがあればtrue
 	bool HasAnimationController() const { return animationController_ != nullptr; }
 
-	/// @brief アニメーションを更新
+	/// @brief アニメーションの更新を予約
+	/// アニメーションLODの判定だけをここで行い、ポーズの評価とパレットの書き込みは UpdateAnimationsAll でまとめて行う
+	/// （呼ばれないまま描画・アニメーションの切り替え・再生状態の取得をした場合は、その時点でこのモデルの分だけを実行する）
 	/// @param deltaTime デルタタイム（秒）
 	void UpdateAnimation(float deltaTime);
 
 	/// @brief アニメーションをリセット
 	void ResetAnimation();
 
-	/// @brief アニメーション時刻を取得
+	/// @brief アニメーションLODを設定
+	/// 描画時のカメラから見た大きさで、次のフレームのポーズの評価頻度と評価するジョイントを決める
+	/// @param settings 設定（boundingRadius が0ならモデルの頂点から求める）
+	void SetAnimationLod(const AnimationLodSettings& settings);
+
+	/// @brief アニメーションLODの状態を取得
+	/// @return 状態（現在のLOD・画面上の大きさなど）
+	const AnimationLod& GetAnimationLod() const { return animationLod_; }
+
+	/// @brief アニメーション時刻を取得（予約中のアニメーション更新があれば先に実行する）
 	/// @return 現在のアニメーション時刻（秒）
-	float GetAnimationTime() const;
+	float GetAnimationTime();
 
-	/// @brief アニメーションが終了したか確認
+	/// @brief アニメーションが終了したか確認（予約中のアニメーション更新があれば先に実行する）
 	/// @return アニメーションが終了していればtrue
-	bool IsAnimationFinished() const;
+	bool IsAnimationFinished();
 
 	/// @brief アニメーションを切り替える（スケルトンアニメーション専用）
 	/// @param animationName 切り替えるアニメーション名
@@ -157,6 +195,18 @@ private:
 	// アニメーションコントローラー
 	std::unique_ptr<IAnimationController> animationController_;
 
+	// アニメーションLOD（描画時に記録したカメラから見た大きさで、アニメーション更新の頻度を決める）
+	AnimationLod animationLod_;
+
+	// アニメーションLODに使う境界球の半径（モデル空間）
+	float animationBoundingRadius_ = 0.0f;
+
+	// 予約中のアニメーション更新（UpdateAnimationsAll か描画・切り替えの直前に実行する）
+	bool animationUpdatePending_ = false;
+	AnimationLod::Action pendingAnimationAction_ = AnimationLod::Action::Evaluate;
+	float pendingAnimationDeltaTime_ = 0.0f;
+	size_t pendingAnimationIndex_ = 0; // 予約リスト内の位置
+
 	// 内部ヘルパーメソッド
 	/// @brief WVP行列データを更新
 	void UpdateTransformationMatrix(const WorldTransform& transform, const ICamera* camera);
@@ -164,6 +214,16 @@ private:
 	/// @brief SkinClusterを更新（スケルトンアニメーションの場合のみ）
 	void UpdateSkinCluster();
 
+	/// @brief 予約したアニメーション更新（ポーズの評価・補間とパレットの書き込み）を実行
+	/// UpdateAnimationsAll からワーカースレッドで呼ばれるため、このモデル以外の状態を書き換えない
+	void EvaluatePendingAnimation();
+
+	/// @brief 予約中のアニメーション更新があれば予約リストから外して実行
+	void ResolvePendingAnimation();
+
+	/// @brief 予約リストから外す（予約中の場合のみ呼ぶ）
+	void RemovePendingAnimation();
+
 	/// @brief 通常モデルの描画コマンドを設定
 	void SetupNormalDrawCommands(ID3D12GraphicsCommandList* cmdList,
 		D3D12_GPU_DESCRIPTOR_HANDLE textureHandle);
@@ -3,30 +3,45 @@
 #include <cassert>
 #include <format>
 #include "Engine/Graphics/Structs/VertexData.h"
+#include "Engine/Graphics/Model/Animation/AnimationLoader.h"
 #include "Engine/Math/MathCore.h"
 #include "Engine/Utility/Logger/Logger.h"
 #include "Engine/Utility/FileErrorDialog/FileErrorDialog.h"
 
-ModelData ModelLoader::LoadModelFile(const std::string& directoryPath, const std::string& filename)
+std::optional<ModelData> ModelLoader::LoadModelFile(const std::string& directoryPath, const std::string& filename, std::optional<Animation>* outAnimation,
+	MeshOptimizer::Report* outOptimizeReport)
 {
 	std::string fullPath = directoryPath + "/" + filename;
 	Logger::GetInstance().Log(std::format("Loading model: {} from directory: {}", filename, directoryPath), LogLevel::INFO, LogCategory::Graphics);
 
-	const aiScene* scene = LoadAssimpFile(fullPath);
+	// Importer がシーンを所有するので、読み込みごとに作る（非同期読み込みで複数のスレッドから呼ばれるため共有しない）
+	Assimp::Importer importer;
+	const aiScene* scene = LoadAssimpFile(importer, fullPath);
 	
 	if (!scene || !scene->HasMeshes()) {
-		std::string errorMsg = std::format("Failed to load model or model has no meshes: {}", fullPath);
-		Logger::GetInstance().Log(errorMsg, LogLevel::Error, LogCategory::Graphics);
-		assert(false && errorMsg.c_str());
+		Logger::GetInstance().Log(std::format("Failed to load model or model has no meshes: {}", fullPath), LogLevel::Error, LogCategory::Graphics);
+		return std::nullopt;
 	}
 
 	ModelData result;
 
+	// 全メッシュの頂点数・インデックス数で先に確保しておく
+	size_t vertexCount = 0;
+	size_t indexCount = 0;
+	for (uint32_t meshIndex = 0; meshIndex < scene->mNumMeshes; ++meshIndex) {
+		vertexCount += scene->mMeshes[meshIndex]->mNumVertices;
+		indexCount += static_cast<size_t>(scene->mMeshes[meshIndex]->mNumFaces) * 3;
+	}
+	result.vertices.reserve(vertexCount);
+	result.indices.reserve(indexCount);
+
 	// 全メッシュを統合して頂点データとインデックスデータを作成
 	for (uint32_t meshIndex = 0; meshIndex < scene->mNumMeshes; ++meshIndex) {
 		aiMesh* mesh = scene->mMeshes[meshIndex];
-		assert(mesh->HasNormals());
-		assert(mesh->HasTextureCoords(0));
+		if (!mesh->HasNormals() || !mesh->HasTextureCoords(0)) {
+			Logger::GetInstance().Log(std::format("Model mesh has no normals or texture coordinates: {}", fullPath), LogLevel::Error, LogCategory::Graphics);
+			return std::nullopt;
+		}
 
 		// 頂点データの変換
 		uint32_t baseVertexIndex = static_cast<uint32_t>(result.vertices.size());
@@ -72,7 +87,8 @@ ModelData ModelLoader::LoadModelFile(const std::string& directoryPath, const std
 			jointWeightData.inverseBindPoseMatrix = MathCore::Matrix::Inverse(bindPoseMatrix);
 
 			for (uint32_t weightIndex = 0; weightIndex < bone->mNumWeights; ++weightIndex) {
-				jointWeightData.vertexWeights.push_back({ bone->mWeights[weightIndex].mWeight, bone->mWeights[weightIndex].mVertexId });
+				// mVertexId はメッシュ内の番号なので、統合した頂点配列での番号にする
+				jointWeightData.vertexWeights.push_back({ bone->mWeights[weightIndex].mWeight, baseVertexIndex + bone->mWeights[weightIndex].mVertexId });
 			}
 		}
 
@@ -89,16 +105,33 @@ ModelData ModelLoader::LoadModelFile(const std::string& directoryPath, const std
 		}
 	}
 
+	// 頂点の統合と、頂点キャッシュ・オーバードロー・頂点フェッチのための並べ替え
+	const MeshOptimizer::Report optimizeReport = MeshOptimizer::Optimize(result);
+	Logger::GetInstance().Log(
+		std::format("Mesh optimized: {} (vertices {} -> {}, ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}, {} clusters)",
+			fullPath, optimizeReport.source.vertexCount, optimizeReport.optimized.vertexCount,
+			optimizeReport.source.GetAcmr(), optimizeReport.optimized.GetAcmr(),
+			optimizeReport.source.GetAtvr(), optimizeReport.optimized.GetAtvr(), optimizeReport.clusterCount),
+		LogLevel::INFO, LogCategory::Graphics);
+	if (outOptimizeReport) {
+		*outOptimizeReport = optimizeReport;
+	}
+
 	// Node階層構造の読み込み
 	result.rootNode = ReadNode(scene->mRootNode);
 
+	// 同じシーンから最初のアニメーションも読む（焼き込みファイルに一緒に保存するため）
+	if (outAnimation) {
+		*outAnimation = scene->mNumAnimations != 0
+			? std::optional<Animation>(AnimationLoader::ParseAnimation(scene, 0))
+			: std::nullopt;
+	}
+
 	return result;
 }
 
-const aiScene* ModelLoader::LoadAssimpFile(const std::string& filepath)
+const aiScene* ModelLoader::LoadAssimpFile(Assimp::Importer& importer, const std::string& filepath)
 {
-	static Assimp::Importer importer;
-
 	Logger::GetInstance().Log(std::format("Loading model file: {}", filepath), LogLevel::INFO, LogCategory::Graphics);
 
 	const aiScene* scene = importer.ReadFile(
@@ -114,7 +147,6 @@ const aiScene* ModelLoader::LoadAssimpFile(const std::string& filepath)
 			filepath, importer.GetErrorString());
 		Logger::GetInstance().Log(errorMsg, LogLevel::Error, LogCategory::Graphics);
 		FileErrorDialog::ShowModelError("Failed to load model file", filepath, importer.GetErrorString());
-		assert(false && errorMsg.c_str());
 		return nullptr;
 	}
 
@@ -4,8 +4,11 @@
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
+#include <optional>
 #include <string>
 
+#include "Engine/Graphics/Model/Animation/Animation.h"
+#include "Engine/Graphics/Model/MeshOptimizer.h"
 #include "Engine/Graphics/Structs/ModelData.h"
 #include "Engine/Graphics/Structs/Node.h"
 #include "Engine/Math/Matrix/Matrix4x4.h"
@@ -13,17 +16,22 @@
 /// @brief モデルファイル読み込みクラス
 class ModelLoader {
 public:
-	/// @brief モデルファイルを読み込む
+	/// @brief モデルファイルを読み込む（GPUを使わないので、ワーカースレッドからも呼べる）
+	/// 頂点・インデックスは MeshOptimizer で最適化してから返す
 	/// @param directoryPath ディレクトリパス
 	/// @param filename ファイル名
-	/// @return 読み込んだモデルデータ
-	static ModelData LoadModelFile(const std::string& directoryPath, const std::string& filename);
+	/// @param outAnimation 最初のアニメーションの出力先（nullptrなら読まない。アニメーションがなければnulloptになる）
+	/// @param outOptimizeReport 最適化の前後の計測結果の出力先（nullptrなら出力しない）
+	/// @return 読み込んだモデルデータ（ファイルがない・壊れている・メッシュがない場合はnullopt）
+	static std::optional<ModelData> LoadModelFile(const std::string& directoryPath, const std::string& filename, std::optional<Animation>* outAnimation = nullptr,
+		MeshOptimizer::Report* outOptimizeReport = nullptr);
 
 private:
 	/// @brief Assimpでファイルを読み込む
+	/// @param importer 読み込みに使うImporter（シーンはこれが破棄されるまで有効）
 	/// @param filepath ファイルパス
-	/// @return Assimpシーン
-	static const aiScene* LoadAssimpFile(const std::string& filepath);
+	/// @return Assimpシーン（失敗した場合はnullptr。エラーのダイアログを表示する）
+	static const aiScene* LoadAssimpFile(Assimp::Importer& importer, const std::string& filepath);
 
 	/// @brief Nodeを再帰的に読み込む
 	/// @param node AssimpのNode
@@ -1,19 +1,68 @@
 #include "ModelManager.h"
 #include "Engine/Graphics/Common/DirectXCommon.h"
 #include "Engine/Graphics/TextureManager.h"
+#include "Animation/AnimationCompressor.h"
 #include "Animation/AnimationLoader.h"
 #include "Animation/Animator.h"
 #include "Skeleton/SkeletonAnimator.h"
+#include "Engine/Utility/Logger/Logger.h"
 
 #include <cassert>
 #include <filesystem>
+#include <format>
 #include <algorithm>
 
-void ModelManager::Initialize(DirectXCommon* dxCommon, ResourceFactory* factory)
+/// @brief モデルリソースの非同期読み込みの要求
+/// ファイルの読み込みをワーカーで行い、GPUリソースの作成とキャッシュへの登録は Finalize で行う
+class ModelLoadRequest : public AsyncLoadRequest {
+public:
+	/// @param manager 登録先のマネージャー
+	/// @param normalizedPath 正規化されたパス（キャッシュのキー）
+	/// @param directoryPath ディレクトリパス
+	/// @param filename ファイル名
+	/// @param resource 初期化済みのリソース
+	ModelLoadRequest(ModelManager* manager, std::string normalizedPath, std::string directoryPath, std::string filename, std::unique_ptr<ModelResource> resource)
+		: AsyncLoadRequest(std::move(normalizedPath)), manager_(manager), directoryPath_(std::move(directoryPath)),
+		filename_(std::move(filename)), resource_(std::move(resource)) {}
+
+	/// @brief 既に読み込まれているリソースで完了済みにする
+	void SetLoadedResource(ModelResource* resource) {
+		result_ = resource;
+		SetCompleted();
+	}
+
+	/// @brief 結果（完了後に有効）
+	ModelResource* const* GetResult() const { return &result_; }
+
+protected:
+	bool Load() override {
+		return resource_->LoadCpuData(directoryPath_, filename_);
+	}
+
+	bool Finalize() override {
+		resource_->CreateGpuResources();
+		result_ = manager_->FinalizeAsyncLoad(GetName(), std::move(resource_));
+		return true;
+	}
+
+	void OnFailed() override {
+		manager_->pendingLoads_.erase(GetName());
+	}
+
+private:
+	ModelManager* manager_ = nullptr;
+	std::string directoryPath_;
+	std::string filename_;
+	std::unique_ptr<ModelResource> resource_;
+	ModelResource* result_ = nullptr;
+};
+
+void ModelManager::Initialize(DirectXCommon* dxCommon, ResourceFactory* factory, AsyncLoader* asyncLoader)
 {
 	assert(dxCommon && factory);
 	dxCommon_ = dxCommon;
 	resourceFactory_ = factory;
+	asyncLoader_ = asyncLoader;
 	Model::Initialize(dxCommon, factory);
 }
 
@@ -160,6 +209,11 @@ bool ModelManager::LoadAnimation(const AnimationLoadInfo& loadInfo)
 
 	ModelResource* resource = it->second.get();
 
+	// 同じ名前のアニメーションは登録済みのものを使い続ける（シーンの再初期化などで同じ読み込みが繰り返されるため）
+	if (resource->GetAnimations().contains(loadInfo.animationName)) {
+		return true;
+	}
+
 	// アニメーションファイル名が指定されていない場合はモデルファイル名と同じ
 	std::string animFilename = loadInfo.animationFilename.empty()
 		? loadInfo.modelFilename
@@ -171,14 +225,30 @@ bool ModelManager::LoadAnimation(const AnimationLoadInfo& loadInfo)
 		animFilename
 	);
 
-	// モデルリソースにアニメーションを追加
-	resource->AddAnimation(loadInfo.animationName, animation);
+	// 圧縮する場合は元のキーフレームを破棄し、圧縮したデータだけを保持する
+	if (loadInfo.compress) {
+		auto compressed = std::make_shared<CompressedAnimation>(
+			AnimationCompressor::Compress(animation, AnimationCompressor::Settings{}));
+		const AnimationCompressor::Report report = AnimationCompressor::Measure(animation, *compressed);
+		Logger::GetInstance().Log(
+			std::format("Animation compressed: {} | keys {} -> {} | {} -> {} bytes | max error translate {:.2e}, rotate {:.3f} deg, scale {:.2e}",
+				loadInfo.animationName, report.sourceKeyCount, report.compressedKeyCount, report.sourceBytes, report.compressedBytes,
+				report.maxTranslateError, report.maxRotateErrorDegrees, report.maxScaleError),
+			LogLevel::INFO, LogCategory::Graphics);
+		animation.compressed = std::move(compressed);
+		animation.nodeAnimations.clear();
+	}
 
-	return true;
+	// モデルリソースにアニメーションを追加（同じ名前が登録済みの場合は失敗）
+	return resource->AddAnimation(loadInfo.animationName, animation);
 }
 
 void ModelManager::ClearCache()
 {
+	// 読み込み中のリソースは仕上げでキャッシュに登録されるので、先に終わらせる
+	while (!pendingLoads_.empty()) {
+		WaitPendingLoad(pendingLoads_.begin()->first);
+	}
 	resourceCache_.clear();
 }
 
@@ -189,6 +259,70 @@ void ModelManager::LoadModelResource(const std::string& directoryPath, const std
 	LoadModelResourceInternal(resolvedPath, filename);
 }
 
+ModelManager::ModelLoadHandle ModelManager::LoadModelResourceAsync(const std::string& directoryPath, const std::string& filename)
+{
+	assert(IsInitialized());
+
+	// パスを解決
+	std::string resolvedPath = ResolveFilePath(directoryPath);
+	std::string normalizedPath = MakeNormalizedPath(resolvedPath, filename);
+
+	// キャッシュに存在するなら完了済みのハンドルを返す
+	auto it = resourceCache_.find(normalizedPath);
+	if (it != resourceCache_.end()) {
+		auto request = std::make_shared<ModelLoadRequest>(this, normalizedPath, resolvedPath, filename, nullptr);
+		request->SetLoadedResource(it->second.get());
+		return ModelLoadHandle(request, request->GetResult());
+	}
+
+	// 読み込み中なら同じ要求を返す
+	auto pendingIt = pendingLoads_.find(normalizedPath);
+	if (pendingIt != pendingLoads_.end()) {
+		return ModelLoadHandle(pendingIt->second, pendingIt->second->GetResult());
+	}
+
+	auto resource = std::make_unique<ModelResource>();
+	resource->Initialize(dxCommon_, resourceFactory_, &TextureManager::GetInstance());
+
+	auto request = std::make_shared<ModelLoadRequest>(this, normalizedPath, resolvedPath, filename, std::move(resource));
+	pendingLoads_[normalizedPath] = request;
+
+	// 非同期読み込みを使わない設定なら、ここで読み込みまで終わらせる
+	if (asyncLoader_) {
+		asyncLoader_->Submit(request);
+	} else {
+		AsyncLoader immediateLoader;
+		immediateLoader.Submit(request);
+		immediateLoader.WaitAll();
+	}
+
+	return ModelLoadHandle(request, request->GetResult());
+}
+
+void ModelManager::WaitPendingLoad(const std::string& normalizedPath)
+{
+	auto it = pendingLoads_.find(normalizedPath);
+	if (it == pendingLoads_.end()) {
+		return;
+	}
+
+	// 仕上げの中で pendingLoads_ から削除されるので、要求を保持してから待つ
+	const std::shared_ptr<ModelLoadRequest> request = it->second;
+	asyncLoader_->Wait(*request);
+
+	// AsyncLoader が終了済みで仕上げが行われなかった場合も、読み込み中から外す
+	pendingLoads_.erase(normalizedPath);
+}
+
+ModelResource* ModelManager::FinalizeAsyncLoad(const std::string& normalizedPath, std::unique_ptr<ModelResource> resource)
+{
+	pendingLoads_.erase(normalizedPath);
+
+	ModelResource* resourcePtr = resource.get();
+	resourceCache_[normalizedPath] = std::move(resource);
+	return resourcePtr;
+}
+
 ModelResource* ModelManager::LoadModelResourceInternal(const std::string& directoryPath, const std::string& filename)
 {
 	assert(IsInitialized());
@@ -196,6 +330,9 @@ ModelResource* ModelManager::LoadModelResourceInternal(const std::string& direct
 	// 正規化されたパスをキャッシュキーとする
 	std::string normalizedPath = MakeNormalizedPath(directoryPath, filename);
 
+	// 非同期で読み込み中なら完了まで待つ（成功していればキャッシュに登録される）
+	WaitPendingLoad(normalizedPath);
+
 	// キャッシュに存在するか確認
 	auto it = resourceCache_.find(normalizedPath);
 	if (it != resourceCache_.end()) {
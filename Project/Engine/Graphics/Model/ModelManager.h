@@ -7,9 +7,11 @@
 #include "ModelResource.h"
 #include "Model.h"
 #include "Animation/Animation.h"
+#include "Engine/Graphics/Resource/AsyncLoader.h"
 
 class DirectXCommon;
 class ResourceFactory;
+class ModelLoadRequest;
 
 /// @brief アニメーション読み込み情報
 struct AnimationLoadInfo {
@@ -17,16 +19,21 @@ struct AnimationLoadInfo {
 	std::string modelFilename;  // モデルファイル名
 	std::string animationName;  // アニメーション名（識別用）
 	std::string animationFilename = "";  // アニメーションファイル名（空の場合はmodelFilenameと同じ）
+	bool compress = false;  // 読み込み後に圧縮するか（キーフレームの削減と量子化。許容誤差は AnimationCompressor::Settings の既定値）
 };
 
 /// @brief モデルリソースとインスタンスを管理するマネージャークラス
 /// リソースのキャッシュとインスタンスの生成を担当
 class ModelManager {
 public:
+	/// @brief 非同期読み込みのハンドル
+	using ModelLoadHandle = AsyncLoadHandle<ModelResource*>;
+
 	/// @brief 初期化
 	/// @param dxCommon DirectXCommonのポインタ
 	/// @param factory リソースファクトリのポインタ
-	void Initialize(DirectXCommon* dxCommon, ResourceFactory* factory);
+	/// @param asyncLoader 非同期読み込みの管理クラス（nullptrなら LoadModelResourceAsync も同期で読み込む）
+	void Initialize(DirectXCommon* dxCommon, ResourceFactory* factory, AsyncLoader* asyncLoader = nullptr);
 
 	/// @brief 静的モデルを作成（アニメーションなし）
 	/// @param filePath ファイルパス（Assetsフォルダを省略可能）
@@ -56,6 +63,7 @@ public:
 	);
 
 	/// @brief アニメーションをモデルリソースに追加
+	/// 同じ名前のアニメーションが登録済みの場合は読み込まず、登録済みのものを使う
 	/// @param loadInfo アニメーション読み込み情報
 	/// @return 成功したらtrue
 	bool LoadAnimation(const AnimationLoadInfo& loadInfo);
@@ -77,12 +85,26 @@ public:
 	/// @param filename ファイル名
 	void LoadModelResource(const std::string& directoryPath, const std::string& filename);
 
+	/// @brief モデルリソースを非同期で事前読み込み（シーンで使用）
+	/// ファイルの読み込み（焼き込みファイル・Assimp）とSkeletonの作成はワーカースレッドで行い、
+	/// 頂点・インデックスバッファの作成は AsyncLoader::Update で行う
+	/// 読み込み中に同じモデルで Create〇〇Model を呼んだ場合は、その場で完了まで待つ
+	/// @param directoryPath ディレクトリパス（Assetsフォルダを省略可能）
+	/// @param filename ファイル名
+	/// @return 読み込みのハンドル（キャッシュにある場合は完了済み）
+	ModelLoadHandle LoadModelResourceAsync(const std::string& directoryPath, const std::string& filename);
+
 private:
+	friend class ModelLoadRequest;
+
 	// DirectXCommon
 	DirectXCommon* dxCommon_ = nullptr;
 	
 	// リソースファクトリ
 	ResourceFactory* resourceFactory_ = nullptr;
+
+	// 非同期読み込みの管理クラス
+	AsyncLoader* asyncLoader_ = nullptr;
 	
 	// デフォルトのベースパス
 	const std::string basePath_ = "Assets/";
@@ -90,6 +112,19 @@ private:
 	// ファイルパスをキーとしたリソースキャッシュ
 	std::unordered_map<std::string, std::unique_ptr<ModelResource>> resourceCache_;
 
+	// 非同期で読み込み中のリソース（キーはキャッシュと同じ）
+	std::unordered_map<std::string, std::shared_ptr<ModelLoadRequest>> pendingLoads_;
+
+	/// @brief 読み込み中のリソースがあれば完了まで待つ
+	/// @param normalizedPath 正規化されたパス
+	void WaitPendingLoad(const std::string& normalizedPath);
+
+	/// @brief 非同期読み込みの仕上げ（ModelLoadRequest から描画スレッドで呼ばれる）
+	/// @param normalizedPath 正規化されたパス
+	/// @param resource GPUリソースまで作成したリソース
+	/// @return キャッシュに登録されたリソース
+	ModelResource* FinalizeAsyncLoad(const std::string& normalizedPath, std::unique_ptr<ModelResource> resource);
+
 	/// @brief フルパスを解決（Assetsフォルダを自動的に追加）
 	/// @param filePath 入力パス
 	/// @return 解決されたフルパス
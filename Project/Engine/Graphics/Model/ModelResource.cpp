@@ -3,10 +3,18 @@
 #include "Engine/Graphics/TextureManager.h"
 #include "Engine/Graphics/Resource/ResourceFactory.h"
 #include "Engine/Graphics/Model/ModelLoader.h"
+#include "Engine/Graphics/Model/Cooked/CookedModel.h"
+#include "Engine/Graphics/Model/Cooked/ModelCooker.h"
 #include "Engine/Graphics/Model/Skeleton/SkeletonLoader.h"
+#include "Engine/Graphics/Model/VertexPacker.h"
 #include "Engine/Graphics/Structs/VertexData.h"
+#include "Engine/Utility/Logger/Logger.h"
 
 #include <cassert>
+#include <cstring>
+#include <format>
+
+ModelResource::~ModelResource() = default;
 
 void ModelResource::Initialize(DirectXCommon* dxCommon, ResourceFactory* factory, TextureManager* textureMg)
 {
@@ -17,63 +25,135 @@ void ModelResource::Initialize(DirectXCommon* dxCommon, ResourceFactory* factory
 
 void ModelResource::LoadFromFile(const std::string& directoryPath, const std::string& filename)
 {
-    assert(dxCommon_ && resourceFactory_ && textureManager_);
-    
-    // ModelLoaderを使用してモデルデータを読み込む
-    ModelData modelData = ModelLoader::LoadModelFile(directoryPath, filename);
-    
-    // ModelDataを保存（スキンクラスター生成に必要）
-    modelData_ = modelData;
-    
+    // 読み込めなかった場合は LoadModelFile がエラーを表示している（リリースビルドではGPUリソースを作らずに IsLoaded を false のままにする）
+    const bool loaded = LoadCpuData(directoryPath, filename);
+    assert(loaded && "ModelResource::LoadFromFile failed to load the model file");
+    if (!loaded) {
+        return;
+    }
+    CreateGpuResources();
+}
+
+bool ModelResource::LoadCpuData(const std::string& directoryPath, const std::string& filename)
+{
+    const std::string sourcePath = directoryPath + "/" + filename;
+
+    auto cookedModel = std::make_unique<CookedModel>();
+    if (cookedModel->Open(sourcePath)) {
+        // 焼き込みファイルから読み込む（頂点・インデックスはマップしたメモリからそのままGPUへ転送する）
+        modelData_.skinClusterData = cookedModel->BuildSkinClusterData();
+        modelData_.material = cookedModel->BuildMaterial();
+        modelData_.rootNode = cookedModel->BuildRootNode();
+        vertices_ = cookedModel->GetVertices();
+        indices_ = cookedModel->GetIndices();
+        cookedModel_ = std::move(cookedModel);
+        Logger::GetInstance().Log(std::format("Model loaded from cooked file: {}", sourcePath), LogLevel::INFO, LogCategory::Graphics);
+    } else {
+        // ModelLoaderを使用してモデルデータを読み込み、次回のために焼き込んでおく
+        std::optional<Animation> animation;
+        std::optional<ModelData> modelData = ModelLoader::LoadModelFile(directoryPath, filename, &animation);
+        if (!modelData) {
+            return false;
+        }
+        modelData_ = std::move(*modelData);
+        ModelCooker::Write(sourcePath, modelData_, animation ? &*animation : nullptr);
+        vertices_ = modelData_.vertices;
+        indices_ = modelData_.indices;
+    }
+
     // RootNodeを保存
-    rootNode_ = modelData.rootNode;
-    
+    rootNode_ = modelData_.rootNode;
+
     // Skeletonを作成
-    skeleton_ = SkeletonLoader::CreateSkeleton(modelData.rootNode);
-    
+    skeleton_ = SkeletonLoader::CreateSkeleton(modelData_.rootNode);
+
     // マテリアルデータを保存
-    materialData_ = modelData.material;
-    
+    materialData_ = modelData_.material;
+
     // 頂点数を設定
-    vertexCount_ = static_cast<UINT>(modelData.vertices.size());
-    
+    vertexCount_ = static_cast<UINT>(vertices_.size());
+
     // インデックス数を設定
-    indexCount_ = static_cast<UINT>(modelData.indices.size());
-    
-    // 頂点バッファの作成
+    indexCount_ = static_cast<UINT>(indices_.size());
+
+    // GPU用の形式に変換（位置と属性のストリームに分け、法線・UVを圧縮。頂点数が少なければインデックスを16bitに）
+    VertexPacker::PackVertices(vertices_, packedPositions_, packedAttributes_);
+    if (VertexPacker::CanUse16BitIndices(vertices_.size())) {
+        VertexPacker::PackIndices(indices_, packedIndices16_);
+    }
+
+    // サイズは数から計算するだけ。誤差の計測は全頂点を戻すので、デバッグビルドだけで行う
+    VertexPacker::Report report = VertexPacker::MeasureSize(vertices_.size(), indices_.size());
+#ifdef _DEBUG
+    VertexPacker::MeasureError(vertices_, packedAttributes_, report);
+    Logger::GetInstance().Log(
+        std::format("Model vertex stream packed: {} ({} -> {} bytes, normal error {:.3f} deg, uv error {:.6f})",
+            sourcePath, report.sourceBytes, report.packedBytes, report.maxNormalErrorDegrees, report.maxTexcoordError),
+        LogLevel::INFO, LogCategory::Graphics);
+#else
+    Logger::GetInstance().Log(
+        std::format("Model vertex stream packed: {} ({} -> {} bytes)", sourcePath, report.sourceBytes, report.packedBytes),
+        LogLevel::INFO, LogCategory::Graphics);
+#endif
+
+    // ファイルパスを保存（デバッグ用）
+    filePath_ = sourcePath;
+    return true;
+}
+
+void ModelResource::CreateGpuResources()
+{
+    assert(dxCommon_ && resourceFactory_ && textureManager_);
+
+    // 頂点バッファの作成（位置のストリームの後ろに属性のストリームを並べて1つのバッファにまとめる）
+    const UINT positionBytes = static_cast<UINT>(sizeof(Vector3) * packedPositions_.size());
+    const UINT attributeBytes = static_cast<UINT>(sizeof(PackedVertexAttribute) * packedAttributes_.size());
     vertexBuffer_ = ResourceFactory::CreateBufferResource(
         dxCommon_->GetDevice(),
-        sizeof(VertexData) * modelData.vertices.size());
+        positionBytes + attributeBytes);
+
+    // 頂点バッファビューの設定（Slot 0: 位置、Slot 1: 法線・UV）
+    positionBufferView_.BufferLocation = vertexBuffer_->GetGPUVirtualAddress();
+    positionBufferView_.SizeInBytes = positionBytes;
+    positionBufferView_.StrideInBytes = sizeof(Vector3);
 
-    // 頂点バッファビューの設定
-    vertexBufferView_.BufferLocation = vertexBuffer_->GetGPUVirtualAddress();
-    vertexBufferView_.SizeInBytes = static_cast<UINT>(sizeof(VertexData) * modelData.vertices.size());
-    vertexBufferView_.StrideInBytes = sizeof(VertexData);
+    attributeBufferView_.BufferLocation = vertexBuffer_->GetGPUVirtualAddress() + positionBytes;
+    attributeBufferView_.SizeInBytes = attributeBytes;
+    attributeBufferView_.StrideInBytes = sizeof(PackedVertexAttribute);
 
     // 頂点データをGPUメモリにコピー
-    void* mapped = nullptr;
-    vertexBuffer_->Map(0, nullptr, &mapped);
-    memcpy(mapped, modelData.vertices.data(), sizeof(VertexData) * modelData.vertices.size());
+    uint8_t* mapped = nullptr;
+    vertexBuffer_->Map(0, nullptr, reinterpret_cast<void**>(&mapped));
+    std::memcpy(mapped, packedPositions_.data(), positionBytes);
+    std::memcpy(mapped + positionBytes, packedAttributes_.data(), attributeBytes);
     vertexBuffer_->Unmap(0, nullptr);
-    
+
+    // インデックスは16bitに変換できていればそちらを使う
+    const bool use16BitIndices = !packedIndices16_.empty() || indices_.empty();
+    const void* indexData = use16BitIndices ? static_cast<const void*>(packedIndices16_.data()) : static_cast<const void*>(indices_.data());
+    const UINT indexBytes = static_cast<UINT>((use16BitIndices ? sizeof(uint16_t) : sizeof(uint32_t)) * indices_.size());
+
     // インデックスバッファの作成
     indexBuffer_ = ResourceFactory::CreateBufferResource(
         dxCommon_->GetDevice(),
-        sizeof(uint32_t) * modelData.indices.size());
+        indexBytes);
     
     // インデックスバッファビューの設定
     indexBufferView_.BufferLocation = indexBuffer_->GetGPUVirtualAddress();
-    indexBufferView_.SizeInBytes = static_cast<UINT>(sizeof(uint32_t) * modelData.indices.size());
-    indexBufferView_.Format = DXGI_FORMAT_R32_UINT;
+    indexBufferView_.SizeInBytes = indexBytes;
+    indexBufferView_.Format = use16BitIndices ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
     
     // インデックスデータをGPUメモリにコピー
     void* mappedIndex = nullptr;
     indexBuffer_->Map(0, nullptr, &mappedIndex);
-    memcpy(mappedIndex, modelData.indices.data(), sizeof(uint32_t) * modelData.indices.size());
+    std::memcpy(mappedIndex, indexData, indexBytes);
     indexBuffer_->Unmap(0, nullptr);
+
+    // 転送したので圧縮した頂点は不要（元の頂点は GetVertices 用に残す）
+    packedPositions_ = {};
+    packedAttributes_ = {};
+    packedIndices16_ = {};
     
-    // ファイルパスを保存（デバッグ用）
-    filePath_ = directoryPath + "/" + filename;
     isLoaded_ = true;
 }
 
@@ -96,6 +176,13 @@ const Animation* ModelResource::GetAnimation(const std::string& name) const {
     return nullptr;
 }
 
-void ModelResource::AddAnimation(const std::string& name, const Animation& animation) {
-    animations_[name] = animation;
+bool ModelResource::AddAnimation(const std::string& name, const Animation& animation) {
+    // 上書きすると SkeletonAnimator が保持している対応付け（AnimationBinding）が無効になる
+    if (!animations_.try_emplace(name, animation).second) {
+        Logger::GetInstance().Log(
+            std::format("Animation '{}' is already registered; the new animation was not added", name),
+            LogLevel::WARNING, LogCategory::Graphics);
+        return false;
+    }
+    return true;
 }
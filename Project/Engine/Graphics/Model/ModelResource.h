@@ -4,11 +4,15 @@
 #include <wrl.h>
 #include <string>
 #include <map>
+#include <memory>
 #include <optional>
+#include <span>
+#include <vector>
 
 #include "Engine/Graphics/Structs/MaterialData.h"
 #include "Engine/Graphics/Structs/ModelData.h"
 #include "Engine/Graphics/Structs/Node.h"
+#include "Engine/Graphics/Structs/VertexData.h"
 #include "Animation/Animation.h"
 #include "Skeleton/Skeleton.h"
 
@@ -16,6 +20,7 @@
 class DirectXCommon;
 class ResourceFactory;
 class TextureManager;
+class CookedModel;
 
 /// @brief モデルの共有リソースを管理するクラス
 /// モデルファイル1個分のメッシュデータとGPUリソースを保持
@@ -26,7 +31,7 @@ public:
 	ModelResource() = default;
 
 	/// @brief デストラクタ
-	~ModelResource() = default;
+	~ModelResource();
 
 	/// @brief 初期化
 	/// @param dxCommon DirectXCommonのポインタ
@@ -35,10 +40,22 @@ public:
 	void Initialize(DirectXCommon* dxCommon, ResourceFactory* factory, TextureManager* textureMg);
 
 	/// @brief モデルファイルの読み込みとGPU転送（OBJ、glTF、FBXなど対応）
+	/// 焼き込みファイル（ModelCooker）があればメモリマップして読み、Assimpは使わない
+	/// なければAssimpで読み込み、次回のために焼き込みファイルを書き出す
 	/// @param directoryPath ディレクトリパス
 	/// @param filename ファイル名
 	void LoadFromFile(const std::string& directoryPath, const std::string& filename);
 
+	/// @brief LoadFromFile のうちGPUを使わない部分（ファイルの読み込み・焼き込み・Skeletonの作成・頂点の圧縮）
+	/// Initialize していなくても呼べるので、ワーカースレッドで実行できる
+	/// @param directoryPath ディレクトリパス
+	/// @param filename ファイル名
+	/// @return 読み込めたらtrue（ファイルがない・壊れている場合はfalse。GPUリソースは作らないこと）
+	bool LoadCpuData(const std::string& directoryPath, const std::string& filename);
+
+	/// @brief LoadFromFile のうちGPUを使う部分（頂点・インデックスバッファの作成と転送。描画スレッドで呼ぶ）
+	void CreateGpuResources();
+
 	/// @brief GPUリソースが作成されているか確認
 	/// @return リソースが有効ならtrue
 	bool IsLoaded() const { return isLoaded_; }
@@ -51,6 +68,17 @@ public:
 	/// @return 頂点数
 	UINT GetVertexCount() const { return vertexCount_; }
 
+	/// @brief 頂点データを取得
+	/// @return 頂点データ（焼き込みファイルから読んだ場合はマップしたファイルを直接指す）
+	std::span<const VertexData> GetVertices() const { return vertices_; }
+
+	/// @brief インデックスデータを取得
+	/// @return インデックスデータ
+	std::span<const int32_t> GetIndices() const { return indices_; }
+
+	/// @brief 焼き込みファイルから読み込んだか
+	bool IsLoadedFromCookedFile() const { return cookedModel_ != nullptr; }
+
 	/// @brief RootNodeを取得
 	/// @return RootNode
 	const Node& GetRootNode() const { return rootNode_; }
@@ -60,6 +88,7 @@ public:
 	const std::optional<Skeleton>& GetSkeleton() const { return skeleton_; }
 
 	/// @brief ModelDataを取得
+	/// 焼き込みファイルから読んだ場合 vertices / indices は空なので、GetVertices / GetIndices を使う
 	/// @return ModelData
 	const ModelData& GetModelData() const { return modelData_; }
 
@@ -77,16 +106,19 @@ public:
 	const std::map<std::string, Animation>& GetAnimations() const { return animations_; }
 
 	/// @brief アニメーションを追加
+	/// 再生中のアニメーターがチャンネルを直接参照しているため、同じ名前のアニメーションは上書きしない
 	/// @param name アニメーション名
 	/// @param animation アニメーションデータ
-	void AddAnimation(const std::string& name, const Animation& animation);
+	/// @return 追加できた場合true（同じ名前のアニメーションが既にある場合はfalse）
+	bool AddAnimation(const std::string& name, const Animation& animation);
 
 private:
 	friend class Model;
 	friend class ModelParticleRenderer;
 
-	Microsoft::WRL::ComPtr<ID3D12Resource> vertexBuffer_;
-	D3D12_VERTEX_BUFFER_VIEW vertexBufferView_{};
+	Microsoft::WRL::ComPtr<ID3D12Resource> vertexBuffer_;  // 位置のストリーム → 属性のストリームの順に格納
+	D3D12_VERTEX_BUFFER_VIEW positionBufferView_{};        // Slot 0: 位置（float3）
+	D3D12_VERTEX_BUFFER_VIEW attributeBufferView_{};       // Slot 1: 法線・UV（PackedVertexAttribute）
 	UINT vertexCount_ = 0;
 	
 	Microsoft::WRL::ComPtr<ID3D12Resource> indexBuffer_;
@@ -94,6 +126,12 @@ private:
 	UINT indexCount_ = 0;
 	
 	ModelData modelData_;
+	std::unique_ptr<CookedModel> cookedModel_; // 焼き込みファイル（読み込んだ場合のみ。頂点・インデックスはここを指す）
+	std::span<const VertexData> vertices_;
+	std::span<const int32_t> indices_;
+	std::vector<Vector3> packedPositions_;                 // GPU転送用に圧縮した頂点（転送後に解放する）
+	std::vector<PackedVertexAttribute> packedAttributes_;
+	std::vector<uint16_t> packedIndices16_;                // 16bitインデックス（使えない場合は空で、indices_ をそのまま転送する）
 	MaterialData materialData_;
 	Node rootNode_;
 	std::optional<Skeleton> skeleton_;
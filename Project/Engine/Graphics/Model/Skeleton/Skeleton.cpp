@@ -0,0 +1,24 @@
+#include "Skeleton.h"
+#include "Engine/Math/MathCore.h"
+#include <cassert>
+
+void Skeleton::UpdateSkeletonSpaceMatrices() {
+    const size_t jointCount = transforms.size();
+    assert(parents.size() == jointCount && skeletonSpaceMatrices.size() == jointCount);
+    if (jointCount == 0) {
+        return;
+    }
+
+    // ルートには親がないので、ローカル行列とスケルトン空間行列は一致する
+    const QuaternionTransform& root = transforms[0];
+    skeletonSpaceMatrices[0] = MathCore::Matrix::MakeAffine(root.scale, root.rotate, root.translate);
+
+    // 親のスケルトン空間行列は更新済み
+    for (size_t i = 1; i < jointCount; ++i) {
+        const QuaternionTransform& transform = transforms[i];
+        skeletonSpaceMatrices[i] = MathCore::Matrix::Multiply(
+            MathCore::Matrix::MakeAffine(transform.scale, transform.rotate, transform.translate),
+            skeletonSpaceMatrices[parents[i]]
+        );
+    }
+}
@@ -1,11 +1,33 @@
 #pragma once
-#include "Joint.h"
+#include "Engine/Math/QuaternionTransform.h"
+#include "Engine/Math/Matrix/Matrix4x4.h"
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
+
+/// @brief ジョイントの名前と親子関係（ポーズの評価では参照しない情報）
+/// 読み込み後は変更しないので、Skeleton をコピーしても共有される
+struct SkeletonHierarchy {
+    std::vector<std::string> names;             // ジョイントのIndex順の名前
+    std::vector<std::vector<int32_t>> children; // ジョイントのIndex順の子JointのIndexのリスト
+    std::map<std::string, int32_t> jointMap;    // Joint名とIndexの辞書
+};
 
 /// @brief Skeleton構造体
+/// ジョイントの情報はIndex順の配列で持つ。親は必ず子より前に並び、Index 0 がルートになる
+/// （SkeletonLoader が深さ優先の順に並べる）
 struct Skeleton {
-    int32_t root;      // RootJointのIndex
-    std::map<std::string, int32_t> jointMap;   // Joint名とIndexの辞書
-    std::vector<Joint> joints;          // 所属しているジョイント
+    std::vector<int32_t> parents;                 // 親JointのIndex（ルートは -1。それ以外は自身のIndexより小さい）
+    std::vector<QuaternionTransform> transforms;  // ローカルの変換
+    std::vector<Matrix4x4> skeletonSpaceMatrices; // skeletonSpaceでの変換行列
+    std::shared_ptr<const SkeletonHierarchy> hierarchy; // 名前・子のリスト
+
+    /// @brief ジョイント数を取得
+    size_t GetJointCount() const { return parents.size(); }
+
+    /// @brief ローカルの変換からスケルトン空間行列を更新
+    /// 親が子より前に並んでいるので、Index順に1回走査するだけで済む
+    void UpdateSkeletonSpaceMatrices();
 };
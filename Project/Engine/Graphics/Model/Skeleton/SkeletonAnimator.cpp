@@ -7,12 +7,21 @@
 SkeletonAnimator::SkeletonAnimator(const Skeleton& skeleton, const Animation& animation, bool looping)
     : skeleton_(skeleton)
     , animation_(&animation)
+    , binding_(AnimationBinding::Create(skeleton_, animation))
+    , cursors_(binding_.jointIndices.size())
     , animationTime_(0.0f)
     , isLooping_(looping) {
     assert(animation_);
+    pose_.Reset(skeleton_);
 }
 
 void SkeletonAnimator::Update(float deltaTime) {
+    // ポーズを更新してスケルトンに書き込み、行列を更新
+    UpdatePose(deltaTime);
+    ApplyPoseToSkeleton();
+}
+
+void SkeletonAnimator::UpdatePose(float deltaTime) {
     // 時刻を進める
     animationTime_ += deltaTime;
 
@@ -23,53 +32,56 @@ void SkeletonAnimator::Update(float deltaTime) {
         animationTime_ = std::min(animationTime_, animation_->duration);
     }
 
-    // スケルトンにアニメーションを適用して行列を更新
-    ApplyAnimationAndUpdateMatrices();
+    // アニメーションをポーズに書き込む
+    SamplePose();
 }
 
 bool SkeletonAnimator::IsFinished() const {
     return !isLooping_ && animationTime_ >= animation_->duration;
 }
 
-void SkeletonAnimator::ApplyAnimationAndUpdateMatrices() {
-    // すべてのJointに対してアニメーションを適用して行列を更新
-    for (Joint& joint : skeleton_.joints) {
-        // アニメーションデータがあれば適用
-        auto it = animation_->nodeAnimations.find(joint.name);
-        if (it != animation_->nodeAnimations.end()) {
-            const NodeAnimation& nodeAnimation = it->second;
-            
-            // translate, rotate, scaleの値を計算
-            joint.transform.translate = AnimationUtils::CalculateVector3(
-                nodeAnimation.translate.keyframes, 
-                animationTime_
-            );
-            joint.transform.rotate = AnimationUtils::CalculateQuaternion(
-                nodeAnimation.rotate.keyframes, 
-                animationTime_
-            );
-            joint.transform.scale = AnimationUtils::CalculateVector3(
-                nodeAnimation.scale.keyframes, 
-                animationTime_
-            );
-        }
+void SkeletonAnimator::SamplePose() {
+    // 末端のジョイントを省略する場合は、子を持つジョイントのチャンネルだけを評価する（末端のチャンネルは後ろにまとまっている）
+    const size_t channelCount = skipLeafJoints_ ? binding_.leafChannelBegin : binding_.jointIndices.size();
 
-        // TransformからlocalMatrixを更新
-        joint.localMatrix = MathCore::Matrix::MakeAffine(
-            joint.transform.scale,
-            joint.transform.rotate,
-            joint.transform.translate
-        );
+    // 圧縮されたアニメーションはキーフレームをその場で展開しながら書き込む
+    if (const CompressedAnimation* compressed = animation_->compressed.get()) {
+        for (size_t i = 0; i < channelCount; ++i) {
+            const CompressedNodeAnimation& nodeAnimation = *binding_.compressedChannels[i];
+            AnimationUtils::NodeAnimationCursor& cursor = cursors_[i];
+            QuaternionTransform& transform = pose_.transforms[binding_.jointIndices[i]];
 
-        // 親がいれば親の行列を掛ける
-        if (joint.parent) {
-            joint.skeletonSpaceMatrix = MathCore::Matrix::Multiply(
-                joint.localMatrix,
-                skeleton_.joints[*joint.parent].skeletonSpaceMatrix
-            );
-        } else {
-            // 親がいないのでlocalMatrixとskeletonSpaceMatrixは一致する
-            joint.skeletonSpaceMatrix = joint.localMatrix;
+            transform.translate = AnimationUtils::CalculateVector3(
+                nodeAnimation.translate, compressed->translateBounds, compressed->timeScale, animationTime_, cursor.translate);
+            transform.rotate = AnimationUtils::CalculateQuaternion(
+                nodeAnimation.rotate, compressed->timeScale, animationTime_, cursor.rotate);
+            transform.scale = AnimationUtils::CalculateVector3(
+                nodeAnimation.scale, compressed->scaleBounds, compressed->timeScale, animationTime_, cursor.scale);
         }
+        return;
+    }
+
+    // 対応付け済みのチャンネルをポーズに書き込む（名前の検索は生成時に済ませてある）
+    for (size_t i = 0; i < channelCount; ++i) {
+        const NodeAnimation& nodeAnimation = *binding_.channels[i];
+        AnimationUtils::NodeAnimationCursor& cursor = cursors_[i];
+        QuaternionTransform& transform = pose_.transforms[binding_.jointIndices[i]];
+
+        // translate, rotate, scaleの値を計算（前回の区間から探索する）
+        transform.translate = AnimationUtils::CalculateVector3(
+            nodeAnimation.translate, 
+            animationTime_,
+            cursor.translate
+        );
+        transform.rotate = AnimationUtils::CalculateQuaternion(
+            nodeAnimation.rotate, 
+            animationTime_,
+            cursor.rotate
+        );
+        transform.scale = AnimationUtils::CalculateVector3(
+            nodeAnimation.scale, 
+            animationTime_,
+            cursor.scale
+        );
     }
 }
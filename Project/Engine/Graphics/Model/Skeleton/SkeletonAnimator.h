@@ -1,6 +1,10 @@
 #pragma once
 #include "Skeleton.h"
 #include "Engine/Graphics/Model/Animation/Animation.h"
+#include "Engine/Graphics/Model/Animation/AnimationBinding.h"
+#include "Engine/Graphics/Model/Animation/AnimationPose.h"
+#include "Engine/Graphics/Model/Animation/AnimationUtils.h"
+#include <vector>
 #include "Engine/Graphics/Model/Animation/IAnimationController.h"
 
 /// @brief スケルトンアニメーションコントローラー
@@ -16,10 +20,21 @@ public:
     /// @brief デストラクタ
     ~SkeletonAnimator() override = default;
 
-    /// @brief アニメーションを更新
+    /// @brief アニメーションを更新（ポーズを更新してスケルトンの行列まで計算する）
     /// @param deltaTime デルタタイム（秒）
     void Update(float deltaTime) override;
 
+    /// @brief 再生時刻を進めてポーズだけを更新（スケルトンの行列は計算しない。ブレンドの入力に使う）
+    /// @param deltaTime デルタタイム（秒）
+    void UpdatePose(float deltaTime);
+
+    /// @brief 現在のポーズをスケルトンに書き込み、行列を更新
+    void ApplyPoseToSkeleton() { pose_.ApplyTo(skeleton_); }
+
+    /// @brief ポーズを取得
+    /// @return 現在のポーズ（ジョイントのIndex順のローカルの変換）
+    const AnimationPose& GetPose() const { return pose_; }
+
     /// @brief アニメーション時刻を取得
     /// @return 現在の再生時刻（秒）
     float GetAnimationTime() const override { return animationTime_; }
@@ -31,6 +46,11 @@ public:
     /// @return アニメーションが終了していればtrue
     bool IsFinished() const override;
 
+    /// @brief 末端のジョイント（子を持たない）のアニメーションを省略するか設定
+    /// 省略したジョイントは最後に評価したときの変換のままになる
+    /// @param skip 省略するか
+    void SetSkipLeafJoints(bool skip) override { skipLeafJoints_ = skip; }
+
     /// @brief ループ再生を設定
     /// @param loop ループ再生するか
     void SetLooping(bool loop) { isLooping_ = loop; }
@@ -45,18 +65,30 @@ public:
     const Skeleton& GetSkeleton() const { return skeleton_; }
 
 private:
-    /// @brief スケルトンにアニメーションを適用して行列を更新
-    void ApplyAnimationAndUpdateMatrices();
+    /// @brief 現在の再生時刻でアニメーションをサンプリングしてポーズに書き込む
+    void SamplePose();
 
     // スケルトン（コピーして保持）
     Skeleton skeleton_;
     
     // 再生中のアニメーション
     const Animation* animation_;
+
+    // アニメーションのチャンネルとジョイントの対応付け（生成時に1度だけ作成）
+    AnimationBinding binding_;
+
+    // チャンネルごとのキーフレーム探索カーソル（binding_.jointIndices と同じ順）
+    std::vector<AnimationUtils::NodeAnimationCursor> cursors_;
+
+    // アニメーションを書き込むポーズ（チャンネルのないジョイントはスケルトンの初期の変換のまま）
+    AnimationPose pose_;
     
     // 現在の再生時刻（秒）
     float animationTime_;
     
     // ループ再生フラグ
     bool isLooping_;
+
+    // 末端のジョイントのアニメーションを省略するか（アニメーションLOD）
+    bool skipLeafJoints_ = false;
 };
@@ -1,57 +1,41 @@
 #include "SkeletonLoader.h"
 #include "Engine/Math/MathCore.h"
+#include <cassert>
 
 Skeleton SkeletonLoader::CreateSkeleton(const Node& rootNode) {
 	Skeleton skeleton;
+	auto hierarchy = std::make_shared<SkeletonHierarchy>();
 
-	// rootNodeからJoint階層を構築
-	skeleton.root = CreateJoint(rootNode, {}, skeleton.joints);
+	// rootNodeからJoint階層を構築（深さ優先で追加するので、親は必ず子より前に並ぶ）
+	CreateJoint(rootNode, -1, skeleton, *hierarchy);
 
 	// 名前とIndexのマッピングを行いアクセスしやすくする
-	for (const Joint& joint : skeleton.joints) {
-		skeleton.jointMap.emplace(joint.name, joint.index);
+	for (size_t i = 0; i < hierarchy->names.size(); ++i) {
+		hierarchy->jointMap.emplace(hierarchy->names[i], static_cast<int32_t>(i));
 	}
+	skeleton.hierarchy = std::move(hierarchy);
 
 	// 初期状態でSkeletonの行列を更新
-	for (Joint& joint : skeleton.joints) {
-		// TransformからlocalMatrixを更新
-		joint.localMatrix = MathCore::Matrix::MakeAffine(
-			joint.transform.scale,
-			joint.transform.rotate,
-			joint.transform.translate
-		);
-
-		// 親がいれば親の行列を掛ける
-		if (joint.parent) {
-			joint.skeletonSpaceMatrix = MathCore::Matrix::Multiply(
-				joint.localMatrix,
-				skeleton.joints[*joint.parent].skeletonSpaceMatrix
-			);
-		} else {
-			// 親がいないのでlocalMatrixとskeletonSpaceMatrixは一致する
-			joint.skeletonSpaceMatrix = joint.localMatrix;
-		}
-	}
+	skeleton.skeletonSpaceMatrices.resize(skeleton.GetJointCount());
+	skeleton.UpdateSkeletonSpaceMatrices();
 
 	return skeleton;
 }
 
-int32_t SkeletonLoader::CreateJoint(const Node& node, const std::optional<int32_t>& parent, std::vector<Joint>& joints) {
-	Joint joint;
-	joint.name = node.name;
-	joint.localMatrix = node.localMatrix;
-	joint.skeletonSpaceMatrix = MathCore::Matrix::Identity();
-	joint.transform = node.transform;
-	joint.index = static_cast<int32_t>(joints.size());
-	joint.parent = parent;
-	joints.push_back(joint);
+int32_t SkeletonLoader::CreateJoint(const Node& node, int32_t parent, Skeleton& skeleton, SkeletonHierarchy& hierarchy) {
+	const int32_t index = static_cast<int32_t>(skeleton.parents.size());
+	assert(parent < index);
+	skeleton.parents.push_back(parent);
+	skeleton.transforms.push_back(node.transform);
+	hierarchy.names.push_back(node.name);
+	hierarchy.children.emplace_back();
 
 	// 子Jointを作成し、そのIndexを登録
 	for (const Node& child : node.children) {
-		int32_t childIndex = CreateJoint(child, joint.index, joints);
-		joints[joint.index].children.push_back(childIndex);
+		const int32_t childIndex = CreateJoint(child, index, skeleton, hierarchy);
+		hierarchy.children[index].push_back(childIndex);
 	}
 
 	// 自身のIndexを返す
-	return joint.index;
+	return index;
 }
@@ -6,6 +6,7 @@
 class SkeletonLoader {
 public:
     /// @brief NodeからSkeletonを作成
+    /// ジョイントはNodeの深さ優先の順（親が必ず子より前）に並べる
     /// @param rootNode ルートNode
     /// @return 作成されたSkeleton
     static Skeleton CreateSkeleton(const Node& rootNode);
@@ -13,8 +14,9 @@ public:
 private:
     /// @brief NodeからJointを作成（再帰的）
     /// @param node Node
-    /// @param parent 親JointのIndex
-    /// @param joints Jointのリスト
+    /// @param parent 親JointのIndex（ルートは -1）
+    /// @param skeleton 追加先のSkeleton
+    /// @param hierarchy 追加先の名前・親子関係
     /// @return 作成されたJointのIndex
-    static int32_t CreateJoint(const Node& node, const std::optional<int32_t>& parent, std::vector<Joint>& joints);
+    static int32_t CreateJoint(const Node& node, int32_t parent, Skeleton& skeleton, SkeletonHierarchy& hierarchy);
 };
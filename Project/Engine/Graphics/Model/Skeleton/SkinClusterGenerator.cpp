@@ -10,16 +10,17 @@ using namespace MathCore;
 SkinCluster SkinClusterGenerator::CreateSkinCluster(
 	const Microsoft::WRL::ComPtr<ID3D12Device>& device,
 	const Skeleton& skeleton,
-	const ModelData& modelData,
+	const std::map<std::string, JointWeightData>& skinClusterData,
+	size_t vertexCount,
 	DescriptorManager* descriptorManager) {
 
 	SkinCluster skinCluster;
 
 	// palette用のResourceを確保
-	skinCluster.paletteResource = ResourceFactory::CreateBufferResource(device, sizeof(WellForGPU) * skeleton.joints.size());
+	skinCluster.paletteResource = ResourceFactory::CreateBufferResource(device, sizeof(WellForGPU) * skeleton.GetJointCount());
 	WellForGPU* mappedPalette = nullptr;
 	skinCluster.paletteResource->Map(0, nullptr, reinterpret_cast<void**>(&mappedPalette));
-	skinCluster.mappedPalette = { mappedPalette, skeleton.joints.size() }; // spanを使ってアクセスするようにする
+	skinCluster.mappedPalette = { mappedPalette, skeleton.GetJointCount() }; // spanを使ってアクセスするようにする
 
 	// palette用のsrvを作成。StructuredBufferでアクセスできるようにする。
 	D3D12_SHADER_RESOURCE_VIEW_DESC paletteSrvDesc{};
@@ -28,31 +29,33 @@ SkinCluster SkinClusterGenerator::CreateSkinCluster(
 	paletteSrvDesc.ViewDimension = D3D12_SRV_DIMENSION_BUFFER;
 	paletteSrvDesc.Buffer.FirstElement = 0;
 	paletteSrvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
-	paletteSrvDesc.Buffer.NumElements = UINT(skeleton.joints.size());
+	paletteSrvDesc.Buffer.NumElements = UINT(skeleton.GetJointCount());
 	paletteSrvDesc.Buffer.StructureByteStride = sizeof(WellForGPU);
 	descriptorManager->CreateSRV(skinCluster.paletteResource.Get(), paletteSrvDesc,
 		skinCluster.paletteSrvHandle.first, skinCluster.paletteSrvHandle.second, "SkinCluster Palette");
 
 	// influence用のResourceを確保。頂点ごとにinfluence情報を追加できるようにする
-	skinCluster.influenceResource = ResourceFactory::CreateBufferResource(device, sizeof(VertexInfluence) * modelData.vertices.size());
+	skinCluster.influenceResource = ResourceFactory::CreateBufferResource(device, sizeof(VertexInfluence) * vertexCount);
 	VertexInfluence* mappedInfluence = nullptr;
 	skinCluster.influenceResource->Map(0, nullptr, reinterpret_cast<void**>(&mappedInfluence));
-	std::memset(mappedInfluence, 0, sizeof(VertexInfluence) * modelData.vertices.size()); // 0埋め。weightを0にしておく
-	skinCluster.mappedInfluence = { mappedInfluence, modelData.vertices.size() };
+	std::memset(mappedInfluence, 0, sizeof(VertexInfluence) * vertexCount); // 0埋め。weightを0にしておく
+	skinCluster.mappedInfluence = { mappedInfluence, vertexCount };
 
 	// Influence用のVBVを作成
 	skinCluster.influenceBufferView.BufferLocation = skinCluster.influenceResource->GetGPUVirtualAddress();
-	skinCluster.influenceBufferView.SizeInBytes = UINT(sizeof(VertexInfluence) * modelData.vertices.size());
+	skinCluster.influenceBufferView.SizeInBytes = UINT(sizeof(VertexInfluence) * vertexCount);
 	skinCluster.influenceBufferView.StrideInBytes = sizeof(VertexInfluence);
 
 	// InverseBindPoseMatrixの格納領域を作成して、単位行列で埋める
-	skinCluster.inverseBindPoseMatrices.resize(skeleton.joints.size());
+	skinCluster.inverseBindPoseMatrices.resize(skeleton.GetJointCount());
 	std::generate(skinCluster.inverseBindPoseMatrices.begin(), skinCluster.inverseBindPoseMatrices.end(), Matrix::Identity);
+	skinCluster.skeletonSpaceMatrices.resize(skeleton.GetJointCount());
+	skinCluster.skeletonSpaceInverseTransposeMatrices.resize(skeleton.GetJointCount());
 
 	// ModelDataのSkinCluster情報を解析してInfluenceの中身を埋める
-	for (const auto& jointWeight : modelData.skinClusterData) { // ModelのSkinClusterの情報を解析
-		auto it = skeleton.jointMap.find(jointWeight.first); // jointWeight.firstはjoint名なので、Skeltonに対象となるjointが含まれているか判断
-		if (it == skeleton.jointMap.end()) {
+	for (const auto& jointWeight : skinClusterData) { // ModelのSkinClusterの情報を解析
+		auto it = skeleton.hierarchy->jointMap.find(jointWeight.first); // jointWeight.firstはjoint名なので、Skeltonに対象となるjointが含まれているか判断
+		if (it == skeleton.hierarchy->jointMap.end()) {
 			continue; //そんな名前のjointは存在しない。なので次に回す
 		}
 
@@ -76,12 +79,22 @@ SkinCluster SkinClusterGenerator::CreateSkinCluster(
 
 void SkinClusterGenerator::Update(SkinCluster& skinCluster, const Skeleton& skeleton)
 {
-	for (size_t jointIndex = 0; jointIndex < skeleton.joints.size(); ++jointIndex) {
-		assert(jointIndex < skinCluster.mappedPalette.size());
+	const size_t jointCount = skeleton.GetJointCount();
+	assert(jointCount <= skinCluster.mappedPalette.size());
+	assert(jointCount <= skinCluster.skeletonSpaceMatrices.size());
 
-		skinCluster.mappedPalette[jointIndex].skeletonSpaceMatrix =
-			skinCluster.inverseBindPoseMatrices[jointIndex] * skeleton.joints[jointIndex].skeletonSpaceMatrix;
-		skinCluster.mappedPalette[jointIndex].skeletonSpaceInverseTransposeMatrix =
-			Matrix::Transpose(Matrix::Inverse(skinCluster.mappedPalette[jointIndex].skeletonSpaceMatrix));
+	// マップしたパレット（アップロードヒープ）からの読み出しは遅いため、CPU側の配列でまとめて計算してから書き込む
+	std::span<Matrix4x4> skeletonSpaceMatrices(skinCluster.skeletonSpaceMatrices.data(), jointCount);
+	std::span<Matrix4x4> inverseTransposeMatrices(skinCluster.skeletonSpaceInverseTransposeMatrices.data(), jointCount);
+
+	// スケルトン空間行列は連続した配列なので、そのまま一括処理の入力にする
+	Batch::MultiplyMatrices(
+		std::span<const Matrix4x4>(skinCluster.inverseBindPoseMatrices.data(), jointCount),
+		skeleton.skeletonSpaceMatrices, skeletonSpaceMatrices);
+	Batch::InverseTransposes(skeletonSpaceMatrices, inverseTransposeMatrices);
+
+	for (size_t jointIndex = 0; jointIndex < jointCount; ++jointIndex) {
+		skinCluster.mappedPalette[jointIndex].skeletonSpaceMatrix = skeletonSpaceMatrices[jointIndex];
+		skinCluster.mappedPalette[jointIndex].skeletonSpaceInverseTransposeMatrix = inverseTransposeMatrices[jointIndex];
 	}
 }
@@ -17,13 +17,15 @@ public:
 	/// @brief スキンクラスターを生成
 	/// @param device デバイス
 	/// @param skeleton スケルトン
-	/// @param modelData モデルデータ
+	/// @param skinClusterData ジョイントと頂点のウェイト情報（ModelData::skinClusterData）
+	/// @param vertexCount モデルの頂点数
 	/// @param descriptorManager ディスクリプタマネージャー
 	/// @return 生成されたスキンクラスター
 	static SkinCluster CreateSkinCluster(
 		const Microsoft::WRL::ComPtr<ID3D12Device>& device,
 		const Skeleton& skeleton,
-		const ModelData& modelData,
+		const std::map<std::string, JointWeightData>& skinClusterData,
+		size_t vertexCount,
 		DescriptorManager* descriptorManager);
 	
 	/// @brief スキンクラスターを更新
@@ -0,0 +1,169 @@
+#include "VertexPacker.h"
+#include "Engine/Math/MathCore.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <numbers>
+
+namespace {
+
+	constexpr float kSnorm16Max = 32767.0f;
+
+	int16_t ToSnorm16(float value) {
+		return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * kSnorm16Max));
+	}
+
+	/// @brief SNORM の変換（D3D と同じく -32768 は -1 として扱う）
+	float FromSnorm16(int16_t value) {
+		return (std::max)(static_cast<float>(value) / kSnorm16Max, -1.0f);
+	}
+
+	float SignNotZero(float value) {
+		return value >= 0.0f ? 1.0f : -1.0f;
+	}
+
+} // namespace
+
+void VertexPacker::PackVertices(std::span<const VertexData> vertices, std::vector<Vector3>& outPositions, std::vector<PackedVertexAttribute>& outAttributes)
+{
+	outPositions.resize(vertices.size());
+	outAttributes.resize(vertices.size());
+	for (size_t index = 0; index < vertices.size(); ++index) {
+		const VertexData& vertex = vertices[index];
+		outPositions[index] = { vertex.position.x, vertex.position.y, vertex.position.z };
+		outAttributes[index] = PackAttribute(vertex);
+	}
+}
+
+void VertexPacker::PackIndices(std::span<const int32_t> indices, std::vector<uint16_t>& outIndices)
+{
+	outIndices.resize(indices.size());
+	std::transform(indices.begin(), indices.end(), outIndices.begin(),
+		[](int32_t index) { return static_cast<uint16_t>(index); });
+}
+
+PackedVertexAttribute VertexPacker::PackAttribute(const VertexData& vertex)
+{
+	PackedVertexAttribute attribute{};
+	EncodeOctahedralNormal(vertex.normal, attribute.normal);
+	attribute.texcoord[0] = FloatToHalf(vertex.texcoord.x);
+	attribute.texcoord[1] = FloatToHalf(vertex.texcoord.y);
+	return attribute;
+}
+
+void VertexPacker::EncodeOctahedralNormal(const Vector3& normal, int16_t outEncoded[2])
+{
+	// L1ノルムで割って八面体に射影し、下半分（z < 0）は外側の三角形へ折り返す
+	const float length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+	float x = length > 0.0f ? normal.x / length : 0.0f;
+	float y = length > 0.0f ? normal.y / length : 0.0f;
+	if (normal.z < 0.0f) {
+		const float foldedX = (1.0f - std::abs(y)) * SignNotZero(x);
+		const float foldedY = (1.0f - std::abs(x)) * SignNotZero(y);
+		x = foldedX;
+		y = foldedY;
+	}
+	outEncoded[0] = ToSnorm16(x);
+	outEncoded[1] = ToSnorm16(y);
+}
+
+Vector3 VertexPacker::DecodeOctahedralNormal(const int16_t encoded[2])
+{
+	Vector3 normal = { FromSnorm16(encoded[0]), FromSnorm16(encoded[1]), 0.0f };
+	normal.z = 1.0f - std::abs(normal.x) - std::abs(normal.y);
+	const float fold = std::clamp(-normal.z, 0.0f, 1.0f);
+	normal.x += normal.x >= 0.0f ? -fold : fold;
+	normal.y += normal.y >= 0.0f ? -fold : fold;
+	return MathCore::Vector::Normalize(normal);
+}
+
+uint16_t VertexPacker::FloatToHalf(float value)
+{
+	const uint32_t bits = std::bit_cast<uint32_t>(value);
+	const uint32_t sign = (bits >> 16) & 0x8000u;
+	const uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+	// NaN / 無限大 / halfで表せない大きさ
+	if (magnitude >= 0x7F800000u) {
+		return static_cast<uint16_t>(sign | (magnitude > 0x7F800000u ? 0x7E00u : 0x7C00u));
+	}
+	if (magnitude >= 0x47800000u) {
+		return static_cast<uint16_t>(sign | 0x7C00u);
+	}
+
+	// halfの非正規化数（2^-14 未満）
+	if (magnitude < 0x38800000u) {
+		if (magnitude < 0x33000000u) {
+			return static_cast<uint16_t>(sign); // 2^-25 未満は0
+		}
+		const uint32_t mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+		const uint32_t shift = 126u - (magnitude >> 23);
+		uint32_t half = mantissa >> shift;
+		const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+		const uint32_t halfway = 1u << (shift - 1u);
+		if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+			++half;
+		}
+		return static_cast<uint16_t>(sign | half);
+	}
+
+	// 正規化数（指数のバイアスを 127 から 15 へ。丸めの繰り上がりで無限大になる場合もそのまま正しい）
+	uint32_t half = (magnitude - 0x38000000u) >> 13;
+	const uint32_t remainder = magnitude & 0x1FFFu;
+	if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+		++half;
+	}
+	return static_cast<uint16_t>(sign | half);
+}
+
+float VertexPacker::HalfToFloat(uint16_t value)
+{
+	const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+	const uint32_t exponent = (value >> 10) & 0x1Fu;
+	const uint32_t mantissa = value & 0x3FFu;
+
+	if (exponent == 0) {
+		const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+		return sign ? -magnitude : magnitude;
+	}
+	if (exponent == 0x1F) {
+		return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+	}
+	return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
+
+VertexPacker::Report VertexPacker::MeasureSize(size_t vertexCount, size_t indexCount)
+{
+	Report report;
+	report.sourceBytes = vertexCount * sizeof(VertexData) + indexCount * sizeof(uint32_t);
+	report.packedBytes = vertexCount * (sizeof(Vector3) + sizeof(PackedVertexAttribute)) +
+		indexCount * (CanUse16BitIndices(vertexCount) ? sizeof(uint16_t) : sizeof(uint32_t));
+	return report;
+}
+
+void VertexPacker::MeasureError(std::span<const VertexData> vertices, std::span<const PackedVertexAttribute> attributes, Report& inoutReport)
+{
+	assert(vertices.size() == attributes.size());
+
+	float minNormalCos = 1.0f;
+	float maxTexcoordError = 0.0f;
+	for (size_t index = 0; index < vertices.size(); ++index) {
+		const VertexData& vertex = vertices[index];
+		const PackedVertexAttribute& attribute = attributes[index];
+
+		const float length = MathCore::Vector::Length(vertex.normal);
+		if (length > 0.0f) {
+			const Vector3 decoded = DecodeOctahedralNormal(attribute.normal);
+			const float cosine = MathCore::Vector::Dot(decoded, vertex.normal) / length;
+			minNormalCos = (std::min)(minNormalCos, cosine);
+		}
+
+		maxTexcoordError = (std::max)({ maxTexcoordError,
+			std::abs(HalfToFloat(attribute.texcoord[0]) - vertex.texcoord.x),
+			std::abs(HalfToFloat(attribute.texcoord[1]) - vertex.texcoord.y) });
+	}
+	inoutReport.maxNormalErrorDegrees = std::acos(std::clamp(minNormalCos, -1.0f, 1.0f)) * 180.0f / std::numbers::pi_v<float>;
+	inoutReport.maxTexcoordError = maxTexcoordError;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Engine/Graphics/Structs/VertexData.h"
+
+/// @brief 頂点・インデックスをGPU用の小さな形式に変換するクラス
+/// VertexData（36バイト）を、位置のストリーム（float3、12バイト）と属性のストリーム（PackedVertexAttribute、8バイト）に分ける
+/// - 位置: w（常に1）を省いた float3。深度だけのパスでは位置のストリームだけを読めばよい
+/// - 法線: 八面体エンコードして SNORM16 x2（最大誤差は約0.05度）
+/// - UV: half x2（0～1の範囲なら誤差は1/2048以下。タイリングで大きな値になると精度が落ちる）
+/// インデックスは頂点数が65536以下なら16bitにする
+class VertexPacker {
+public:
+	/// @brief 圧縮前後のサイズと誤差
+	struct Report {
+		uint64_t sourceBytes = 0;          // 圧縮前（VertexData + 32bitインデックス）
+		uint64_t packedBytes = 0;          // 圧縮後（位置 + 属性 + インデックス）
+		float maxNormalErrorDegrees = 0.0f; // 法線の最大誤差（度）
+		float maxTexcoordError = 0.0f;      // UVの最大誤差
+	};
+
+	/// @brief 頂点を位置と属性のストリームに分けて圧縮する
+	/// @param vertices 頂点
+	/// @param outPositions 位置のストリーム
+	/// @param outAttributes 属性のストリーム
+	static void PackVertices(std::span<const VertexData> vertices, std::vector<Vector3>& outPositions, std::vector<PackedVertexAttribute>& outAttributes);
+
+	/// @brief 16bitインデックスを使えるか
+	/// @param vertexCount 頂点数
+	static bool CanUse16BitIndices(size_t vertexCount) { return vertexCount <= 0x10000; }
+
+	/// @brief インデックスを16bitに変換する（CanUse16BitIndices が true の場合のみ）
+	/// @param indices インデックス
+	/// @param outIndices 16bitインデックス
+	static void PackIndices(std::span<const int32_t> indices, std::vector<uint16_t>& outIndices);
+
+	/// @brief 1頂点分の属性を圧縮する
+	static PackedVertexAttribute PackAttribute(const VertexData& vertex);
+
+	/// @brief 法線を八面体エンコードする（シェーダーの DecodeOctahedralNormal と対になる）
+	static void EncodeOctahedralNormal(const Vector3& normal, int16_t outEncoded[2]);
+
+	/// @brief 八面体エンコードした法線を戻す
+	static Vector3 DecodeOctahedralNormal(const int16_t encoded[2]);
+
+	/// @brief float を half に変換する（最近接偶数丸め）
+	static uint16_t FloatToHalf(float value);
+
+	/// @brief half を float に変換する
+	static float HalfToFloat(uint16_t value);
+
+	/// @brief 圧縮前後のサイズを計算する（誤差は0のまま）
+	/// @param vertexCount 頂点数
+	/// @param indexCount インデックス数
+	static Report MeasureSize(size_t vertexCount, size_t indexCount);
+
+	/// @brief 圧縮済みの属性を元の頂点と比べて誤差を計測する（属性を戻すだけで、圧縮し直さない。デバッグ・ベンチマーク用）
+	/// @param vertices 元の頂点
+	/// @param attributes PackVertices で作った属性
+	/// @param inoutReport 誤差を書き込むレポート
+	static void MeasureError(std::span<const VertexData> vertices, std::span<const PackedVertexAttribute> attributes, Report& inoutReport);
+};
@@ -74,9 +74,9 @@ void ModelRenderer::Initialize(ID3D12Device* device) {
     assert(pixelShaderBlob != nullptr);
     
     bool result = psoMg_->CreateBuilder()
-        .AddInputElement("POSITION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT)
-        .AddInputElement("TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT)
-        .AddInputElement("NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT)
+        .AddInputElement("POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 0)
+        .AddInputElement("NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, D3D12_APPEND_ALIGNED_ELEMENT, 1)
+        .AddInputElement("TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 1)
         .SetRasterizer(D3D12_CULL_MODE_BACK, D3D12_FILL_MODE_SOLID)
         .SetDepthStencil(true, true)
         .SetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE)
@@ -81,11 +81,11 @@ void SkinnedModelRenderer::Initialize(ID3D12Device* device) {
     assert(pixelShaderBlob != nullptr);
     
     bool skinningResult = psoMg_->CreateBuilder()
-        .AddInputElement("POSITION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 0)
-        .AddInputElement("TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 0)
-        .AddInputElement("NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 0)
-        .AddInputElement("WEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 1)
-        .AddInputElement("INDEX", 0, DXGI_FORMAT_R32G32B32A32_SINT, D3D12_APPEND_ALIGNED_ELEMENT, 1)
+        .AddInputElement("POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 0)
+        .AddInputElement("NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, D3D12_APPEND_ALIGNED_ELEMENT, 1)
+        .AddInputElement("TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 1)
+        .AddInputElement("WEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 2)
+        .AddInputElement("INDEX", 0, DXGI_FORMAT_R32G32B32A32_SINT, D3D12_APPEND_ALIGNED_ELEMENT, 2)
         .SetRasterizer(D3D12_CULL_MODE_BACK, D3D12_FILL_MODE_SOLID)
         .SetDepthStencil(true, true)
         .SetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE)
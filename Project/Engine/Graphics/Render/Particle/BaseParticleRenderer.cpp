@@ -48,12 +48,12 @@ void BaseParticleRenderer::SetCamera(const ICamera* camera) {
 }
 
 void BaseParticleRenderer::CreateRootSignature() {
-    // Root Parameter 0: インスタンシング用SRV (t0, Vertex Shader)
-    RootSignatureManager::DescriptorRangeConfig instanceRange;
-    instanceRange.type = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
-    instanceRange.numDescriptors = 1;
-    instanceRange.baseShaderRegister = 0;  // t0
-    rootSignatureMg_->AddDescriptorTable({ instanceRange }, D3D12_SHADER_VISIBILITY_VERTEX);
+    // Root Parameter 0: インスタンシング用ルートSRV (t0, Vertex Shader)
+    // 共有リングバッファ内の位置をシステムごとにGPUアドレスで直接指定する
+    RootSignatureManager::RootDescriptorConfig instanceSRV;
+    instanceSRV.shaderRegister = 0;  // t0
+    instanceSRV.visibility = D3D12_SHADER_VISIBILITY_VERTEX;
+    rootSignatureMg_->AddRootSRV(instanceSRV);
 
     // Root Parameter 1: テクスチャ用ディスクリプタテーブル (t0, Pixel Shader)
     RootSignatureManager::DescriptorRangeConfig textureRange;
@@ -62,6 +62,13 @@ void BaseParticleRenderer::CreateRootSignature() {
     textureRange.baseShaderRegister = 0;  // t0
     rootSignatureMg_->AddDescriptorTable({ textureRange }, D3D12_SHADER_VISIBILITY_PIXEL);
 
+    // Root Parameter 2: 描画定数 (b0, Vertex Shader)
+    RootSignatureManager::RootConstantsConfig drawConstants;
+    drawConstants.shaderRegister = 0;  // b0
+    drawConstants.num32BitValues = sizeof(ParticleDrawConstants) / sizeof(uint32_t);
+    drawConstants.visibility = D3D12_SHADER_VISIBILITY_VERTEX;
+    rootSignatureMg_->AddRootConstants(drawConstants);
+
     // Static Sampler (s0, Pixel Shader)
     rootSignatureMg_->AddDefaultLinearSampler(0, D3D12_SHADER_VISIBILITY_PIXEL);
 
@@ -84,8 +91,12 @@ bool BaseParticleRenderer::ValidateDrawCall(ParticleSystem* particle) const {
 
 void BaseParticleRenderer::SetupCommonResources(ParticleSystem* particle, D3D12_GPU_DESCRIPTOR_HANDLE textureHandle) {
     // インスタンシングリソースを設定（Root Parameter 0）
-    cmdList_->SetGraphicsRootDescriptorTable(0, particle->GetInstancingSrvHandleGPU());
+    cmdList_->SetGraphicsRootShaderResourceView(0, particle->GetInstancingGpuAddress());
     
     // テクスチャを設定（Root Parameter 1）
     cmdList_->SetGraphicsRootDescriptorTable(1, textureHandle);
+
+    // ビュープロジェクション・ビルボード行列を設定（Root Parameter 2）
+    cmdList_->SetGraphicsRoot32BitConstants(
+        2, sizeof(ParticleDrawConstants) / sizeof(uint32_t), &particle->GetDrawConstants(), 0);
 }
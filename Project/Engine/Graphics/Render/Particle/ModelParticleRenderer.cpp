@@ -25,7 +25,11 @@ void ModelParticleRenderer::Draw(ParticleSystem* particle) {
     uint32_t instanceCount = particle->GetInstanceCount();
 
     // モデルの頂点バッファとインデックスバッファを設定
-    cmdList_->IASetVertexBuffers(0, 1, &modelResource->vertexBufferView_);
+    D3D12_VERTEX_BUFFER_VIEW vbvs[2] = {
+        modelResource->positionBufferView_,  // Slot 0: 位置
+        modelResource->attributeBufferView_  // Slot 1: 法線・UV
+    };
+    cmdList_->IASetVertexBuffers(0, 2, vbvs);
     cmdList_->IASetIndexBuffer(&modelResource->indexBufferView_);
 
     // テクスチャハンドルを決定（パーティクル設定 > モデルデフォルト）
@@ -52,9 +56,9 @@ void ModelParticleRenderer::CreatePSO() {
 
     // ビルダーパターンでPSOを構築
     bool result = pipelineMg_->CreateBuilder()
-        .AddInputElement("POSITION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT)
-        .AddInputElement("TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT)
-        .AddInputElement("NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT)
+        .AddInputElement("POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 0)
+        .AddInputElement("NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, D3D12_APPEND_ALIGNED_ELEMENT, 1)
+        .AddInputElement("TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, D3D12_APPEND_ALIGNED_ELEMENT, 1)
         .SetRasterizer(D3D12_CULL_MODE_BACK, D3D12_FILL_MODE_SOLID)
         .SetDepthStencil(true, true)  // 深度テストと深度書き込みを有効化
         .SetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE)
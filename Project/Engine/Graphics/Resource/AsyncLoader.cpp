@@ -0,0 +1,116 @@
+#include "AsyncLoader.h"
+#include "Engine/Utility/Job/JobSystem.h"
+#include "Engine/Utility/Logger/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <format>
+
+void AsyncLoader::Initialize(JobSystem* jobSystem)
+{
+	jobSystem_ = jobSystem;
+}
+
+void AsyncLoader::Finalize()
+{
+	pendingRequests_.clear();
+	progress_ = {};
+}
+
+void AsyncLoader::Submit(std::shared_ptr<AsyncLoadRequest> request)
+{
+	assert(request);
+
+	// 前回の読み込みが全て終わっていれば進捗を数え直す
+	if (pendingRequests_.empty()) {
+		progress_ = {};
+	}
+	++progress_.totalCount;
+	pendingRequests_.push_back(request);
+
+	if (jobSystem_) {
+		jobSystem_->Schedule([request]() { RunLoad(*request); });
+	} else {
+		RunLoad(*request);
+	}
+}
+
+void AsyncLoader::Update()
+{
+	using Clock = std::chrono::steady_clock;
+	const auto start = Clock::now();
+
+	for (size_t index = 0; index < pendingRequests_.size();) {
+		const AsyncLoadRequest::State state = pendingRequests_[index]->GetState();
+		if (state != AsyncLoadRequest::State::Loaded && state != AsyncLoadRequest::State::Failed) {
+			++index;
+			continue;
+		}
+
+		const std::shared_ptr<AsyncLoadRequest> request = pendingRequests_[index];
+		pendingRequests_.erase(pendingRequests_.begin() + index);
+		Complete(*request);
+
+		if (std::chrono::duration<double, std::milli>(Clock::now() - start).count() >= finalizeBudgetMilliseconds_) {
+			break;
+		}
+	}
+}
+
+void AsyncLoader::Wait(const AsyncLoadRequest& request)
+{
+	auto it = std::find_if(pendingRequests_.begin(), pendingRequests_.end(),
+		[&request](const std::shared_ptr<AsyncLoadRequest>& pending) { return pending.get() == &request; });
+	if (it == pendingRequests_.end()) {
+		return; // 完了済み
+	}
+	const std::shared_ptr<AsyncLoadRequest> target = *it;
+	pendingRequests_.erase(it);
+
+	// ワーカーがまだ取り出していなければここで実行し、実行中なら終わるまで待つ
+	RunLoad(*target);
+	target->state_.wait(AsyncLoadRequest::State::Loading, std::memory_order_acquire);
+
+	Complete(*target);
+}
+
+void AsyncLoader::WaitAll()
+{
+	while (!pendingRequests_.empty()) {
+		Wait(*pendingRequests_.front());
+	}
+}
+
+void AsyncLoader::RunLoad(AsyncLoadRequest& request)
+{
+	AsyncLoadRequest::State expected = AsyncLoadRequest::State::Queued;
+	if (!request.state_.compare_exchange_strong(expected, AsyncLoadRequest::State::Loading, std::memory_order_acq_rel)) {
+		return; // 他のスレッドが実行済み・実行中
+	}
+
+	bool succeeded = false;
+	try {
+		succeeded = request.Load();
+	} catch (const std::exception& exception) {
+		Logger::GetInstance().Log(std::format("Async load failed: {}\n{}", request.GetName(), exception.what()), LogLevel::Error, LogCategory::Resource);
+	}
+
+	request.state_.store(succeeded ? AsyncLoadRequest::State::Loaded : AsyncLoadRequest::State::Failed, std::memory_order_release);
+	request.state_.notify_all();
+}
+
+void AsyncLoader::Complete(AsyncLoadRequest& request)
+{
+	if (request.GetState() == AsyncLoadRequest::State::Loaded) {
+		const bool succeeded = request.Finalize();
+		request.state_.store(succeeded ? AsyncLoadRequest::State::Completed : AsyncLoadRequest::State::Failed, std::memory_order_release);
+	}
+
+	if (request.GetState() == AsyncLoadRequest::State::Failed) {
+		Logger::GetInstance().Log(std::format("Async load failed: {}", request.GetName()), LogLevel::Error, LogCategory::Resource);
+		request.OnFailed();
+	}
+
+	++progress_.completedCount;
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class JobSystem;
+
+/// @brief 非同期読み込みの要求（1ファイル分）
+/// 読み込みは2段階に分かれる
+/// - Load: ワーカースレッドで実行する（ファイルの読み込み・デコード・ミップマップ生成・頂点の変換など。GPUリソースは作らない）
+/// - Finalize: 描画スレッドで実行する（GPUリソースの作成と転送、キャッシュへの登録）
+class AsyncLoadRequest {
+public:
+	/// @brief 要求の状態
+	enum class State : uint32_t {
+		Queued,    // ワーカーでの実行待ち
+		Loading,   // ワーカーで実行中
+		Loaded,    // ワーカーでの処理が終わり、描画スレッドでの仕上げ待ち
+		Completed, // 完了
+		Failed     // 失敗
+	};
+
+	virtual ~AsyncLoadRequest() = default;
+
+	/// @brief 現在の状態を取得
+	State GetState() const { return state_.load(std::memory_order_acquire); }
+
+	/// @brief 完了したか（成功・失敗どちらでも）
+	bool IsDone() const { const State state = GetState(); return state == State::Completed || state == State::Failed; }
+
+	/// @brief 読み込み対象の名前（ファイルパスなど。ログ用）
+	const std::string& GetName() const { return name_; }
+
+protected:
+	explicit AsyncLoadRequest(std::string name) : name_(std::move(name)) {}
+
+	/// @brief ワーカースレッドでの処理
+	/// @return 成功したらtrue
+	virtual bool Load() = 0;
+
+	/// @brief 描画スレッドでの仕上げ（Load が成功した場合のみ呼ばれる）
+	/// @return 成功したらtrue
+	virtual bool Finalize() = 0;
+
+	/// @brief 失敗した時の処理（描画スレッドで呼ばれる。エラーの表示など）
+	virtual void OnFailed() {}
+
+	/// @brief Submit せずに完了済みにする（既にキャッシュにある場合など）
+	void SetCompleted() { state_.store(State::Completed, std::memory_order_release); }
+
+private:
+	friend class AsyncLoader;
+
+	std::atomic<State> state_ = State::Queued;
+	std::string name_;
+};
+
+/// @brief 非同期読み込みの結果を受け取るハンドル
+/// 要求が完了するまでは IsReady が false を返す。完了後は Get で結果を取得する
+/// @tparam T 結果の型
+template<typename T>
+class AsyncLoadHandle {
+public:
+	AsyncLoadHandle() = default;
+
+	/// @param request 要求
+	/// @param result 結果（要求が所有するもの）
+	AsyncLoadHandle(std::shared_ptr<const AsyncLoadRequest> request, const T* result)
+		: request_(std::move(request)), result_(result) {}
+
+	/// @brief 要求を持っているか
+	bool IsValid() const { return request_ != nullptr; }
+
+	/// @brief 読み込みが完了して結果を使えるか
+	bool IsReady() const { return request_ && request_->GetState() == AsyncLoadRequest::State::Completed; }
+
+	/// @brief 読み込みに失敗したか
+	bool IsFailed() const { return request_ && request_->GetState() == AsyncLoadRequest::State::Failed; }
+
+	/// @brief 結果を取得（IsReady が true の場合のみ）
+	const T& Get() const {
+		assert(IsReady() && "AsyncLoadHandle::Get called before the load completed");
+		return *result_;
+	}
+
+	/// @brief 要求を取得（AsyncLoader::Wait に渡す）
+	const std::shared_ptr<const AsyncLoadRequest>& GetRequest() const { return request_; }
+
+private:
+	std::shared_ptr<const AsyncLoadRequest> request_;
+	const T* result_ = nullptr;
+};
+
+/// @brief 非同期読み込みの管理クラス
+/// 要求のワーカー側の処理を JobSystem で実行し、描画スレッドでの仕上げを毎フレームの時間予算内で行う
+/// Submit / Update / Wait は描画スレッド（メインスレッド）からのみ呼ぶ
+class AsyncLoader {
+public:
+	/// @brief 読み込みの進捗
+	struct Progress {
+		uint32_t completedCount = 0; // 完了した要求の数（失敗を含む）
+		uint32_t totalCount = 0;     // 要求の数（読み込みが全て終わった後の最初の Submit で0に戻る）
+
+		/// @brief 進捗の割合（0.0 ～ 1.0。要求がなければ1.0）
+		float GetRatio() const { return totalCount > 0 ? static_cast<float>(completedCount) / static_cast<float>(totalCount) : 1.0f; }
+	};
+
+	AsyncLoader() = default;
+	~AsyncLoader() = default;
+
+	AsyncLoader(const AsyncLoader&) = delete;
+	AsyncLoader& operator=(const AsyncLoader&) = delete;
+
+	/// @brief 初期化
+	/// @param jobSystem ワーカー側の処理を実行するジョブシステム（nullptrなら Submit の中で実行する）
+	void Initialize(JobSystem* jobSystem);
+
+	/// @brief 終了処理（未完了の要求を破棄する。ワーカーで実行中の処理は要求が所有するデータだけを扱うので、そのまま終わらせる）
+	void Finalize();
+
+	/// @brief 要求を登録して、ワーカーでの処理を開始する
+	/// @param request 要求
+	void Submit(std::shared_ptr<AsyncLoadRequest> request);
+
+	/// @brief ワーカーでの処理が終わった要求を、時間予算の範囲で仕上げる（毎フレーム呼ぶ）
+	/// 予算を超えても1フレームに最低1件は仕上げる
+	void Update();
+
+	/// @brief 要求が完了するまで待つ（仕上げもこの中で行う）
+	/// まだワーカーで実行されていなければ、呼び出し元で実行する
+	/// @param request 要求（Submit したもの）
+	void Wait(const AsyncLoadRequest& request);
+
+	/// @brief 全ての要求が完了するまで待つ
+	void WaitAll();
+
+	/// @brief 1フレームあたりの仕上げの時間予算を設定
+	/// @param milliseconds 時間（ミリ秒）
+	void SetFinalizeBudget(double milliseconds) { finalizeBudgetMilliseconds_ = milliseconds; }
+
+	/// @brief 未完了の要求があるか
+	bool IsLoading() const { return !pendingRequests_.empty(); }
+
+	/// @brief 進捗を取得（ロード画面の表示用）
+	const Progress& GetProgress() const { return progress_; }
+
+private:
+	/// @brief ワーカー側の処理を実行（まだ誰も実行していない場合のみ）
+	static void RunLoad(AsyncLoadRequest& request);
+
+	/// @brief 仕上げを行って完了させる
+	void Complete(AsyncLoadRequest& request);
+
+	JobSystem* jobSystem_ = nullptr;
+	std::vector<std::shared_ptr<AsyncLoadRequest>> pendingRequests_; // 未完了の要求（登録順）
+	Progress progress_;
+	double finalizeBudgetMilliseconds_ = 2.0;
+};
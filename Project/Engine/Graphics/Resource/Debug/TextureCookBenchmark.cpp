@@ -0,0 +1,113 @@
+#include "TextureCookBenchmark.h"
+#include "Engine/Graphics/TextureManager.h"
+#include "Engine/Graphics/Resource/TextureCooker.h"
+#include "Engine/Utility/Logger/Logger.h"
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	template<typename Function>
+	double MeasureMilliseconds(Function&& function) {
+		const auto start = Clock::now();
+		function();
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	/// @brief WICで読み込む画像ファイルか（DDSは焼き込まない）
+	bool IsSourceImage(const std::filesystem::path& path) {
+		const std::string extension = path.extension().string();
+		return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".bmp";
+	}
+
+	std::string GetFormatName(DXGI_FORMAT format) {
+		switch (format) {
+		case DXGI_FORMAT_BC1_UNORM: return "BC1";
+		case DXGI_FORMAT_BC1_UNORM_SRGB: return "BC1 sRGB";
+		case DXGI_FORMAT_BC4_UNORM: return "BC4";
+		case DXGI_FORMAT_BC5_UNORM: return "BC5";
+		case DXGI_FORMAT_BC7_UNORM: return "BC7";
+		case DXGI_FORMAT_BC7_UNORM_SRGB: return "BC7 sRGB";
+		default: return "未圧縮";
+		}
+	}
+
+	void LogResult(const TextureCookBenchmark::Result& result) {
+		Logger::GetInstance().Log(
+			std::format("[TextureCookBenchmark] {}: {} | decode+mips {:.3f} ms | cook {:.3f} ms | cooked {:.3f} ms (x{:.1f}) | {} -> {} bytes (x{:.1f})",
+				result.name, result.format, result.sourceMilliseconds, result.cookMilliseconds, result.cookedMilliseconds,
+				result.cookedMilliseconds > 0.0 ? result.sourceMilliseconds / result.cookedMilliseconds : 0.0,
+				result.sourceBytes, result.cookedBytes,
+				result.cookedBytes > 0 ? static_cast<double>(result.sourceBytes) / static_cast<double>(result.cookedBytes) : 0.0),
+			LogLevel::INFO, LogCategory::System);
+	}
+
+} // namespace
+
+std::vector<TextureCookBenchmark::Result> TextureCookBenchmark::Run(const std::string& directoryPath)
+{
+	std::vector<Result> results;
+	Result total;
+	total.name = "合計";
+	total.format = "-";
+	total.cooked = true;
+
+	std::error_code error;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(directoryPath, error)) {
+		if (!entry.is_regular_file(error) || !IsSourceImage(entry.path())) {
+			continue;
+		}
+
+		std::string sourcePath = entry.path().generic_string();
+		Result result;
+		result.name = std::filesystem::relative(entry.path(), directoryPath, error).generic_string();
+
+		// WICでのデコード＋ミップマップ生成（焼き込みファイルを使わない）
+		DirectX::ScratchImage mipImages;
+		TextureManager::DecodeError decodeError;
+		bool isDecoded = false;
+		result.sourceMilliseconds = MeasureMilliseconds([&]() {
+			isDecoded = TextureManager::DecodeTexture(sourcePath, mipImages, decodeError, false);
+		});
+		if (!isDecoded) {
+			continue;
+		}
+		result.sourceBytes = mipImages.GetPixelsSize();
+
+		// 圧縮と書き出し
+		uint64_t sourceHash = 0;
+		bool isWritten = false;
+		result.cookMilliseconds = MeasureMilliseconds([&]() {
+			isWritten = TextureCooker::ComputeSourceHash(sourcePath, sourceHash) && TextureCooker::Cook(sourcePath, sourceHash, mipImages);
+		});
+
+		// 焼き込みファイルの読み込み（TextureManager と同じく、ハッシュの取得から行う）
+		DirectX::ScratchImage cookedImages;
+		bool isLoaded = false;
+		result.cookedMilliseconds = MeasureMilliseconds([&]() {
+			uint64_t hash = 0;
+			isLoaded = TextureCooker::ResolveSourceHash(sourcePath, hash) && TextureCooker::LoadCooked(sourcePath, hash, cookedImages);
+		});
+
+		result.cooked = isWritten && isLoaded;
+		result.format = GetFormatName(cookedImages.GetMetadata().format);
+		result.cookedBytes = isLoaded ? cookedImages.GetPixelsSize() : 0;
+		LogResult(result);
+
+		total.sourceMilliseconds += result.sourceMilliseconds;
+		total.cookMilliseconds += result.cookMilliseconds;
+		total.cookedMilliseconds += result.cookedMilliseconds;
+		total.sourceBytes += result.sourceBytes;
+		total.cookedBytes += result.cookedBytes;
+		total.cooked = total.cooked && result.cooked;
+		results.push_back(result);
+	}
+
+	LogResult(total);
+	results.push_back(total);
+	return results;
+}
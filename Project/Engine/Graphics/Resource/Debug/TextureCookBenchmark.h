@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief テクスチャの焼き込み（TextureCooker）のベンチマーク（GPU不要）
+/// Assets 以下の画像ファイルを全て焼き込み、WICでのデコード＋ミップマップ生成と、焼き込みファイルの読み込みの時間を比較する
+/// あわせて、GPUに置く時のサイズ（ミップマップを含む）を圧縮前後で比較する
+/// ゲームの起動前に全てのテクスチャを焼き込んでおく用途にも使える
+class TextureCookBenchmark {
+public:
+	/// @brief テクスチャごとの計測結果
+	struct Result {
+		std::string name;                 // テクスチャ（最後の行は合計）
+		std::string format;               // 焼き込んだ形式
+		double sourceMilliseconds = 0;    // WICでのデコード＋ミップマップ生成
+		double cookMilliseconds = 0;      // 圧縮と書き出し（初回の読み込み時だけかかる）
+		double cookedMilliseconds = 0;    // 焼き込みファイルの読み込み（ハッシュの計算を含む）
+		uint64_t sourceBytes = 0;         // 圧縮前のサイズ（ミップマップを含む）
+		uint64_t cookedBytes = 0;         // 焼き込み後のサイズ（ミップマップを含む）
+		bool cooked = false;              // 焼き込みファイルを作って読み込めたか
+	};
+
+	/// @brief Assets 以下のテクスチャでベンチマークを実行
+	/// @param directoryPath 対象のディレクトリ（サブディレクトリを含む）
+	/// @return テクスチャごとの結果と合計（ログにも出力される）
+	static std::vector<Result> Run(const std::string& directoryPath = "Assets");
+};
@@ -0,0 +1,211 @@
+#include "TextureCooker.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include "Engine/Utility/MappedFile/MappedFile.h"
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+namespace {
+
+	constexpr uint64_t kFnvOffsetBasis = 0xCBF29CE484222325ull;
+	constexpr uint64_t kFnvPrime = 0x100000001B3ull;
+
+	constexpr const char* kCookedExtension = ".cooked.dds";
+	constexpr const char* kStampExtension = ".cooked.stamp";
+	constexpr uint32_t kStampMagic = 0x504D5453; // "STMP"
+
+	/// @brief 元ファイルのサイズ・更新時刻と、その時の内容のハッシュ（.cooked.stamp の中身）
+	struct SourceStamp {
+		uint32_t magic = kStampMagic;
+		uint32_t version = 0;    // 焼き込み形式のバージョン
+		uint64_t size = 0;       // ファイルサイズ
+		int64_t writeTime = 0;   // 最終更新時刻（std::filesystem::file_time_type のカウント）
+		uint64_t sourceHash = 0; // 内容のハッシュ
+	};
+
+	/// @brief 元ファイルのサイズと更新時刻を取得
+	/// @return 元ファイルが存在すればtrue
+	bool ReadFileStamp(const std::filesystem::path& sourcePath, SourceStamp& outStamp) {
+		std::error_code error;
+		const uint64_t size = std::filesystem::file_size(sourcePath, error);
+		if (error) {
+			return false;
+		}
+		const auto writeTime = std::filesystem::last_write_time(sourcePath, error);
+		if (error) {
+			return false;
+		}
+		outStamp.size = size;
+		outStamp.writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+		return true;
+	}
+
+	/// @brief 4の倍数か（BC圧縮の最上位ミップに必要）
+	bool IsBlockAligned(size_t size) {
+		return size % 4 == 0;
+	}
+
+} // namespace
+
+bool TextureCooker::ComputeSourceHash(const std::string& sourcePath, uint64_t& outHash)
+{
+	MappedFile file;
+	if (!file.Open(sourcePath)) {
+		return false;
+	}
+
+	uint64_t hash = kFnvOffsetBasis;
+	hash = (hash ^ kVersion) * kFnvPrime;
+	const std::byte* data = file.GetData();
+	for (size_t index = 0; index < file.GetSize(); ++index) {
+		hash = (hash ^ static_cast<uint8_t>(data[index])) * kFnvPrime;
+	}
+
+	outHash = hash;
+	return true;
+}
+
+bool TextureCooker::ResolveSourceHash(const std::string& sourcePath, uint64_t& outHash)
+{
+	const std::filesystem::path sourceFilePath(Logger::GetInstance().ConvertString(sourcePath));
+	std::filesystem::path stampPath = sourceFilePath;
+	stampPath += kStampExtension;
+
+	SourceStamp current;
+	current.version = kVersion;
+	if (!ReadFileStamp(sourceFilePath, current)) {
+		return false;
+	}
+
+	// サイズ・更新時刻が記録と同じなら、記録したハッシュを使う（元ファイルを読まない）
+	SourceStamp recorded;
+	std::ifstream input(stampPath, std::ios::binary);
+	if (input.read(reinterpret_cast<char*>(&recorded), sizeof(recorded)) &&
+		recorded.magic == current.magic && recorded.version == current.version &&
+		recorded.size == current.size && recorded.writeTime == current.writeTime) {
+		outHash = recorded.sourceHash;
+		return true;
+	}
+	input.close();
+
+	// 一致しなければ内容から計算して記録し直す（内容が同じなら既存の焼き込みファイルがそのまま使われる）
+	if (!ComputeSourceHash(sourcePath, current.sourceHash)) {
+		return false;
+	}
+	std::ofstream output(stampPath, std::ios::binary | std::ios::trunc);
+	output.write(reinterpret_cast<const char*>(&current), sizeof(current));
+	if (!output) {
+		Logger::GetInstance().Log(std::format("Failed to write texture stamp: {}{}", sourcePath, kStampExtension), LogLevel::WARNING, LogCategory::Resource);
+	}
+
+	outHash = current.sourceHash;
+	return true;
+}
+
+std::string TextureCooker::GetCookedPath(const std::string& sourcePath, uint64_t sourceHash)
+{
+	return std::format("{}.{:016x}{}", sourcePath, sourceHash, kCookedExtension);
+}
+
+bool TextureCooker::LoadCooked(const std::string& sourcePath, uint64_t sourceHash, DirectX::ScratchImage& outImage)
+{
+	const std::wstring cookedPathW = Logger::GetInstance().ConvertString(GetCookedPath(sourcePath, sourceHash));
+
+	std::error_code error;
+	if (!std::filesystem::exists(cookedPathW, error)) {
+		return false;
+	}
+
+	const HRESULT hr = DirectX::LoadFromDDSFile(cookedPathW.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, outImage);
+	return SUCCEEDED(hr);
+}
+
+DXGI_FORMAT TextureCooker::SelectFormat(const DirectX::ScratchImage& mipImages)
+{
+	const DirectX::TexMetadata& metadata = mipImages.GetMetadata();
+	if (DirectX::IsCompressed(metadata.format) || !IsBlockAligned(metadata.width) || !IsBlockAligned(metadata.height)) {
+		return metadata.format;
+	}
+
+	switch (metadata.format) {
+	case DXGI_FORMAT_R8_UNORM:
+		return DXGI_FORMAT_BC4_UNORM;
+
+	case DXGI_FORMAT_R8G8_UNORM:
+		return DXGI_FORMAT_BC5_UNORM;
+
+	case DXGI_FORMAT_R8G8B8A8_UNORM:
+	case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+	case DXGI_FORMAT_B8G8R8A8_UNORM:
+	case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+	case DXGI_FORMAT_B8G8R8X8_UNORM:
+	case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB: {
+		// 不透明ならアルファのないBC1（8分の1）、半透明を含むならBC7（4分の1）
+		const DXGI_FORMAT format = mipImages.IsAlphaAllOpaque() ? DXGI_FORMAT_BC1_UNORM : DXGI_FORMAT_BC7_UNORM;
+		return DirectX::IsSRGB(metadata.format) ? DirectX::MakeSRGB(format) : format;
+	}
+
+	default:
+		// HDR・16bitなどは精度が落ちるので圧縮しない
+		return metadata.format;
+	}
+}
+
+bool TextureCooker::Cook(const std::string& sourcePath, uint64_t sourceHash, DirectX::ScratchImage& mipImages)
+{
+	const DirectX::TexMetadata metadata = mipImages.GetMetadata();
+	const DXGI_FORMAT format = SelectFormat(mipImages);
+
+	if (format != metadata.format) {
+		// BC7は最も時間のかかるモードを省く（それでもBC3より高画質）
+		DirectX::TEX_COMPRESS_FLAGS flags = DirectX::TEX_COMPRESS_PARALLEL;
+		if (format == DXGI_FORMAT_BC7_UNORM || format == DXGI_FORMAT_BC7_UNORM_SRGB) {
+			flags |= DirectX::TEX_COMPRESS_BC7_QUICK;
+		}
+
+		DirectX::ScratchImage compressed;
+		const HRESULT hr = DirectX::Compress(mipImages.GetImages(), mipImages.GetImageCount(), metadata,
+			format, flags, DirectX::TEX_THRESHOLD_DEFAULT, compressed);
+		if (FAILED(hr)) {
+			Logger::GetInstance().Log(std::format("Failed to compress texture: {} (HRESULT: 0x{:08X})", sourcePath, static_cast<unsigned int>(hr)),
+				LogLevel::WARNING, LogCategory::Resource);
+			return false;
+		}
+		mipImages = std::move(compressed);
+	}
+
+	const std::string cookedPath = GetCookedPath(sourcePath, sourceHash);
+	const std::wstring cookedPathW = Logger::GetInstance().ConvertString(cookedPath);
+	const std::wstring temporaryPathW = cookedPathW + L".tmp";
+
+	HRESULT hr = DirectX::SaveToDDSFile(mipImages.GetImages(), mipImages.GetImageCount(), mipImages.GetMetadata(),
+		DirectX::DDS_FLAGS_NONE, temporaryPathW.c_str());
+	if (FAILED(hr)) {
+		Logger::GetInstance().Log(std::format("Failed to write cooked texture: {} (HRESULT: 0x{:08X})", cookedPath, static_cast<unsigned int>(hr)),
+			LogLevel::WARNING, LogCategory::Resource);
+		return false;
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryPathW, cookedPathW, error);
+	if (error) {
+		std::filesystem::remove(temporaryPathW, error);
+		Logger::GetInstance().Log(std::format("Failed to replace cooked texture: {}", cookedPath), LogLevel::WARNING, LogCategory::Resource);
+		return false;
+	}
+
+	// 元ファイルの古い内容から作った焼き込みファイルを削除
+	const std::filesystem::path cookedFile(cookedPathW);
+	const std::wstring prefix = std::filesystem::path(Logger::GetInstance().ConvertString(sourcePath)).filename().wstring() + L".";
+	for (const auto& entry : std::filesystem::directory_iterator(cookedFile.parent_path(), error)) {
+		const std::wstring name = entry.path().filename().wstring();
+		if (name != cookedFile.filename().wstring() && name.starts_with(prefix) && name.ends_with(L".cooked.dds")) {
+			std::filesystem::remove(entry.path(), error);
+		}
+	}
+
+	Logger::GetInstance().Log(std::format("Texture cooked: {} ({}x{}, {} mips, {} bytes)", cookedPath,
+		metadata.width, metadata.height, metadata.mipLevels, mipImages.GetPixelsSize()), LogLevel::INFO, LogCategory::Resource);
+	return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <externals/DirectXTex/DirectXTex.h>
+
+/// @brief テクスチャを焼き込みファイル（ミップマップ付き・BC圧縮済みのDDS）に変換するクラス
+/// WICでのデコードとミップマップの生成を初回だけにし、次回からはDDSをそのままGPUへ転送する
+/// 焼き込みファイルは元ファイルの隣に「元ファイル名.<内容のハッシュ>.cooked.dds」として作る
+/// 元ファイルの内容が変わるとハッシュが変わるので、古い焼き込みファイルは使われずに作り直される
+/// 内容のハッシュは「元ファイル名.cooked.stamp」に元ファイルのサイズ・更新時刻と一緒に記録し、
+/// サイズ・更新時刻が変わっていなければ元ファイルを読まずにそのハッシュを使う（CookedModel と同じ判定）
+/// 圧縮形式は画像の内容で選ぶ
+/// - 1チャンネル: BC4 / 2チャンネル: BC5
+/// - 不透明なカラー: BC1 / 半透明を含むカラー: BC7
+/// - 既に圧縮済み、HDRなど上記以外の形式、幅・高さが4の倍数でない場合は圧縮せず、ミップマップだけを焼き込む
+class TextureCooker {
+public:
+	/// @brief 元ファイルの内容のハッシュを計算（FNV-1a。焼き込み形式のバージョンを含む）
+	/// @param sourcePath 元ファイルのパス
+	/// @param outHash ハッシュ
+	/// @return 元ファイルを読めたらtrue
+	static bool ComputeSourceHash(const std::string& sourcePath, uint64_t& outHash);
+
+	/// @brief 元ファイルの内容のハッシュを取得（読み込み時はこちらを使う）
+	/// 記録したサイズ・更新時刻と一致すれば記録したハッシュを返し、一致しなければ内容から計算して記録し直す
+	/// @param sourcePath 元ファイルのパス
+	/// @param outHash ハッシュ
+	/// @return 元ファイルがあり、ハッシュを取得できたらtrue
+	static bool ResolveSourceHash(const std::string& sourcePath, uint64_t& outHash);
+
+	/// @brief 焼き込みファイルのパスを取得
+	/// @param sourcePath 元ファイルのパス
+	/// @param sourceHash 元ファイルの内容のハッシュ
+	static std::string GetCookedPath(const std::string& sourcePath, uint64_t sourceHash);
+
+	/// @brief 焼き込みファイルを読み込む
+	/// @param sourcePath 元ファイルのパス
+	/// @param sourceHash 元ファイルの内容のハッシュ
+	/// @param outImage ミップマップを含む画像
+	/// @return 元ファイルと同じ内容の焼き込みファイルがあり、読み込めたらtrue
+	static bool LoadCooked(const std::string& sourcePath, uint64_t sourceHash, DirectX::ScratchImage& outImage);
+
+	/// @brief 焼き込みに使う形式を選ぶ
+	/// @param mipImages ミップマップを含む画像
+	/// @return 形式（圧縮しない場合は元の形式）
+	static DXGI_FORMAT SelectFormat(const DirectX::ScratchImage& mipImages);
+
+	/// @brief 圧縮して焼き込みファイルを書き出す（同じ元ファイルの古い焼き込みファイルは削除する）
+	/// 一時ファイルに書いてから置き換えるので、書き込み途中のファイルが読まれることはない
+	/// @param sourcePath 元ファイルのパス
+	/// @param sourceHash 元ファイルの内容のハッシュ
+	/// @param mipImages ミップマップを含む画像（圧縮した場合は圧縮後の画像に置き換える）
+	/// @return 書き出せたらtrue
+	static bool Cook(const std::string& sourcePath, uint64_t sourceHash, DirectX::ScratchImage& mipImages);
+
+private:
+	// 焼き込み形式のバージョン（形式の選び方や圧縮の設定を変えたら上げる）
+	static constexpr uint32_t kVersion = 1;
+};
@@ -28,6 +28,8 @@ struct WellForGPU {
 /// CPUで作られた諸々のデータをGPUで扱えるようにするための構造体
 struct SkinCluster {
 	std::vector<Matrix4x4> inverseBindPoseMatrices;   // BindPoseの逆行列（Joint数分）
+	std::vector<Matrix4x4> skeletonSpaceMatrices;     // パレット計算用の作業領域（Joint数分）
+	std::vector<Matrix4x4> skeletonSpaceInverseTransposeMatrices; // パレット計算用の作業領域（Joint数分）
 
 	Microsoft::WRL::ComPtr<ID3D12Resource> influenceResource;  // Influence用リソース
 	D3D12_VERTEX_BUFFER_VIEW influenceBufferView;              // InfluenceのBufferView
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "Vector/Vector2.h"
 #include "Vector/Vector3.h"
 #include "Vector/Vector4.h"
@@ -7,4 +9,10 @@ struct VertexData {
     Vector4 position; // 頂点の位置
     Vector2 texcoord; // UV座標
     Vector3 normal; // 法線ベクトル
-};
\ No newline at end of file
+};
+
+/// @brief GPU用に圧縮した頂点属性（モデルの頂点バッファのSlot 1。位置はSlot 0 の float3）
+struct PackedVertexAttribute {
+    int16_t normal[2];    // 八面体エンコードした法線（R16G16_SNORM）
+    uint16_t texcoord[2]; // UV座標（R16G16_FLOAT）
+};
@@ -1,8 +1,10 @@
 #include "TextureManager.h"
 #include "Engine/Graphics/Common/DirectXCommon.h"
 #include "Engine/Graphics/Resource/ResourceFactory.h"
+#include "Engine/Graphics/Resource/TextureCooker.h"
 #include "Engine/Utility/Logger/Logger.h"
 #include "Engine/Utility/FileErrorDialog/FileErrorDialog.h"
+#include "Engine/Utility/Job/JobSystem.h"
 
 #include "externals/DirectXTex/d3dx12.h"
 #include <Windows.h>
@@ -20,44 +22,177 @@ TextureManager& TextureManager::GetInstance()
 	return instance;
 }
 
+/// @brief テクスチャの非同期読み込みの要求
+/// デコードとミップマップ生成をワーカーで行い、GPUリソースの作成は Finalize で行う
+class TextureLoadRequest : public AsyncLoadRequest {
+public:
+	explicit TextureLoadRequest(std::string resolvedPath) : AsyncLoadRequest(std::move(resolvedPath)) {}
+
+	/// @brief 既に読み込まれているテクスチャで完了済みにする
+	void SetLoadedTexture(const TextureManager::LoadedTexture& texture) {
+		result_ = texture;
+		SetCompleted();
+	}
+
+	/// @brief 結果（完了後に有効）
+	const TextureManager::LoadedTexture* GetResult() const { return &result_; }
+
+protected:
+	bool Load() override {
+		// WIC はスレッドごとにCOMの初期化が必要
+		const HRESULT comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+		const bool succeeded = TextureManager::DecodeTexture(GetName(), mipImages_, error_, true, &pendingCook_);
+		if (SUCCEEDED(comResult)) {
+			CoUninitialize();
+		}
+		return succeeded;
+	}
+
+	bool Finalize() override {
+		TextureManager& textureManager = TextureManager::GetInstance();
+		result_ = textureManager.FinalizeAsyncLoad(GetName(), mipImages_);
+		textureManager.ScheduleCook(GetName(), pendingCook_, std::move(mipImages_));
+		return true;
+	}
+
+	void OnFailed() override {
+		TextureManager::GetInstance().OnAsyncLoadFailed(GetName(), error_);
+	}
+
+private:
+	DirectX::ScratchImage mipImages_;
+	TextureManager::PendingCook pendingCook_;
+	TextureManager::DecodeError error_;
+	TextureManager::LoadedTexture result_{};
+};
+
 // 初期化
-void TextureManager::Initialize(DirectXCommon* dxCommon)
+void TextureManager::Initialize(DirectXCommon* dxCommon, AsyncLoader* asyncLoader, JobSystem* jobSystem)
 {
 	std::lock_guard<std::mutex> lock(cacheMutex_);
 
 	assert(dxCommon != nullptr);
 	dxCommon_ = dxCommon;
+	asyncLoader_ = asyncLoader;
+	jobSystem_ = jobSystem;
 	isInitialized_ = true;
 }
 
 // テクスチャの読み込み
 TextureManager::LoadedTexture TextureManager::Load(const std::string& filePath)
 {
-	std::lock_guard<std::mutex> lock(cacheMutex_);
-
 	assert(isInitialized_ && "TextureManager is not initialized!");
 
 	// パスを解決
 	std::string resolvedPath = ResolveFilePath(filePath);
 
-	// すでに読み込んでいるならキャッシュを返す
-	auto it = textureCache_.find(resolvedPath);
-	if (it != textureCache_.end()) {
-		Logger::GetInstance().Log(std::format("Texture already loaded (cache hit): {}", resolvedPath), LogLevel::INFO, LogCategory::Graphics);
-		return it->second;
+	// 非同期で読み込み中なら完了まで待つ（仕上げの中で cacheMutex_ を取るので、ロックの外で待つ）
+	std::shared_ptr<TextureLoadRequest> pendingRequest;
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex_);
+		auto pendingIt = pendingRequests_.find(resolvedPath);
+		if (pendingIt != pendingRequests_.end()) {
+			pendingRequest = pendingIt->second;
+		}
+	}
+	if (pendingRequest) {
+		asyncLoader_->Wait(*pendingRequest);
+		if (pendingRequest->GetState() == AsyncLoadRequest::State::Failed) {
+			throw std::runtime_error(std::format("Failed to load texture: {}", resolvedPath)); // エラーは OnFailed で表示済み
+		}
 	}
 
-	// ロード開始ログ
-	Logger::GetInstance().Log(std::format("Loading texture: {}", resolvedPath), LogLevel::INFO, LogCategory::Graphics);
-
+	DirectX::ScratchImage mipImages;
+	PendingCook pendingCook;
 	LoadedTexture result{};
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex_);
+
+		// すでに読み込んでいるならキャッシュを返す
+		auto it = textureCache_.find(resolvedPath);
+		if (it != textureCache_.end()) {
+			Logger::GetInstance().Log(std::format("Texture already loaded (cache hit): {}", resolvedPath), LogLevel::INFO, LogCategory::Graphics);
+			return it->second;
+		}
+
+		// ロード開始ログ
+		Logger::GetInstance().Log(std::format("Loading texture: {}", resolvedPath), LogLevel::INFO, LogCategory::Graphics);
 
-	// 1. テクスチャの読み込みとミップマップ生成
+		// 1. テクスチャの読み込みとミップマップ生成
+		DecodeError error;
+		if (!DecodeTexture(resolvedPath, mipImages, error, true, &pendingCook)) {
+			ReportDecodeError(resolvedPath, error);
+			throw std::runtime_error(error.message);
+		}
+
+		// 2～4. リソース生成・データ転送・SRV作成
+		result = CreateTexture(resolvedPath, mipImages);
+	}
+
+	// 5. 焼き込みファイルがなければ、転送済みの画像をジョブで焼き込む（ロックの外で行う）
+	ScheduleCook(resolvedPath, pendingCook, std::move(mipImages));
+	return result;
+}
+
+// テクスチャの非同期読み込み
+TextureManager::TextureLoadHandle TextureManager::LoadAsync(const std::string& filePath)
+{
+	assert(isInitialized_ && "TextureManager is not initialized!");
+
+	std::string resolvedPath = ResolveFilePath(filePath);
+
+	std::shared_ptr<TextureLoadRequest> request;
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex_);
+
+		// すでに読み込んでいるなら完了済みのハンドルを返す
+		auto it = textureCache_.find(resolvedPath);
+		if (it != textureCache_.end()) {
+			request = std::make_shared<TextureLoadRequest>(resolvedPath);
+			request->SetLoadedTexture(it->second);
+			return TextureLoadHandle(request, request->GetResult());
+		}
+
+		// 読み込み中なら同じ要求を返す
+		auto pendingIt = pendingRequests_.find(resolvedPath);
+		if (pendingIt != pendingRequests_.end()) {
+			return TextureLoadHandle(pendingIt->second, pendingIt->second->GetResult());
+		}
+
+		request = std::make_shared<TextureLoadRequest>(resolvedPath);
+		pendingRequests_[resolvedPath] = request;
+	}
+
+	Logger::GetInstance().Log(std::format("Loading texture (async): {}", resolvedPath), LogLevel::INFO, LogCategory::Graphics);
+
+	// 非同期読み込みを使わない設定なら、ここで読み込みまで終わらせる
+	if (asyncLoader_) {
+		asyncLoader_->Submit(request);
+	} else {
+		AsyncLoader immediateLoader;
+		immediateLoader.Submit(request);
+		immediateLoader.WaitAll();
+	}
+
+	return TextureLoadHandle(request, request->GetResult());
+}
+
+bool TextureManager::DecodeTexture(const std::string& resolvedPath, DirectX::ScratchImage& outMipImages, DecodeError& outError,
+	bool useCookedFile, PendingCook* outPendingCook)
+{
 	DirectX::ScratchImage image;
 	std::wstring filePathW = Logger::GetInstance().ConvertString(resolvedPath);
+	const bool isDds = filePathW.ends_with(L".dds");
+
+	// DDS以外は、元ファイルと同じ内容から作った焼き込みファイルがあればそれを使う（デコードとミップマップ生成を省く）
+	uint64_t sourceHash = 0;
+	const bool canCook = useCookedFile && !isDds && TextureCooker::ResolveSourceHash(resolvedPath, sourceHash);
+	if (canCook && TextureCooker::LoadCooked(resolvedPath, sourceHash, outMipImages)) {
+		return true;
+	}
 
 	HRESULT hr;
-	if (filePathW.ends_with(L".dds")) { // DDSファイルの場合
+	if (isDds) { // DDSファイルの場合
 		hr = DirectX::LoadFromDDSFile(filePathW.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, image);
 
 	} else { // その他の形式の場合
@@ -66,38 +201,84 @@ TextureManager::LoadedTexture TextureManager::Load(const std::string& filePath)
 	}
 
 	if (FAILED(hr)) {
-		std::string errorMsg = std::format("Failed to load texture file: {}\nHRESULT: 0x{:08X}\nPlease check if the file exists and the path is correct.", resolvedPath, static_cast<unsigned int>(hr));
-		Logger::GetInstance().Log(errorMsg, LogLevel::Error, LogCategory::Graphics);
-		FileErrorDialog::ShowTextureError("Failed to load texture file", resolvedPath, hr);
-		throw std::runtime_error(errorMsg);
+		outError.result = hr;
+		outError.title = "Failed to load texture file";
+		outError.message = std::format("Failed to load texture file: {}\nHRESULT: 0x{:08X}\nPlease check if the file exists and the path is correct.", resolvedPath, static_cast<unsigned int>(hr));
+		return false;
 	}
 
-	DirectX::ScratchImage mipImages;
-
 	if (DirectX::IsCompressed(image.GetMetadata().format)) { //圧縮フォーマットか調べる
-		mipImages = std::move(image); //圧縮フォーマットの場合はミップマップ生成せずそのまま使う
+		outMipImages = std::move(image); //圧縮フォーマットの場合はミップマップ生成せずそのまま使う
 
 	} else {
 		// 画像サイズが1x1の場合はミップマップ生成をスキップ
 		const DirectX::TexMetadata& metadata = image.GetMetadata();
 		if (metadata.width == 1 && metadata.height == 1) {
 			// 1x1テクスチャの場合はそのまま使用
-			mipImages = std::move(image);
+			outMipImages = std::move(image);
 		} else {
 
 			size_t mipLevels = 0; // 0を指定すると自動的に最大ミップレベルを計算
 			
-			hr = DirectX::GenerateMipMaps(image.GetImages(), image.GetImageCount(), image.GetMetadata(), DirectX::TEX_FILTER_SRGB, mipLevels, mipImages);
+			hr = DirectX::GenerateMipMaps(image.GetImages(), image.GetImageCount(), image.GetMetadata(), DirectX::TEX_FILTER_SRGB, mipLevels, outMipImages);
 			
 			if (FAILED(hr)) {
-				std::string errorMsg = std::format("Failed to generate mipmaps for texture: {}\nHRESULT: 0x{:08X}", resolvedPath, static_cast<unsigned int>(hr));
-				Logger::GetInstance().Log(errorMsg, LogLevel::Error, LogCategory::Graphics);
-				FileErrorDialog::ShowTextureError("Failed to generate mipmaps for texture", resolvedPath, hr);
-				throw std::runtime_error(errorMsg);
+				outError.result = hr;
+				outError.title = "Failed to generate mipmaps for texture";
+				outError.message = std::format("Failed to generate mipmaps for texture: {}\nHRESULT: 0x{:08X}", resolvedPath, static_cast<unsigned int>(hr));
+				return false;
 			}
 		}
 	}
 
+	// 次回のための焼き込みは時間がかかるので、呼び出し側がジョブで行う（今回は未圧縮の画像を使う）
+	if (canCook && outPendingCook) {
+		outPendingCook->required = true;
+		outPendingCook->sourceHash = sourceHash;
+	}
+
+	return true;
+}
+
+void TextureManager::ScheduleCook(const std::string& resolvedPath, const PendingCook& pendingCook, DirectX::ScratchImage&& mipImages)
+{
+	if (!pendingCook.required) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(cookMutex_);
+		if (!cookingPaths_.insert(resolvedPath).second) {
+			return; // 同じファイルを焼き込み中
+		}
+	}
+
+	// std::function はコピー可能な関数しか持てないので、画像は shared_ptr で渡す
+	auto images = std::make_shared<DirectX::ScratchImage>(std::move(mipImages));
+	auto cook = [this, resolvedPath, sourceHash = pendingCook.sourceHash, images]() {
+		TextureCooker::Cook(resolvedPath, sourceHash, *images);
+
+		std::lock_guard<std::mutex> lock(cookMutex_);
+		cookingPaths_.erase(resolvedPath);
+	};
+
+	if (jobSystem_) {
+		jobSystem_->Schedule(std::move(cook));
+	} else {
+		cook();
+	}
+}
+
+void TextureManager::ReportDecodeError(const std::string& resolvedPath, const DecodeError& error) const
+{
+	Logger::GetInstance().Log(error.message, LogLevel::Error, LogCategory::Graphics);
+	FileErrorDialog::ShowTextureError(error.title, resolvedPath, error.result);
+}
+
+TextureManager::LoadedTexture TextureManager::CreateTexture(const std::string& resolvedPath, const DirectX::ScratchImage& mipImages)
+{
+	LoadedTexture result{};
+
 	const DirectX::TexMetadata& texMetadata = mipImages.GetMetadata();
 
 	// メタデータをキャッシュに保存
@@ -116,7 +297,7 @@ TextureManager::LoadedTexture TextureManager::Load(const std::string& filePath)
 	D3D12_HEAP_PROPERTIES heapProperties{};
 	heapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
 
-	hr = dxCommon_->GetDevice()->CreateCommittedResource(
+	HRESULT hr = dxCommon_->GetDevice()->CreateCommittedResource(
 		&heapProperties,
 		D3D12_HEAP_FLAG_NONE,
 		&resourceDesc,
@@ -185,6 +366,31 @@ TextureManager::LoadedTexture TextureManager::Load(const std::string& filePath)
 	return result;
 }
 
+TextureManager::LoadedTexture TextureManager::FinalizeAsyncLoad(const std::string& resolvedPath, const DirectX::ScratchImage& mipImages)
+{
+	std::lock_guard<std::mutex> lock(cacheMutex_);
+
+	pendingRequests_.erase(resolvedPath);
+
+	// 待っている間に同期読み込みされていればそれを使う
+	auto it = textureCache_.find(resolvedPath);
+	if (it != textureCache_.end()) {
+		return it->second;
+	}
+	return CreateTexture(resolvedPath, mipImages);
+}
+
+void TextureManager::OnAsyncLoadFailed(const std::string& resolvedPath, const DecodeError& error)
+{
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex_);
+		pendingRequests_.erase(resolvedPath);
+	}
+
+	// 同期読み込みと違い、例外は投げずに呼び出し元のハンドルで失敗を知らせる
+	ReportDecodeError(resolvedPath, error);
+}
+
 DirectX::TexMetadata TextureManager::GetMetadata(const std::string& filePath)
 {
 	std::lock_guard<std::mutex> lock(cacheMutex_);
@@ -226,6 +432,7 @@ void TextureManager::Clear()
 
 	textureCache_.clear();
 	metadataCache_.clear();
+	pendingRequests_.clear();
 }
 
 std::string TextureManager::ResolveFilePath(const std::string& filePath) const
@@ -5,10 +5,16 @@
 #include <string>
 #include <wrl.h>
 #include <unordered_map>
+#include <memory>
 #include <mutex>
+#include <unordered_set>
+
+#include "Engine/Graphics/Resource/AsyncLoader.h"
 
 class GameScene;
 class DirectXCommon;
+class JobSystem;
+class TextureLoadRequest;
 
 class TextureManager {
 public:
@@ -19,6 +25,9 @@ public:
 		D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle;
 	};
 
+	/// @brief 非同期読み込みのハンドル
+	using TextureLoadHandle = AsyncLoadHandle<LoadedTexture>;
+
 	// シングルトンアクセス
 	static TextureManager& GetInstance();
 
@@ -30,13 +39,22 @@ public:
 
 	/// @brief 初期化処理
 	/// @param dxCommon dxCommonへのポインタ
-	void Initialize(DirectXCommon* dxCommon);
+	/// @param asyncLoader 非同期読み込みの管理クラス（nullptrなら LoadAsync も同期で読み込む）
+	/// @param jobSystem 焼き込みを実行するジョブシステム（nullptrなら読み込みの後にその場で焼き込む）
+	void Initialize(DirectXCommon* dxCommon, AsyncLoader* asyncLoader = nullptr, JobSystem* jobSystem = nullptr);
 
 	/// @brief テクスチャの読み込み
 	/// @param filePath ファイルパス（Assetsフォルダを省略可能）
 	/// @return 読み込まれたテクスチャ
 	LoadedTexture Load(const std::string& filePath);
 
+	/// @brief テクスチャの非同期読み込み
+	/// デコードとミップマップ生成はワーカースレッドで行い、GPUリソースの作成と転送は AsyncLoader::Update で行う
+	/// 読み込み中に同じファイルを Load した場合は、その場で完了まで待つ
+	/// @param filePath ファイルパス（Assetsフォルダを省略可能）
+	/// @return 読み込みのハンドル（キャッシュにある場合は完了済み）
+	TextureLoadHandle LoadAsync(const std::string& filePath);
+
 	/// @brief テクスチャのメタデータを取得
 	/// @param filePath ファイルパス（Assetsフォルダを省略可能）
 	/// @return テクスチャのメタデータ（幅・高さなど）
@@ -53,7 +71,34 @@ public:
 	/// @return テクスチャキャッシュへの参照
 	const std::unordered_map<std::string, LoadedTexture>& GetTextureCache() const { return textureCache_; }
 
+	/// @brief デコードのエラー情報
+	struct DecodeError {
+		HRESULT result = S_OK;
+		std::string title;   // エラーダイアログのタイトル
+		std::string message; // ログに出すメッセージ
+	};
+
+	/// @brief デコードした画像の焼き込みが必要かどうか（DecodeTexture が設定する）
+	struct PendingCook {
+		bool required = false;   // 焼き込みファイルがなく、デコードした画像を焼き込む必要がある
+		uint64_t sourceHash = 0; // デコードした時の元ファイルの内容のハッシュ
+	};
+
+	/// @brief 画像ファイルのデコードとミップマップ生成（GPUを使わないので、どのスレッドからでも呼べる）
+	/// DDS以外は焼き込みファイル（TextureCooker）があればそれを読む
+	/// なければデコードした未圧縮の画像を返し、焼き込みは outPendingCook を受け取った呼び出し側がジョブで行う
+	/// @param resolvedPath 解決済みのパス
+	/// @param outMipImages ミップマップを含む画像（焼き込みファイルを読んだ場合はBC圧縮済み）
+	/// @param outError 失敗した場合のエラー情報
+	/// @param useCookedFile 焼き込みファイルを使うか（falseなら毎回デコードする。ベンチマーク用）
+	/// @param outPendingCook 焼き込みが必要かどうか（nullptrなら焼き込まない）
+	/// @return 成功したらtrue
+	static bool DecodeTexture(const std::string& resolvedPath, DirectX::ScratchImage& outMipImages, DecodeError& outError,
+		bool useCookedFile = true, PendingCook* outPendingCook = nullptr);
+
 private:
+	friend class TextureLoadRequest;
+
 	// プライベートコンストラクタ・デストラクタ
 	TextureManager() = default;
 	~TextureManager() = default;
@@ -63,7 +108,31 @@ private:
 	/// @return 解決されたフルパス
 	std::string ResolveFilePath(const std::string& filePath) const;
 
+	/// @brief デコードのエラーをログとダイアログで知らせる
+	void ReportDecodeError(const std::string& resolvedPath, const DecodeError& error) const;
+
+	/// @brief GPUリソースの作成・転送・SRVの作成を行い、キャッシュに登録する（cacheMutex_ を持った状態で呼ぶ）
+	/// @param resolvedPath 解決済みのパス
+	/// @param mipImages ミップマップを含む画像
+	/// @return 読み込まれたテクスチャ
+	LoadedTexture CreateTexture(const std::string& resolvedPath, const DirectX::ScratchImage& mipImages);
+
+	/// @brief 非同期読み込みの仕上げ（TextureLoadRequest から描画スレッドで呼ばれる）
+	LoadedTexture FinalizeAsyncLoad(const std::string& resolvedPath, const DirectX::ScratchImage& mipImages);
+
+	/// @brief 非同期読み込みの失敗（TextureLoadRequest から描画スレッドで呼ばれる）
+	void OnAsyncLoadFailed(const std::string& resolvedPath, const DecodeError& error);
+
+	/// @brief デコードした画像の焼き込みをジョブに登録する（cacheMutex_ を持たずに、GPUへの転送を済ませてから呼ぶ）
+	/// 焼き込みが終わるまでは、次に読み込んだ時も未圧縮の画像を使う
+	/// @param resolvedPath 解決済みのパス
+	/// @param pendingCook DecodeTexture が設定した情報（焼き込みが不要なら何もしない）
+	/// @param mipImages ミップマップを含む画像（ジョブに引き渡す）
+	void ScheduleCook(const std::string& resolvedPath, const PendingCook& pendingCook, DirectX::ScratchImage&& mipImages);
+
 	DirectXCommon* dxCommon_ = nullptr;
+	AsyncLoader* asyncLoader_ = nullptr;
+	JobSystem* jobSystem_ = nullptr;
 	bool isInitialized_ = false;
 
 	// デフォルトのベースパス
@@ -73,7 +142,13 @@ private:
 	std::unordered_map<std::string, LoadedTexture> textureCache_;
 	// メタデータキャッシュ
 	std::unordered_map<std::string, DirectX::TexMetadata> metadataCache_;
+	// 非同期で読み込み中のテクスチャ
+	std::unordered_map<std::string, std::shared_ptr<TextureLoadRequest>> pendingRequests_;
 
 	// スレッドセーフ用ミューテックス
 	mutable std::mutex cacheMutex_;
+
+	// 焼き込みのジョブを実行中のテクスチャ（同じファイルを重ねて焼き込まない）
+	std::unordered_set<std::string> cookingPaths_;
+	std::mutex cookMutex_;
 };
@@ -0,0 +1,530 @@
+#include "MathBenchmark.h"
+#include "MathCore.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <random>
+
+namespace {
+	constexpr uint32_t kSeed = 12345;
+	// 入力データの数（L1キャッシュに収まる程度にして、メモリ帯域ではなく演算を計測する）
+	constexpr uint32_t kInputCount = 256;
+
+	using Clock = std::chrono::steady_clock;
+
+	//================================================
+	// 変更前のスカラー実装（比較用）
+	//================================================
+
+	Matrix4x4 LegacyMultiply(const Matrix4x4& m1, const Matrix4x4& m2) {
+		Matrix4x4 result;
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				result.m[i][j] = 0;
+				for (int k = 0; k < 4; ++k) {
+					result.m[i][j] += m1.m[i][k] * m2.m[k][j];
+				}
+			}
+		}
+		return result;
+	}
+
+	Matrix4x4 LegacyTranspose(const Matrix4x4& m) {
+		Matrix4x4 result;
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				result.m[i][j] = m.m[j][i];
+			}
+		}
+		return result;
+	}
+
+	Matrix4x4 LegacyInverse(const Matrix4x4& m) {
+		Matrix4x4 result;
+		float det;
+
+		// 各要素の余因子を直接計算
+		float cof[4][4];
+
+		cof[0][0] = m.m[1][1] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[1][2] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) + m.m[1][3] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]);
+		cof[0][1] = -(m.m[1][0] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[1][2] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[1][3] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]));
+		cof[0][2] = m.m[1][0] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) - m.m[1][1] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[1][3] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]);
+		cof[0][3] = -(m.m[1][0] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]) - m.m[1][1] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]) + m.m[1][2] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]));
+
+		cof[1][0] = -(m.m[0][1] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[0][2] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) + m.m[0][3] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]));
+		cof[1][1] = m.m[0][0] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[0][2] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[0][3] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]);
+		cof[1][2] = -(m.m[0][0] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) - m.m[0][1] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[0][3] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]));
+		cof[1][3] = m.m[0][0] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]) - m.m[0][1] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]) + m.m[0][2] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]);
+
+		cof[2][0] = m.m[0][1] * (m.m[1][2] * m.m[3][3] - m.m[1][3] * m.m[3][2]) - m.m[0][2] * (m.m[1][1] * m.m[3][3] - m.m[1][3] * m.m[3][1]) + m.m[0][3] * (m.m[1][1] * m.m[3][2] - m.m[1][2] * m.m[3][1]);
+		cof[2][1] = -(m.m[0][0] * (m.m[1][2] * m.m[3][3] - m.m[1][3] * m.m[3][2]) - m.m[0][2] * (m.m[1][0] * m.m[3][3] - m.m[1][3] * m.m[3][0]) + m.m[0][3] * (m.m[1][0] * m.m[3][2] - m.m[1][2] * m.m[3][0]));
+		cof[2][2] = m.m[0][0] * (m.m[1][1] * m.m[3][3] - m.m[1][3] * m.m[3][1]) - m.m[0][1] * (m.m[1][0] * m.m[3][3] - m.m[1][3] * m.m[3][0]) + m.m[0][3] * (m.m[1][0] * m.m[3][1] - m.m[1][1] * m.m[3][0]);
+		cof[2][3] = -(m.m[0][0] * (m.m[1][1] * m.m[3][2] - m.m[1][2] * m.m[3][1]) - m.m[0][1] * (m.m[1][0] * m.m[3][2] - m.m[1][2] * m.m[3][0]) + m.m[0][2] * (m.m[1][0] * m.m[3][1] - m.m[1][1] * m.m[3][0]));
+
+		cof[3][0] = -(m.m[0][1] * (m.m[1][2] * m.m[2][3] - m.m[1][3] * m.m[2][2]) - m.m[0][2] * (m.m[1][1] * m.m[2][3] - m.m[1][3] * m.m[2][1]) + m.m[0][3] * (m.m[1][1] * m.m[2][2] - m.m[1][2] * m.m[2][1]));
+		cof[3][1] = m.m[0][0] * (m.m[1][2] * m.m[2][3] - m.m[1][3] * m.m[2][2]) - m.m[0][2] * (m.m[1][0] * m.m[2][3] - m.m[1][3] * m.m[2][0]) + m.m[0][3] * (m.m[1][0] * m.m[2][2] - m.m[1][2] * m.m[2][0]);
+		cof[3][2] = -(m.m[0][0] * (m.m[1][1] * m.m[2][3] - m.m[1][3] * m.m[2][1]) - m.m[0][1] * (m.m[1][0] * m.m[2][3] - m.m[1][3] * m.m[2][0]) + m.m[0][3] * (m.m[1][0] * m.m[2][1] - m.m[1][1] * m.m[2][0]));
+		cof[3][3] = m.m[0][0] * (m.m[1][1] * m.m[2][2] - m.m[1][2] * m.m[2][1]) - m.m[0][1] * (m.m[1][0] * m.m[2][2] - m.m[1][2] * m.m[2][0]) + m.m[0][2] * (m.m[1][0] * m.m[2][1] - m.m[1][1] * m.m[2][0]);
+
+		// 行列式の計算
+		det = m.m[0][0] * cof[0][0] + m.m[0][1] * cof[0][1] + m.m[0][2] * cof[0][2] + m.m[0][3] * cof[0][3];
+
+		if (det == 0.0f) {
+			return MathCore::Matrix::Identity();
+		}
+
+		// 逆行列の計算
+		float invDet = 1.0f / det;
+		for (int i = 0; i < 4; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				result.m[j][i] = cof[i][j] * invDet;
+			}
+		}
+
+		return result;
+	}
+
+	Vector3 LegacyTransformCoord(const Vector3& vector, const Matrix4x4& matrix) {
+		Vector3 result;
+		result.x = vector.x * matrix.m[0][0] + vector.y * matrix.m[1][0] + vector.z * matrix.m[2][0] + matrix.m[3][0];
+		result.y = vector.x * matrix.m[0][1] + vector.y * matrix.m[1][1] + vector.z * matrix.m[2][1] + matrix.m[3][1];
+		result.z = vector.x * matrix.m[0][2] + vector.y * matrix.m[1][2] + vector.z * matrix.m[2][2] + matrix.m[3][2];
+		float w = vector.x * matrix.m[0][3] + vector.y * matrix.m[1][3] + vector.z * matrix.m[2][3] + matrix.m[3][3];
+
+		result.x /= w;
+		result.y /= w;
+		result.z /= w;
+
+		return result;
+	}
+
+	Vector3 LegacyTransformNormal(const Vector3& v, const Matrix4x4& m) {
+		Vector3 result;
+		result.x = v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0];
+		result.y = v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1];
+		result.z = v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2];
+		return result;
+	}
+
+	Quaternion LegacyQuaternionMultiply(const Quaternion& lhs, const Quaternion& rhs) {
+		Quaternion result;
+		result.w = lhs.w * rhs.w - lhs.x * rhs.x - lhs.y * rhs.y - lhs.z * rhs.z;
+		result.x = lhs.w * rhs.x + lhs.x * rhs.w + lhs.y * rhs.z - lhs.z * rhs.y;
+		result.y = lhs.w * rhs.y - lhs.x * rhs.z + lhs.y * rhs.w + lhs.z * rhs.x;
+		result.z = lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w;
+		return result;
+	}
+
+	Quaternion LegacySlerp(const Quaternion& q0, const Quaternion& q1, float t) {
+		float dot = q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w;
+
+		Quaternion q1Adjusted = q1;
+		if (dot < 0.0f) {
+			dot = -dot;
+			q1Adjusted.x = -q1.x;
+			q1Adjusted.y = -q1.y;
+			q1Adjusted.z = -q1.z;
+			q1Adjusted.w = -q1.w;
+		}
+
+		const float epsilon = 1e-6f;
+		if (dot > 1.0f - epsilon) {
+			Quaternion result;
+			result.x = (1.0f - t) * q0.x + t * q1Adjusted.x;
+			result.y = (1.0f - t) * q0.y + t * q1Adjusted.y;
+			result.z = (1.0f - t) * q0.z + t * q1Adjusted.z;
+			result.w = (1.0f - t) * q0.w + t * q1Adjusted.w;
+			return MathCore::QuaternionMath::Normalize(result);
+		}
+
+		float theta = std::acos(dot);
+		float sinTheta = std::sin(theta);
+		float scale0 = std::sin((1.0f - t) * theta) / sinTheta;
+		float scale1 = std::sin(t * theta) / sinTheta;
+
+		Quaternion result;
+		result.x = scale0 * q0.x + scale1 * q1Adjusted.x;
+		result.y = scale0 * q0.y + scale1 * q1Adjusted.y;
+		result.z = scale0 * q0.z + scale1 * q1Adjusted.z;
+		result.w = scale0 * q0.w + scale1 * q1Adjusted.w;
+		return result;
+	}
+
+	//================================================
+	// 入力データ・誤差
+	//================================================
+
+	/// @brief ベンチマークの入力（スケール・回転・平行移動を持つアフィン行列など）
+	struct Inputs {
+		std::vector<Matrix4x4> matrices;
+		std::vector<Matrix4x4> uniformScaleMatrices; // 均等スケールのアフィン行列
+		std::vector<Vector3> vectors;
+		std::vector<Quaternion> quaternions;
+		std::vector<float> ratios;
+	};
+
+	Inputs CreateInputs() {
+		Inputs inputs;
+		std::mt19937 engine(kSeed);
+		std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+		std::uniform_real_distribution<float> angle(-3.14159265f, 3.14159265f);
+		std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		std::uniform_real_distribution<float> ratio(0.0f, 1.0f);
+
+		for (uint32_t i = 0; i < kInputCount; ++i) {
+			// 引数の評価順に依存しないよう、乱数は1つずつ取り出す
+			Vector3 scaleValue, rotateValue, translateValue, vector;
+			Quaternion quaternion;
+			scaleValue.x = scale(engine); scaleValue.y = scale(engine); scaleValue.z = scale(engine);
+			rotateValue.x = angle(engine); rotateValue.y = angle(engine); rotateValue.z = angle(engine);
+			translateValue.x = position(engine); translateValue.y = position(engine); translateValue.z = position(engine);
+			vector.x = position(engine); vector.y = position(engine); vector.z = position(engine);
+			quaternion.x = unit(engine); quaternion.y = unit(engine); quaternion.z = unit(engine); quaternion.w = unit(engine);
+
+			inputs.matrices.push_back(MathCore::Matrix::MakeAffine(scaleValue, rotateValue, translateValue));
+			inputs.uniformScaleMatrices.push_back(MathCore::Matrix::MakeAffine({ scaleValue.x, scaleValue.x, scaleValue.x }, rotateValue, translateValue));
+			inputs.vectors.push_back(vector);
+			inputs.quaternions.push_back(MathCore::QuaternionMath::Normalize(quaternion));
+			inputs.ratios.push_back(ratio(engine));
+		}
+		return inputs;
+	}
+
+	/// @brief 要素ごとの差（値が1以上の場合は相対誤差）
+	float Difference(const float* a, const float* b, int count) {
+		float maxError = 0.0f;
+		for (int i = 0; i < count; ++i) {
+			const float scale = (std::max)(1.0f, std::abs(a[i]));
+			maxError = (std::max)(maxError, std::abs(a[i] - b[i]) / scale);
+		}
+		return maxError;
+	}
+
+	float Difference(const Matrix4x4& a, const Matrix4x4& b) { return Difference(&a.m[0][0], &b.m[0][0], 16); }
+	float Difference(const Vector3& a, const Vector3& b) { return Difference(&a.x, &b.x, 3); }
+	float Difference(const Quaternion& a, const Quaternion& b) { return Difference(&a.x, &b.x, 4); }
+
+	/// @brief 1回あたりの時間（ナノ秒）を計測
+	/// @param iterationCount 呼び出し回数
+	/// @param function uint32_t（入力のインデックス）を受け取り、最適化で消されないよう結果を蓄積する関数
+	template <typename Function>
+	double MeasureNanoseconds(uint32_t iterationCount, Function&& function) {
+		const auto start = Clock::now();
+		for (uint32_t i = 0; i < iterationCount; ++i) {
+			function(i % kInputCount);
+		}
+		const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+		return elapsed / static_cast<double>(iterationCount);
+	}
+
+	/// @brief 関数ポインタを最適化で追跡できない形で返す
+	/// 同じ翻訳単位にある変更前の実装だけがインライン展開され、比較が不公平になるのを防ぐ
+	template <typename Function>
+	Function* Opaque(Function* function) {
+		Function* volatile pointer = function;
+		return pointer;
+	}
+
+	// 計測結果を捨てないための出力先
+	volatile float g_sink = 0.0f;
+}
+
+std::vector<MathBenchmark::Result> MathBenchmark::RunSkinningPalette(uint32_t characterCount, uint32_t jointCount, uint32_t frameCount) {
+	std::vector<Result> results;
+	if (characterCount == 0 || jointCount == 0 || frameCount == 0) {
+		return results;
+	}
+
+	// 親子が一列に並んだスケルトン（根はインポート時の単位変換を想定した均等スケール）
+	std::mt19937 engine(kSeed);
+	std::uniform_real_distribution<float> angle(-0.5f, 0.5f);
+	std::uniform_real_distribution<float> offset(-0.2f, 0.2f);
+	auto makeSkeletonSpace = [&](std::vector<Matrix4x4>& skeletonSpace) {
+		for (uint32_t joint = 0; joint < jointCount; ++joint) {
+			Vector3 rotate, translate;
+			rotate.x = angle(engine); rotate.y = angle(engine); rotate.z = angle(engine);
+			translate.x = offset(engine); translate.y = 1.0f; translate.z = offset(engine);
+			const float scale = joint == 0 ? 0.01f : 1.0f;
+			const Matrix4x4 local = MathCore::Matrix::MakeAffine({ scale, scale, scale }, rotate, translate);
+			skeletonSpace[joint] = joint == 0 ? local : local * skeletonSpace[joint - 1];
+		}
+	};
+
+	std::vector<Matrix4x4> inverseBindPoseMatrices(jointCount);
+	makeSkeletonSpace(inverseBindPoseMatrices);
+	for (auto& matrix : inverseBindPoseMatrices) {
+		matrix = MathCore::Matrix::Inverse(matrix);
+	}
+
+	// キャラクターごとの姿勢（スケルトン空間の行列）
+	std::vector<std::vector<Matrix4x4>> poses(characterCount, std::vector<Matrix4x4>(jointCount));
+	for (auto& pose : poses) {
+		makeSkeletonSpace(pose);
+	}
+
+	// パレット（GPUへ送る行列と逆転置行列）と計算用の作業領域
+	struct PaletteEntry {
+		Matrix4x4 skeletonSpaceMatrix;
+		Matrix4x4 skeletonSpaceInverseTransposeMatrix;
+	};
+	std::vector<std::vector<PaletteEntry>> palettes(characterCount, std::vector<PaletteEntry>(jointCount));
+	std::vector<Matrix4x4> skeletonSpaceMatrices(jointCount);
+	std::vector<Matrix4x4> inverseTransposeMatrices(jointCount);
+
+	// 変更前の SkinClusterGenerator::Update（ジョイントごとに Transpose(Inverse(...))）
+	auto legacyUpdate = [&](uint32_t character) {
+		auto& palette = palettes[character];
+		for (uint32_t joint = 0; joint < jointCount; ++joint) {
+			palette[joint].skeletonSpaceMatrix = inverseBindPoseMatrices[joint] * poses[character][joint];
+			palette[joint].skeletonSpaceInverseTransposeMatrix =
+				MathCore::Matrix::Transpose(MathCore::Matrix::Inverse(palette[joint].skeletonSpaceMatrix));
+		}
+	};
+
+	// 一括処理で、逆転置行列は一般の逆行列で求める場合（行列の種類の判定の効果を分けて見るため）
+	auto batchGeneralUpdate = [&](uint32_t character) {
+		MathCore::Batch::MultiplyMatrices(inverseBindPoseMatrices, poses[character], skeletonSpaceMatrices);
+		for (uint32_t joint = 0; joint < jointCount; ++joint) {
+			if (!MathSimd::InverseMatrix4x4(&skeletonSpaceMatrices[joint].m[0][0], &inverseTransposeMatrices[joint].m[0][0], true)) {
+				inverseTransposeMatrices[joint] = MathCore::Matrix::Identity();
+			}
+		}
+		auto& palette = palettes[character];
+		for (uint32_t joint = 0; joint < jointCount; ++joint) {
+			palette[joint].skeletonSpaceMatrix = skeletonSpaceMatrices[joint];
+			palette[joint].skeletonSpaceInverseTransposeMatrix = inverseTransposeMatrices[joint];
+		}
+	};
+
+	// 現在の SkinClusterGenerator::Update と同じ処理
+	auto currentUpdate = [&](uint32_t character) {
+		MathCore::Batch::MultiplyMatrices(inverseBindPoseMatrices, poses[character], skeletonSpaceMatrices);
+		MathCore::Batch::InverseTransposes(skeletonSpaceMatrices, inverseTransposeMatrices);
+		auto& palette = palettes[character];
+		for (uint32_t joint = 0; joint < jointCount; ++joint) {
+			palette[joint].skeletonSpaceMatrix = skeletonSpaceMatrices[joint];
+			palette[joint].skeletonSpaceInverseTransposeMatrix = inverseTransposeMatrices[joint];
+		}
+	};
+
+	// 全キャラクター分を frameCount 回更新した1フレームあたりの時間（ミリ秒）
+	auto measureFrame = [&](auto&& update) {
+		const auto start = Clock::now();
+		for (uint32_t frame = 0; frame < frameCount; ++frame) {
+			for (uint32_t character = 0; character < characterCount; ++character) {
+				update(character);
+			}
+		}
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frameCount;
+	};
+
+	// 結果の差（変更前の実装で計算したパレットとの比較）
+	auto paletteError = [&](auto&& update) {
+		std::vector<std::vector<PaletteEntry>> expected(characterCount);
+		for (uint32_t character = 0; character < characterCount; ++character) {
+			legacyUpdate(character);
+			expected[character] = palettes[character];
+		}
+		float maxError = 0.0f;
+		for (uint32_t character = 0; character < characterCount; ++character) {
+			update(character);
+			for (uint32_t joint = 0; joint < jointCount; ++joint) {
+				maxError = (std::max)(maxError, Difference(
+					expected[character][joint].skeletonSpaceInverseTransposeMatrix,
+					palettes[character][joint].skeletonSpaceInverseTransposeMatrix));
+			}
+		}
+		return maxError;
+	};
+
+	const double legacyMilliseconds = measureFrame(legacyUpdate);
+	const double batchGeneralMilliseconds = measureFrame(batchGeneralUpdate);
+	const double currentMilliseconds = measureFrame(currentUpdate);
+	const double jointsPerFrame = static_cast<double>(characterCount) * jointCount;
+
+	Result versusLegacy;
+	versusLegacy.name = std::format("Skinning palette {}x{} joints (vs Transpose(Inverse) loop)", characterCount, jointCount);
+	versusLegacy.scalarNanoseconds = legacyMilliseconds * 1e6 / jointsPerFrame;
+	versusLegacy.currentNanoseconds = currentMilliseconds * 1e6 / jointsPerFrame;
+	versusLegacy.maxError = paletteError(currentUpdate);
+	results.push_back(versusLegacy);
+
+	Result versusGeneral;
+	versusGeneral.name = std::format("Skinning palette {}x{} joints (vs batch, general inverse)", characterCount, jointCount);
+	versusGeneral.scalarNanoseconds = batchGeneralMilliseconds * 1e6 / jointsPerFrame;
+	versusGeneral.currentNanoseconds = currentMilliseconds * 1e6 / jointsPerFrame;
+	versusGeneral.maxError = versusLegacy.maxError;
+	results.push_back(versusGeneral);
+
+	Logger::GetInstance().Log(
+		std::format("MathBenchmark: skinning palette {} characters x {} joints | Transpose(Inverse) loop {:.3f} ms | batch (general inverse) {:.3f} ms | current {:.3f} ms per frame | max error {:.2e}",
+			characterCount, jointCount, legacyMilliseconds, batchGeneralMilliseconds, currentMilliseconds, versusLegacy.maxError),
+		LogLevel::INFO, LogCategory::System);
+
+	return results;
+}
+
+bool MathBenchmark::IsSimdEnabled() {
+	return MATHCORE_USE_SSE != 0;
+}
+
+std::vector<MathBenchmark::Result> MathBenchmark::Run(uint32_t iterationCount) {
+	std::vector<Result> results;
+	if (iterationCount == 0) {
+		return results;
+	}
+
+	const Inputs inputs = CreateInputs();
+	const auto& matrices = inputs.matrices;
+	const auto& vectors = inputs.vectors;
+	const auto& quaternions = inputs.quaternions;
+	const auto& ratios = inputs.ratios;
+	auto next = [](uint32_t i) { return (i + 1) % kInputCount; };
+
+	// 同じ入力に対する変更前と現在の実装を計測して結果を比較
+	auto measure = [&](const char* name, auto&& legacy, auto&& current) {
+		Result result;
+		result.name = name;
+
+		float sink = 0.0f;
+		result.scalarNanoseconds = MeasureNanoseconds(iterationCount, [&](uint32_t i) { sink += legacy(i); });
+		result.currentNanoseconds = MeasureNanoseconds(iterationCount, [&](uint32_t i) { sink += current(i); });
+		g_sink = sink;
+		results.push_back(result);
+	};
+	auto recordError = [&](auto&& error) {
+		float maxError = 0.0f;
+		for (uint32_t i = 0; i < kInputCount; ++i) {
+			maxError = (std::max)(maxError, error(i));
+		}
+		results.back().maxError = maxError;
+	};
+
+	// 全関数を同じ条件（インライン展開なしの呼び出し）で比較する
+	const auto legacyMultiply = Opaque(&LegacyMultiply);
+	const auto legacyTranspose = Opaque(&LegacyTranspose);
+	const auto legacyInverse = Opaque(&LegacyInverse);
+	const auto legacyTransformCoord = Opaque(&LegacyTransformCoord);
+	const auto legacyTransformNormal = Opaque(&LegacyTransformNormal);
+	const auto legacyQuaternionMultiply = Opaque(&LegacyQuaternionMultiply);
+	const auto legacySlerp = Opaque(&LegacySlerp);
+	const auto multiply = Opaque(&MathCore::Matrix::Multiply);
+	const auto transpose = Opaque(&MathCore::Matrix::Transpose);
+	const auto inverseTranspose = Opaque(&MathCore::Matrix::InverseTranspose);
+	const auto inverse = Opaque(&MathCore::Matrix::Inverse);
+	const auto inverseAffine = Opaque(&MathCore::Matrix::InverseAffine);
+	const auto transformCoord = Opaque<Vector3(const Vector3&, const Matrix4x4&)>(&MathCore::CoordinateTransform::TransformCoord);
+	const auto transformNormal = Opaque(&MathCore::CoordinateTransform::TransformNormal);
+	const auto quaternionMultiply = Opaque(&MathCore::QuaternionMath::Multiply);
+	const auto slerp = Opaque(&MathCore::QuaternionMath::Slerp);
+
+	measure("Matrix::Multiply",
+		[&](uint32_t i) { return legacyMultiply(matrices[i], matrices[next(i)]).m[3][0]; },
+		[&](uint32_t i) { return multiply(matrices[i], matrices[next(i)]).m[3][0]; });
+	recordError([&](uint32_t i) { return Difference(legacyMultiply(matrices[i], matrices[next(i)]), multiply(matrices[i], matrices[next(i)])); });
+
+	measure("Matrix::Transpose",
+		[&](uint32_t i) { return legacyTranspose(matrices[i]).m[0][3]; },
+		[&](uint32_t i) { return transpose(matrices[i]).m[0][3]; });
+	recordError([&](uint32_t i) { return Difference(legacyTranspose(matrices[i]), transpose(matrices[i])); });
+
+	measure("Matrix::Inverse",
+		[&](uint32_t i) { return legacyInverse(matrices[i]).m[3][0]; },
+		[&](uint32_t i) { return inverse(matrices[i]).m[3][0]; });
+	recordError([&](uint32_t i) { return Difference(legacyInverse(matrices[i]), inverse(matrices[i])); });
+
+	// アフィン行列専用の逆行列は、変更前に使うしかなかった一般の逆行列と比較
+	measure("Matrix::InverseAffine (vs Inverse)",
+		[&](uint32_t i) { return legacyInverse(matrices[i]).m[3][0]; },
+		[&](uint32_t i) { return inverseAffine(matrices[i]).m[3][0]; });
+	recordError([&](uint32_t i) { return Difference(legacyInverse(matrices[i]), inverseAffine(matrices[i])); });
+
+	// 逆転置行列は変更前の Transpose(Inverse(m)) と比較（非均等スケール → アフィン、均等スケール → 回転 + 均等スケールの経路）
+	const auto& uniformScaleMatrices = inputs.uniformScaleMatrices;
+	measure("Matrix::InverseTranspose affine (vs Transpose(Inverse))",
+		[&](uint32_t i) { return legacyTranspose(legacyInverse(matrices[i])).m[0][3]; },
+		[&](uint32_t i) { return inverseTranspose(matrices[i]).m[0][3]; });
+	recordError([&](uint32_t i) { return Difference(legacyTranspose(legacyInverse(matrices[i])), inverseTranspose(matrices[i])); });
+
+	measure("Matrix::InverseTranspose uniform scale (vs Transpose(Inverse))",
+		[&](uint32_t i) { return legacyTranspose(legacyInverse(uniformScaleMatrices[i])).m[0][3]; },
+		[&](uint32_t i) { return inverseTranspose(uniformScaleMatrices[i]).m[0][3]; });
+	recordError([&](uint32_t i) { return Difference(legacyTranspose(legacyInverse(uniformScaleMatrices[i])), inverseTranspose(uniformScaleMatrices[i])); });
+
+	measure("TransformCoord",
+		[&](uint32_t i) { return legacyTransformCoord(vectors[i], matrices[i]).x; },
+		[&](uint32_t i) { return transformCoord(vectors[i], matrices[i]).x; });
+	recordError([&](uint32_t i) { return Difference(legacyTransformCoord(vectors[i], matrices[i]), transformCoord(vectors[i], matrices[i])); });
+
+	measure("TransformNormal",
+		[&](uint32_t i) { return legacyTransformNormal(vectors[i], matrices[i]).x; },
+		[&](uint32_t i) { return transformNormal(vectors[i], matrices[i]).x; });
+	recordError([&](uint32_t i) { return Difference(legacyTransformNormal(vectors[i], matrices[i]), transformNormal(vectors[i], matrices[i])); });
+
+	measure("QuaternionMath::Multiply",
+		[&](uint32_t i) { return legacyQuaternionMultiply(quaternions[i], quaternions[next(i)]).w; },
+		[&](uint32_t i) { return quaternionMultiply(quaternions[i], quaternions[next(i)]).w; });
+	recordError([&](uint32_t i) { return Difference(legacyQuaternionMultiply(quaternions[i], quaternions[next(i)]), quaternionMultiply(quaternions[i], quaternions[next(i)])); });
+
+	measure("QuaternionMath::Slerp",
+		[&](uint32_t i) { return legacySlerp(quaternions[i], quaternions[next(i)], ratios[i]).w; },
+		[&](uint32_t i) { return slerp(quaternions[i], quaternions[next(i)], ratios[i]).w; });
+	recordError([&](uint32_t i) { return Difference(legacySlerp(quaternions[i], quaternions[next(i)], ratios[i]), slerp(quaternions[i], quaternions[next(i)], ratios[i])); });
+
+	// 一括処理は要素ごとに MathCore の関数を呼ぶループと比較する（1要素あたりの時間）
+	const uint32_t batchRepeatCount = (std::max)(1u, iterationCount / kInputCount);
+	auto measureBatch = [&](const char* name, auto&& loop, auto&& batch, auto&& error) {
+		auto timePerElement = [&](auto&& function) {
+			const auto start = Clock::now();
+			for (uint32_t repeat = 0; repeat < batchRepeatCount; ++repeat) {
+				function();
+			}
+			const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			return elapsed / (static_cast<double>(batchRepeatCount) * kInputCount);
+		};
+
+		Result result;
+		result.name = name;
+		result.scalarNanoseconds = timePerElement(loop);
+		result.currentNanoseconds = timePerElement(batch);
+		results.push_back(result);
+		recordError(error);
+	};
+
+	const Matrix4x4& transform = matrices[0];
+	std::vector<Vector3> expectedVectors(kInputCount), batchVectors(kInputCount);
+	std::vector<Matrix4x4> expectedMatrices(kInputCount), batchMatrices(kInputCount);
+
+	measureBatch("Batch::TransformCoords (vs loop)",
+		[&] { for (uint32_t i = 0; i < kInputCount; ++i) { expectedVectors[i] = transformCoord(vectors[i], transform); } },
+		[&] { MathCore::Batch::TransformCoords(vectors, transform, batchVectors); },
+		[&](uint32_t i) { return Difference(expectedVectors[i], batchVectors[i]); });
+
+	measureBatch("Batch::TransformNormals (vs loop)",
+		[&] { for (uint32_t i = 0; i < kInputCount; ++i) { expectedVectors[i] = transformNormal(vectors[i], transform); } },
+		[&] { MathCore::Batch::TransformNormals(vectors, transform, batchVectors); },
+		[&](uint32_t i) { return Difference(expectedVectors[i], batchVectors[i]); });
+
+	measureBatch("Batch::MultiplyMatrices (vs loop)",
+		[&] { for (uint32_t i = 0; i < kInputCount; ++i) { expectedMatrices[i] = multiply(matrices[i], transform); } },
+		[&] { MathCore::Batch::MultiplyMatrices(matrices, transform, batchMatrices); },
+		[&](uint32_t i) { return Difference(expectedMatrices[i], batchMatrices[i]); });
+
+	measureBatch("Batch::InverseTransposes (vs loop)",
+		[&] { for (uint32_t i = 0; i < kInputCount; ++i) { expectedMatrices[i] = transpose(inverse(matrices[i])); } },
+		[&] { MathCore::Batch::InverseTransposes(matrices, batchMatrices); },
+		[&](uint32_t i) { return Difference(expectedMatrices[i], batchMatrices[i]); });
+
+	for (const auto& result : results) {
+		Logger::GetInstance().Log(
+			std::format("MathBenchmark ({}): {} | scalar {:.2f} ns | current {:.2f} ns | x{:.2f} | max error {:.2e}",
+				IsSimdEnabled() ? "SSE" : "Scalar", result.name, result.scalarNanoseconds, result.currentNanoseconds,
+				result.scalarNanoseconds / (std::max)(result.currentNanoseconds, 1e-9), result.maxError),
+			LogLevel::INFO, LogCategory::System);
+	}
+
+	return results;
+}
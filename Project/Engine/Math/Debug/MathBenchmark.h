@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief MathCore の行列・ベクトル・クォータニオン演算のマイクロベンチマーク（GPU不要）
+/// 変更前のスカラー実装（比較用にベンチマーク内へ保持）と現在の MathCore を同じ入力で計測し、
+/// 1回あたりの時間と結果の最大誤差を比較する
+/// 一括処理（MathCore::Batch）は、要素ごとに MathCore の関数を呼ぶループと1要素あたりの時間で比較する
+class MathBenchmark {
+public:
+	/// @brief 演算ごとの計測結果
+	struct Result {
+		std::string name;             // 演算名
+		double scalarNanoseconds = 0; // 1回あたりの時間（変更前のスカラー実装。一括処理では要素ごとの呼び出し）
+		double currentNanoseconds = 0;// 1回あたりの時間（現在の MathCore）
+		float maxError = 0.0f;        // 結果の要素ごとの差の最大値（相対誤差。値が1未満の場合は絶対誤差）
+	};
+
+	/// @brief 全演算のベンチマークを実行
+	/// @param iterationCount 各演算の呼び出し回数
+	/// @return 演算ごとの結果（ログにも出力される）
+	static std::vector<Result> Run(uint32_t iterationCount = 1000000);
+
+	/// @brief スキニングのパレット更新（SkinClusterGenerator::Update 相当）のベンチマークを実行
+	/// 変更前のジョイントごとの Transpose(Inverse(...)) と、現在の一括処理・行列の種類に応じた逆転置行列を比較する
+	/// @param characterCount キャラクター数
+	/// @param jointCount 1体あたりのジョイント数
+	/// @param frameCount 計測するフレーム数
+	/// @return 1ジョイントあたりの時間での比較結果（1フレームあたりの時間はログに出力される）
+	static std::vector<Result> RunSkinningPalette(uint32_t characterCount = 200, uint32_t jointCount = 100, uint32_t frameCount = 60);
+
+	/// @brief 現在の MathCore がSIMD実装でビルドされているか
+	static bool IsSimdEnabled();
+};
@@ -0,0 +1,443 @@
+#include "MathCore.h"
+#include "Engine/Utility/CpuFeature/CpuFeature.h"
+#include "Engine/Utility/Job/JobSystem.h"
+#include <algorithm>
+#include <cassert>
+
+#if MATHCORE_USE_SSE
+#include <immintrin.h>
+#endif
+
+using CpuFeature::SimdLevel;
+
+namespace {
+	static_assert(sizeof(Vector3) == sizeof(float) * 3, "Vector3はfloat3要素で詰められている必要がある");
+	static_assert(sizeof(Matrix4x4) == sizeof(float) * 16, "Matrix4x4はfloat16要素で詰められている必要がある");
+
+	// 並列処理時の1ジョブあたりの要素数
+	constexpr uint32_t kParallelGrain = 1024;
+
+	SimdLevel ActiveLevel() {
+#if MATHCORE_USE_SSE
+		static const SimdLevel level = CpuFeature::GetMaxSimdLevel();
+		return level;
+#else
+		return SimdLevel::Scalar;
+#endif
+	}
+
+	const float* AsFloats(const Vector3* values) { return reinterpret_cast<const float*>(values); }
+	float* AsFloats(Vector3* values) { return reinterpret_cast<float*>(values); }
+	const float* AsFloats(const Matrix4x4* values) { return &values->m[0][0]; }
+	float* AsFloats(Matrix4x4* values) { return &values->m[0][0]; }
+
+	/// @brief 要素数が多くジョブシステムがある場合は分割して並列に、それ以外は一度に処理する
+	/// @param function void(uint32_t begin, uint32_t end)
+	template <typename Function>
+	void Dispatch(size_t count, JobSystem* jobSystem, const Function& function) {
+		const uint32_t elementCount = static_cast<uint32_t>(count);
+		if (jobSystem && elementCount >= MathCore::Batch::kParallelThreshold) {
+			jobSystem->ParallelFor(elementCount, kParallelGrain, function);
+		} else if (elementCount > 0) {
+			function(0, elementCount);
+		}
+	}
+
+	// ──────────────────────────────────────────────────────────
+	// スカラー実装（フォールバック・端数処理）
+	// 演算順序は MathCore の単体関数と同じ
+	// ──────────────────────────────────────────────────────────
+
+	void TransformCoordsScalar(const Vector3* input, const Matrix4x4& m, Vector3* output, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			const Vector3 v = input[i];
+			const float x = v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0] + m.m[3][0];
+			const float y = v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1] + m.m[3][1];
+			const float z = v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2] + m.m[3][2];
+			const float w = v.x * m.m[0][3] + v.y * m.m[1][3] + v.z * m.m[2][3] + m.m[3][3];
+			output[i] = { x / w, y / w, z / w };
+		}
+	}
+
+	void TransformNormalsScalar(const Vector3* input, const Matrix4x4& m, Vector3* output, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			const Vector3 v = input[i];
+			output[i] = {
+				v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0],
+				v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1],
+				v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2]
+			};
+		}
+	}
+
+	void ComputeBoundsScalar(const Vector3* points, uint32_t count, Vector3& minValue, Vector3& maxValue) {
+		for (uint32_t i = 0; i < count; ++i) {
+			minValue.x = std::min(minValue.x, points[i].x);
+			minValue.y = std::min(minValue.y, points[i].y);
+			minValue.z = std::min(minValue.z, points[i].z);
+			maxValue.x = std::max(maxValue.x, points[i].x);
+			maxValue.y = std::max(maxValue.y, points[i].y);
+			maxValue.z = std::max(maxValue.z, points[i].z);
+		}
+	}
+
+#if MATHCORE_USE_SSE
+	// ──────────────────────────────────────────────────────────
+	// SSE2実装（Vector3は4要素単位で xyz の並びを成分ごとのレジスタに組み替えて処理）
+	// ──────────────────────────────────────────────────────────
+
+	// 128bit / 256bit で同じ並べ替えを書けるよう、レジスタの型で多重定義する
+	// 256bit版はレーン（128bit）ごとに同じ並べ替えになる
+	template <int Mask>
+	__m128 Shuffle(__m128 a, __m128 b) { return _mm_shuffle_ps(a, b, Mask); }
+	template <int Mask>
+	__m256 Shuffle(__m256 a, __m256 b) { return _mm256_shuffle_ps(a, b, Mask); }
+	__m128 UnpackLow(__m128 a, __m128 b) { return _mm_unpacklo_ps(a, b); }
+	__m256 UnpackLow(__m256 a, __m256 b) { return _mm256_unpacklo_ps(a, b); }
+	__m128 UnpackHigh(__m128 a, __m128 b) { return _mm_unpackhi_ps(a, b); }
+	__m256 UnpackHigh(__m256 a, __m256 b) { return _mm256_unpackhi_ps(a, b); }
+
+	/// @brief 4要素分の Vector3（12 float）を成分ごとのレジスタに組み替える
+	/// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3 → x, y, z
+	template <typename Register>
+	void Deinterleave3(Register a, Register b, Register c, Register& x, Register& y, Register& z) {
+		const Register x2y2x3y3 = Shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(b, c);
+		const Register y0z0y1z1 = Shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(a, b);
+		x = Shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(a, x2y2x3y3);
+		y = Shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(y0z0y1z1, x2y2x3y3);
+		z = Shuffle<_MM_SHUFFLE(3, 0, 3, 1)>(y0z0y1z1, c);
+	}
+
+	/// @brief 成分ごとのレジスタを Vector3 4要素分の並びに戻す（Deinterleave3 の逆）
+	template <typename Register>
+	void Interleave3(Register x, Register y, Register z, Register& a, Register& b, Register& c) {
+		const Register x0y0x1y1 = UnpackLow(x, y);
+		const Register x2y2x3y3 = UnpackHigh(x, y);
+		a = Shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(x0y0x1y1, Shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(z, x));
+		b = Shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(Shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(y, z), x2y2x3y3);
+		c = Shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(z, x), Shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(y, z));
+	}
+
+	void TransformCoordsSSE2(const Vector3* input, const Matrix4x4& m, Vector3* output, uint32_t count) {
+		const __m128 m00 = _mm_set1_ps(m.m[0][0]), m01 = _mm_set1_ps(m.m[0][1]), m02 = _mm_set1_ps(m.m[0][2]), m03 = _mm_set1_ps(m.m[0][3]);
+		const __m128 m10 = _mm_set1_ps(m.m[1][0]), m11 = _mm_set1_ps(m.m[1][1]), m12 = _mm_set1_ps(m.m[1][2]), m13 = _mm_set1_ps(m.m[1][3]);
+		const __m128 m20 = _mm_set1_ps(m.m[2][0]), m21 = _mm_set1_ps(m.m[2][1]), m22 = _mm_set1_ps(m.m[2][2]), m23 = _mm_set1_ps(m.m[2][3]);
+		const __m128 m30 = _mm_set1_ps(m.m[3][0]), m31 = _mm_set1_ps(m.m[3][1]), m32 = _mm_set1_ps(m.m[3][2]), m33 = _mm_set1_ps(m.m[3][3]);
+
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			const float* source = AsFloats(input + i);
+			__m128 x, y, z;
+			Deinterleave3(_mm_loadu_ps(source), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+
+			const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_mul_ps(z, m20)), m30);
+			const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_mul_ps(z, m21)), m31);
+			const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_mul_ps(z, m22)), m32);
+			const __m128 rw = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m03), _mm_mul_ps(y, m13)), _mm_mul_ps(z, m23)), m33);
+
+			__m128 a, b, c;
+			Interleave3(_mm_div_ps(rx, rw), _mm_div_ps(ry, rw), _mm_div_ps(rz, rw), a, b, c);
+			float* destination = AsFloats(output + i);
+			_mm_storeu_ps(destination, a);
+			_mm_storeu_ps(destination + 4, b);
+			_mm_storeu_ps(destination + 8, c);
+		}
+		TransformCoordsScalar(input + i, m, output + i, count - i);
+	}
+
+	void TransformNormalsSSE2(const Vector3* input, const Matrix4x4& m, Vector3* output, uint32_t count) {
+		const __m128 m00 = _mm_set1_ps(m.m[0][0]), m01 = _mm_set1_ps(m.m[0][1]), m02 = _mm_set1_ps(m.m[0][2]);
+		const __m128 m10 = _mm_set1_ps(m.m[1][0]), m11 = _mm_set1_ps(m.m[1][1]), m12 = _mm_set1_ps(m.m[1][2]);
+		const __m128 m20 = _mm_set1_ps(m.m[2][0]), m21 = _mm_set1_ps(m.m[2][1]), m22 = _mm_set1_ps(m.m[2][2]);
+
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			const float* source = AsFloats(input + i);
+			__m128 x, y, z;
+			Deinterleave3(_mm_loadu_ps(source), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+
+			const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_mul_ps(z, m20));
+			const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_mul_ps(z, m21));
+			const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_mul_ps(z, m22));
+
+			__m128 a, b, c;
+			Interleave3(rx, ry, rz, a, b, c);
+			float* destination = AsFloats(output + i);
+			_mm_storeu_ps(destination, a);
+			_mm_storeu_ps(destination + 4, b);
+			_mm_storeu_ps(destination + 8, c);
+		}
+		TransformNormalsScalar(input + i, m, output + i, count - i);
+	}
+
+	void ComputeBoundsSSE2(const Vector3* points, uint32_t count, Vector3& minValue, Vector3& maxValue) {
+		__m128 minX = _mm_set1_ps(minValue.x), minY = _mm_set1_ps(minValue.y), minZ = _mm_set1_ps(minValue.z);
+		__m128 maxX = _mm_set1_ps(maxValue.x), maxY = _mm_set1_ps(maxValue.y), maxZ = _mm_set1_ps(maxValue.z);
+
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			const float* source = AsFloats(points + i);
+			__m128 x, y, z;
+			Deinterleave3(_mm_loadu_ps(source), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+			minX = _mm_min_ps(minX, x); minY = _mm_min_ps(minY, y); minZ = _mm_min_ps(minZ, z);
+			maxX = _mm_max_ps(maxX, x); maxY = _mm_max_ps(maxY, y); maxZ = _mm_max_ps(maxZ, z);
+		}
+
+		alignas(16) float lanes[6][4];
+		_mm_store_ps(lanes[0], minX); _mm_store_ps(lanes[1], minY); _mm_store_ps(lanes[2], minZ);
+		_mm_store_ps(lanes[3], maxX); _mm_store_ps(lanes[4], maxY); _mm_store_ps(lanes[5], maxZ);
+		for (int lane = 0; lane < 4; ++lane) {
+			minValue.x = std::min(minValue.x, lanes[0][lane]);
+			minValue.y = std::min(minValue.y, lanes[1][lane]);
+			minValue.z = std::min(minValue.z, lanes[2][lane]);
+			maxValue.x = std::max(maxValue.x, lanes[3][lane]);
+			maxValue.y = std::max(maxValue.y, lanes[4][lane]);
+			maxValue.z = std::max(maxValue.z, lanes[5][lane]);
+		}
+		ComputeBoundsScalar(points + i, count - i, minValue, maxValue);
+	}
+
+	// ──────────────────────────────────────────────────────────
+	// AVX2実装（Vector3は8要素単位。前半4要素を下位128bit、後半4要素を上位128bitに載せて
+	// SSE2版と同じレーン内の並べ替えを行う。行列は2行ずつ処理する）
+	// ──────────────────────────────────────────────────────────
+
+	__m256 LoadHalves(const float* low, const float* high) {
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
+	}
+
+	void StoreHalves(float* low, float* high, __m256 value) {
+		_mm_storeu_ps(low, _mm256_castps256_ps128(value));
+		_mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+	}
+
+	/// @brief 8要素分の Vector3 を成分ごとのレジスタに読み込む
+	void LoadVector3x8(const Vector3* points, __m256& x, __m256& y, __m256& z) {
+		const float* source = AsFloats(points);
+		Deinterleave3(
+			LoadHalves(source, source + 12), LoadHalves(source + 4, source + 16), LoadHalves(source + 8, source + 20),
+			x, y, z);
+	}
+
+	/// @brief 成分ごとのレジスタを8要素分の Vector3 として書き込む
+	void StoreVector3x8(Vector3* points, __m256 x, __m256 y, __m256 z) {
+		__m256 a, b, c;
+		Interleave3(x, y, z, a, b, c);
+		float* destination = AsFloats(points);
+		StoreHalves(destination, destination + 12, a);
+		StoreHalves(destination + 4, destination + 16, b);
+		StoreHalves(destination + 8, destination + 20, c);
+	}
+
+	void TransformCoordsAVX2(const Vector3* input, const Matrix4x4& m, Vector3* output, uint32_t count) {
+		const __m256 m00 = _mm256_set1_ps(m.m[0][0]), m01 = _mm256_set1_ps(m.m[0][1]), m02 = _mm256_set1_ps(m.m[0][2]), m03 = _mm256_set1_ps(m.m[0][3]);
+		const __m256 m10 = _mm256_set1_ps(m.m[1][0]), m11 = _mm256_set1_ps(m.m[1][1]), m12 = _mm256_set1_ps(m.m[1][2]), m13 = _mm256_set1_ps(m.m[1][3]);
+		const __m256 m20 = _mm256_set1_ps(m.m[2][0]), m21 = _mm256_set1_ps(m.m[2][1]), m22 = _mm256_set1_ps(m.m[2][2]), m23 = _mm256_set1_ps(m.m[2][3]);
+		const __m256 m30 = _mm256_set1_ps(m.m[3][0]), m31 = _mm256_set1_ps(m.m[3][1]), m32 = _mm256_set1_ps(m.m[3][2]), m33 = _mm256_set1_ps(m.m[3][3]);
+
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256 x, y, z;
+			LoadVector3x8(input + i, x, y, z);
+
+			const __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m00), _mm256_mul_ps(y, m10)), _mm256_mul_ps(z, m20)), m30);
+			const __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m01), _mm256_mul_ps(y, m11)), _mm256_mul_ps(z, m21)), m31);
+			const __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m02), _mm256_mul_ps(y, m12)), _mm256_mul_ps(z, m22)), m32);
+			const __m256 rw = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m03), _mm256_mul_ps(y, m13)), _mm256_mul_ps(z, m23)), m33);
+
+			StoreVector3x8(output + i, _mm256_div_ps(rx, rw), _mm256_div_ps(ry, rw), _mm256_div_ps(rz, rw));
+		}
+		TransformCoordsSSE2(input + i, m, output + i, count - i);
+	}
+
+	void TransformNormalsAVX2(const Vector3* input, const Matrix4x4& m, Vector3* output, uint32_t count) {
+		const __m256 m00 = _mm256_set1_ps(m.m[0][0]), m01 = _mm256_set1_ps(m.m[0][1]), m02 = _mm256_set1_ps(m.m[0][2]);
+		const __m256 m10 = _mm256_set1_ps(m.m[1][0]), m11 = _mm256_set1_ps(m.m[1][1]), m12 = _mm256_set1_ps(m.m[1][2]);
+		const __m256 m20 = _mm256_set1_ps(m.m[2][0]), m21 = _mm256_set1_ps(m.m[2][1]), m22 = _mm256_set1_ps(m.m[2][2]);
+
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256 x, y, z;
+			LoadVector3x8(input + i, x, y, z);
+
+			const __m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m00), _mm256_mul_ps(y, m10)), _mm256_mul_ps(z, m20));
+			const __m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m01), _mm256_mul_ps(y, m11)), _mm256_mul_ps(z, m21));
+			const __m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m02), _mm256_mul_ps(y, m12)), _mm256_mul_ps(z, m22));
+
+			StoreVector3x8(output + i, rx, ry, rz);
+		}
+		TransformNormalsSSE2(input + i, m, output + i, count - i);
+	}
+
+	/// @brief 2行分（下位レーンが i 行目、上位レーンが i+1 行目）の行列積。演算順序はスカラー版と同じ
+	__m256 MultiplyRowPairAVX2(__m256 rows, __m256 b0, __m256 b1, __m256 b2, __m256 b3) {
+		__m256 result = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+		result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+		result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+		result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+		return result;
+	}
+
+	void MultiplyMatricesAVX2(const Matrix4x4* input, const Matrix4x4& matrix, Matrix4x4* output, uint32_t count) {
+		const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.m[0]));
+		const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.m[1]));
+		const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.m[2]));
+		const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.m[3]));
+
+		for (uint32_t i = 0; i < count; ++i) {
+			const float* a = AsFloats(input + i);
+			const __m256 upper = MultiplyRowPairAVX2(_mm256_loadu_ps(a), b0, b1, b2, b3);
+			const __m256 lower = MultiplyRowPairAVX2(_mm256_loadu_ps(a + 8), b0, b1, b2, b3);
+			float* destination = AsFloats(output + i);
+			_mm256_storeu_ps(destination, upper);
+			_mm256_storeu_ps(destination + 8, lower);
+		}
+	}
+
+	void MultiplyMatrixPairsAVX2(const Matrix4x4* lhs, const Matrix4x4* rhs, Matrix4x4* output, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs[i].m[0]));
+			const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs[i].m[1]));
+			const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs[i].m[2]));
+			const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs[i].m[3]));
+			const float* a = AsFloats(lhs + i);
+			const __m256 upper = MultiplyRowPairAVX2(_mm256_loadu_ps(a), b0, b1, b2, b3);
+			const __m256 lower = MultiplyRowPairAVX2(_mm256_loadu_ps(a + 8), b0, b1, b2, b3);
+			float* destination = AsFloats(output + i);
+			_mm256_storeu_ps(destination, upper);
+			_mm256_storeu_ps(destination + 8, lower);
+		}
+	}
+#endif
+
+	// ──────────────────────────────────────────────────────────
+	// 行列1つ単位の処理（SSE2/スカラーは MathSimd のカーネルをインライン展開して使う）
+	// ──────────────────────────────────────────────────────────
+
+	void MultiplyMatricesRange(const Matrix4x4* input, const Matrix4x4& matrix, Matrix4x4* output, uint32_t count) {
+#if MATHCORE_USE_SSE
+		if (ActiveLevel() == SimdLevel::AVX2) {
+			MultiplyMatricesAVX2(input, matrix, output, count);
+			return;
+		}
+#endif
+		for (uint32_t i = 0; i < count; ++i) {
+			// output と input が同じ領域の場合に備えて一時変数を経由する
+			Matrix4x4 result;
+			MathSimd::MultiplyMatrix4x4(AsFloats(input + i), &matrix.m[0][0], &result.m[0][0]);
+			output[i] = result;
+		}
+	}
+
+	void MultiplyMatrixPairsRange(const Matrix4x4* lhs, const Matrix4x4* rhs, Matrix4x4* output, uint32_t count) {
+#if MATHCORE_USE_SSE
+		if (ActiveLevel() == SimdLevel::AVX2) {
+			MultiplyMatrixPairsAVX2(lhs, rhs, output, count);
+			return;
+		}
+#endif
+		for (uint32_t i = 0; i < count; ++i) {
+			Matrix4x4 result;
+			MathSimd::MultiplyMatrix4x4(AsFloats(lhs + i), AsFloats(rhs + i), &result.m[0][0]);
+			output[i] = result;
+		}
+	}
+
+	void InverseTransposesRange(const Matrix4x4* input, Matrix4x4* output, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			Matrix4x4 result;
+			if (!MathSimd::InverseTransposeMatrix4x4(AsFloats(input + i), &result.m[0][0])) {
+				result = MathCore::Matrix::Identity();
+			}
+			output[i] = result;
+		}
+	}
+
+	void TransformCoordsRange(const Vector3* input, const Matrix4x4& matrix, Vector3* output, uint32_t count) {
+		switch (ActiveLevel()) {
+#if MATHCORE_USE_SSE
+		case SimdLevel::AVX2: TransformCoordsAVX2(input, matrix, output, count); break;
+		case SimdLevel::SSE2: TransformCoordsSSE2(input, matrix, output, count); break;
+#endif
+		default:              TransformCoordsScalar(input, matrix, output, count); break;
+		}
+	}
+
+	void TransformNormalsRange(const Vector3* input, const Matrix4x4& matrix, Vector3* output, uint32_t count) {
+		switch (ActiveLevel()) {
+#if MATHCORE_USE_SSE
+		case SimdLevel::AVX2: TransformNormalsAVX2(input, matrix, output, count); break;
+		case SimdLevel::SSE2: TransformNormalsSSE2(input, matrix, output, count); break;
+#endif
+		default:              TransformNormalsScalar(input, matrix, output, count); break;
+		}
+	}
+}
+
+namespace MathCore {
+
+	//================================================
+	// 一括処理の実装
+	//================================================
+	namespace Batch {
+		void TransformCoords(std::span<const Vector3> input, const Matrix4x4& matrix, std::span<Vector3> output, JobSystem* jobSystem) {
+			assert(output.size() >= input.size());
+			Dispatch(input.size(), jobSystem, [&](uint32_t begin, uint32_t end) {
+				TransformCoordsRange(input.data() + begin, matrix, output.data() + begin, end - begin);
+			});
+		}
+
+		void TransformNormals(std::span<const Vector3> input, const Matrix4x4& matrix, std::span<Vector3> output, JobSystem* jobSystem) {
+			assert(output.size() >= input.size());
+			Dispatch(input.size(), jobSystem, [&](uint32_t begin, uint32_t end) {
+				TransformNormalsRange(input.data() + begin, matrix, output.data() + begin, end - begin);
+			});
+		}
+
+		void MultiplyMatrices(std::span<const Matrix4x4> input, const Matrix4x4& matrix, std::span<Matrix4x4> output, JobSystem* jobSystem) {
+			assert(output.size() >= input.size());
+			// matrix が output の一部の場合に途中で書き換わらないよう複製しておく
+			const Matrix4x4 rhs = matrix;
+			Dispatch(input.size(), jobSystem, [&](uint32_t begin, uint32_t end) {
+				MultiplyMatricesRange(input.data() + begin, rhs, output.data() + begin, end - begin);
+			});
+		}
+
+		void MultiplyMatrices(std::span<const Matrix4x4> lhs, std::span<const Matrix4x4> rhs, std::span<Matrix4x4> output, JobSystem* jobSystem) {
+			assert(rhs.size() >= lhs.size());
+			assert(output.size() >= lhs.size());
+			Dispatch(lhs.size(), jobSystem, [&](uint32_t begin, uint32_t end) {
+				MultiplyMatrixPairsRange(lhs.data() + begin, rhs.data() + begin, output.data() + begin, end - begin);
+			});
+		}
+
+		void InverseTransposes(std::span<const Matrix4x4> input, std::span<Matrix4x4> output, JobSystem* jobSystem) {
+			assert(output.size() >= input.size());
+			Dispatch(input.size(), jobSystem, [&](uint32_t begin, uint32_t end) {
+				InverseTransposesRange(input.data() + begin, output.data() + begin, end - begin);
+			});
+		}
+
+		bool ComputeBounds(std::span<const Vector3> points, Vector3& outMin, Vector3& outMax) {
+			if (points.empty()) {
+				return false;
+			}
+
+			Vector3 minValue = points[0];
+			Vector3 maxValue = points[0];
+			const uint32_t count = static_cast<uint32_t>(points.size()) - 1;
+#if MATHCORE_USE_SSE
+			if (ActiveLevel() != SimdLevel::Scalar) {
+				ComputeBoundsSSE2(points.data() + 1, count, minValue, maxValue);
+			} else
+#endif
+			{
+				ComputeBoundsScalar(points.data() + 1, count, minValue, maxValue);
+			}
+			outMin = minValue;
+			outMax = maxValue;
+			return true;
+		}
+	}
+
+} // namespace MathCore
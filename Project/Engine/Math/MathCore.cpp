@@ -2,6 +2,45 @@
 #include <algorithm>
 #include <cassert>
 
+#if MATHCORE_USE_SSE
+namespace {
+	//================================================
+	// SSE実装の補助関数
+	//================================================
+
+	/// @brief 行列の4行を読み込む
+	void LoadRows(const Matrix4x4& m, __m128 rows[4]) {
+		rows[0] = _mm_loadu_ps(m.m[0]);
+		rows[1] = _mm_loadu_ps(m.m[1]);
+		rows[2] = _mm_loadu_ps(m.m[2]);
+		rows[3] = _mm_loadu_ps(m.m[3]);
+	}
+
+	/// @brief 4行を行列に書き込む
+	void StoreRows(const __m128 rows[4], Matrix4x4& m) {
+		_mm_storeu_ps(m.m[0], rows[0]);
+		_mm_storeu_ps(m.m[1], rows[1]);
+		_mm_storeu_ps(m.m[2], rows[2]);
+		_mm_storeu_ps(m.m[3], rows[3]);
+	}
+
+	/// @brief 3成分の外積（w成分は0）
+	__m128 Cross3(__m128 a, __m128 b) {
+		const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+		return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	/// @brief (x, y, z, *) を Vector3 に書き込む
+	Vector3 StoreVector3(__m128 v) {
+		alignas(16) float values[4];
+		_mm_store_ps(values, v);
+		return { values[0], values[1], values[2] };
+	}
+}
+#endif
+
 namespace MathCore {
 
 	//================================================
@@ -82,68 +121,120 @@ namespace MathCore {
 
 		Matrix4x4 Multiply(const Matrix4x4& m1, const Matrix4x4& m2) {
 			Matrix4x4 result;
-			for (int i = 0; i < 4; ++i) {
-				for (int j = 0; j < 4; ++j) {
-					result.m[i][j] = 0;
-					for (int k = 0; k < 4; ++k) {
-						result.m[i][j] += m1.m[i][k] * m2.m[k][j];
-					}
-				}
-			}
+			MathSimd::MultiplyMatrix4x4(&m1.m[0][0], &m2.m[0][0], &result.m[0][0]);
 			return result;
 		}
 
 		Matrix4x4 Inverse(const Matrix4x4& m) {
 			Matrix4x4 result;
-			float det;
-
-			// 各要素の余因子を直接計算
-			float cof[4][4];
+			if (!MathSimd::InverseMatrix4x4(&m.m[0][0], &result.m[0][0])) {
+				return Identity();
+			}
+			return result;
+		}
 
-			cof[0][0] = m.m[1][1] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[1][2] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) + m.m[1][3] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]);
-			cof[0][1] = -(m.m[1][0] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[1][2] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[1][3] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]));
-			cof[0][2] = m.m[1][0] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) - m.m[1][1] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[1][3] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]);
-			cof[0][3] = -(m.m[1][0] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]) - m.m[1][1] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]) + m.m[1][2] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]));
+		Matrix4x4 InverseAffine(const Matrix4x4& m) {
+			// 左上3x3の逆行列は各行の外積（余因子）を行列式で割ったものの転置
+			// 平行移動は -t * (3x3の逆行列)
+#if MATHCORE_USE_SSE
+			__m128 rows[4];
+			LoadRows(m, rows);
+			const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			const __m128 row0 = _mm_and_ps(rows[0], xyzMask);
+			const __m128 row1 = _mm_and_ps(rows[1], xyzMask);
+			const __m128 row2 = _mm_and_ps(rows[2], xyzMask);
+
+			__m128 cofactor0 = Cross3(row1, row2);
+			__m128 cofactor1 = Cross3(row2, row0);
+			__m128 cofactor2 = Cross3(row0, row1);
+
+			// 行列式 = row0・(row1 × row2)
+			const __m128 products = _mm_mul_ps(row0, cofactor0);
+			const __m128 det = _mm_add_ss(
+				_mm_add_ss(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(1, 1, 1, 1))),
+				_mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 2, 2, 2)));
+			const float determinant = _mm_cvtss_f32(det);
+			if (determinant == 0.0f) {
+				return Identity();
+			}
 
-			cof[1][0] = -(m.m[0][1] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[0][2] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) + m.m[0][3] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]));
-			cof[1][1] = m.m[0][0] * (m.m[2][2] * m.m[3][3] - m.m[2][3] * m.m[3][2]) - m.m[0][2] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[0][3] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]);
-			cof[1][2] = -(m.m[0][0] * (m.m[2][1] * m.m[3][3] - m.m[2][3] * m.m[3][1]) - m.m[0][1] * (m.m[2][0] * m.m[3][3] - m.m[2][3] * m.m[3][0]) + m.m[0][3] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]));
-			cof[1][3] = m.m[0][0] * (m.m[2][1] * m.m[3][2] - m.m[2][2] * m.m[3][1]) - m.m[0][1] * (m.m[2][0] * m.m[3][2] - m.m[2][2] * m.m[3][0]) + m.m[0][2] * (m.m[2][0] * m.m[3][1] - m.m[2][1] * m.m[3][0]);
+			const __m128 inverseDet = _mm_set1_ps(1.0f / determinant);
+			cofactor0 = _mm_mul_ps(cofactor0, inverseDet);
+			cofactor1 = _mm_mul_ps(cofactor1, inverseDet);
+			cofactor2 = _mm_mul_ps(cofactor2, inverseDet);
 
-			cof[2][0] = m.m[0][1] * (m.m[1][2] * m.m[3][3] - m.m[1][3] * m.m[3][2]) - m.m[0][2] * (m.m[1][1] * m.m[3][3] - m.m[1][3] * m.m[3][1]) + m.m[0][3] * (m.m[1][1] * m.m[3][2] - m.m[1][2] * m.m[3][1]);
-			cof[2][1] = -(m.m[0][0] * (m.m[1][2] * m.m[3][3] - m.m[1][3] * m.m[3][2]) - m.m[0][2] * (m.m[1][0] * m.m[3][3] - m.m[1][3] * m.m[3][0]) + m.m[0][3] * (m.m[1][0] * m.m[3][2] - m.m[1][2] * m.m[3][0]));
-			cof[2][2] = m.m[0][0] * (m.m[1][1] * m.m[3][3] - m.m[1][3] * m.m[3][1]) - m.m[0][1] * (m.m[1][0] * m.m[3][3] - m.m[1][3] * m.m[3][0]) + m.m[0][3] * (m.m[1][0] * m.m[3][1] - m.m[1][1] * m.m[3][0]);
-			cof[2][3] = -(m.m[0][0] * (m.m[1][1] * m.m[3][2] - m.m[1][2] * m.m[3][1]) - m.m[0][1] * (m.m[1][0] * m.m[3][2] - m.m[1][2] * m.m[3][0]) + m.m[0][2] * (m.m[1][0] * m.m[3][1] - m.m[1][1] * m.m[3][0]));
+			// 余因子を列として並べた行列が逆行列（w成分は0）
+			__m128 zero = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(cofactor0, cofactor1, cofactor2, zero);
 
-			cof[3][0] = -(m.m[0][1] * (m.m[1][2] * m.m[2][3] - m.m[1][3] * m.m[2][2]) - m.m[0][2] * (m.m[1][1] * m.m[2][3] - m.m[1][3] * m.m[2][1]) + m.m[0][3] * (m.m[1][1] * m.m[2][2] - m.m[1][2] * m.m[2][1]));
-			cof[3][1] = m.m[0][0] * (m.m[1][2] * m.m[2][3] - m.m[1][3] * m.m[2][2]) - m.m[0][2] * (m.m[1][0] * m.m[2][3] - m.m[1][3] * m.m[2][0]) + m.m[0][3] * (m.m[1][0] * m.m[2][2] - m.m[1][2] * m.m[2][0]);
-			cof[3][2] = -(m.m[0][0] * (m.m[1][1] * m.m[2][3] - m.m[1][3] * m.m[2][1]) - m.m[0][1] * (m.m[1][0] * m.m[2][3] - m.m[1][3] * m.m[2][0]) + m.m[0][3] * (m.m[1][0] * m.m[2][1] - m.m[1][1] * m.m[2][0]));
-			cof[3][3] = m.m[0][0] * (m.m[1][1] * m.m[2][2] - m.m[1][2] * m.m[2][1]) - m.m[0][1] * (m.m[1][0] * m.m[2][2] - m.m[1][2] * m.m[2][0]) + m.m[0][2] * (m.m[1][0] * m.m[2][1] - m.m[1][1] * m.m[2][0]);
+			const __m128 translation = rows[3];
+			__m128 inverseTranslation = _mm_mul_ps(_mm_shuffle_ps(translation, translation, _MM_SHUFFLE(0, 0, 0, 0)), cofactor0);
+			inverseTranslation = _mm_add_ps(inverseTranslation, _mm_mul_ps(_mm_shuffle_ps(translation, translation, _MM_SHUFFLE(1, 1, 1, 1)), cofactor1));
+			inverseTranslation = _mm_add_ps(inverseTranslation, _mm_mul_ps(_mm_shuffle_ps(translation, translation, _MM_SHUFFLE(2, 2, 2, 2)), cofactor2));
+			inverseTranslation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), inverseTranslation);
 
-			// 行列式の計算
-			det = m.m[0][0] * cof[0][0] + m.m[0][1] * cof[0][1] + m.m[0][2] * cof[0][2] + m.m[0][3] * cof[0][3];
+			rows[0] = cofactor0;
+			rows[1] = cofactor1;
+			rows[2] = cofactor2;
+			rows[3] = inverseTranslation;
 
+			Matrix4x4 result;
+			StoreRows(rows, result);
+			return result;
+#else
+			const Vector3 row0 = { m.m[0][0], m.m[0][1], m.m[0][2] };
+			const Vector3 row1 = { m.m[1][0], m.m[1][1], m.m[1][2] };
+			const Vector3 row2 = { m.m[2][0], m.m[2][1], m.m[2][2] };
+			const Vector3 cofactor0 = Vector::Cross(row1, row2);
+			const Vector3 cofactor1 = Vector::Cross(row2, row0);
+			const Vector3 cofactor2 = Vector::Cross(row0, row1);
+
+			const float det = Vector::Dot(row0, cofactor0);
 			if (det == 0.0f) {
 				return Identity();
 			}
+			const float invDet = 1.0f / det;
 
-			// 逆行列の計算
-			float invDet = 1.0f / det;
-			for (int i = 0; i < 4; ++i) {
-				for (int j = 0; j < 4; ++j) {
-					result.m[j][i] = cof[i][j] * invDet;
-				}
+			Matrix4x4 result = {
+				cofactor0.x * invDet, cofactor1.x * invDet, cofactor2.x * invDet, 0.0f,
+				cofactor0.y * invDet, cofactor1.y * invDet, cofactor2.y * invDet, 0.0f,
+				cofactor0.z * invDet, cofactor1.z * invDet, cofactor2.z * invDet, 0.0f,
+				0.0f, 0.0f, 0.0f, 1.0f
+			};
+			for (int j = 0; j < 3; ++j) {
+				result.m[3][j] = -(m.m[3][0] * result.m[0][j] + m.m[3][1] * result.m[1][j] + m.m[3][2] * result.m[2][j]);
 			}
-
 			return result;
+#endif
 		}
 
 		Matrix4x4 Transpose(const Matrix4x4& m) {
 			Matrix4x4 result;
-			for (int i = 0; i < 4; ++i) {
-				for (int j = 0; j < 4; ++j) {
-					result.m[i][j] = m.m[j][i];
-				}
+			MathSimd::TransposeMatrix4x4(&m.m[0][0], &result.m[0][0]);
+			return result;
+		}
+
+		MatrixClass Classify(const Matrix4x4& m) {
+			if (!MathSimd::IsAffineMatrix4x4(&m.m[0][0])) {
+				return MatrixClass::General;
+			}
+
+			// InverseTranspose と同じ基準で判定
+			const Vector3 row0 = { m.m[0][0], m.m[0][1], m.m[0][2] };
+			const Vector3 row1 = { m.m[1][0], m.m[1][1], m.m[1][2] };
+			const Vector3 row2 = { m.m[2][0], m.m[2][1], m.m[2][2] };
+			const float lengthSq0 = Vector::Dot(row0, row0);
+			if (!MathSimd::Detail::IsSimilarity(lengthSq0, Vector::Dot(row1, row1), Vector::Dot(row2, row2),
+				Vector::Dot(row0, row1), Vector::Dot(row1, row2), Vector::Dot(row2, row0))) {
+				return MatrixClass::Affine;
+			}
+			return std::abs(lengthSq0 - 1.0f) <= MathSimd::kSimilarityTolerance ? MatrixClass::Rigid : MatrixClass::UniformScale;
+		}
+
+		Matrix4x4 InverseTranspose(const Matrix4x4& m) {
+			Matrix4x4 result;
+			if (!MathSimd::InverseTransposeMatrix4x4(&m.m[0][0], &result.m[0][0])) {
+				return Identity();
 			}
 			return result;
 		}
@@ -383,6 +474,21 @@ namespace MathCore {
 	//================================================
 	namespace QuaternionMath {
 		Quaternion Multiply(const Quaternion& lhs, const Quaternion& rhs) {
+#if MATHCORE_USE_SSE
+			// (x, y, z, w) の各成分を lhs の1成分 × rhs の並べ替えの和で求める
+			const __m128 r = _mm_loadu_ps(&rhs.x);
+			__m128 result = _mm_mul_ps(_mm_set1_ps(lhs.w), r);
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(lhs.x),
+				_mm_mul_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f))));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(lhs.y),
+				_mm_mul_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f))));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(lhs.z),
+				_mm_mul_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f))));
+
+			Quaternion q;
+			_mm_storeu_ps(&q.x, result);
+			return q;
+#else
 			Quaternion result;
 
 			// 実部の計算: w1*w2 から各虚部の内積を引く
@@ -398,6 +504,7 @@ namespace MathCore {
 			result.z = lhs.w * rhs.z + lhs.x * rhs.y - lhs.y * rhs.x + lhs.z * rhs.w;
 
 			return result;
+#endif
 		}
 
 		Quaternion Identity() {
@@ -566,20 +673,27 @@ namespace MathCore {
 				return QuaternionMath::Normalize(result);
 			}
 
-			// θを計算
+			// θを計算（sinθ = √(1 - cos²θ) で sin の呼び出しを1回省き、除算は逆数の乗算にまとめる）
 			float theta = std::acosf(dot);
-			float sinTheta = std::sinf(theta);
+			float inverseSinTheta = 1.0f / std::sqrtf(1.0f - dot * dot);
 
 			// スケーリング係数を計算
-			float scale0 = std::sinf((1.0f - t) * theta) / sinTheta;
-			float scale1 = std::sinf(t * theta) / sinTheta;
+			float scale0 = std::sinf((1.0f - t) * theta) * inverseSinTheta;
+			float scale1 = std::sinf(t * theta) * inverseSinTheta;
 
 			// 補間結果を計算
 			Quaternion result;
+#if MATHCORE_USE_SSE
+			const __m128 blended = _mm_add_ps(
+				_mm_mul_ps(_mm_set1_ps(scale0), _mm_loadu_ps(&q0.x)),
+				_mm_mul_ps(_mm_set1_ps(scale1), _mm_loadu_ps(&q1Adjusted.x)));
+			_mm_storeu_ps(&result.x, blended);
+#else
 			result.x = scale0 * q0.x + scale1 * q1Adjusted.x;
 			result.y = scale0 * q0.y + scale1 * q1Adjusted.y;
 			result.z = scale0 * q0.z + scale1 * q1Adjusted.z;
 			result.w = scale0 * q0.w + scale1 * q1Adjusted.w;
+#endif
 			return result;
 		}
 	}
@@ -589,6 +703,15 @@ namespace MathCore {
 	//================================================
 	namespace CoordinateTransform {
 		Vector3 TransformCoord(const Vector3& vector, const Matrix4x4& matrix) {
+#if MATHCORE_USE_SSE
+			// 行ベクトル × 行列（各行を成分で重み付けして加算）。演算順序はスカラー版と同じ
+			__m128 result = _mm_mul_ps(_mm_set1_ps(vector.x), _mm_loadu_ps(matrix.m[0]));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(vector.y), _mm_loadu_ps(matrix.m[1])));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(vector.z), _mm_loadu_ps(matrix.m[2])));
+			result = _mm_add_ps(result, _mm_loadu_ps(matrix.m[3]));
+			result = _mm_div_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 3, 3, 3)));
+			return StoreVector3(result);
+#else
 			Vector3 result;
 			result.x = vector.x * matrix.m[0][0] + vector.y * matrix.m[1][0] + vector.z * matrix.m[2][0] + matrix.m[3][0];
 			result.y = vector.x * matrix.m[0][1] + vector.y * matrix.m[1][1] + vector.z * matrix.m[2][1] + matrix.m[3][1];
@@ -600,6 +723,7 @@ namespace MathCore {
 			result.z /= w;
 
 			return result;
+#endif
 		}
 
 		Vector4 TransformCoord(const Vector4& vector, const Matrix4x4& matrix) {
@@ -612,11 +736,18 @@ namespace MathCore {
 		}
 
 		Vector3 TransformNormal(const Vector3& v, const Matrix4x4& m) {
+#if MATHCORE_USE_SSE
+			__m128 result = _mm_mul_ps(_mm_set1_ps(v.x), _mm_loadu_ps(m.m[0]));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(v.y), _mm_loadu_ps(m.m[1])));
+			result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(v.z), _mm_loadu_ps(m.m[2])));
+			return StoreVector3(result);
+#else
 			Vector3 result;
 			result.x = v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0];
 			result.y = v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1];
 			result.z = v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2];
 			return result;
+#endif
 		}
 	}
 
@@ -7,7 +7,11 @@
 #include "Quaternion/Quaternion.h"
 #include "EulerTransform.h"
 #include <cmath>
+#include <cstdint>
 #include <numbers>
+#include <span>
+
+class JobSystem;
 
 /// @brief 数学ライブラリの中核機能を提供する名前空間
 namespace MathCore {
@@ -38,9 +42,24 @@ namespace MathCore {
         Matrix4x4 Subtract(const Matrix4x4& m1, const Matrix4x4& m2);
         Matrix4x4 Multiply(const Matrix4x4& m1, const Matrix4x4& m2);
         Matrix4x4 Inverse(const Matrix4x4& m);
+        // アフィン変換（4列目が (0, 0, 0, 1)）専用の逆行列。Inverse より高速（特異な場合は単位行列）
+        Matrix4x4 InverseAffine(const Matrix4x4& m);
         Matrix4x4 Transpose(const Matrix4x4& m);
         Matrix4x4 Identity();
 
+        // 行列の種類（逆行列・逆転置行列の計算方法の選択に使用）
+        enum class MatrixClass {
+            Rigid,        // 回転 + 平行移動
+            UniformScale, // 回転 + 均等スケール + 平行移動
+            Affine,       // 4列目が (0, 0, 0, 1)（非均等スケール・せん断を含む）
+            General       // 射影を含む
+        };
+        MatrixClass Classify(const Matrix4x4& m);
+
+        // 法線変換用の逆転置行列 Transpose(Inverse(m))。行列の種類を判定し、アフィン・均等スケールの場合は
+        // 4x4の逆行列を経由せずに求める（特異な場合は単位行列）
+        Matrix4x4 InverseTranspose(const Matrix4x4& m);
+
         // 変換行列生成
         Matrix4x4 Translation(const Vector3& translate);
         Matrix4x4 Scale(const Vector3& scale);
@@ -92,6 +111,30 @@ namespace MathCore {
         Vector3 TransformNormal(const Vector3& v, const Matrix4x4& m);
     }
 
+    //================================================
+    // 一括処理（要素ごとの関数呼び出しを避け、SIMDでまとめて処理する）
+    //================================================
+    namespace Batch {
+        // ジョブシステムが渡され、要素数がこれ以上の場合は並列に処理する
+        constexpr uint32_t kParallelThreshold = 4096;
+
+        // output[i] = TransformCoord(input[i], matrix)（output は input と同じ領域でもよい）
+        void TransformCoords(std::span<const Vector3> input, const Matrix4x4& matrix, std::span<Vector3> output, JobSystem* jobSystem = nullptr);
+        // output[i] = TransformNormal(input[i], matrix)（output は input と同じ領域でもよい）
+        void TransformNormals(std::span<const Vector3> input, const Matrix4x4& matrix, std::span<Vector3> output, JobSystem* jobSystem = nullptr);
+
+        // output[i] = input[i] * matrix（output は input と同じ領域でもよい）
+        void MultiplyMatrices(std::span<const Matrix4x4> input, const Matrix4x4& matrix, std::span<Matrix4x4> output, JobSystem* jobSystem = nullptr);
+        // output[i] = lhs[i] * rhs[i]（スキニングのパレット計算など。output は lhs / rhs と同じ領域でもよい）
+        void MultiplyMatrices(std::span<const Matrix4x4> lhs, std::span<const Matrix4x4> rhs, std::span<Matrix4x4> output, JobSystem* jobSystem = nullptr);
+
+        // output[i] = Matrix::InverseTranspose(input[i])（output は input と同じ領域でもよい）
+        void InverseTransposes(std::span<const Matrix4x4> input, std::span<Matrix4x4> output, JobSystem* jobSystem = nullptr);
+
+        // 点群の各成分の最小値・最大値（空の場合は false を返し、出力を変更しない）
+        bool ComputeBounds(std::span<const Vector3> points, Vector3& outMin, Vector3& outMax);
+    }
+
     //================================================
     // レンダリングパイプライン
     //================================================
@@ -0,0 +1,344 @@
+#pragma once
+
+// SSEが使える環境（x64では常に利用可能）ではSSE実装を使用し、それ以外はスカラー実装にフォールバックする
+// MATHCORE_DISABLE_SIMD を定義するとスカラー実装に固定できる（結果の比較・検証用）
+#if !defined(MATHCORE_DISABLE_SIMD) && (defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__))
+#define MATHCORE_USE_SSE 1
+#include <emmintrin.h>
+#else
+#define MATHCORE_USE_SSE 0
+#endif
+
+/// @brief MathCore の行列演算で使用するSIMDカーネル
+/// 行列は行優先の float[16]（Matrix4x4::m と同じ並び）として扱う
+/// 積・転置はスカラー実装と同じ演算順序（FMA不使用）のため、結果はビット単位で一致する
+namespace MathSimd {
+
+#if MATHCORE_USE_SSE
+    namespace Detail {
+        /// @brief 2x2行列（行優先で (00, 01, 10, 11) に格納）の積 a * b
+        inline __m128 Mat2Multiply(__m128 a, __m128 b) {
+            return _mm_add_ps(
+                _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        /// @brief 2x2行列の余因子行列との積 adj(a) * b
+        inline __m128 Mat2AdjugateMultiply(__m128 a, __m128 b) {
+            return _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        /// @brief 2x2行列と余因子行列の積 a * adj(b)
+        inline __m128 Mat2MultiplyAdjugate(__m128 a, __m128 b) {
+            return _mm_sub_ps(
+                _mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+    } // namespace Detail
+#endif
+
+    // 回転 + 均等スケールとみなす許容誤差（各行の長さの2乗の差・行同士の内積を、長さの2乗に対する比で判定）
+    constexpr float kSimilarityTolerance = 1e-5f;
+
+    namespace Detail {
+        /// @brief 左上3x3の各行の長さの2乗と行同士の内積から、回転 + 均等スケールかを判定
+        inline bool IsSimilarity(float lengthSq0, float lengthSq1, float lengthSq2, float dot01, float dot12, float dot20) {
+            const float tolerance = kSimilarityTolerance * lengthSq0;
+            const auto absolute = [](float value) { return value < 0.0f ? -value : value; };
+            return lengthSq0 > 0.0f &&
+                absolute(lengthSq1 - lengthSq0) <= tolerance && absolute(lengthSq2 - lengthSq0) <= tolerance &&
+                absolute(dot01) <= tolerance && absolute(dot12) <= tolerance && absolute(dot20) <= tolerance;
+        }
+    } // namespace Detail
+
+    /// @brief 4x4行列の積 out = a * b
+    /// @param a 左辺（float[16]）
+    /// @param b 右辺（float[16]）
+    /// @param out 出力（float[16]。a, b と重ならないこと）
+    inline void MultiplyMatrix4x4(const float* a, const float* b, float* out) {
+#if MATHCORE_USE_SSE
+        // 結果の i 行目 = Σk a[i][k] * (b の k 行目)
+        const __m128 b0 = _mm_loadu_ps(b + 0);
+        const __m128 b1 = _mm_loadu_ps(b + 4);
+        const __m128 b2 = _mm_loadu_ps(b + 8);
+        const __m128 b3 = _mm_loadu_ps(b + 12);
+        for (int i = 0; i < 4; ++i) {
+            const __m128 row = _mm_loadu_ps(a + i * 4);
+            __m128 result = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+            result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+            _mm_storeu_ps(out + i * 4, result);
+        }
+#else
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                float sum = a[i * 4 + 0] * b[0 * 4 + j];
+                sum += a[i * 4 + 1] * b[1 * 4 + j];
+                sum += a[i * 4 + 2] * b[2 * 4 + j];
+                sum += a[i * 4 + 3] * b[3 * 4 + j];
+                out[i * 4 + j] = sum;
+            }
+        }
+#endif
+    }
+
+    /// @brief 4x4行列の転置
+    /// @param m 入力（float[16]）
+    /// @param out 出力（float[16]。m と重ならないこと）
+    inline void TransposeMatrix4x4(const float* m, float* out) {
+#if MATHCORE_USE_SSE
+        __m128 row0 = _mm_loadu_ps(m + 0);
+        __m128 row1 = _mm_loadu_ps(m + 4);
+        __m128 row2 = _mm_loadu_ps(m + 8);
+        __m128 row3 = _mm_loadu_ps(m + 12);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        _mm_storeu_ps(out + 0, row0);
+        _mm_storeu_ps(out + 4, row1);
+        _mm_storeu_ps(out + 8, row2);
+        _mm_storeu_ps(out + 12, row3);
+#else
+        // ループのままだと展開されない場合があるため、16要素を直接書く
+        out[0] = m[0];  out[1] = m[4];  out[2] = m[8];   out[3] = m[12];
+        out[4] = m[1];  out[5] = m[5];  out[6] = m[9];   out[7] = m[13];
+        out[8] = m[2];  out[9] = m[6];  out[10] = m[10]; out[11] = m[14];
+        out[12] = m[3]; out[13] = m[7]; out[14] = m[11]; out[15] = m[15];
+#endif
+    }
+
+    /// @brief 4x4行列の逆行列
+    /// @param m 入力（float[16]）
+    /// @param out 出力（float[16]。m と重ならないこと）。特異な場合は書き込まない
+    /// @param transposeResult true の場合は逆行列の転置（法線変換用の逆転置行列）を書き込む
+    /// @return 逆行列が存在する場合true
+    inline bool InverseMatrix4x4(const float* m, float* out, bool transposeResult = false) {
+#if MATHCORE_USE_SSE
+        // 2x2のブロック行列 [A B; C D] に分けて余因子で逆行列を求める
+        const __m128 row0 = _mm_loadu_ps(m + 0);
+        const __m128 row1 = _mm_loadu_ps(m + 4);
+        const __m128 row2 = _mm_loadu_ps(m + 8);
+        const __m128 row3 = _mm_loadu_ps(m + 12);
+
+        const __m128 a = _mm_movelh_ps(row0, row1);
+        const __m128 b = _mm_movehl_ps(row1, row0);
+        const __m128 c = _mm_movelh_ps(row2, row3);
+        const __m128 d = _mm_movehl_ps(row3, row2);
+
+        // 各ブロックの行列式 (|A|, |B|, |C|, |D|)
+        const __m128 detSub = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+            _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+        const __m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+        const __m128 dc = Detail::Mat2AdjugateMultiply(d, c);
+        const __m128 ab = Detail::Mat2AdjugateMultiply(a, b);
+        __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Detail::Mat2Multiply(b, dc));
+        __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Detail::Mat2Multiply(c, ab));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Detail::Mat2MultiplyAdjugate(d, ab));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Detail::Mat2MultiplyAdjugate(a, dc));
+
+        // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+        __m128 trace = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+        trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+        trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+        const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+        if (_mm_cvtss_f32(det) == 0.0f) {
+            return false;
+        }
+
+        const __m128 inverseDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+        x = _mm_mul_ps(x, inverseDet);
+        y = _mm_mul_ps(y, inverseDet);
+        z = _mm_mul_ps(z, inverseDet);
+        w = _mm_mul_ps(w, inverseDet);
+
+        if (transposeResult) {
+            // 転置は組み立て時の並べ替えを変えるだけで済む
+            _mm_storeu_ps(out + 0, _mm_shuffle_ps(x, z, _MM_SHUFFLE(2, 3, 2, 3)));
+            _mm_storeu_ps(out + 4, _mm_shuffle_ps(x, z, _MM_SHUFFLE(0, 1, 0, 1)));
+            _mm_storeu_ps(out + 8, _mm_shuffle_ps(y, w, _MM_SHUFFLE(2, 3, 2, 3)));
+            _mm_storeu_ps(out + 12, _mm_shuffle_ps(y, w, _MM_SHUFFLE(0, 1, 0, 1)));
+        } else {
+            _mm_storeu_ps(out + 0, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_storeu_ps(out + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+            _mm_storeu_ps(out + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_storeu_ps(out + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+        }
+        return true;
+#else
+        // 各要素の余因子を直接計算
+        const auto e = [m](int row, int column) { return m[row * 4 + column]; };
+        float cof[4][4];
+
+        cof[0][0] = e(1, 1) * (e(2, 2) * e(3, 3) - e(2, 3) * e(3, 2)) - e(1, 2) * (e(2, 1) * e(3, 3) - e(2, 3) * e(3, 1)) + e(1, 3) * (e(2, 1) * e(3, 2) - e(2, 2) * e(3, 1));
+        cof[0][1] = -(e(1, 0) * (e(2, 2) * e(3, 3) - e(2, 3) * e(3, 2)) - e(1, 2) * (e(2, 0) * e(3, 3) - e(2, 3) * e(3, 0)) + e(1, 3) * (e(2, 0) * e(3, 2) - e(2, 2) * e(3, 0)));
+        cof[0][2] = e(1, 0) * (e(2, 1) * e(3, 3) - e(2, 3) * e(3, 1)) - e(1, 1) * (e(2, 0) * e(3, 3) - e(2, 3) * e(3, 0)) + e(1, 3) * (e(2, 0) * e(3, 1) - e(2, 1) * e(3, 0));
+        cof[0][3] = -(e(1, 0) * (e(2, 1) * e(3, 2) - e(2, 2) * e(3, 1)) - e(1, 1) * (e(2, 0) * e(3, 2) - e(2, 2) * e(3, 0)) + e(1, 2) * (e(2, 0) * e(3, 1) - e(2, 1) * e(3, 0)));
+
+        cof[1][0] = -(e(0, 1) * (e(2, 2) * e(3, 3) - e(2, 3) * e(3, 2)) - e(0, 2) * (e(2, 1) * e(3, 3) - e(2, 3) * e(3, 1)) + e(0, 3) * (e(2, 1) * e(3, 2) - e(2, 2) * e(3, 1)));
+        cof[1][1] = e(0, 0) * (e(2, 2) * e(3, 3) - e(2, 3) * e(3, 2)) - e(0, 2) * (e(2, 0) * e(3, 3) - e(2, 3) * e(3, 0)) + e(0, 3) * (e(2, 0) * e(3, 2) - e(2, 2) * e(3, 0));
+        cof[1][2] = -(e(0, 0) * (e(2, 1) * e(3, 3) - e(2, 3) * e(3, 1)) - e(0, 1) * (e(2, 0) * e(3, 3) - e(2, 3) * e(3, 0)) + e(0, 3) * (e(2, 0) * e(3, 1) - e(2, 1) * e(3, 0)));
+        cof[1][3] = e(0, 0) * (e(2, 1) * e(3, 2) - e(2, 2) * e(3, 1)) - e(0, 1) * (e(2, 0) * e(3, 2) - e(2, 2) * e(3, 0)) + e(0, 2) * (e(2, 0) * e(3, 1) - e(2, 1) * e(3, 0));
+
+        cof[2][0] = e(0, 1) * (e(1, 2) * e(3, 3) - e(1, 3) * e(3, 2)) - e(0, 2) * (e(1, 1) * e(3, 3) - e(1, 3) * e(3, 1)) + e(0, 3) * (e(1, 1) * e(3, 2) - e(1, 2) * e(3, 1));
+        cof[2][1] = -(e(0, 0) * (e(1, 2) * e(3, 3) - e(1, 3) * e(3, 2)) - e(0, 2) * (e(1, 0) * e(3, 3) - e(1, 3) * e(3, 0)) + e(0, 3) * (e(1, 0) * e(3, 2) - e(1, 2) * e(3, 0)));
+        cof[2][2] = e(0, 0) * (e(1, 1) * e(3, 3) - e(1, 3) * e(3, 1)) - e(0, 1) * (e(1, 0) * e(3, 3) - e(1, 3) * e(3, 0)) + e(0, 3) * (e(1, 0) * e(3, 1) - e(1, 1) * e(3, 0));
+        cof[2][3] = -(e(0, 0) * (e(1, 1) * e(3, 2) - e(1, 2) * e(3, 1)) - e(0, 1) * (e(1, 0) * e(3, 2) - e(1, 2) * e(3, 0)) + e(0, 2) * (e(1, 0) * e(3, 1) - e(1, 1) * e(3, 0)));
+
+        cof[3][0] = -(e(0, 1) * (e(1, 2) * e(2, 3) - e(1, 3) * e(2, 2)) - e(0, 2) * (e(1, 1) * e(2, 3) - e(1, 3) * e(2, 1)) + e(0, 3) * (e(1, 1) * e(2, 2) - e(1, 2) * e(2, 1)));
+        cof[3][1] = e(0, 0) * (e(1, 2) * e(2, 3) - e(1, 3) * e(2, 2)) - e(0, 2) * (e(1, 0) * e(2, 3) - e(1, 3) * e(2, 0)) + e(0, 3) * (e(1, 0) * e(2, 2) - e(1, 2) * e(2, 0));
+        cof[3][2] = -(e(0, 0) * (e(1, 1) * e(2, 3) - e(1, 3) * e(2, 1)) - e(0, 1) * (e(1, 0) * e(2, 3) - e(1, 3) * e(2, 0)) + e(0, 3) * (e(1, 0) * e(2, 1) - e(1, 1) * e(2, 0)));
+        cof[3][3] = e(0, 0) * (e(1, 1) * e(2, 2) - e(1, 2) * e(2, 1)) - e(0, 1) * (e(1, 0) * e(2, 2) - e(1, 2) * e(2, 0)) + e(0, 2) * (e(1, 0) * e(2, 1) - e(1, 1) * e(2, 0));
+
+        // 行列式の計算
+        const float det = e(0, 0) * cof[0][0] + e(0, 1) * cof[0][1] + e(0, 2) * cof[0][2] + e(0, 3) * cof[0][3];
+        if (det == 0.0f) {
+            return false;
+        }
+
+        // 逆行列は余因子行列の転置を行列式で割ったもの
+        const float invDet = 1.0f / det;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                if (transposeResult) {
+                    out[i * 4 + j] = cof[i][j] * invDet;
+                } else {
+                    out[j * 4 + i] = cof[i][j] * invDet;
+                }
+            }
+        }
+        return true;
+#endif
+    }
+
+    /// @brief 4x4行列が4列目 (0, 0, 0, 1) のアフィン行列か
+    inline bool IsAffineMatrix4x4(const float* m) {
+        return m[3] == 0.0f && m[7] == 0.0f && m[11] == 0.0f && m[15] == 1.0f;
+    }
+
+    /// @brief 逆転置行列 Transpose(Inverse(m)) を行列の種類に応じた方法で求める
+    /// - 射影を含む行列: InverseMatrix4x4 と同じ一般の逆行列
+    /// - アフィン行列: 左上3x3の余因子と行列式だけで求める（4x4の余因子展開を省略）
+    /// - 回転 + 均等スケール（剛体を含む）: 左上3x3を スケールの2乗 で割るだけ（余因子も不要）
+    /// @param m 入力（float[16]）
+    /// @param out 出力（float[16]。m と重ならないこと）。特異な場合は書き込まない
+    /// @return 逆行列が存在する場合true
+    inline bool InverseTransposeMatrix4x4(const float* m, float* out) {
+        if (!IsAffineMatrix4x4(m)) {
+            return InverseMatrix4x4(m, out, true);
+        }
+
+        // アフィン行列 [R 0; t 1] の逆転置行列は [R^-T  -(R^-1)^T t^T; 0 1]
+        // i 行目は (R^-T の i 行目, -(R^-T の i 行目)・t) になる
+#if MATHCORE_USE_SSE
+        // 3x3部分を列ごとのレジスタ（各レーンが行 0, 1, 2）に並べ替える
+        __m128 c0 = _mm_loadu_ps(m + 0);
+        __m128 c1 = _mm_loadu_ps(m + 4);
+        __m128 c2 = _mm_loadu_ps(m + 8);
+        __m128 c3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+        const __m128 t = _mm_loadu_ps(m + 12);
+        const __m128 tx = _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 ty = _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 tz = _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2));
+
+        // レーン i に行 i+1, i+2 を持ってくる並べ替え
+        const auto next1 = [](__m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1)); };
+        const auto next2 = [](__m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 0, 2)); };
+
+        // 各行の長さの2乗と、隣の行との内積
+        const __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, c0), _mm_mul_ps(c1, c1)), _mm_mul_ps(c2, c2));
+        const __m128 dots = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, next1(c0)), _mm_mul_ps(c1, next1(c1))), _mm_mul_ps(c2, next1(c2)));
+
+        __m128 r0, r1, r2;
+        __m128 scale;
+        const float lengthSq0 = _mm_cvtss_f32(lengthSq);
+        const __m128 tolerance = _mm_set1_ps(kSimilarityTolerance * lengthSq0);
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        const __m128 lengthError = _mm_and_ps(_mm_sub_ps(lengthSq, _mm_set1_ps(lengthSq0)), absMask);
+        const __m128 dotError = _mm_and_ps(dots, absMask);
+        const int similar = _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(lengthError, tolerance), _mm_cmple_ps(dotError, tolerance)));
+
+        if (lengthSq0 > 0.0f && (similar & 0x7) == 0x7) {
+            // R = sQ のとき R^-T = R / s^2
+            r0 = c0;
+            r1 = c1;
+            r2 = c2;
+            scale = _mm_set1_ps(1.0f / lengthSq0);
+        } else {
+            // R^-T の i 行目は (行 i+1) × (行 i+2) / det
+            r0 = _mm_sub_ps(_mm_mul_ps(next1(c1), next2(c2)), _mm_mul_ps(next1(c2), next2(c1)));
+            r1 = _mm_sub_ps(_mm_mul_ps(next1(c2), next2(c0)), _mm_mul_ps(next1(c0), next2(c2)));
+            r2 = _mm_sub_ps(_mm_mul_ps(next1(c0), next2(c1)), _mm_mul_ps(next1(c1), next2(c0)));
+            const float det = _mm_cvtss_f32(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, r0), _mm_mul_ps(c1, r1)), _mm_mul_ps(c2, r2)));
+            if (det == 0.0f) {
+                return false;
+            }
+            scale = _mm_set1_ps(1.0f / det);
+        }
+
+        r0 = _mm_mul_ps(r0, scale);
+        r1 = _mm_mul_ps(r1, scale);
+        r2 = _mm_mul_ps(r2, scale);
+        __m128 translation = _mm_sub_ps(_mm_setzero_ps(),
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, r0), _mm_mul_ps(ty, r1)), _mm_mul_ps(tz, r2)));
+        _MM_TRANSPOSE4_PS(r0, r1, r2, translation);
+        _mm_storeu_ps(out + 0, r0);
+        _mm_storeu_ps(out + 4, r1);
+        _mm_storeu_ps(out + 8, r2);
+        _mm_storeu_ps(out + 12, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+        return true;
+#else
+        const float* row[3] = { m + 0, m + 4, m + 8 };
+        const auto dot = [](const float* a, const float* b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; };
+
+        float result[3][3];
+        float scale;
+        const float lengthSq0 = dot(row[0], row[0]);
+        if (Detail::IsSimilarity(lengthSq0, dot(row[1], row[1]), dot(row[2], row[2]),
+            dot(row[0], row[1]), dot(row[1], row[2]), dot(row[2], row[0]))) {
+            // R = sQ のとき R^-T = R / s^2
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    result[i][j] = row[i][j];
+                }
+            }
+            scale = 1.0f / lengthSq0;
+        } else {
+            // R^-T の i 行目は (行 i+1) × (行 i+2) / det
+            for (int i = 0; i < 3; ++i) {
+                const float* a = row[(i + 1) % 3];
+                const float* b = row[(i + 2) % 3];
+                result[i][0] = a[1] * b[2] - a[2] * b[1];
+                result[i][1] = a[2] * b[0] - a[0] * b[2];
+                result[i][2] = a[0] * b[1] - a[1] * b[0];
+            }
+            const float det = dot(row[0], result[0]);
+            if (det == 0.0f) {
+                return false;
+            }
+            scale = 1.0f / det;
+        }
+
+        const float* t = m + 12;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                out[i * 4 + j] = result[i][j] * scale;
+            }
+            out[i * 4 + 3] = -dot(t, out + i * 4);
+        }
+        out[12] = 0.0f;
+        out[13] = 0.0f;
+        out[14] = 0.0f;
+        out[15] = 1.0f;
+        return true;
+#endif
+    }
+
+} // namespace MathSimd
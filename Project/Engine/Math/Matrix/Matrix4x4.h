@@ -1,5 +1,6 @@
 
 #pragma once
+#include "MathSimd.h"
 
 struct Matrix4x4 {
     float m[4][4];
@@ -7,14 +8,7 @@ struct Matrix4x4 {
     // 演算子オーバーロード
     Matrix4x4 operator*(const Matrix4x4& other) const {
         Matrix4x4 result;
-        for (int i = 0; i < 4; ++i) {
-            for (int j = 0; j < 4; ++j) {
-                result.m[i][j] = 0;
-                for (int k = 0; k < 4; ++k) {
-                    result.m[i][j] += m[i][k] * other.m[k][j];
-                }
-            }
-        }
+        MathSimd::MultiplyMatrix4x4(&m[0][0], &other.m[0][0], &result.m[0][0]);
         return result;
     }
 
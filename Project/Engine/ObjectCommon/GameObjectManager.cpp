@@ -1,12 +1,14 @@
 #include "GameObjectManager.h"
+#include "Engine/Graphics/Model/Model.h"
 #include "Engine/Graphics/Render/RenderManager.h"
+#include "Engine/Particle/ParticleSystem.h"
 #include <algorithm>
 
 #ifdef _DEBUG
 #include <imgui.h>
 #endif
 
-void GameObjectManager::UpdateAll() {
+void GameObjectManager::UpdateAll(JobSystem* jobSystem) {
 	// コピーを作成してから更新（ループ中の配列変更に対応）
 	std::vector<GameObject*> objectsToUpdate;
 	objectsToUpdate.reserve(objects_.size());
@@ -18,11 +20,44 @@ void GameObjectManager::UpdateAll() {
 	}
 	
 	// コピーしたリストを使って更新
+	std::vector<ParticleSystem*> particleSystems;
 	for (auto* obj : objectsToUpdate) {
 		if (obj && !obj->IsMarkedForDestroy()) {
-			obj->Update();
+			// パーティクルは共有乱数を使う放出処理だけをここで行う
+			if (auto* particleSystem = dynamic_cast<ParticleSystem*>(obj)) {
+				particleSystem->UpdateEmission();
+				particleSystems.push_back(particleSystem);
+			} else {
+				obj->Update();
+			}
+		}
+	}
+
+	// パーティクルのシミュレーションをまとめて実行（全システムの完了まで待機）
+	ParticleSystem::SimulateAll(particleSystems, jobSystem);
+
+	// 各オブジェクトの Update で予約したスケルトンの評価とパレットの書き込みをまとめて実行（全モデルの完了まで待機）
+	Model::UpdateAnimationsAll(jobSystem);
+}
+
+void GameObjectManager::PrepareRenderData(const ICamera* camera, JobSystem* jobSystem) {
+	if (!camera) return;
+
+	ParticleSystem::PrepareRenderDataAll(CollectParticleSystems(), camera, jobSystem);
+}
+
+std::vector<ParticleSystem*> GameObjectManager::CollectParticleSystems() const {
+	std::vector<ParticleSystem*> particleSystems;
+
+	for (auto& obj : objects_) {
+		if (obj && obj->IsActive() && !obj->IsMarkedForDestroy()) {
+			if (auto* particleSystem = dynamic_cast<ParticleSystem*>(obj.get())) {
+				particleSystems.push_back(particleSystem);
+			}
 		}
 	}
+
+	return particleSystems;
 }
 
 void GameObjectManager::RegisterAllToRender(RenderManager* renderManager) {
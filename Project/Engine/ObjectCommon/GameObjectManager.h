@@ -7,6 +7,8 @@
 // Forward declaration
 class RenderManager;
 class ICamera;
+class JobSystem;
+class ParticleSystem;
 
 /// @brief すべてのGameObjectを一元管理するマネージャー
 /// @note 更新、描画、削除を自動化し、使用者は登録とDestroyのみを意識する
@@ -25,7 +27,16 @@ public:
 	}
 
 	/// @brief 全オブジェクトの更新処理
-	void UpdateAll();
+	/// @note パーティクルシステムは放出のみ逐次で行い、シミュレーションは最後にまとめてジョブに分散する
+	/// @note モデルのアニメーションは各オブジェクトの Update で予約し、スケルトンの評価とパレットの書き込みを最後にまとめてジョブに分散する
+	/// @param jobSystem ジョブシステム（nullptrの場合は全て逐次）
+	void UpdateAll(JobSystem* jobSystem = nullptr);
+
+	/// @brief パーティクルシステムの描画データをジョブに分散して構築（RenderManager::DrawAll より前に呼ぶ）
+	/// @note 全システムの構築完了まで待機してから戻る
+	/// @param camera 描画に使用するカメラ
+	/// @param jobSystem ジョブシステム（nullptrの場合は逐次）
+	void PrepareRenderData(const ICamera* camera, JobSystem* jobSystem = nullptr);
 
 	/// @brief 全オブジェクトをRenderManagerに登録して描画
 	/// @param renderManager レンダーマネージャー
@@ -52,6 +63,10 @@ public:
 #endif
 
 private:
+	/// @brief 更新・描画対象のパーティクルシステムを収集
+	/// @return 有効なパーティクルシステムのリスト
+	std::vector<ParticleSystem*> CollectParticleSystems() const;
+
 	/// @brief 管理中のオブジェクトリスト
 	std::vector<std::unique_ptr<GameObject>> objects_;
 
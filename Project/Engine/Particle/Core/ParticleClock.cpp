@@ -0,0 +1,50 @@
+#include "ParticleClock.h"
+#include <algorithm>
+
+void ParticleClock::SetSettings(const Settings& settings) {
+	settings_ = settings;
+	settings_.fixedDeltaTime = (std::max)(settings_.fixedDeltaTime, 1.0f / 1000.0f);
+	settings_.maxSubsteps = (std::max)(settings_.maxSubsteps, 1u);
+	settings_.timeScale = (std::max)(settings_.timeScale, 0.0f);
+	accumulator_ = 0.0f;
+}
+
+void ParticleClock::Advance(float frameDeltaTime) {
+	const float deltaTime = (std::min)((std::max)(frameDeltaTime, 0.0f), settings_.maxDeltaTime);
+
+	switch (settings_.mode) {
+	case ParticleTimeMode::FixedStep: {
+		// 刻み幅に満たない端数は次フレームへ持ち越す（同じフレーム時間の列に対しては、毎回同じステップ数になる）
+		accumulator_ += deltaTime * settings_.timeScale;
+		stepDeltaTime_ = settings_.fixedDeltaTime;
+		stepCount_ = 0;
+		while (accumulator_ >= stepDeltaTime_) {
+			accumulator_ -= stepDeltaTime_;
+			if (stepCount_ < settings_.maxSubsteps) {
+				++stepCount_;
+			} else {
+				// 処理落ちで追いつけない分は破棄し、次フレーム以降に負荷を持ち越さない
+				++droppedStepCount_;
+			}
+		}
+		break;
+	}
+	case ParticleTimeMode::Scaled:
+		stepDeltaTime_ = deltaTime * settings_.timeScale;
+		stepCount_ = stepDeltaTime_ > 0.0f ? 1 : 0;
+		break;
+	default:
+		stepDeltaTime_ = deltaTime;
+		stepCount_ = stepDeltaTime_ > 0.0f ? 1 : 0;
+		break;
+	}
+
+	totalStepCount_ += stepCount_;
+}
+
+void ParticleClock::Reset() {
+	accumulator_ = 0.0f;
+	stepCount_ = 0;
+	droppedStepCount_ = 0;
+	totalStepCount_ = 0;
+}
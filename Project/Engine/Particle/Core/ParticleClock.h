@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+/// @brief シミュレーション時間の進め方
+enum class ParticleTimeMode {
+	Variable,   // 実経過時間をそのまま1ステップとして使う
+	FixedStep,  // 固定刻みで進める（端数は次フレームに持ち越す。ステップごとの時間は描画レートによらず一定）
+	Scaled      // 実経過時間にタイムスケールを掛けて1ステップとして使う（スロー・早送り演出用）
+};
+
+/// @brief パーティクルシステムごとのシミュレーション時計
+/// フレームの実経過時間からそのフレームで実行するステップ数と1ステップの時間を決める
+class ParticleClock {
+public:
+	/// @brief 時計の設定
+	struct Settings {
+		ParticleTimeMode mode = ParticleTimeMode::Variable;
+		float fixedDeltaTime = 1.0f / 60.0f;  // FixedStepの刻み幅（秒）
+		uint32_t maxSubsteps = 4;             // FixedStepで1フレームに実行する最大ステップ数（超過分は破棄）
+		float timeScale = 1.0f;               // Scaled / FixedStepで実経過時間に掛ける倍率
+		float maxDeltaTime = 0.1f;            // 1フレームとして扱う実経過時間の上限（ヒッチ時の暴走防止）
+	};
+
+	ParticleClock() = default;
+	~ParticleClock() = default;
+
+	/// @brief 設定を変更（FixedStepの持ち越し時間はリセットされる）
+	/// @param settings 設定
+	void SetSettings(const Settings& settings);
+
+	/// @brief 設定を取得
+	const Settings& GetSettings() const { return settings_; }
+
+	/// @brief フレームの実経過時間だけ時計を進め、このフレームのステップを決定する
+	/// @param frameDeltaTime 前フレームからの実経過時間（秒）
+	void Advance(float frameDeltaTime);
+
+	/// @brief 持ち越し時間と累計ステップ数をリセット
+	void Reset();
+
+	/// @brief このフレームに実行するステップ数を取得
+	uint32_t GetStepCount() const { return stepCount_; }
+
+	/// @brief 1ステップあたりの時間（秒）を取得
+	float GetStepDeltaTime() const { return stepDeltaTime_; }
+
+	/// @brief 上限を超えて破棄したステップの累計を取得（FixedStepのみ）
+	uint32_t GetDroppedStepCount() const { return droppedStepCount_; }
+
+	/// @brief リセット以降に実行したステップの累計を取得
+	uint64_t GetTotalStepCount() const { return totalStepCount_; }
+
+private:
+	Settings settings_;
+
+	uint32_t stepCount_ = 0;
+	float stepDeltaTime_ = 0.0f;
+	float accumulator_ = 0.0f;          // FixedStepの持ち越し時間
+	uint32_t droppedStepCount_ = 0;
+	uint64_t totalStepCount_ = 0;
+};
@@ -0,0 +1,79 @@
+#include "ParticleDepthSorter.h"
+#include <cstring>
+#include <utility>
+
+const uint32_t* ParticleDepthSorter::SortBackToFront(const Vector3* positions, uint32_t count, const Matrix4x4& viewMatrix) {
+	if (count == 0) {
+		return nullptr;
+	}
+
+	// resizeは容量を超えた場合のみ再確保する（縮小時もメモリは保持）
+	keys_.resize(count);
+	keysTemp_.resize(count);
+	indices_.resize(count);
+	indicesTemp_.resize(count);
+
+	// ビュー空間のZ（平行移動成分は全要素共通のため順序に影響しない）
+	const float axisX = viewMatrix.m[0][2];
+	const float axisY = viewMatrix.m[1][2];
+	const float axisZ = viewMatrix.m[2][2];
+
+	for (uint32_t i = 0; i < count; ++i) {
+		const float depth = positions[i].x * axisX + positions[i].y * axisY + positions[i].z * axisZ;
+		// 奥から手前に並べるため、キーを反転して昇順ソートで深度の降順にする
+		keys_[i] = ~ToSortableKey(depth);
+		indices_[i] = i;
+	}
+
+	RadixSort(count);
+	return indices_.data();
+}
+
+uint32_t ParticleDepthSorter::ToSortableKey(float value) {
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	// 負の値は全ビットを反転、正の値は符号ビットのみ立てることで整数比較の順序と一致させる
+	const uint32_t mask = (bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;
+	return bits ^ mask;
+}
+
+void ParticleDepthSorter::RadixSort(uint32_t count) {
+	// 全桁のヒストグラムを1回の走査でまとめて作成
+	uint32_t histograms[kPassCount][kRadixSize] = {};
+	for (uint32_t i = 0; i < count; ++i) {
+		const uint32_t key = keys_[i];
+		for (uint32_t pass = 0; pass < kPassCount; ++pass) {
+			++histograms[pass][(key >> (pass * kRadixBits)) & (kRadixSize - 1)];
+		}
+	}
+
+	for (uint32_t pass = 0; pass < kPassCount; ++pass) {
+		uint32_t* histogram = histograms[pass];
+		const uint32_t shift = pass * kRadixBits;
+
+		// 全要素が同じ桁値のパスは並びが変わらないため省略（深度の範囲が狭い場合は上位桁が揃いやすい）
+		if (histogram[(keys_[0] >> shift) & (kRadixSize - 1)] == count) {
+			continue;
+		}
+
+		// 出現数を書き込み開始位置に変換
+		uint32_t offset = 0;
+		for (uint32_t digit = 0; digit < kRadixSize; ++digit) {
+			const uint32_t digitCount = histogram[digit];
+			histogram[digit] = offset;
+			offset += digitCount;
+		}
+
+		// 安定な分配（同じ桁値の要素は元の順序を保つ）
+		for (uint32_t i = 0; i < count; ++i) {
+			const uint32_t key = keys_[i];
+			const uint32_t destination = histogram[(key >> shift) & (kRadixSize - 1)]++;
+			keysTemp_[destination] = key;
+			indicesTemp_[destination] = indices_[i];
+		}
+
+		std::swap(keys_, keysTemp_);
+		std::swap(indices_, indicesTemp_);
+	}
+}
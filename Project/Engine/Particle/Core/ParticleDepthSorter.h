@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "MathCore.h"
+
+/// @brief パーティクルの深度ソート（アルファブレンド用の奥→手前の描画順を作成）
+/// ビュー空間の深度を順序を保つ32ビット整数キーに変換し、8ビット×4パスのLSD基数ソートでインデックスを並べ替える
+/// 作業バッファは保持して使い回すため、パーティクル数が増えない限り毎フレームの確保は発生しない
+class ParticleDepthSorter {
+public:
+	ParticleDepthSorter() = default;
+	~ParticleDepthSorter() = default;
+
+	/// @brief ビュー空間の深度が大きい（奥にある）順にインデックスを並べる
+	/// 深度が等しいパーティクル同士は元の順序を保つ（安定ソート）
+	/// @param positions ワールド座標（count要素）
+	/// @param count パーティクル数
+	/// @param viewMatrix ビュー行列
+	/// @return 並べ替えたインデックス（count要素。次にSortを呼ぶまで有効）
+	const uint32_t* SortBackToFront(const Vector3* positions, uint32_t count, const Matrix4x4& viewMatrix);
+
+	/// @brief 浮動小数点数を大小関係を保った符号なし整数に変換
+	/// @param value 変換する値
+	/// @return 昇順に並べると value の昇順になるキー
+	static uint32_t ToSortableKey(float value);
+
+private:
+	/// @brief keys_ をキーとして indices_ を昇順に基数ソート
+	/// @param count 要素数
+	void RadixSort(uint32_t count);
+
+	// 基数ソートの1パスで扱うビット数と桁数
+	static constexpr uint32_t kRadixBits = 8;
+	static constexpr uint32_t kRadixSize = 1u << kRadixBits;
+	static constexpr uint32_t kPassCount = 32 / kRadixBits;
+
+	// 作業バッファ（パスごとに入れ替えて使用する）
+	std::vector<uint32_t> keys_;
+	std::vector<uint32_t> keysTemp_;
+	std::vector<uint32_t> indices_;
+	std::vector<uint32_t> indicesTemp_;
+};
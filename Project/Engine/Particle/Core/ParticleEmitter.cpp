@@ -22,21 +22,30 @@ void ParticleEmitter::Initialize(
 	rotationModule_ = rotationModule;
 }
 
-uint32_t ParticleEmitter::EmitParticles(
+void ParticleEmitter::GenerateParticles(
 	uint32_t count,
 	const EulerTransform& emitterTransform,
-	uint32_t maxParticles,
-	std::list<Particle>& outParticles
+	std::vector<Particle>& outParticles
 ) {
-	uint32_t emittedCount = 0;
+	outParticles.reserve(outParticles.size() + count);
 
-	for (uint32_t i = 0; i < count && outParticles.size() < maxParticles; ++i) {
+	for (uint32_t i = 0; i < count; ++i) {
 		Particle newParticle = CreateParticle(emitterTransform);
+
+		// 放出時刻がステップ開始より後のパーティクルは、その分だけ過去に巻き戻しておく
+		const float spawnTime = emissionModule_ ? emissionModule_->GetSpawnTime(i) : 0.0f;
+		if (spawnTime > 0.0f) {
+			newParticle.currentTime -= spawnTime;
+			newParticle.transform.translate.x -= newParticle.velocity.x * spawnTime;
+			newParticle.transform.translate.y -= newParticle.velocity.y * spawnTime;
+			newParticle.transform.translate.z -= newParticle.velocity.z * spawnTime;
+			newParticle.transform.rotate.x -= newParticle.rotationSpeed.x * spawnTime;
+			newParticle.transform.rotate.y -= newParticle.rotationSpeed.y * spawnTime;
+			newParticle.transform.rotate.z -= newParticle.rotationSpeed.z * spawnTime;
+		}
+
 		outParticles.push_back(newParticle);
-		++emittedCount;
 	}
-
-	return emittedCount;
 }
 
 Particle ParticleEmitter::CreateParticle(const EulerTransform& emitterTransform) {
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <list>
 #include <cstdint>
+#include <vector>
 #include "MathCore.h"
 
 // 前方宣言
@@ -34,17 +34,16 @@ public:
 		RotationModule* rotationModule
 	);
 
-	/// @brief パーティクルを放出
-	/// @param count 放出数
-    /// @param emitterTransform エミッターのトランスフォーム
-	/// @param maxParticles 最大パーティクル数
-	/// @param outParticles 出力先のパーティクルリスト
-	/// @return 実際に放出されたパーティクル数
-	uint32_t EmitParticles(
+	/// @brief パーティクルを生成して出力配列の末尾に追加（プールへの追加は呼び出し側で行う）
+	/// EmissionModuleの放出時刻に合わせて、ステップ開始時点まで経過時間・位置・回転を巻き戻す
+	/// （続くステップの更新でステップ幅ぶん進むと、放出時刻からの経過分だけ進んだ状態になる）
+	/// @param count 生成数（直前のEmissionModule::CalculateEmissionCountの戻り値）
+	/// @param emitterTransform エミッターのトランスフォーム
+	/// @param outParticles 出力先
+	void GenerateParticles(
 		uint32_t count,
 		const EulerTransform& emitterTransform,
-		uint32_t maxParticles,
-		std::list<Particle>& outParticles
+		std::vector<Particle>& outParticles
 	);
 
 private:
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include "MathCore.h"
+
+/// @brief GPU送信用パーティクルデータ（1インスタンス36バイト）
+/// ワールド行列は頂点シェーダーで位置・回転・スケールから展開する（Particle.hlsli と同じレイアウト）
+struct ParticleForGPU {
+    Vector3 position;       // ワールド座標
+    uint32_t color;         // RGBA8 UNORM（R が最下位バイト）
+    Vector3 scale;          // スケール
+    uint32_t rotation[2];   // 回転クォータニオン xyzw（SNORM16 x4、[0] = xy, [1] = zw）
+};
+
+static_assert(sizeof(ParticleForGPU) == 36, "ParticleForGPUはParticle.hlsliのStructuredBufferと同じ36バイトである必要がある");
+
+/// @brief パーティクル描画の定数（システムごとにルート定数で送る）
+struct ParticleDrawConstants {
+    Matrix4x4 viewProjection;   // ビュープロジェクション行列
+    Matrix4x4 billboard;        // ビルボード回転行列（ビルボード無効時は単位行列）
+};
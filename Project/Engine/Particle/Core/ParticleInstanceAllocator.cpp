@@ -0,0 +1,123 @@
+#include "ParticleInstanceAllocator.h"
+#include "Engine/Graphics/Common/DirectXCommon.h"
+#include "Engine/Graphics/Resource/ResourceFactory.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <algorithm>
+#include <cassert>
+#include <format>
+
+ParticleInstanceAllocator& ParticleInstanceAllocator::GetInstance()
+{
+	static ParticleInstanceAllocator instance;
+	return instance;
+}
+
+void ParticleInstanceAllocator::Initialize(DirectXCommon* dxCommon, uint32_t initialCapacity)
+{
+	dxCommon_ = dxCommon;
+	CreateBuffer((std::max)(1u, initialCapacity));
+}
+
+void ParticleInstanceAllocator::Finalize()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	retiredBuffers_.clear();
+	resource_.Reset();
+	mappedData_ = nullptr;
+	capacity_ = 0;
+	retiredFrameUsage_ = 0;
+	dxCommon_ = nullptr;
+}
+
+void ParticleInstanceAllocator::BeginFrame(uint32_t frameIndex)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	// 前フレームの終了位置を記録し、同じバックバッファを使った前回フレームの終了位置までを解放
+	frameEnd_[currentFrameIndex_] = head_;
+	currentFrameIndex_ = frameIndex % kFrameCount;
+	tail_ = frameEnd_[currentFrameIndex_];
+	frameBegin_ = head_;
+	retiredFrameUsage_ = 0;
+
+	// 旧バッファはkFrameCountフレーム経過すればGPUが参照しなくなる
+	for (auto& retired : retiredBuffers_) {
+		--retired.remainingFrames;
+	}
+	std::erase_if(retiredBuffers_, [](const RetiredBuffer& retired) { return retired.remainingFrames == 0; });
+}
+
+ParticleInstanceAllocation ParticleInstanceAllocator::Allocate(uint32_t count)
+{
+	if (count == 0 || !resource_) {
+		return {};
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	// 末尾に収まらない場合は先頭に折り返す（読み飛ばした領域は今フレームの使用量に含める）
+	uint64_t start = head_;
+	const uint64_t position = start % capacity_;
+	if (position + count > capacity_) {
+		start += capacity_ - position;
+	}
+
+	// GPUが使用中の領域に重なる場合はバッファを拡張する
+	if (start + count - tail_ > capacity_) {
+		Grow(count);
+		start = head_;
+	}
+
+	head_ = start + count;
+
+	const uint64_t offset = start % capacity_;
+	ParticleInstanceAllocation allocation;
+	allocation.data = mappedData_ + offset;
+	allocation.gpuAddress = resource_->GetGPUVirtualAddress() + offset * sizeof(ParticleForGPU);
+	allocation.count = count;
+	return allocation;
+}
+
+void ParticleInstanceAllocator::CreateBuffer(uint32_t capacity)
+{
+	assert(dxCommon_ != nullptr && "ParticleInstanceAllocator must be initialized");
+
+	resource_ = ResourceFactory::CreateBufferResource(
+		dxCommon_->GetDevice(),
+		sizeof(ParticleForGPU) * capacity
+	);
+
+	// アップロードヒープのため、解放まで永続的にマップしておく
+	resource_->Map(0, nullptr, reinterpret_cast<void**>(&mappedData_));
+	capacity_ = capacity;
+
+	// 新しいバッファは全領域が空き
+	head_ = 0;
+	tail_ = 0;
+	frameBegin_ = 0;
+	std::fill(std::begin(frameEnd_), std::end(frameEnd_), 0);
+}
+
+void ParticleInstanceAllocator::Grow(uint32_t requiredCount)
+{
+	// 今フレームの割り当て済み領域はGPUから参照されるため、旧バッファをフレーム完了まで保持する
+	retiredBuffers_.push_back({ resource_, kFrameCount });
+
+	// 新しいバッファでは位置が0に戻るため、今フレームの使用量を引き継ぐ
+	retiredFrameUsage_ += head_ - frameBegin_;
+
+	// 1フレーム分の要求量がkFrameCountフレーム分収まるまで倍々に拡張する
+	const uint64_t frameDemand = retiredFrameUsage_ + requiredCount;
+	uint64_t newCapacity = capacity_;
+	while (newCapacity < frameDemand * kFrameCount) {
+		newCapacity *= 2;
+	}
+
+	Logger::GetInstance().Log(
+		std::format("ParticleInstanceAllocator: grow {} -> {} instances ({} KB)",
+			capacity_, newCapacity, newCapacity * sizeof(ParticleForGPU) / 1024),
+		LogLevel::INFO, LogCategory::Graphics);
+
+	CreateBuffer(static_cast<uint32_t>(newCapacity));
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "ParticleGPUData.h"
+
+// 前方宣言
+class DirectXCommon;
+
+/// @brief インスタンシング領域の割り当て結果（割り当てたフレームのみ有効）
+struct ParticleInstanceAllocation {
+    ParticleForGPU* data = nullptr;           // 書き込み先（マップ済みアップロードバッファ）
+    D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0; // ルートSRVに設定するアドレス
+    uint32_t count = 0;                       // 割り当てたインスタンス数
+};
+
+/// @brief 全パーティクルシステムで共有するインスタンシング用リングアロケータ
+/// 1本のアップロードバッファを先頭から順に切り出し、GPUが使い終えたフレームの領域を再利用する
+/// 空きが足りない場合はバッファを倍々で作り直す（置き換えた旧バッファはGPUが使い終えるまで保持）
+class ParticleInstanceAllocator {
+public:
+    // ダブルバッファリング（CommandManager::kFrameCountと同じ）
+    static constexpr uint32_t kFrameCount = 2;
+    // 初期容量（インスタンス数）
+    static constexpr uint32_t kInitialCapacity = 16384;
+
+    // シングルトンアクセス
+    static ParticleInstanceAllocator& GetInstance();
+
+    // コピー・ムーブを禁止
+    ParticleInstanceAllocator(const ParticleInstanceAllocator&) = delete;
+    ParticleInstanceAllocator& operator=(const ParticleInstanceAllocator&) = delete;
+    ParticleInstanceAllocator(ParticleInstanceAllocator&&) = delete;
+    ParticleInstanceAllocator& operator=(ParticleInstanceAllocator&&) = delete;
+
+    /// @brief 初期化（リングバッファを作成）
+    /// @param dxCommon DirectXCommon
+    /// @param initialCapacity 初期容量（インスタンス数）
+    void Initialize(DirectXCommon* dxCommon, uint32_t initialCapacity = kInitialCapacity);
+
+    /// @brief 終了処理（全バッファを解放）
+    void Finalize();
+
+    /// @brief フレーム開始処理
+    /// 同じバックバッファを使った前回のフレームはGPU処理が完了しているため、その領域を解放する
+    /// @param frameIndex 今フレームのバックバッファインデックス
+    void BeginFrame(uint32_t frameIndex);
+
+    /// @brief 今フレーム用のインスタンシング領域を割り当て（複数スレッドから呼び出し可能）
+    /// @param count インスタンス数
+    /// @return 割り当て結果（count が0、または未初期化の場合は空）
+    ParticleInstanceAllocation Allocate(uint32_t count);
+
+    /// @brief 初期化済みかどうか
+    bool IsInitialized() const { return resource_ != nullptr; }
+
+    /// @brief リングバッファの容量（インスタンス数）を取得
+    uint32_t GetCapacity() const { return capacity_; }
+
+    /// @brief 今フレームに割り当てたインスタンス数を取得（折り返しで読み飛ばした分と、拡張前のバッファに割り当てた分を含む）
+    uint32_t GetFrameUsage() const { return static_cast<uint32_t>(retiredFrameUsage_ + (head_ - frameBegin_)); }
+
+private:
+    ParticleInstanceAllocator() = default;
+    ~ParticleInstanceAllocator() = default;
+
+    /// @brief リングバッファを作成してマップ
+    /// @param capacity 容量（インスタンス数）
+    void CreateBuffer(uint32_t capacity);
+
+    /// @brief 現在のバッファを退避し、より大きなバッファに置き換える
+    /// @param requiredCount 今回割り当てたいインスタンス数
+    void Grow(uint32_t requiredCount);
+
+    /// @brief 置き換え済みでGPUの使用が終わるのを待っているバッファ
+    struct RetiredBuffer {
+        Microsoft::WRL::ComPtr<ID3D12Resource> resource;
+        uint32_t remainingFrames = 0;
+    };
+
+    DirectXCommon* dxCommon_ = nullptr;
+
+    Microsoft::WRL::ComPtr<ID3D12Resource> resource_;
+    ParticleForGPU* mappedData_ = nullptr;
+    uint32_t capacity_ = 0;
+
+    // リング上の位置（インスタンス単位で単調増加させ、容量の剰余で実際の位置を求める）
+    uint64_t head_ = 0;                     // 次に割り当てる位置
+    uint64_t tail_ = 0;                     // GPUが使用中の可能性がある最古の位置
+    uint64_t frameBegin_ = 0;               // 今フレームの開始位置
+    uint64_t frameEnd_[kFrameCount] = {};   // バックバッファごとの前回フレーム終了位置
+    uint64_t retiredFrameUsage_ = 0;        // 今フレームに拡張前のバッファへ割り当てた数（拡張で位置が戻るため別に保持）
+    uint32_t currentFrameIndex_ = 0;
+
+    std::vector<RetiredBuffer> retiredBuffers_;
+
+    std::mutex mutex_;
+};
@@ -0,0 +1,95 @@
+#include "ParticlePool.h"
+#include "Engine/Particle/ParticleSystem.h" // Particle構造体のため
+#include <algorithm>
+
+void ParticlePool::Initialize(uint32_t capacity) {
+	count_ = 0;
+	SetCapacity(capacity);
+}
+
+void ParticlePool::SetCapacity(uint32_t capacity) {
+	const bool shrink = capacity < capacity_;
+	capacity_ = capacity;
+	count_ = (std::min)(count_, capacity);
+
+	auto resizeStream = [capacity, shrink](auto& stream) {
+		stream.resize(capacity);
+		// 縮小時は余ったメモリも解放する
+		if (shrink) {
+			stream.shrink_to_fit();
+		}
+	};
+
+	resizeStream(positions_);
+	resizeStream(velocities_);
+	resizeStream(colors_);
+	resizeStream(scales_);
+	resizeStream(rotations_);
+	resizeStream(ages_);
+
+	resizeStream(initialColors_);
+	resizeStream(initialScales_);
+	resizeStream(rotationSpeeds_);
+	resizeStream(lifeTimes_);
+}
+
+bool ParticlePool::Push(const Particle& particle) {
+	if (IsFull()) {
+		return false;
+	}
+
+	const uint32_t index = count_++;
+
+	positions_[index] = particle.transform.translate;
+	velocities_[index] = particle.velocity;
+	colors_[index] = particle.color;
+	scales_[index] = particle.transform.scale;
+	rotations_[index] = particle.transform.rotate;
+	ages_[index] = particle.currentTime;
+
+	initialColors_[index] = particle.initialColor;
+	initialScales_[index] = particle.initialScale;
+	rotationSpeeds_[index] = particle.rotationSpeed;
+	lifeTimes_[index] = particle.lifeTime;
+
+	return true;
+}
+
+void ParticlePool::Remove(uint32_t index) {
+	if (index >= count_) {
+		return;
+	}
+
+	// 末尾要素を削除位置に移動（順序は保持しない）
+	const uint32_t last = --count_;
+	if (index == last) {
+		return;
+	}
+
+	positions_[index] = positions_[last];
+	velocities_[index] = velocities_[last];
+	colors_[index] = colors_[last];
+	scales_[index] = scales_[last];
+	rotations_[index] = rotations_[last];
+	ages_[index] = ages_[last];
+
+	initialColors_[index] = initialColors_[last];
+	initialScales_[index] = initialScales_[last];
+	rotationSpeeds_[index] = rotationSpeeds_[last];
+	lifeTimes_[index] = lifeTimes_[last];
+}
+
+Particle ParticlePool::GetParticle(uint32_t index) const {
+	Particle particle{};
+	particle.transform.translate = positions_[index];
+	particle.transform.scale = scales_[index];
+	particle.transform.rotate = rotations_[index];
+	particle.velocity = velocities_[index];
+	particle.color = colors_[index];
+	particle.initialColor = initialColors_[index];
+	particle.initialScale = initialScales_[index];
+	particle.lifeTime = lifeTimes_[index];
+	particle.currentTime = ages_[index];
+	particle.rotationSpeed = rotationSpeeds_[index];
+	return particle;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "MathCore.h"
+
+// 前方宣言
+struct Particle;
+
+/// @brief プール内の連続区間 [begin, end)（ジョブ分割用）
+struct ParticleRange {
+	uint32_t begin = 0;
+	uint32_t end = 0;
+
+	/// @brief 区間の要素数を取得
+	uint32_t GetCount() const { return end - begin; }
+};
+
+/// @brief SoA（Structure of Arrays）形式のパーティクルプール
+/// 属性ごとに連続した配列で保持し、削除は末尾要素との入れ替え（swap-and-pop）で行う
+/// 容量はSetCapacityで変更するまで固定（Pushで自動拡張はしない）
+/// 生存パーティクルは常に [0, GetCount()) に詰めて配置される
+class ParticlePool {
+public:
+	// 1パーティクルあたりのメモリ量（全ストリームの合計）
+	static constexpr size_t kBytesPerParticle =
+		sizeof(Vector3) * 6 +  // 位置・速度・スケール・回転・初期スケール・回転速度
+		sizeof(Vector4) * 2 +  // 色・初期色
+		sizeof(float) * 2;     // 経過時間・寿命
+
+	ParticlePool() = default;
+	~ParticlePool() = default;
+
+	/// @brief 初期化（容量分の配列を確保）
+	/// @param capacity 最大パーティクル数
+	void Initialize(uint32_t capacity);
+
+	/// @brief 容量を変更（生存パーティクルは保持し、縮小時は容量を超えた末尾側を破棄する）
+	/// @param capacity 新しい最大パーティクル数
+	void SetCapacity(uint32_t capacity);
+
+	/// @brief 全パーティクルを削除（確保済みメモリは維持）
+	void Clear() { count_ = 0; }
+
+	/// @brief パーティクルを末尾に追加
+	/// @param particle 追加するパーティクル
+	/// @return 追加できた場合true（容量超過時はfalse）
+	bool Push(const Particle& particle);
+
+	/// @brief パーティクルを削除（末尾要素を移動して穴を埋める）
+	/// @param index 削除するインデックス
+	void Remove(uint32_t index);
+
+	/// @brief 指定インデックスのパーティクルを構造体として取得
+	/// @param index インデックス
+	/// @return パーティクル
+	Particle GetParticle(uint32_t index) const;
+
+	/// @brief 生存パーティクル数を取得
+	uint32_t GetCount() const { return count_; }
+
+	/// @brief 容量を取得
+	uint32_t GetCapacity() const { return capacity_; }
+
+	/// @brief 空かどうか
+	bool IsEmpty() const { return count_ == 0; }
+
+	/// @brief 満杯かどうか
+	bool IsFull() const { return count_ >= capacity_; }
+
+	/// @brief 生存パーティクル全体の区間を取得
+	ParticleRange GetRange() const { return { 0, count_ }; }
+
+	// ──────────────────────────────────────────────────────────
+	// ストリームアクセサ（有効範囲は [0, GetCount())）
+	// ──────────────────────────────────────────────────────────
+
+	Vector3* GetPositions() { return positions_.data(); }
+	const Vector3* GetPositions() const { return positions_.data(); }
+
+	Vector3* GetVelocities() { return velocities_.data(); }
+	const Vector3* GetVelocities() const { return velocities_.data(); }
+
+	Vector4* GetColors() { return colors_.data(); }
+	const Vector4* GetColors() const { return colors_.data(); }
+
+	const Vector4* GetInitialColors() const { return initialColors_.data(); }
+
+	Vector3* GetScales() { return scales_.data(); }
+	const Vector3* GetScales() const { return scales_.data(); }
+
+	const Vector3* GetInitialScales() const { return initialScales_.data(); }
+
+	Vector3* GetRotations() { return rotations_.data(); }
+	const Vector3* GetRotations() const { return rotations_.data(); }
+
+	const Vector3* GetRotationSpeeds() const { return rotationSpeeds_.data(); }
+
+	float* GetAges() { return ages_.data(); }
+	const float* GetAges() const { return ages_.data(); }
+
+	const float* GetLifeTimes() const { return lifeTimes_.data(); }
+
+private:
+	uint32_t count_ = 0;
+	uint32_t capacity_ = 0;
+
+	// 毎フレーム更新されるストリーム
+	std::vector<Vector3> positions_;
+	std::vector<Vector3> velocities_;
+	std::vector<Vector4> colors_;
+	std::vector<Vector3> scales_;
+	std::vector<Vector3> rotations_;
+	std::vector<float> ages_;           // 経過時間（Particle::currentTime）
+
+	// 生成時に決まり、以降は読み取り専用のストリーム
+	std::vector<Vector4> initialColors_;
+	std::vector<Vector3> initialScales_;
+	std::vector<Vector3> rotationSpeeds_;
+	std::vector<float> lifeTimes_;
+};
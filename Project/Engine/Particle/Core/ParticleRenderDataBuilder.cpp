@@ -1,85 +1,114 @@
 #include "ParticleRenderDataBuilder.h"
 #include "Engine/Camera/ICamera.h"
-#include "Engine/Particle/ParticleSystem.h" // Particle, BillboardType, ParticleRenderMode定義のため
+#include "ParticlePool.h"
+#include "ParticleSimd.h"
+#include "Engine/Utility/Job/JobSystem.h"
 #include <cmath>
+#include <algorithm>
 
 using namespace MathCore;
 
 uint32_t ParticleRenderDataBuilder::BuildRenderData(
-	const std::list<Particle>& particles,
-	const ICamera* camera,
-	BillboardType billboardType,
-	ParticleRenderMode renderMode,
+	const ParticlePool& pool,
 	ParticleForGPU* instancingData,
-	uint32_t maxInstances
+	uint32_t maxInstances,
+	ParticleSortMode sortMode,
+	const Matrix4x4& viewMatrix,
+	JobSystem* jobSystem
 ) {
-	if (!camera || !instancingData) {
+	if (!instancingData) {
 		return 0;
 	}
 
-	// renderModeは将来の拡張用（現在未使用）
-(void)renderMode;
+	// プールのストリームを取得
+	const Vector3* positions = pool.GetPositions();
+	const Vector3* scales = pool.GetScales();
+	const Vector3* rotations = pool.GetRotations();
+	const Vector4* colors = pool.GetColors();
 
-	// カメラから行列を取得
-	Matrix4x4 viewMatrix = camera->GetViewMatrix();
-	Matrix4x4 projectionMatrix = camera->GetProjectionMatrix();
-	Matrix4x4 viewProjectionMatrix = Matrix::Multiply(viewMatrix, projectionMatrix);
-
-	// ビルボード行列を作成
-	Matrix4x4 billboardMatrix = CreateBillboardMatrix(viewMatrix, billboardType);
-
-	// GPUデータの構築
-	uint32_t instanceCount = 0;
-	for (const auto& particle : particles) {
-		if (instanceCount >= maxInstances) break;
-
-		// ワールド行列を計算
-		Matrix4x4 worldMatrix = CalculateWorldMatrix(particle, billboardType, billboardMatrix);
+	uint32_t instanceCount = (std::min)(pool.GetCount(), maxInstances);
+	if (instanceCount == 0) {
+		return 0;
+	}
 
-		// WVP行列を計算
-		Matrix4x4 worldViewProjection = Matrix::Multiply(worldMatrix, viewProjectionMatrix);
+	// GPUデータの構築（各インスタンスは独立しているため区間に分割できる）
+	// 行列はシェーダー側で展開するため、ここでは回転の変換と量子化のみを行う
+	auto buildRange = [&](uint32_t begin, uint32_t end) {
+		ParticleSimd::PackInstances(
+			instancingData + begin,
+			positions + begin,
+			rotations + begin,
+			scales + begin,
+			colors + begin,
+			end - begin
+		);
+	};
+
+	// 深度ソート時は並べ替えた順に属性を小さなブロックへ集めてから圧縮する
+	// （書き込み先は連続のまま保ち、書き込み結合メモリへのランダムアクセスを避ける）
+	const uint32_t* sortedIndices = nullptr;
+	auto buildSortedRange = [&](uint32_t begin, uint32_t end) {
+		Vector3 blockPositions[kSortedBlockSize];
+		Vector3 blockRotations[kSortedBlockSize];
+		Vector3 blockScales[kSortedBlockSize];
+		Vector4 blockColors[kSortedBlockSize];
+
+		for (uint32_t blockBegin = begin; blockBegin < end; blockBegin += kSortedBlockSize) {
+			const uint32_t blockCount = (std::min)(kSortedBlockSize, end - blockBegin);
+			for (uint32_t i = 0; i < blockCount; ++i) {
+				const uint32_t index = sortedIndices[blockBegin + i];
+				blockPositions[i] = positions[index];
+				blockRotations[i] = rotations[index];
+				blockScales[i] = scales[index];
+				blockColors[i] = colors[index];
+			}
+			ParticleSimd::PackInstances(
+				instancingData + blockBegin,
+				blockPositions,
+				blockRotations,
+				blockScales,
+				blockColors,
+				blockCount
+			);
+		}
+	};
 
-		// GPU送信データに格納
-		instancingData[instanceCount].WVP = worldViewProjection;
-		instancingData[instanceCount].World = worldMatrix;
-		instancingData[instanceCount].color = particle.color;
+	if (sortMode == ParticleSortMode::BackToFront) {
+		// ソート自体はO(n)で軽いため逐次で行い、圧縮のみ区間分割する
+		sortedIndices = depthSorter_.SortBackToFront(positions, instanceCount, viewMatrix);
+		if (jobSystem && instanceCount >= kParallelThreshold) {
+			jobSystem->ParallelFor(instanceCount, kChunkSize, buildSortedRange);
+		} else {
+			buildSortedRange(0, instanceCount);
+		}
+		return instanceCount;
+	}
 
-		++instanceCount;
+	if (jobSystem && instanceCount >= kParallelThreshold) {
+		jobSystem->ParallelFor(instanceCount, kChunkSize, buildRange);
+	} else {
+		buildRange(0, instanceCount);
 	}
 
 	return instanceCount;
 }
 
-Matrix4x4 ParticleRenderDataBuilder::CalculateWorldMatrix(
-    const Particle& particle,
-    BillboardType billboardType,
-    const Matrix4x4& billboardMatrix
-) {
-	if (billboardType != BillboardType::None) {
-		// スケールと回転のみでローカル行列を作成（位置は原点）
-		Matrix4x4 scaleRotateMatrix = Matrix::MakeAffine(
-			particle.transform.scale,
-			particle.transform.rotate,
-			Vector3{ 0.0f, 0.0f, 0.0f }  // 原点で作成
-		);
-
-		// ビルボード変換を適用（回転とスケールのみ）
-		Matrix4x4 billboardedMatrix = Matrix::Multiply(scaleRotateMatrix, billboardMatrix);
+ParticleDrawConstants ParticleRenderDataBuilder::BuildDrawConstants(const ICamera* camera, BillboardType billboardType) {
+	ParticleDrawConstants constants;
+	constants.viewProjection = Matrix::Identity();
+	constants.billboard = Matrix::Identity();
+	if (!camera) {
+		return constants;
+	}
 
-		// 最後に位置を適用
-		billboardedMatrix.m[3][0] = particle.transform.translate.x;
-		billboardedMatrix.m[3][1] = particle.transform.translate.y;
-		billboardedMatrix.m[3][2] = particle.transform.translate.z;
+	// カメラから行列を取得
+	Matrix4x4 viewMatrix = camera->GetViewMatrix();
+	Matrix4x4 projectionMatrix = camera->GetProjectionMatrix();
+	constants.viewProjection = Matrix::Multiply(viewMatrix, projectionMatrix);
 
-		return billboardedMatrix;
-	} else {
-		// ビルボードなし（モデルパーティクル）の場合は通常通り
-		return Matrix::MakeAffine(
-			particle.transform.scale,
-			particle.transform.rotate,
-			particle.transform.translate
-		);
-	}
+	// ビルボード行列を作成
+	constants.billboard = CreateBillboardMatrix(viewMatrix, billboardType);
+	return constants;
 }
 
 Matrix4x4 ParticleRenderDataBuilder::CreateBillboardMatrix(const Matrix4x4& viewMatrix, BillboardType type) {
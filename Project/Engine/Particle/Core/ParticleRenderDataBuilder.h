@@ -1,14 +1,14 @@
 #pragma once
 
 #include "MathCore.h"
-#include "ParticleResourceManager.h"  // ParticleForGPU定義のため
-#include <list>
+#include "ParticleGPUData.h"
+#include "ParticleDepthSorter.h"
 #include <cstdint>
 
 // 前方宣言
 class ICamera;
-struct Particle;
-struct ParticleForGPU;
+class ParticlePool;
+class JobSystem;
 
 /// @brief ビルボードタイプ
 enum class BillboardType {
@@ -24,30 +24,49 @@ enum class ParticleRenderMode {
 	Model           // 3Dモデル
 };
 
+/// @brief パーティクルの描画順
+enum class ParticleSortMode {
+	None,           // ソートしない（プール内の順序。加算合成など順序に依存しないブレンド向け）
+	BackToFront     // カメラから遠い順（通常のアルファブレンド向け）
+};
+
 /// @brief パーティクルの描画データビルダー
 /// GPU送信データの準備とビルボード計算を担当
 class ParticleRenderDataBuilder {
 public:
+	// この数以上のインスタンスがある場合に区間分割して並列構築する
+	static constexpr uint32_t kParallelThreshold = 2048;
+	// 並列構築時の1ジョブあたりのインスタンス数
+	static constexpr uint32_t kChunkSize = 1024;
+	// ソート時に並べ替えた属性をまとめて圧縮する単位（作業領域をスタックに置ける大きさ）
+	static constexpr uint32_t kSortedBlockSize = 256;
+
 	ParticleRenderDataBuilder() = default;
 	~ParticleRenderDataBuilder() = default;
 
-	/// @brief 描画データを準備
-	/// @param particles パーティクルリスト
-	/// @param camera カメラ
-	/// @param billboardType ビルボードタイプ
-	/// @param renderMode 描画モード
+	/// @brief 描画データを準備（インスタンスごとの位置・回転・スケール・色を圧縮して書き込む）
+	/// @param pool パーティクルプール
 	/// @param instancingData GPU送信データ（出力）
-	/// @param maxInstances 最大インスタンス数
+	/// @param maxInstances 最大インスタンス数（instancingDataに確保済みの要素数）
+	/// @param sortMode 描画順（BackToFrontの場合はビュー空間の深度で並べ替えて書き込む）
+	/// @param viewMatrix ビュー行列（深度ソートに使用）
+	/// @param jobSystem 区間分割に使用するジョブシステム（nullptrの場合は呼び出しスレッドで逐次構築）
 	/// @return 準備したインスタンス数
 	uint32_t BuildRenderData(
-		const std::list<Particle>& particles,
-		const ICamera* camera,
-		BillboardType billboardType,
-		ParticleRenderMode renderMode,
+		const ParticlePool& pool,
 		ParticleForGPU* instancingData,
-		uint32_t maxInstances
+		uint32_t maxInstances,
+		ParticleSortMode sortMode,
+		const Matrix4x4& viewMatrix,
+		JobSystem* jobSystem = nullptr
 	);
 
+	/// @brief システム共通の描画定数を作成（ワールド行列の展開は頂点シェーダーで行う）
+	/// @param camera カメラ
+	/// @param billboardType ビルボードタイプ
+	/// @return ビュープロジェクション行列とビルボード行列
+	ParticleDrawConstants BuildDrawConstants(const ICamera* camera, BillboardType billboardType);
+
 private:
 	/// @brief ビルボード行列を作成
 	/// @param viewMatrix ビュー行列
@@ -55,14 +74,6 @@ private:
 	/// @return ビルボード行列
 	Matrix4x4 CreateBillboardMatrix(const Matrix4x4& viewMatrix, BillboardType type);
 
-	/// @brief ワールド行列を計算
-	/// @param particle パーティクル
-	/// @param billboardType ビルボードタイプ
-	/// @param billboardMatrix ビルボード行列
-	/// @return ワールド行列
-	Matrix4x4 CalculateWorldMatrix(
-		const Particle& particle,
-		BillboardType billboardType,
-		const Matrix4x4& billboardMatrix
-	);
+	// 深度ソート（作業バッファをフレーム間で使い回す）
+	ParticleDepthSorter depthSorter_;
 };
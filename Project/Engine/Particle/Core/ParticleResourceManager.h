@@ -1,62 +1,31 @@
 #pragma once
 
 #include <d3d12.h>
-#include <wrl.h>
 #include <cstdint>
-#include "MathCore.h"
-
-// 前方宣言
-class DirectXCommon;
-class ResourceFactory;
-
-/// @brief GPU送信用パーティクルデータ
-struct ParticleForGPU {
-    Matrix4x4 WVP;
-    Matrix4x4 World;
-    Vector4 color;
-};
+#include "ParticleInstanceAllocator.h" // ParticleForGPU定義のため
 
 /// @brief パーティクルシステムのリソース管理クラス
-/// GPUリソース（インスタンシングバッファ、SRV）の生成と管理を担当
+/// 共有リングアロケータ（ParticleInstanceAllocator）から毎フレーム必要数だけインスタンシング領域を取得し、
+/// 描画時に参照するGPUアドレスを保持する
 class ParticleResourceManager {
 public:
     ParticleResourceManager() = default;
     ~ParticleResourceManager() = default;
 
-    /// @brief 初期化
-    /// @param dxCommon DirectXCommon
-    /// @param resourceFactory リソースファクトリ
-    /// @param maxInstances 最大インスタンス数
-    void Initialize(DirectXCommon* dxCommon, ResourceFactory* resourceFactory, uint32_t maxInstances);
-
-    /// @brief インスタンシングデータへのポインタを取得
-    /// @return インスタンシングデータのポインタ
-    ParticleForGPU* GetInstancingData() { return instancingData_; }
+    /// @brief 今フレームのインスタンシング領域を確保
+    /// @param count 必要なインスタンス数
+    /// @return 書き込み先のポインタ（count が0の場合はnullptr）
+    ParticleForGPU* AcquireInstancingData(uint32_t count);
 
-    /// @brief SRVのGPUハンドルを取得
-    /// @return SRVのGPUディスクリプタハンドル
-    D3D12_GPU_DESCRIPTOR_HANDLE GetSrvHandleGPU() const { return srvHandleGPU_; }
+    /// @brief 今フレームに確保したインスタンス数を取得
+    /// @return インスタンス数
+    uint32_t GetAllocatedCount() const { return allocation_.count; }
 
-    /// @brief SRVのCPUハンドルを取得
-    /// @return SRVのCPUディスクリプタハンドル
-  D3D12_CPU_DESCRIPTOR_HANDLE GetSrvHandleCPU() const { return srvHandleCPU_; }
+    /// @brief インスタンシングデータのGPU仮想アドレスを取得（ルートSRV用）
+    /// @return GPU仮想アドレス
+    D3D12_GPU_VIRTUAL_ADDRESS GetInstancingGpuAddress() const { return allocation_.gpuAddress; }
 
 private:
-    /// @brief インスタンシングリソースを作成
-    /// @param maxInstances 最大インスタンス数
-    void CreateInstancingResource(uint32_t maxInstances);
-
-    /// @brief SRVを作成
-  /// @param maxInstances 最大インスタンス数
-    void CreateSRV(uint32_t maxInstances);
-
-    // DirectX関連
-    DirectXCommon* dxCommon_ = nullptr;
-    ResourceFactory* resourceFactory_ = nullptr;
-
-    // GPUリソース
-  Microsoft::WRL::ComPtr<ID3D12Resource> instancingResource_;
-    D3D12_CPU_DESCRIPTOR_HANDLE srvHandleCPU_ = {};
-    D3D12_GPU_DESCRIPTOR_HANDLE srvHandleGPU_ = {};
-    ParticleForGPU* instancingData_ = nullptr;
+    // 今フレームの割り当て結果
+    ParticleInstanceAllocation allocation_;
 };
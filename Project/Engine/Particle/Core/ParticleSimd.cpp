@@ -0,0 +1,790 @@
+#include "ParticleSimd.h"
+#include <immintrin.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+using CpuFeature::SimdLevel;
+using SizeCurve = SizeModule::SizeData::SizeCurve;
+
+namespace {
+	static_assert(sizeof(Vector3) == sizeof(float) * 3, "Vector3はfloat3要素で詰められている必要がある");
+	static_assert(sizeof(Vector4) == sizeof(float) * 4, "Vector4はfloat4要素で詰められている必要がある");
+
+	constexpr float kPi = std::numbers::pi_v<float>;
+	constexpr float kTwoPi = 2.0f * std::numbers::pi_v<float>;
+
+	// sin/cos の多項式近似（Cephes sinf/cosf の係数）
+	// 角度を π/2 単位で範囲縮小し、|r| <= π/4 の区間で評価する
+	constexpr float kTwoOverPi = 2.0f / std::numbers::pi_v<float>;
+	constexpr float kHalfPiPart1 = 1.5703125f;                  // π/2 を3分割した上位（範囲縮小の誤差を抑えるため）
+	constexpr float kHalfPiPart2 = 4.837512969970703125e-4f;
+	constexpr float kHalfPiPart3 = 7.54978995489188216e-8f;
+	constexpr float kSin0 = -1.6666654611e-1f;
+	constexpr float kSin1 = 8.3321608736e-3f;
+	constexpr float kSin2 = -1.9515295891e-4f;
+	constexpr float kCos0 = 4.166664568298827e-2f;
+	constexpr float kCos1 = -1.388731625493765e-3f;
+	constexpr float kCos2 = 2.443315711809948e-5f;
+
+	// インスタンスデータの量子化スケール
+	constexpr float kSnorm16Scale = 32767.0f;
+	constexpr float kUnorm8Scale = 255.0f;
+
+	SimdLevel& ActiveLevel() {
+		static SimdLevel level = CpuFeature::GetMaxSimdLevel();
+		return level;
+	}
+
+	float* AsFloats(Vector3* values) { return reinterpret_cast<float*>(values); }
+	const float* AsFloats(const Vector3* values) { return reinterpret_cast<const float*>(values); }
+
+	/// @brief マスクが立っているレーンはa、それ以外はb（SSE2にはblendvがないため）
+	__m128 Select(__m128 mask, __m128 a, __m128 b) {
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	// ──────────────────────────────────────────────────────────
+	// スカラー実装（フォールバック・端数処理）
+	// ──────────────────────────────────────────────────────────
+
+	void ScaleFloatsScalar(float* values, float scale, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			values[i] *= scale;
+		}
+	}
+
+	void MultiplyAddFloatsScalar(float* values, const float* rates, float deltaTime, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			values[i] += rates[i] * deltaTime;
+		}
+	}
+
+	void AddVector3Scalar(Vector3* values, const Vector3& delta, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			values[i].x += delta.x;
+			values[i].y += delta.y;
+			values[i].z += delta.z;
+		}
+	}
+
+	void ClampVector3Scalar(Vector3* values, const Vector3& minValue, const Vector3& maxValue, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			values[i].x = std::clamp(values[i].x, minValue.x, maxValue.x);
+			values[i].y = std::clamp(values[i].y, minValue.y, maxValue.y);
+			values[i].z = std::clamp(values[i].z, minValue.z, maxValue.z);
+		}
+	}
+
+	void WrapAnglesScalar(float* values, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			while (values[i] > kPi) {
+				values[i] -= kTwoPi;
+			}
+			while (values[i] < -kPi) {
+				values[i] += kTwoPi;
+			}
+		}
+	}
+
+	void CalculateLifetimeRatiosScalar(float* ratios, const float* ages, const float* lifeTimes, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			ratios[i] = lifeTimes[i] <= 0.0f ? 1.0f : std::clamp(ages[i] / lifeTimes[i], 0.0f, 1.0f);
+		}
+	}
+
+	void LerpColorsScalar(Vector4* colors, const Vector4* startColors, const Vector4& endColor, const float* ratios, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			const Vector4& start = startColors[i];
+			const float t = ratios[i];
+			colors[i] = {
+				start.x + (endColor.x - start.x) * t,
+				start.y + (endColor.y - start.y) * t,
+				start.z + (endColor.z - start.z) * t,
+				start.w + (endColor.w - start.w) * t
+			};
+		}
+	}
+
+	float EvaluateCurveScalar(float t, SizeCurve curve) {
+		switch (curve) {
+		case SizeCurve::Linear:    return t;
+		case SizeCurve::EaseIn:    return t * t;
+		case SizeCurve::EaseOut:   return 1.0f - (1.0f - t) * (1.0f - t);
+		case SizeCurve::EaseInOut: return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
+		case SizeCurve::Constant:  return 0.0f;
+		default:                   return t;
+		}
+	}
+
+	void EvaluateSizeCurveScalar(float* values, const float* ratios, SizeCurve curve, uint32_t count) {
+		for (uint32_t i = 0; i < count; ++i) {
+			values[i] = EvaluateCurveScalar(ratios[i], curve);
+		}
+	}
+
+	void LerpUniformScalesScalar(
+		Vector3* scales, const Vector3* startScales, float endSize, const float* curveValues,
+		float minSize, float maxSize, uint32_t count
+	) {
+		for (uint32_t i = 0; i < count; ++i) {
+			const float startSize = startScales[i].x;
+			float size = startSize + (endSize - startSize) * curveValues[i];
+			size = std::clamp(size, minSize, maxSize);
+			scales[i] = { size, size, size };
+		}
+	}
+
+	/// @brief sin/cosを同時に計算（SIMD版と同じ演算順序）
+	void SinCosScalar(float x, float& outSin, float& outCos) {
+		// x = k * π/2 + r に分解し、象限 k に応じてsin/cosを入れ替える
+		const int32_t k = static_cast<int32_t>(std::nearbyint(x * kTwoOverPi));
+		const float kf = static_cast<float>(k);
+		const float r = ((x - kf * kHalfPiPart1) - kf * kHalfPiPart2) - kf * kHalfPiPart3;
+		const float r2 = r * r;
+		const float sinR = r + (r * r2) * (kSin0 + r2 * (kSin1 + r2 * kSin2));
+		const float cosR = (1.0f - 0.5f * r2) + (r2 * r2) * (kCos0 + r2 * (kCos1 + r2 * kCos2));
+
+		const uint32_t quadrant = static_cast<uint32_t>(k) & 3;
+		const float s = (quadrant & 1) ? cosR : sinR;
+		const float c = (quadrant & 1) ? sinR : cosR;
+		outSin = (quadrant & 2) ? -s : s;
+		outCos = ((quadrant + 1) & 2) ? -c : c;
+	}
+
+	/// @brief オイラー角（Matrix::MakeAffineと同じX→Y→Zの順に回転）をクォータニオン xyzw に変換
+	void EulerToQuaternionScalar(const Vector3& rotate, float quaternion[4]) {
+		float sx, cx, sy, cy, sz, cz;
+		SinCosScalar(rotate.x * 0.5f, sx, cx);
+		SinCosScalar(rotate.y * 0.5f, sy, cy);
+		SinCosScalar(rotate.z * 0.5f, sz, cz);
+
+		const float a = cy * cz;
+		const float b = sy * sz;
+		const float c = sy * cz;
+		const float d = cy * sz;
+		quaternion[0] = sx * a - cx * b;
+		quaternion[1] = cx * c + sx * d;
+		quaternion[2] = cx * d - sx * c;
+		quaternion[3] = cx * a + sx * b;
+	}
+
+	/// @brief 2成分をSNORM16に量子化して下位16bit・上位16bitに詰める
+	uint32_t PackSnorm16x2Scalar(float low, float high) {
+		const int32_t l = static_cast<int32_t>(std::nearbyint(std::clamp(low, -1.0f, 1.0f) * kSnorm16Scale));
+		const int32_t h = static_cast<int32_t>(std::nearbyint(std::clamp(high, -1.0f, 1.0f) * kSnorm16Scale));
+		return (static_cast<uint32_t>(l) & 0xFFFFu) | (static_cast<uint32_t>(h) << 16);
+	}
+
+	/// @brief 色をRGBA8 UNORMに量子化（Rが最下位バイト）
+	uint32_t PackColorScalar(const Vector4& color) {
+		auto toByte = [](float value) {
+			return static_cast<uint32_t>(std::nearbyint(std::clamp(value, 0.0f, 1.0f) * kUnorm8Scale));
+		};
+		return toByte(color.x) | (toByte(color.y) << 8) | (toByte(color.z) << 16) | (toByte(color.w) << 24);
+	}
+
+	/// @brief インスタンスデータを書き込む
+	/// 書き込み先はアップロードヒープ（ライトコンバインメモリ）のため、読み戻さずに先頭から順に埋める
+	void WriteInstance(
+		ParticleForGPU& instance, const Vector3& position, const Vector3& scale,
+		uint32_t color, uint32_t rotationXY, uint32_t rotationZW
+	) {
+		instance.position = position;
+		instance.color = color;
+		instance.scale = scale;
+		instance.rotation[0] = rotationXY;
+		instance.rotation[1] = rotationZW;
+	}
+
+	void PackInstancesScalar(
+		ParticleForGPU* instances, const Vector3* positions, const Vector3* rotations,
+		const Vector3* scales, const Vector4* colors, uint32_t count
+	) {
+		for (uint32_t i = 0; i < count; ++i) {
+			float quaternion[4];
+			EulerToQuaternionScalar(rotations[i], quaternion);
+			WriteInstance(
+				instances[i], positions[i], scales[i], PackColorScalar(colors[i]),
+				PackSnorm16x2Scalar(quaternion[0], quaternion[1]),
+				PackSnorm16x2Scalar(quaternion[2], quaternion[3]));
+		}
+	}
+
+	// ──────────────────────────────────────────────────────────
+	// SSE2実装（4要素単位）
+	// ──────────────────────────────────────────────────────────
+
+	void ScaleFloatsSSE2(float* values, float scale, uint32_t count) {
+		const __m128 s = _mm_set1_ps(scale);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			_mm_storeu_ps(values + i, _mm_mul_ps(_mm_loadu_ps(values + i), s));
+		}
+		ScaleFloatsScalar(values + i, scale, count - i);
+	}
+
+	void MultiplyAddFloatsSSE2(float* values, const float* rates, float deltaTime, uint32_t count) {
+		const __m128 dt = _mm_set1_ps(deltaTime);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128 v = _mm_loadu_ps(values + i);
+			__m128 r = _mm_loadu_ps(rates + i);
+			_mm_storeu_ps(values + i, _mm_add_ps(v, _mm_mul_ps(r, dt)));
+		}
+		MultiplyAddFloatsScalar(values + i, rates + i, deltaTime, count - i);
+	}
+
+	// Vector3配列は4要素（float12個）ごとに xyzx / yzxy / zxyz の周期で並ぶ
+	void AddVector3SSE2(Vector3* values, const Vector3& delta, uint32_t count) {
+		const __m128 d0 = _mm_setr_ps(delta.x, delta.y, delta.z, delta.x);
+		const __m128 d1 = _mm_setr_ps(delta.y, delta.z, delta.x, delta.y);
+		const __m128 d2 = _mm_setr_ps(delta.z, delta.x, delta.y, delta.z);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			float* p = AsFloats(values + i);
+			_mm_storeu_ps(p + 0, _mm_add_ps(_mm_loadu_ps(p + 0), d0));
+			_mm_storeu_ps(p + 4, _mm_add_ps(_mm_loadu_ps(p + 4), d1));
+			_mm_storeu_ps(p + 8, _mm_add_ps(_mm_loadu_ps(p + 8), d2));
+		}
+		AddVector3Scalar(values + i, delta, count - i);
+	}
+
+	void ClampVector3SSE2(Vector3* values, const Vector3& minValue, const Vector3& maxValue, uint32_t count) {
+		const __m128 lo0 = _mm_setr_ps(minValue.x, minValue.y, minValue.z, minValue.x);
+		const __m128 lo1 = _mm_setr_ps(minValue.y, minValue.z, minValue.x, minValue.y);
+		const __m128 lo2 = _mm_setr_ps(minValue.z, minValue.x, minValue.y, minValue.z);
+		const __m128 hi0 = _mm_setr_ps(maxValue.x, maxValue.y, maxValue.z, maxValue.x);
+		const __m128 hi1 = _mm_setr_ps(maxValue.y, maxValue.z, maxValue.x, maxValue.y);
+		const __m128 hi2 = _mm_setr_ps(maxValue.z, maxValue.x, maxValue.y, maxValue.z);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			// std::clampと同じ比較順序になるよう、定数側を第1引数に置く
+			float* p = AsFloats(values + i);
+			_mm_storeu_ps(p + 0, _mm_min_ps(hi0, _mm_max_ps(lo0, _mm_loadu_ps(p + 0))));
+			_mm_storeu_ps(p + 4, _mm_min_ps(hi1, _mm_max_ps(lo1, _mm_loadu_ps(p + 4))));
+			_mm_storeu_ps(p + 8, _mm_min_ps(hi2, _mm_max_ps(lo2, _mm_loadu_ps(p + 8))));
+		}
+		ClampVector3Scalar(values + i, minValue, maxValue, count - i);
+	}
+
+	void WrapAnglesSSE2(float* values, uint32_t count) {
+		const __m128 pi = _mm_set1_ps(kPi);
+		const __m128 negativePi = _mm_set1_ps(-kPi);
+		const __m128 twoPi = _mm_set1_ps(kTwoPi);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128 angle = _mm_loadu_ps(values + i);
+			for (;;) {
+				__m128 over = _mm_cmpgt_ps(angle, pi);
+				__m128 under = _mm_cmplt_ps(angle, negativePi);
+				if (_mm_movemask_ps(_mm_or_ps(over, under)) == 0) {
+					break;
+				}
+				angle = Select(over, _mm_sub_ps(angle, twoPi), angle);
+				angle = Select(under, _mm_add_ps(angle, twoPi), angle);
+			}
+			_mm_storeu_ps(values + i, angle);
+		}
+		WrapAnglesScalar(values + i, count - i);
+	}
+
+	void CalculateLifetimeRatiosSSE2(float* ratios, const float* ages, const float* lifeTimes, uint32_t count) {
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128 life = _mm_loadu_ps(lifeTimes + i);
+			__m128 ratio = _mm_div_ps(_mm_loadu_ps(ages + i), life);
+			ratio = _mm_min_ps(one, _mm_max_ps(zero, ratio));
+			ratio = Select(_mm_cmple_ps(life, zero), one, ratio);
+			_mm_storeu_ps(ratios + i, ratio);
+		}
+		CalculateLifetimeRatiosScalar(ratios + i, ages + i, lifeTimes + i, count - i);
+	}
+
+	void LerpColorsSSE2(Vector4* colors, const Vector4* startColors, const Vector4& endColor, const float* ratios, uint32_t count) {
+		const __m128 end = _mm_loadu_ps(&endColor.x);
+		for (uint32_t i = 0; i < count; ++i) {
+			__m128 start = _mm_loadu_ps(&startColors[i].x);
+			__m128 t = _mm_set1_ps(ratios[i]);
+			_mm_storeu_ps(&colors[i].x, _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(end, start), t)));
+		}
+	}
+
+	void EvaluateSizeCurveSSE2(float* values, const float* ratios, SizeCurve curve, uint32_t count) {
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			__m128 t = _mm_loadu_ps(ratios + i);
+			__m128 u = _mm_sub_ps(one, t);
+			__m128 result;
+			switch (curve) {
+			case SizeCurve::EaseIn:
+				result = _mm_mul_ps(t, t);
+				break;
+			case SizeCurve::EaseOut:
+				result = _mm_sub_ps(one, _mm_mul_ps(u, u));
+				break;
+			case SizeCurve::EaseInOut:
+				result = Select(
+					_mm_cmplt_ps(t, half),
+					_mm_mul_ps(_mm_mul_ps(two, t), t),
+					_mm_sub_ps(one, _mm_mul_ps(_mm_mul_ps(two, u), u))
+				);
+				break;
+			case SizeCurve::Constant:
+				result = _mm_setzero_ps();
+				break;
+			case SizeCurve::Linear:
+			default:
+				result = t;
+				break;
+			}
+			_mm_storeu_ps(values + i, result);
+		}
+		EvaluateSizeCurveScalar(values + i, ratios + i, curve, count - i);
+	}
+
+	void LerpUniformScalesSSE2(
+		Vector3* scales, const Vector3* startScales, float endSize, const float* curveValues,
+		float minSize, float maxSize, uint32_t count
+	) {
+		const __m128 end = _mm_set1_ps(endSize);
+		const __m128 lo = _mm_set1_ps(minSize);
+		const __m128 hi = _mm_set1_ps(maxSize);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			// 4要素分の初期スケールから x 成分だけを取り出す
+			const float* src = AsFloats(startScales + i);
+			__m128 a = _mm_loadu_ps(src + 0); // x0 y0 z0 x1
+			__m128 b = _mm_loadu_ps(src + 4); // y1 z1 x2 y2
+			__m128 c = _mm_loadu_ps(src + 8); // z2 x3 y3 z3
+			__m128 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)); // x2 x2 x3 x3
+			__m128 start = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0)); // x0 x1 x2 x3
+
+			__m128 size = _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(end, start), _mm_loadu_ps(curveValues + i)));
+			size = _mm_min_ps(hi, _mm_max_ps(lo, size));
+
+			// s0 s0 s0 s1 | s1 s1 s2 s2 | s2 s3 s3 s3 の順に書き戻す
+			float* dst = AsFloats(scales + i);
+			_mm_storeu_ps(dst + 0, _mm_shuffle_ps(size, size, _MM_SHUFFLE(1, 0, 0, 0)));
+			_mm_storeu_ps(dst + 4, _mm_shuffle_ps(size, size, _MM_SHUFFLE(2, 2, 1, 1)));
+			_mm_storeu_ps(dst + 8, _mm_shuffle_ps(size, size, _MM_SHUFFLE(3, 3, 3, 2)));
+		}
+		LerpUniformScalesScalar(scales + i, startScales + i, endSize, curveValues + i, minSize, maxSize, count - i);
+	}
+
+	/// @brief 4レーン分のsin/cos（SinCosScalarと同じ演算順序）
+	void SinCosSSE2(__m128 x, __m128& outSin, __m128& outCos) {
+		const __m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(kTwoOverPi)));
+		const __m128 kf = _mm_cvtepi32_ps(k);
+		__m128 r = _mm_sub_ps(x, _mm_mul_ps(kf, _mm_set1_ps(kHalfPiPart1)));
+		r = _mm_sub_ps(r, _mm_mul_ps(kf, _mm_set1_ps(kHalfPiPart2)));
+		r = _mm_sub_ps(r, _mm_mul_ps(kf, _mm_set1_ps(kHalfPiPart3)));
+		const __m128 r2 = _mm_mul_ps(r, r);
+
+		__m128 sinPoly = _mm_add_ps(_mm_set1_ps(kSin1), _mm_mul_ps(r2, _mm_set1_ps(kSin2)));
+		sinPoly = _mm_add_ps(_mm_set1_ps(kSin0), _mm_mul_ps(r2, sinPoly));
+		const __m128 sinR = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), sinPoly));
+
+		__m128 cosPoly = _mm_add_ps(_mm_set1_ps(kCos1), _mm_mul_ps(r2, _mm_set1_ps(kCos2)));
+		cosPoly = _mm_add_ps(_mm_set1_ps(kCos0), _mm_mul_ps(r2, cosPoly));
+		const __m128 cosR = _mm_add_ps(
+			_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)),
+			_mm_mul_ps(_mm_mul_ps(r2, r2), cosPoly));
+
+		// 象限の bit0 でsin/cosを入れ替え、bit1 を符号ビットに移して反転する
+		const __m128i one = _mm_set1_epi32(1);
+		const __m128i two = _mm_set1_epi32(2);
+		const __m128i quadrant = _mm_and_si128(k, _mm_set1_epi32(3));
+		const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+		const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+		const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+		outSin = _mm_xor_ps(Select(swap, cosR, sinR), sinSign);
+		outCos = _mm_xor_ps(Select(swap, sinR, cosR), cosSign);
+	}
+
+	/// @brief 2成分をSNORM16に量子化して下位16bit・上位16bitに詰める
+	__m128i PackSnorm16x2SSE2(__m128 low, __m128 high) {
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 negativeOne = _mm_set1_ps(-1.0f);
+		const __m128 scale = _mm_set1_ps(kSnorm16Scale);
+		const __m128i l = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(one, _mm_max_ps(negativeOne, low)), scale));
+		const __m128i h = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(one, _mm_max_ps(negativeOne, high)), scale));
+		return _mm_or_si128(_mm_and_si128(l, _mm_set1_epi32(0xFFFF)), _mm_slli_epi32(h, 16));
+	}
+
+	/// @brief 色をRGBA8 UNORMに量子化（1色 = 1レジスタで処理）
+	uint32_t PackColorSSE2(const Vector4& color) {
+		const __m128 clamped = _mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), _mm_loadu_ps(&color.x)));
+		__m128i bytes = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(kUnorm8Scale)));
+		bytes = _mm_packs_epi32(bytes, bytes);
+		bytes = _mm_packus_epi16(bytes, bytes);
+		return static_cast<uint32_t>(_mm_cvtsi128_si32(bytes));
+	}
+
+	void PackInstancesSSE2(
+		ParticleForGPU* instances, const Vector3* positions, const Vector3* rotations,
+		const Vector3* scales, const Vector4* colors, uint32_t count
+	) {
+		const __m128 half = _mm_set1_ps(0.5f);
+		uint32_t i = 0;
+		for (; i + 4 <= count; i += 4) {
+			const Vector3* r = rotations + i;
+			__m128 sx, cx, sy, cy, sz, cz;
+			SinCosSSE2(_mm_mul_ps(_mm_setr_ps(r[0].x, r[1].x, r[2].x, r[3].x), half), sx, cx);
+			SinCosSSE2(_mm_mul_ps(_mm_setr_ps(r[0].y, r[1].y, r[2].y, r[3].y), half), sy, cy);
+			SinCosSSE2(_mm_mul_ps(_mm_setr_ps(r[0].z, r[1].z, r[2].z, r[3].z), half), sz, cz);
+
+			const __m128 a = _mm_mul_ps(cy, cz);
+			const __m128 b = _mm_mul_ps(sy, sz);
+			const __m128 c = _mm_mul_ps(sy, cz);
+			const __m128 d = _mm_mul_ps(cy, sz);
+			const __m128 qx = _mm_sub_ps(_mm_mul_ps(sx, a), _mm_mul_ps(cx, b));
+			const __m128 qy = _mm_add_ps(_mm_mul_ps(cx, c), _mm_mul_ps(sx, d));
+			const __m128 qz = _mm_sub_ps(_mm_mul_ps(cx, d), _mm_mul_ps(sx, c));
+			const __m128 qw = _mm_add_ps(_mm_mul_ps(cx, a), _mm_mul_ps(sx, b));
+
+			alignas(16) uint32_t rotationXY[4];
+			alignas(16) uint32_t rotationZW[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(rotationXY), PackSnorm16x2SSE2(qx, qy));
+			_mm_store_si128(reinterpret_cast<__m128i*>(rotationZW), PackSnorm16x2SSE2(qz, qw));
+
+			for (uint32_t j = 0; j < 4; ++j) {
+				WriteInstance(
+					instances[i + j], positions[i + j], scales[i + j], PackColorSSE2(colors[i + j]),
+					rotationXY[j], rotationZW[j]);
+			}
+		}
+		PackInstancesScalar(instances + i, positions + i, rotations + i, scales + i, colors + i, count - i);
+	}
+
+	// ──────────────────────────────────────────────────────────
+	// AVX2実装（8要素単位、端数はSSE2実装に委譲）
+	// ──────────────────────────────────────────────────────────
+
+	void ScaleFloatsAVX2(float* values, float scale, uint32_t count) {
+		const __m256 s = _mm256_set1_ps(scale);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			_mm256_storeu_ps(values + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), s));
+		}
+		ScaleFloatsSSE2(values + i, scale, count - i);
+	}
+
+	void MultiplyAddFloatsAVX2(float* values, const float* rates, float deltaTime, uint32_t count) {
+		const __m256 dt = _mm256_set1_ps(deltaTime);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256 v = _mm256_loadu_ps(values + i);
+			__m256 r = _mm256_loadu_ps(rates + i);
+			_mm256_storeu_ps(values + i, _mm256_add_ps(v, _mm256_mul_ps(r, dt)));
+		}
+		MultiplyAddFloatsSSE2(values + i, rates + i, deltaTime, count - i);
+	}
+
+	// Vector3配列は8要素（float24個）ごとに xyzxyzxy / zxyzxyzx / yzxyzxyz の周期で並ぶ
+	void AddVector3AVX2(Vector3* values, const Vector3& delta, uint32_t count) {
+		const __m256 d0 = _mm256_setr_ps(delta.x, delta.y, delta.z, delta.x, delta.y, delta.z, delta.x, delta.y);
+		const __m256 d1 = _mm256_setr_ps(delta.z, delta.x, delta.y, delta.z, delta.x, delta.y, delta.z, delta.x);
+		const __m256 d2 = _mm256_setr_ps(delta.y, delta.z, delta.x, delta.y, delta.z, delta.x, delta.y, delta.z);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			float* p = AsFloats(values + i);
+			_mm256_storeu_ps(p + 0, _mm256_add_ps(_mm256_loadu_ps(p + 0), d0));
+			_mm256_storeu_ps(p + 8, _mm256_add_ps(_mm256_loadu_ps(p + 8), d1));
+			_mm256_storeu_ps(p + 16, _mm256_add_ps(_mm256_loadu_ps(p + 16), d2));
+		}
+		AddVector3SSE2(values + i, delta, count - i);
+	}
+
+	void ClampVector3AVX2(Vector3* values, const Vector3& minValue, const Vector3& maxValue, uint32_t count) {
+		const __m256 lo0 = _mm256_setr_ps(minValue.x, minValue.y, minValue.z, minValue.x, minValue.y, minValue.z, minValue.x, minValue.y);
+		const __m256 lo1 = _mm256_setr_ps(minValue.z, minValue.x, minValue.y, minValue.z, minValue.x, minValue.y, minValue.z, minValue.x);
+		const __m256 lo2 = _mm256_setr_ps(minValue.y, minValue.z, minValue.x, minValue.y, minValue.z, minValue.x, minValue.y, minValue.z);
+		const __m256 hi0 = _mm256_setr_ps(maxValue.x, maxValue.y, maxValue.z, maxValue.x, maxValue.y, maxValue.z, maxValue.x, maxValue.y);
+		const __m256 hi1 = _mm256_setr_ps(maxValue.z, maxValue.x, maxValue.y, maxValue.z, maxValue.x, maxValue.y, maxValue.z, maxValue.x);
+		const __m256 hi2 = _mm256_setr_ps(maxValue.y, maxValue.z, maxValue.x, maxValue.y, maxValue.z, maxValue.x, maxValue.y, maxValue.z);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			float* p = AsFloats(values + i);
+			_mm256_storeu_ps(p + 0, _mm256_min_ps(hi0, _mm256_max_ps(lo0, _mm256_loadu_ps(p + 0))));
+			_mm256_storeu_ps(p + 8, _mm256_min_ps(hi1, _mm256_max_ps(lo1, _mm256_loadu_ps(p + 8))));
+			_mm256_storeu_ps(p + 16, _mm256_min_ps(hi2, _mm256_max_ps(lo2, _mm256_loadu_ps(p + 16))));
+		}
+		ClampVector3SSE2(values + i, minValue, maxValue, count - i);
+	}
+
+	void WrapAnglesAVX2(float* values, uint32_t count) {
+		const __m256 pi = _mm256_set1_ps(kPi);
+		const __m256 negativePi = _mm256_set1_ps(-kPi);
+		const __m256 twoPi = _mm256_set1_ps(kTwoPi);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256 angle = _mm256_loadu_ps(values + i);
+			for (;;) {
+				__m256 over = _mm256_cmp_ps(angle, pi, _CMP_GT_OQ);
+				__m256 under = _mm256_cmp_ps(angle, negativePi, _CMP_LT_OQ);
+				if (_mm256_movemask_ps(_mm256_or_ps(over, under)) == 0) {
+					break;
+				}
+				angle = _mm256_blendv_ps(angle, _mm256_sub_ps(angle, twoPi), over);
+				angle = _mm256_blendv_ps(angle, _mm256_add_ps(angle, twoPi), under);
+			}
+			_mm256_storeu_ps(values + i, angle);
+		}
+		WrapAnglesSSE2(values + i, count - i);
+	}
+
+	void CalculateLifetimeRatiosAVX2(float* ratios, const float* ages, const float* lifeTimes, uint32_t count) {
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256 life = _mm256_loadu_ps(lifeTimes + i);
+			__m256 ratio = _mm256_div_ps(_mm256_loadu_ps(ages + i), life);
+			ratio = _mm256_min_ps(one, _mm256_max_ps(zero, ratio));
+			ratio = _mm256_blendv_ps(ratio, one, _mm256_cmp_ps(life, zero, _CMP_LE_OQ));
+			_mm256_storeu_ps(ratios + i, ratio);
+		}
+		CalculateLifetimeRatiosSSE2(ratios + i, ages + i, lifeTimes + i, count - i);
+	}
+
+	void LerpColorsAVX2(Vector4* colors, const Vector4* startColors, const Vector4& endColor, const float* ratios, uint32_t count) {
+		const __m128 end128 = _mm_loadu_ps(&endColor.x);
+		const __m256 end = _mm256_set_m128(end128, end128);
+		uint32_t i = 0;
+		for (; i + 2 <= count; i += 2) {
+			__m256 start = _mm256_loadu_ps(&startColors[i].x);
+			__m256 t = _mm256_set_m128(_mm_set1_ps(ratios[i + 1]), _mm_set1_ps(ratios[i]));
+			_mm256_storeu_ps(&colors[i].x, _mm256_add_ps(start, _mm256_mul_ps(_mm256_sub_ps(end, start), t)));
+		}
+		LerpColorsSSE2(colors + i, startColors + i, endColor, ratios + i, count - i);
+	}
+
+	void EvaluateSizeCurveAVX2(float* values, const float* ratios, SizeCurve curve, uint32_t count) {
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 two = _mm256_set1_ps(2.0f);
+		const __m256 half = _mm256_set1_ps(0.5f);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			__m256 t = _mm256_loadu_ps(ratios + i);
+			__m256 u = _mm256_sub_ps(one, t);
+			__m256 result;
+			switch (curve) {
+			case SizeCurve::EaseIn:
+				result = _mm256_mul_ps(t, t);
+				break;
+			case SizeCurve::EaseOut:
+				result = _mm256_sub_ps(one, _mm256_mul_ps(u, u));
+				break;
+			case SizeCurve::EaseInOut:
+				result = _mm256_blendv_ps(
+					_mm256_sub_ps(one, _mm256_mul_ps(_mm256_mul_ps(two, u), u)),
+					_mm256_mul_ps(_mm256_mul_ps(two, t), t),
+					_mm256_cmp_ps(t, half, _CMP_LT_OQ)
+				);
+				break;
+			case SizeCurve::Constant:
+				result = _mm256_setzero_ps();
+				break;
+			case SizeCurve::Linear:
+			default:
+				result = t;
+				break;
+			}
+			_mm256_storeu_ps(values + i, result);
+		}
+		EvaluateSizeCurveSSE2(values + i, ratios + i, curve, count - i);
+	}
+
+	/// @brief 8レーン分のsin/cos（SinCosScalarと同じ演算順序）
+	void SinCosAVX2(__m256 x, __m256& outSin, __m256& outCos) {
+		const __m256i k = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(kTwoOverPi)));
+		const __m256 kf = _mm256_cvtepi32_ps(k);
+		__m256 r = _mm256_sub_ps(x, _mm256_mul_ps(kf, _mm256_set1_ps(kHalfPiPart1)));
+		r = _mm256_sub_ps(r, _mm256_mul_ps(kf, _mm256_set1_ps(kHalfPiPart2)));
+		r = _mm256_sub_ps(r, _mm256_mul_ps(kf, _mm256_set1_ps(kHalfPiPart3)));
+		const __m256 r2 = _mm256_mul_ps(r, r);
+
+		__m256 sinPoly = _mm256_add_ps(_mm256_set1_ps(kSin1), _mm256_mul_ps(r2, _mm256_set1_ps(kSin2)));
+		sinPoly = _mm256_add_ps(_mm256_set1_ps(kSin0), _mm256_mul_ps(r2, sinPoly));
+		const __m256 sinR = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), sinPoly));
+
+		__m256 cosPoly = _mm256_add_ps(_mm256_set1_ps(kCos1), _mm256_mul_ps(r2, _mm256_set1_ps(kCos2)));
+		cosPoly = _mm256_add_ps(_mm256_set1_ps(kCos0), _mm256_mul_ps(r2, cosPoly));
+		const __m256 cosR = _mm256_add_ps(
+			_mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), r2)),
+			_mm256_mul_ps(_mm256_mul_ps(r2, r2), cosPoly));
+
+		const __m256i one = _mm256_set1_epi32(1);
+		const __m256i two = _mm256_set1_epi32(2);
+		const __m256i quadrant = _mm256_and_si256(k, _mm256_set1_epi32(3));
+		const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+		const __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+		const __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+		outSin = _mm256_xor_ps(_mm256_blendv_ps(sinR, cosR, swap), sinSign);
+		outCos = _mm256_xor_ps(_mm256_blendv_ps(cosR, sinR, swap), cosSign);
+	}
+
+	__m256i PackSnorm16x2AVX2(__m256 low, __m256 high) {
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 negativeOne = _mm256_set1_ps(-1.0f);
+		const __m256 scale = _mm256_set1_ps(kSnorm16Scale);
+		const __m256i l = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(one, _mm256_max_ps(negativeOne, low)), scale));
+		const __m256i h = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(one, _mm256_max_ps(negativeOne, high)), scale));
+		return _mm256_or_si256(_mm256_and_si256(l, _mm256_set1_epi32(0xFFFF)), _mm256_slli_epi32(h, 16));
+	}
+
+	// 回転はVector3配列からストライド3でギャザーし、色の量子化は1色ずつSSE2で行う
+	void PackInstancesAVX2(
+		ParticleForGPU* instances, const Vector3* positions, const Vector3* rotations,
+		const Vector3* scales, const Vector4* colors, uint32_t count
+	) {
+		const __m256 half = _mm256_set1_ps(0.5f);
+		const __m256i stride = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+		uint32_t i = 0;
+		for (; i + 8 <= count; i += 8) {
+			const float* r = AsFloats(rotations + i);
+			__m256 sx, cx, sy, cy, sz, cz;
+			SinCosAVX2(_mm256_mul_ps(_mm256_i32gather_ps(r + 0, stride, 4), half), sx, cx);
+			SinCosAVX2(_mm256_mul_ps(_mm256_i32gather_ps(r + 1, stride, 4), half), sy, cy);
+			SinCosAVX2(_mm256_mul_ps(_mm256_i32gather_ps(r + 2, stride, 4), half), sz, cz);
+
+			const __m256 a = _mm256_mul_ps(cy, cz);
+			const __m256 b = _mm256_mul_ps(sy, sz);
+			const __m256 c = _mm256_mul_ps(sy, cz);
+			const __m256 d = _mm256_mul_ps(cy, sz);
+			const __m256 qx = _mm256_sub_ps(_mm256_mul_ps(sx, a), _mm256_mul_ps(cx, b));
+			const __m256 qy = _mm256_add_ps(_mm256_mul_ps(cx, c), _mm256_mul_ps(sx, d));
+			const __m256 qz = _mm256_sub_ps(_mm256_mul_ps(cx, d), _mm256_mul_ps(sx, c));
+			const __m256 qw = _mm256_add_ps(_mm256_mul_ps(cx, a), _mm256_mul_ps(sx, b));
+
+			alignas(32) uint32_t rotationXY[8];
+			alignas(32) uint32_t rotationZW[8];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(rotationXY), PackSnorm16x2AVX2(qx, qy));
+			_mm256_store_si256(reinterpret_cast<__m256i*>(rotationZW), PackSnorm16x2AVX2(qz, qw));
+
+			for (uint32_t j = 0; j < 8; ++j) {
+				WriteInstance(
+					instances[i + j], positions[i + j], scales[i + j], PackColorSSE2(colors[i + j]),
+					rotationXY[j], rotationZW[j]);
+			}
+		}
+		PackInstancesSSE2(instances + i, positions + i, rotations + i, scales + i, colors + i, count - i);
+	}
+}
+
+namespace ParticleSimd {
+
+CpuFeature::SimdLevel GetSimdLevel() {
+	return ActiveLevel();
+}
+
+void SetSimdLevel(CpuFeature::SimdLevel level) {
+	if (level == SimdLevel::AVX2 && !CpuFeature::HasAVX2()) {
+		level = CpuFeature::GetMaxSimdLevel();
+	}
+	ActiveLevel() = level;
+}
+
+void AddVector3(Vector3* values, const Vector3& delta, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: AddVector3AVX2(values, delta, count); break;
+	case SimdLevel::SSE2: AddVector3SSE2(values, delta, count); break;
+	default:              AddVector3Scalar(values, delta, count); break;
+	}
+}
+
+void ScaleVector3(Vector3* values, float scale, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: ScaleFloatsAVX2(AsFloats(values), scale, count * 3); break;
+	case SimdLevel::SSE2: ScaleFloatsSSE2(AsFloats(values), scale, count * 3); break;
+	default:              ScaleFloatsScalar(AsFloats(values), scale, count * 3); break;
+	}
+}
+
+void MultiplyAddVector3(Vector3* values, const Vector3* rates, float deltaTime, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: MultiplyAddFloatsAVX2(AsFloats(values), AsFloats(rates), deltaTime, count * 3); break;
+	case SimdLevel::SSE2: MultiplyAddFloatsSSE2(AsFloats(values), AsFloats(rates), deltaTime, count * 3); break;
+	default:              MultiplyAddFloatsScalar(AsFloats(values), AsFloats(rates), deltaTime, count * 3); break;
+	}
+}
+
+void ClampVector3(Vector3* values, const Vector3& minValue, const Vector3& maxValue, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: ClampVector3AVX2(values, minValue, maxValue, count); break;
+	case SimdLevel::SSE2: ClampVector3SSE2(values, minValue, maxValue, count); break;
+	default:              ClampVector3Scalar(values, minValue, maxValue, count); break;
+	}
+}
+
+void WrapAnglesVector3(Vector3* values, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: WrapAnglesAVX2(AsFloats(values), count * 3); break;
+	case SimdLevel::SSE2: WrapAnglesSSE2(AsFloats(values), count * 3); break;
+	default:              WrapAnglesScalar(AsFloats(values), count * 3); break;
+	}
+}
+
+void CalculateLifetimeRatios(float* ratios, const float* ages, const float* lifeTimes, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: CalculateLifetimeRatiosAVX2(ratios, ages, lifeTimes, count); break;
+	case SimdLevel::SSE2: CalculateLifetimeRatiosSSE2(ratios, ages, lifeTimes, count); break;
+	default:              CalculateLifetimeRatiosScalar(ratios, ages, lifeTimes, count); break;
+	}
+}
+
+void LerpColors(Vector4* colors, const Vector4* startColors, const Vector4& endColor, const float* ratios, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: LerpColorsAVX2(colors, startColors, endColor, ratios, count); break;
+	case SimdLevel::SSE2: LerpColorsSSE2(colors, startColors, endColor, ratios, count); break;
+	default:              LerpColorsScalar(colors, startColors, endColor, ratios, count); break;
+	}
+}
+
+void EvaluateSizeCurve(float* values, const float* ratios, SizeModule::SizeData::SizeCurve curve, uint32_t count) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: EvaluateSizeCurveAVX2(values, ratios, curve, count); break;
+	case SimdLevel::SSE2: EvaluateSizeCurveSSE2(values, ratios, curve, count); break;
+	default:              EvaluateSizeCurveScalar(values, ratios, curve, count); break;
+	}
+}
+
+void LerpUniformScales(
+	Vector3* scales,
+	const Vector3* startScales,
+	float endSize,
+	const float* curveValues,
+	float minSize,
+	float maxSize,
+	uint32_t count
+) {
+	// x成分の抽出と3成分への展開がシャッフル主体のため、AVX2でも128bit実装を使用する
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2:
+	case SimdLevel::SSE2: LerpUniformScalesSSE2(scales, startScales, endSize, curveValues, minSize, maxSize, count); break;
+	default:              LerpUniformScalesScalar(scales, startScales, endSize, curveValues, minSize, maxSize, count); break;
+	}
+}
+
+void PackInstances(
+	ParticleForGPU* instances,
+	const Vector3* positions,
+	const Vector3* rotations,
+	const Vector3* scales,
+	const Vector4* colors,
+	uint32_t count
+) {
+	switch (ActiveLevel()) {
+	case SimdLevel::AVX2: PackInstancesAVX2(instances, positions, rotations, scales, colors, count); break;
+	case SimdLevel::SSE2: PackInstancesSSE2(instances, positions, rotations, scales, colors, count); break;
+	default:              PackInstancesScalar(instances, positions, rotations, scales, colors, count); break;
+	}
+}
+
+} // namespace ParticleSimd
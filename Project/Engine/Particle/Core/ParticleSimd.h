@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include "MathCore.h"
+#include "Engine/Particle/Modules/SizeModule.h"
+#include "Engine/Utility/CpuFeature/CpuFeature.h"
+#include "ParticleGPUData.h"
+
+/// @brief パーティクル更新用のSIMDバッチカーネル
+/// SSE2/AVX2で4〜8要素を同時に処理し、端数や非対応CPUではスカラー実装にフォールバックする
+/// 各レベルは同じ演算順序（FMA不使用）で実装しているため、結果はスカラー版とビット単位で一致する
+namespace ParticleSimd {
+
+/// @brief 使用中のSIMDレベルを取得（初期値はCPUが対応する最上位）
+CpuFeature::SimdLevel GetSimdLevel();
+
+/// @brief 使用するSIMDレベルを設定（ベンチマーク・検証用）
+/// @param level SIMDレベル（CPUが対応していない場合は対応する最上位に丸める）
+void SetSimdLevel(CpuFeature::SimdLevel level);
+
+/// @brief values[i] += delta
+void AddVector3(Vector3* values, const Vector3& delta, uint32_t count);
+
+/// @brief values[i] *= scale
+void ScaleVector3(Vector3* values, float scale, uint32_t count);
+
+/// @brief values[i] += rates[i] * deltaTime（位置・回転の積分）
+void MultiplyAddVector3(Vector3* values, const Vector3* rates, float deltaTime, uint32_t count);
+
+/// @brief values[i] を成分ごとに [minValue, maxValue] に制限
+void ClampVector3(Vector3* values, const Vector3& minValue, const Vector3& maxValue, uint32_t count);
+
+/// @brief values[i] の各成分を -π〜π の範囲に正規化
+void WrapAnglesVector3(Vector3* values, uint32_t count);
+
+/// @brief ratios[i] = clamp(ages[i] / lifeTimes[i], 0, 1)（寿命0以下は1）
+void CalculateLifetimeRatios(float* ratios, const float* ages, const float* lifeTimes, uint32_t count);
+
+/// @brief colors[i] = lerp(startColors[i], endColor, ratios[i])
+void LerpColors(Vector4* colors, const Vector4* startColors, const Vector4& endColor, const float* ratios, uint32_t count);
+
+/// @brief values[i] = curve(ratios[i])
+void EvaluateSizeCurve(float* values, const float* ratios, SizeModule::SizeData::SizeCurve curve, uint32_t count);
+
+/// @brief scales[i] = 均等スケール clamp(lerp(startScales[i].x, endSize, curveValues[i]), minSize, maxSize)
+void LerpUniformScales(
+	Vector3* scales,
+	const Vector3* startScales,
+	float endSize,
+	const float* curveValues,
+	float minSize,
+	float maxSize,
+	uint32_t count
+);
+
+/// @brief 描画用のインスタンスデータを構築
+/// オイラー角はクォータニオン（SNORM16 x4）、色はRGBA8に量子化する。sin/cosは全レベル共通の多項式近似を使用
+/// @param instances 書き込み先（count要素）
+void PackInstances(
+	ParticleForGPU* instances,
+	const Vector3* positions,
+	const Vector3* rotations,
+	const Vector3* scales,
+	const Vector4* colors,
+	uint32_t count
+);
+
+} // namespace ParticleSimd
@@ -1,5 +1,7 @@
 #include "ParticleUpdater.h"
-#include "Engine/Particle/ParticleSystem.h" // Particle構造体のため
+#include "ParticlePool.h"
+#include "ParticleSimd.h"
+#include "Engine/Utility/Job/JobSystem.h"
 #include "Engine/Particle/Modules/ForceModule.h"
 #include "Engine/Particle/Modules/ColorModule.h"
 #include "Engine/Particle/Modules/SizeModule.h"
@@ -21,58 +23,98 @@ void ParticleUpdater::Initialize(
 }
 
 uint32_t ParticleUpdater::UpdateParticles(
-	std::list<Particle>& particles,
+	ParticlePool& pool,
 	float deltaTime,
-	float gravityModifier
+	float gravityModifier,
+	JobSystem* jobSystem
 ) {
-	uint32_t destroyedCount = 0;
+	// ライフタイムチェック（寿命切れはここで削除し、以降は生存分のみ処理）
+	// swap-and-popで並びが変わるため、この処理だけは常に逐次で行う
+	uint32_t destroyedCount = UpdateLifetimes(pool, deltaTime);
 
-	for (auto particleIterator = particles.begin(); particleIterator != particles.end();) {
-		// ライフタイムチェック
-		particleIterator->currentTime += deltaTime;
-		if (particleIterator->currentTime >= particleIterator->lifeTime) {
-			particleIterator = particles.erase(particleIterator);
-			++destroyedCount;
-			continue;
-		}
+	ReserveScratch(pool.GetCapacity());
 
-		// 単一パーティクルの更新
-		UpdateSingleParticle(*particleIterator, deltaTime, gravityModifier);
-
-		++particleIterator;
+	// 以降のモジュールは要素ごとに独立しているため、区間に分割しても結果は変わらない
+	const uint32_t count = pool.GetCount();
+	if (jobSystem && count >= kParallelThreshold) {
+		jobSystem->ParallelFor(count, kChunkSize, [&](uint32_t begin, uint32_t end) {
+			UpdateRange(pool, ParticleRange{ begin, end }, deltaTime, gravityModifier);
+		});
+	} else {
+		UpdateRange(pool, pool.GetRange(), deltaTime, gravityModifier);
 	}
 
 	return destroyedCount;
 }
 
-void ParticleUpdater::UpdateSingleParticle(Particle& particle, float deltaTime, float gravityModifier) {
+void ParticleUpdater::UpdateRange(ParticlePool& pool, const ParticleRange& range, float deltaTime, float gravityModifier) {
+	// 区間のライフタイム係数をまとめて計算
+	ParticleSimd::CalculateLifetimeRatios(
+		lifetimeRatios_.data() + range.begin,
+		pool.GetAges() + range.begin,
+		pool.GetLifeTimes() + range.begin,
+		range.GetCount());
+	const float* lifetimeRatios = lifetimeRatios_.data();
+
 	// 力の適用（MainModuleのgravityModifierを考慮）
 	if (forceModule_ && forceModule_->IsEnabled()) {
-		forceModule_->ApplyForces(particle, deltaTime, gravityModifier);
+		forceModule_->ApplyForcesBatch(pool, range, deltaTime, gravityModifier);
 	}
 
 	// 位置の更新
-	particle.transform.translate.x += particle.velocity.x * deltaTime;
-	particle.transform.translate.y += particle.velocity.y * deltaTime;
-	particle.transform.translate.z += particle.velocity.z * deltaTime;
+	IntegratePositions(pool, range, deltaTime);
 
 	// 色の更新（initialColorからのグラデーション）
 	if (colorModule_ && colorModule_->IsEnabled()) {
-		colorModule_->UpdateColor(particle);
+		colorModule_->UpdateColorBatch(pool, range, lifetimeRatios);
 	}
 
 	// サイズの更新
 	if (sizeModule_ && sizeModule_->IsEnabled()) {
-		sizeModule_->UpdateSize(particle);
+		sizeModule_->UpdateSizeBatch(pool, range, lifetimeRatios, scratch_.data());
 	}
 
 	// 回転の更新
 	if (rotationModule_ && rotationModule_->IsEnabled()) {
-		rotationModule_->UpdateRotation(particle, deltaTime);
+		rotationModule_->UpdateRotationBatch(pool, range, lifetimeRatios, deltaTime);
 	}
 
 	// ノイズの適用
 	if (noiseModule_ && noiseModule_->IsEnabled()) {
-		noiseModule_->ApplyNoise(particle, deltaTime);
+		noiseModule_->ApplyNoiseBatch(pool, range, deltaTime);
+	}
+}
+
+uint32_t ParticleUpdater::UpdateLifetimes(ParticlePool& pool, float deltaTime) {
+	uint32_t destroyedCount = 0;
+
+	float* ages = pool.GetAges();
+	const float* lifeTimes = pool.GetLifeTimes();
+
+	// 末尾から走査することで、swap-and-popで移動してくる要素は処理済みのものだけになる
+	for (uint32_t i = pool.GetCount(); i-- > 0;) {
+		ages[i] += deltaTime;
+		if (ages[i] >= lifeTimes[i]) {
+			pool.Remove(i);
+			++destroyedCount;
+		}
+	}
+
+	return destroyedCount;
+}
+
+void ParticleUpdater::IntegratePositions(ParticlePool& pool, const ParticleRange& range, float deltaTime) {
+	ParticleSimd::MultiplyAddVector3(
+		pool.GetPositions() + range.begin,
+		pool.GetVelocities() + range.begin,
+		deltaTime,
+		range.GetCount());
+}
+
+void ParticleUpdater::ReserveScratch(uint32_t capacity) {
+	// プール容量が拡張されたときのみ再確保する（縮小時は確保済みのまま使い回す）
+	if (lifetimeRatios_.size() < capacity) {
+		lifetimeRatios_.resize(capacity);
+		scratch_.resize(capacity);
 	}
 }
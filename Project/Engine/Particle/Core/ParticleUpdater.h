@@ -1,10 +1,12 @@
 #pragma once
 
-#include <list>
 #include <cstdint>
+#include <vector>
 
 // 前方宣言
-struct Particle;
+class ParticlePool;
+struct ParticleRange;
+class JobSystem;
 class ForceModule;
 class ColorModule;
 class SizeModule;
@@ -13,8 +15,15 @@ class NoiseModule;
 
 /// @brief パーティクル更新処理クラス
 /// パーティクルの物理演算・色・サイズ・回転などの更新を担当
+/// 各モジュールはプールの連続配列に対してバッチで実行される
+/// パーティクル数が多い場合は区間に分割し、JobSystemで並列に更新する
 class ParticleUpdater {
 public:
+	// この数以上のパーティクルがある場合に区間分割して並列更新する
+	static constexpr uint32_t kParallelThreshold = 2048;
+	// 並列更新時の1ジョブあたりのパーティクル数
+	static constexpr uint32_t kChunkSize = 1024;
+
 	ParticleUpdater() = default;
 	~ParticleUpdater() = default;
 
@@ -32,23 +41,42 @@ public:
 		NoiseModule* noiseModule
 	);
 
-	/// @brief パーティクルリストを更新
-	/// @param particles パーティクルリスト（参照渡し、寿命切れは削除）
+	/// @brief プール内のパーティクルを更新
+	/// @param pool パーティクルプール（寿命切れは削除）
 	/// @param deltaTime フレーム時間
 	/// @param gravityModifier 重力倍率（MainModuleから取得）
+	/// @param jobSystem 区間分割に使用するジョブシステム（nullptrの場合は呼び出しスレッドで逐次更新）
 	/// @return 削除されたパーティクル数
 	uint32_t UpdateParticles(
-		std::list<Particle>& particles,
+		ParticlePool& pool,
 		float deltaTime,
-		float gravityModifier
+		float gravityModifier,
+		JobSystem* jobSystem = nullptr
 	);
 
 private:
-	/// @brief 単一パーティクルを更新
-	/// @param particle パーティクル
+	/// @brief 経過時間を進め、寿命切れのパーティクルを削除
+	/// @param pool パーティクルプール
+	/// @param deltaTime フレーム時間
+	/// @return 削除されたパーティクル数
+	uint32_t UpdateLifetimes(ParticlePool& pool, float deltaTime);
+
+	/// @brief 指定区間に全モジュールを適用（区間外の要素には触れない）
+	/// @param pool パーティクルプール
+	/// @param range 処理する区間
 	/// @param deltaTime フレーム時間
 	/// @param gravityModifier 重力倍率
-	void UpdateSingleParticle(Particle& particle, float deltaTime, float gravityModifier);
+	void UpdateRange(ParticlePool& pool, const ParticleRange& range, float deltaTime, float gravityModifier);
+
+	/// @brief 速度を位置に積分
+	/// @param pool パーティクルプール
+	/// @param range 処理する区間
+	/// @param deltaTime フレーム時間
+	void IntegratePositions(ParticlePool& pool, const ParticleRange& range, float deltaTime);
+
+	/// @brief 作業用バッファをプール容量に合わせて確保
+	/// @param capacity プールの最大パーティクル数
+	void ReserveScratch(uint32_t capacity);
 
 	// モジュールへの参照（ポインタ）
 	ForceModule* forceModule_ = nullptr;
@@ -56,4 +84,9 @@ private:
 	SizeModule* sizeModule_ = nullptr;
 	RotationModule* rotationModule_ = nullptr;
 	NoiseModule* noiseModule_ = nullptr;
+
+	// 色・サイズ・回転で共有するライフタイム係数（フレームごとに1回だけ計算）
+	std::vector<float> lifetimeRatios_;
+	// モジュールの中間結果用
+	std::vector<float> scratch_;
 };
@@ -0,0 +1,150 @@
+#include "ParticleJobBenchmark.h"
+#include "Engine/Particle/ParticleSystem.h"
+#include "Engine/Particle/Core/ParticlePool.h"
+#include "Engine/Particle/Core/ParticleUpdater.h"
+#include "Engine/Utility/Job/JobSystem.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <random>
+
+namespace {
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+	constexpr uint32_t kSeed = 12345;
+
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief 1システム分の更新対象（ParticleSystemのうちシミュレーションに必要な部分のみ）
+	struct BenchmarkSystem {
+		ForceModule forceModule;
+		ColorModule colorModule;
+		SizeModule sizeModule;
+		RotationModule rotationModule;
+		NoiseModule noiseModule;
+		ParticleUpdater updater;
+		ParticlePool pool;
+		double elapsedMilliseconds = 0.0;
+	};
+
+	/// @brief システムごとに異なるシードでパーティクルを生成
+	std::vector<Particle> CreateParticles(uint32_t count, uint32_t seed) {
+		std::mt19937 engine(seed);
+		std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+		std::uniform_real_distribution<float> velocity(-2.0f, 2.0f);
+		std::uniform_real_distribution<float> lifeTime(0.5f, 3.0f);
+
+		std::vector<Particle> particles(count);
+		for (auto& particle : particles) {
+			particle.transform.translate = { position(engine), position(engine), position(engine) };
+			particle.transform.rotate = { 0.0f, 0.0f, 0.0f };
+			particle.transform.scale = { 1.0f, 1.0f, 1.0f };
+			particle.initialScale = particle.transform.scale;
+			particle.velocity = { velocity(engine), velocity(engine), velocity(engine) };
+			particle.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+			particle.initialColor = particle.color;
+			particle.lifeTime = lifeTime(engine);
+			particle.currentTime = 0.0f;
+			particle.rotationSpeed = { 0.0f, 0.0f, 1.0f };
+		}
+		return particles;
+	}
+
+	/// @brief 2つのプールの内容がビット単位で一致するか
+	bool IsSamePool(const ParticlePool& a, const ParticlePool& b) {
+		const uint32_t count = a.GetCount();
+		if (count != b.GetCount()) {
+			return false;
+		}
+		return std::memcmp(a.GetPositions(), b.GetPositions(), sizeof(Vector3) * count) == 0 &&
+			std::memcmp(a.GetVelocities(), b.GetVelocities(), sizeof(Vector3) * count) == 0 &&
+			std::memcmp(a.GetColors(), b.GetColors(), sizeof(Vector4) * count) == 0 &&
+			std::memcmp(a.GetScales(), b.GetScales(), sizeof(Vector3) * count) == 0 &&
+			std::memcmp(a.GetRotations(), b.GetRotations(), sizeof(Vector3) * count) == 0;
+	}
+}
+
+std::vector<ParticleJobBenchmark::Result> ParticleJobBenchmark::Run(
+	uint32_t systemCount,
+	uint32_t particlesPerSystem,
+	uint32_t frameCount,
+	uint32_t maxThreadCount
+) {
+	std::vector<Result> results;
+	if (systemCount == 0 || particlesPerSystem == 0 || frameCount == 0) {
+		return results;
+	}
+
+	std::vector<std::vector<Particle>> sources;
+	sources.reserve(systemCount);
+	for (uint32_t i = 0; i < systemCount; ++i) {
+		sources.push_back(CreateParticles(particlesPerSystem, kSeed + i));
+	}
+
+	// 1スレッド実行の最終状態（一致確認用）
+	std::vector<std::unique_ptr<BenchmarkSystem>> serialSystems;
+
+	for (uint32_t threadCount = 1; threadCount <= (std::max)(1u, maxThreadCount); threadCount *= 2) {
+		JobSystem jobSystem;
+		jobSystem.Initialize(threadCount);
+
+		std::vector<std::unique_ptr<BenchmarkSystem>> systems;
+		systems.reserve(systemCount);
+		for (uint32_t i = 0; i < systemCount; ++i) {
+			auto system = std::make_unique<BenchmarkSystem>();
+			system->updater.Initialize(
+				&system->forceModule, &system->colorModule, &system->sizeModule,
+				&system->rotationModule, &system->noiseModule);
+			system->pool.Initialize(particlesPerSystem);
+			for (const auto& particle : sources[i]) {
+				system->pool.Push(particle);
+			}
+			systems.push_back(std::move(system));
+		}
+
+		// ParticleSystem::SimulateAll と同じく、システム単位で分散し大規模なプールは区間分割する
+		auto start = Clock::now();
+		for (uint32_t frame = 0; frame < frameCount; ++frame) {
+			jobSystem.ParallelFor(systemCount, 1, [&](uint32_t begin, uint32_t end) {
+				for (uint32_t i = begin; i < end; ++i) {
+					BenchmarkSystem& system = *systems[i];
+					auto systemStart = Clock::now();
+					system.updater.UpdateParticles(system.pool, kDeltaTime, 1.0f, &jobSystem);
+					system.elapsedMilliseconds += std::chrono::duration<double, std::milli>(Clock::now() - systemStart).count();
+				}
+			});
+		}
+		auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start);
+
+		Result result;
+		result.threadCount = jobSystem.GetThreadCount();
+		result.frameMilliseconds = elapsed.count() / frameCount;
+		result.systemMilliseconds.reserve(systemCount);
+		for (const auto& system : systems) {
+			result.systemMilliseconds.push_back(system->elapsedMilliseconds / frameCount);
+		}
+
+		if (serialSystems.empty()) {
+			result.speedup = 1.0;
+			result.matchesSerial = true;
+			serialSystems = std::move(systems);
+		} else {
+			result.speedup = result.frameMilliseconds > 0.0 ? results.front().frameMilliseconds / result.frameMilliseconds : 0.0;
+			result.matchesSerial = true;
+			for (uint32_t i = 0; i < systemCount; ++i) {
+				result.matchesSerial &= IsSamePool(serialSystems[i]->pool, systems[i]->pool);
+			}
+		}
+
+		Logger::GetInstance().Log(
+			std::format("ParticleJobBenchmark: {} systems x {} particles | {} threads | {:.3f} ms/frame | x{:.2f} | output {}",
+				systemCount, particlesPerSystem, result.threadCount, result.frameMilliseconds, result.speedup,
+				result.matchesSerial ? "match" : "MISMATCH"),
+			result.matchesSerial ? LogLevel::INFO : LogLevel::WARNING, LogCategory::System);
+
+		results.push_back(std::move(result));
+	}
+
+	return results;
+}
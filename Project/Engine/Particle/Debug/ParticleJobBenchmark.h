@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/// @brief ジョブシステムによるパーティクル並列更新のスケーリング計測（GPU不要）
+/// 複数のパーティクルシステム相当のプールを用意し、スレッド数を変えて ParticleSystem::SimulateAll と同じ分散方法で更新する
+class ParticleJobBenchmark {
+public:
+	/// @brief スレッド数ごとの計測結果
+	struct Result {
+		uint32_t threadCount = 0;                  // 呼び出し元を含むスレッド数
+		double frameMilliseconds = 0.0;            // 1フレームあたりの平均更新時間（全システム）
+		double speedup = 0.0;                      // 1スレッド比の速度向上率
+		bool matchesSerial = false;                // 1スレッド実行と結果がビット単位で一致したか
+		std::vector<double> systemMilliseconds;    // システムごとの1フレームあたり平均更新時間
+	};
+
+	/// @brief ベンチマークを実行
+	/// @param systemCount パーティクルシステム数
+	/// @param particlesPerSystem システムあたりのパーティクル数
+	/// @param frameCount 計測するフレーム数
+	/// @param maxThreadCount 計測する最大スレッド数（1, 2, 4, ... と倍にしていく）
+	/// @return スレッド数ごとの計測結果（ログにも出力される）
+	static std::vector<Result> Run(
+		uint32_t systemCount = 8,
+		uint32_t particlesPerSystem = 50000,
+		uint32_t frameCount = 60,
+		uint32_t maxThreadCount = 16
+	);
+};
@@ -0,0 +1,179 @@
+#include "ParticleRenderDataBenchmark.h"
+#include "Engine/Particle/Core/ParticleGPUData.h"
+#include "Engine/Particle/Core/ParticleSimd.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <random>
+#include <vector>
+
+using namespace MathCore;
+
+namespace {
+	constexpr uint32_t kSeed = 12345;
+
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief 旧来のGPU送信データ（比較用）
+	struct MatrixParticleForGPU {
+		Matrix4x4 WVP;
+		Matrix4x4 World;
+		Vector4 color;
+	};
+
+	/// @brief 計測用のインスタンス属性（SoA）
+	struct InstanceStreams {
+		std::vector<Vector3> positions;
+		std::vector<Vector3> rotations;
+		std::vector<Vector3> scales;
+		std::vector<Vector4> colors;
+	};
+
+	InstanceStreams CreateStreams(uint32_t count) {
+		std::mt19937 engine(kSeed);
+		std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+		std::uniform_real_distribution<float> angle(-3.14159265f, 3.14159265f);
+		std::uniform_real_distribution<float> scale(0.1f, 2.0f);
+		std::uniform_real_distribution<float> color(0.0f, 1.0f);
+
+		InstanceStreams streams;
+		streams.positions.resize(count);
+		streams.rotations.resize(count);
+		streams.scales.resize(count);
+		streams.colors.resize(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			streams.positions[i] = { position(engine), position(engine), position(engine) };
+			streams.rotations[i] = { angle(engine), angle(engine), angle(engine) };
+			const float size = scale(engine);
+			streams.scales[i] = { size, size, size };
+			streams.colors[i] = { color(engine), color(engine), color(engine), color(engine) };
+		}
+		return streams;
+	}
+
+	/// @brief 旧来の構築処理（MakeAffine + ビルボード乗算 + WVP乗算）
+	void BuildMatrixInstances(
+		MatrixParticleForGPU* instances, const InstanceStreams& streams,
+		const Matrix4x4& billboard, const Matrix4x4& viewProjection, uint32_t count
+	) {
+		for (uint32_t i = 0; i < count; ++i) {
+			Matrix4x4 world = Matrix::Multiply(
+				Matrix::MakeAffine(streams.scales[i], streams.rotations[i], Vector3{ 0.0f, 0.0f, 0.0f }), billboard);
+			world.m[3][0] = streams.positions[i].x;
+			world.m[3][1] = streams.positions[i].y;
+			world.m[3][2] = streams.positions[i].z;
+
+			instances[i].WVP = Matrix::Multiply(world, viewProjection);
+			instances[i].World = world;
+			instances[i].color = streams.colors[i];
+		}
+	}
+
+	/// @brief 圧縮形式からシェーダー（Particle.hlsli）と同じ手順で頂点のワールド座標を求める
+	Vector3 ExpandPackedVertex(const ParticleForGPU& instance, const Matrix4x4& billboard, const Vector3& local) {
+		float q[4];
+		for (uint32_t i = 0; i < 4; ++i) {
+			const uint32_t packed = instance.rotation[i / 2];
+			const int16_t value = static_cast<int16_t>(i % 2 == 0 ? (packed & 0xFFFFu) : (packed >> 16));
+			q[i] = (std::max)(static_cast<float>(value) / 32767.0f, -1.0f);
+		}
+		const float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+		for (float& component : q) {
+			component /= length;
+		}
+
+		const Vector3 v = { local.x * instance.scale.x, local.y * instance.scale.y, local.z * instance.scale.z };
+		const Vector3 axis = { q[0], q[1], q[2] };
+		Vector3 t = Vector::Cross(axis, v);
+		t = { 2.0f * t.x, 2.0f * t.y, 2.0f * t.z };
+		const Vector3 c = Vector::Cross(axis, t);
+		const Vector3 rotated = { v.x + q[3] * t.x + c.x, v.y + q[3] * t.y + c.y, v.z + q[3] * t.z + c.z };
+
+		return {
+			rotated.x * billboard.m[0][0] + rotated.y * billboard.m[1][0] + rotated.z * billboard.m[2][0] + instance.position.x,
+			rotated.x * billboard.m[0][1] + rotated.y * billboard.m[1][1] + rotated.z * billboard.m[2][1] + instance.position.y,
+			rotated.x * billboard.m[0][2] + rotated.y * billboard.m[1][2] + rotated.z * billboard.m[2][2] + instance.position.z
+		};
+	}
+}
+
+ParticleRenderDataBenchmark::Result ParticleRenderDataBenchmark::Run(uint32_t instanceCount, uint32_t frameCount) {
+	Result result;
+	result.instanceCount = instanceCount;
+	result.frameCount = frameCount;
+	result.simdLevel = CpuFeature::GetMaxSimdLevel();
+	result.matrixBytes = sizeof(MatrixParticleForGPU) * instanceCount;
+	result.packedBytes = sizeof(ParticleForGPU) * instanceCount;
+
+	if (instanceCount == 0 || frameCount == 0) {
+		return result;
+	}
+
+	const InstanceStreams streams = CreateStreams(instanceCount);
+
+	// ViewFacingのビルボード行列（ビュー行列の逆行列の回転部分）
+	const Matrix4x4 view = Matrix::LookAt({ 0.0f, 5.0f, -20.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+	Matrix4x4 billboard = Matrix::Inverse(view);
+	billboard.m[3][0] = 0.0f;
+	billboard.m[3][1] = 0.0f;
+	billboard.m[3][2] = 0.0f;
+	const Matrix4x4 viewProjection = Matrix::Multiply(view, Rendering::PerspectiveFov(0.45f, 16.0f / 9.0f, 0.1f, 100.0f));
+
+	std::vector<MatrixParticleForGPU> matrixInstances(instanceCount);
+	std::vector<ParticleForGPU> packedInstances(instanceCount);
+
+	auto start = Clock::now();
+	for (uint32_t frame = 0; frame < frameCount; ++frame) {
+		BuildMatrixInstances(matrixInstances.data(), streams, billboard, viewProjection, instanceCount);
+	}
+	result.matrixMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frameCount;
+
+	// 指定レベルで圧縮形式を構築し、1フレームあたりの平均時間を返す
+	const CpuFeature::SimdLevel previousLevel = ParticleSimd::GetSimdLevel();
+	auto measure = [&](CpuFeature::SimdLevel level) {
+		ParticleSimd::SetSimdLevel(level);
+		auto packStart = Clock::now();
+		for (uint32_t frame = 0; frame < frameCount; ++frame) {
+			ParticleSimd::PackInstances(
+				packedInstances.data(),
+				streams.positions.data(),
+				streams.rotations.data(),
+				streams.scales.data(),
+				streams.colors.data(),
+				instanceCount);
+		}
+		return std::chrono::duration<double, std::milli>(Clock::now() - packStart).count() / frameCount;
+	};
+	result.packedScalarMilliseconds = measure(CpuFeature::SimdLevel::Scalar);
+	result.packedMilliseconds = measure(result.simdLevel);
+	ParticleSimd::SetSimdLevel(previousLevel);
+
+	// ビルボードの四隅を両形式で展開して誤差を確認
+	const Vector3 corners[] = {
+		{ -0.5f, 0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f }, { -0.5f, -0.5f, 0.0f }, { 0.5f, -0.5f, 0.0f }
+	};
+	for (uint32_t i = 0; i < instanceCount; ++i) {
+		const Matrix4x4& world = matrixInstances[i].World;
+		for (const Vector3& corner : corners) {
+			const Vector3 expected = {
+				corner.x * world.m[0][0] + corner.y * world.m[1][0] + corner.z * world.m[2][0] + world.m[3][0],
+				corner.x * world.m[0][1] + corner.y * world.m[1][1] + corner.z * world.m[2][1] + world.m[3][1],
+				corner.x * world.m[0][2] + corner.y * world.m[1][2] + corner.z * world.m[2][2] + world.m[3][2]
+			};
+			const Vector3 actual = ExpandPackedVertex(packedInstances[i], billboard, corner);
+			result.maxPositionError = (std::max)({ result.maxPositionError,
+				std::fabs(actual.x - expected.x), std::fabs(actual.y - expected.y), std::fabs(actual.z - expected.z) });
+		}
+	}
+
+	Logger::GetInstance().Log(
+		std::format("ParticleRenderDataBenchmark: {} instances x {} frames | matrix {:.3f} ms/frame ({} KB) | packed scalar {:.3f} ms/frame | {} {:.3f} ms/frame ({} KB) | x{:.2f} time, x{:.2f} bytes | max error {:.6f}",
+			instanceCount, frameCount, result.matrixMilliseconds, result.matrixBytes / 1024,
+			result.packedScalarMilliseconds, CpuFeature::GetSimdLevelName(result.simdLevel), result.packedMilliseconds,
+			result.packedBytes / 1024, result.GetSpeedup(), result.GetBandwidthRatio(), result.maxPositionError),
+		LogLevel::INFO, LogCategory::System);
+
+	return result;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Engine/Utility/CpuFeature/CpuFeature.h"
+
+/// @brief 描画データ構築のマイクロベンチマーク（GPU不要）
+/// 旧来の行列形式（WVP + World + color の144バイト）と、頂点シェーダーで展開する圧縮形式（36バイト）の構築時間を比較する
+class ParticleRenderDataBenchmark {
+public:
+	/// @brief 計測結果
+	struct Result {
+		uint32_t instanceCount = 0;            // インスタンス数
+		uint32_t frameCount = 0;               // 計測フレーム数
+		CpuFeature::SimdLevel simdLevel = CpuFeature::SimdLevel::Scalar; // 圧縮形式の計測に使用したSIMDレベル
+		double matrixMilliseconds = 0.0;       // 1フレームあたりの構築時間（行列形式）
+		double packedScalarMilliseconds = 0.0; // 1フレームあたりの構築時間（圧縮形式・スカラー）
+		double packedMilliseconds = 0.0;       // 1フレームあたりの構築時間（圧縮形式・SIMD）
+		size_t matrixBytes = 0;                // 1フレームの転送量（行列形式）
+		size_t packedBytes = 0;                // 1フレームの転送量（圧縮形式）
+		float maxPositionError = 0.0f;         // シェーダーと同じ方法で展開した頂点位置の最大誤差（ワールド空間）
+
+		/// @brief 行列形式比の速度向上率を取得
+		double GetSpeedup() const { return packedMilliseconds > 0.0 ? matrixMilliseconds / packedMilliseconds : 0.0; }
+
+		/// @brief 転送量の削減率を取得
+		double GetBandwidthRatio() const { return packedBytes > 0 ? static_cast<double>(matrixBytes) / static_cast<double>(packedBytes) : 0.0; }
+	};
+
+	/// @brief ベンチマークを実行
+	/// ビルボード（ViewFacing）で構築し、圧縮形式はスカラー実装と利用可能な最上位のSIMD実装を計測する
+	/// @param instanceCount インスタンス数
+	/// @param frameCount 計測するフレーム数
+	/// @return 計測結果（ログにも出力される）
+	static Result Run(uint32_t instanceCount = 100000, uint32_t frameCount = 60);
+};
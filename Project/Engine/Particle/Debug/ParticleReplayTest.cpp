@@ -0,0 +1,115 @@
+#include "ParticleReplayTest.h"
+#include "Engine/Particle/ParticleSystem.h"
+#include "Engine/Utility/Random/RandomGenerator.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <cstring>
+#include <format>
+#include <memory>
+
+namespace {
+	constexpr uint32_t kSeed = 12345;
+	// 先頭を基準として比較する描画レート（Hz）
+	constexpr uint32_t kFrameRates[] = { 60, 30, 120, 144 };
+	constexpr float kFixedDeltaTime = 1.0f / 60.0f;
+
+	/// @brief プールの内容のスナップショット
+	struct PoolSnapshot {
+		std::vector<Vector3> positions;
+		std::vector<Vector3> velocities;
+		std::vector<Vector4> colors;
+		std::vector<Vector3> scales;
+		std::vector<Vector3> rotations;
+		std::vector<float> ages;
+
+		/// @brief ビット単位で一致するか
+		bool operator==(const PoolSnapshot& other) const {
+			auto equalBits = [](const auto& a, const auto& b) {
+				return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(a[0])) == 0;
+			};
+			return equalBits(positions, other.positions) && equalBits(velocities, other.velocities) &&
+				equalBits(colors, other.colors) && equalBits(scales, other.scales) &&
+				equalBits(rotations, other.rotations) && equalBits(ages, other.ages);
+		}
+	};
+
+	PoolSnapshot TakeSnapshot(const ParticlePool& pool) {
+		const uint32_t count = pool.GetCount();
+		PoolSnapshot snapshot;
+		snapshot.positions.assign(pool.GetPositions(), pool.GetPositions() + count);
+		snapshot.velocities.assign(pool.GetVelocities(), pool.GetVelocities() + count);
+		snapshot.colors.assign(pool.GetColors(), pool.GetColors() + count);
+		snapshot.scales.assign(pool.GetScales(), pool.GetScales() + count);
+		snapshot.rotations.assign(pool.GetRotations(), pool.GetRotations() + count);
+		snapshot.ages.assign(pool.GetAges(), pool.GetAges() + count);
+		return snapshot;
+	}
+
+	/// @brief 乱数・放出・力場・寿命による削除を一通り通る設定
+	void ConfigureSystem(ParticleSystem& system) {
+		auto& mainData = system.GetMainModule().GetMainData();
+		mainData.looping = true;
+		mainData.duration = 2.0f;
+		mainData.maxParticles = 2000;
+		mainData.startLifetime = 1.5f;
+		mainData.startLifetimeRandomness = 0.5f;
+		mainData.startSpeedRandomness = 0.5f;
+		mainData.startColorRandomness = 0.5f;
+		mainData.gravityModifier = 1.0f;
+
+		auto& emissionData = system.GetEmissionModule().GetEmissionData();
+		emissionData.rateOverTime = 90;
+		emissionData.burstCount = 200;
+		emissionData.burstTime = 0.5f;
+
+		ParticleClock::Settings clockSettings;
+		clockSettings.mode = ParticleTimeMode::FixedStep;
+		clockSettings.fixedDeltaTime = kFixedDeltaTime;
+		clockSettings.maxSubsteps = 8;
+		system.SetClockSettings(clockSettings);
+	}
+}
+
+std::vector<ParticleReplayTest::Result> ParticleReplayTest::Run(DirectXCommon* dxCommon, ResourceFactory* resourceFactory, uint32_t stepCount) {
+	std::vector<Result> results;
+	PoolSnapshot reference;
+
+	for (uint32_t frameRate : kFrameRates) {
+		auto system = std::make_unique<ParticleSystem>();
+		system->Initialize(dxCommon, resourceFactory, "ParticleReplayTest");
+		ConfigureSystem(*system);
+
+		// Initializeで時刻シードに戻るため、再生直前に固定シードを設定する
+		RandomGenerator::GetInstance().Initialize(kSeed);
+		system->Play();
+
+		Result result;
+		result.frameRate = frameRate;
+		const float frameDeltaTime = 1.0f / static_cast<float>(frameRate);
+		while (system->GetClock().GetTotalStepCount() < stepCount) {
+			system->UpdateEmission(frameDeltaTime);
+			system->Simulate();
+			++result.frameCount;
+		}
+		result.stepCount = system->GetClock().GetTotalStepCount();
+		result.particleCount = system->GetParticleCount();
+
+		PoolSnapshot snapshot = TakeSnapshot(system->GetParticlePool());
+		if (results.empty()) {
+			reference = std::move(snapshot);
+			result.matchesReference = true;
+		} else {
+			result.matchesReference = result.stepCount == results.front().stepCount && snapshot == reference;
+		}
+		results.push_back(result);
+
+		Logger::GetInstance().Log(
+			std::format("ParticleReplayTest: {} Hz | {} frames | {} steps | {} particles | {}",
+				result.frameRate, result.frameCount, result.stepCount, result.particleCount,
+				result.matchesReference ? "match" : "MISMATCH"),
+			LogLevel::INFO, LogCategory::System);
+	}
+
+	// ゲーム側の乱数が固定シードのままにならないよう戻す
+	RandomGenerator::GetInstance().Initialize();
+	return results;
+}
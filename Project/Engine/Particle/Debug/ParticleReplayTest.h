@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// 前方宣言
+class DirectXCommon;
+class ResourceFactory;
+
+/// @brief 固定ステップ時計の決定性テスト
+/// 同じ乱数シード・同じ設定のパーティクルシステムを異なる描画レートで再生し、
+/// 同じステップ数だけ進めた時点のプールの内容がビット単位で一致するかを検証する
+class ParticleReplayTest {
+public:
+	/// @brief 描画レートごとの検証結果
+	struct Result {
+		uint32_t frameRate = 0;          // 再生時の描画レート（Hz）
+		uint32_t frameCount = 0;         // 再生したフレーム数
+		uint64_t stepCount = 0;          // 実行したシミュレーションステップ数
+		uint32_t particleCount = 0;      // 終了時点の生存パーティクル数
+		bool matchesReference = false;   // 基準（先頭の描画レート）の結果とビット単位で一致したか
+	};
+
+	/// @brief テストを実行
+	/// 検証中は共有乱数を固定シードで初期化し直し、終了後に時刻ベースのシードへ戻す
+	/// @param dxCommon DirectXCommon（テスト用パーティクルシステムの初期化に使用）
+	/// @param resourceFactory リソースファクトリ
+	/// @param stepCount 再生するシミュレーションステップ数（1/60秒刻み）
+	/// @return 描画レートごとの結果（ログにも出力される）
+	static std::vector<Result> Run(DirectXCommon* dxCommon, ResourceFactory* resourceFactory, uint32_t stepCount = 600);
+};
@@ -0,0 +1,97 @@
+#include "ParticleSortBenchmark.h"
+#include "Engine/Particle/Core/ParticleDepthSorter.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include "MathCore.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <numeric>
+#include <random>
+
+using namespace MathCore;
+
+namespace {
+	constexpr uint32_t kSeed = 12345;
+	constexpr uint32_t kParticleCounts[] = { 10000, 50000, 100000 };
+
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief フレームごとに原点の周りを回る視点のビュー行列を作成
+	Matrix4x4 CreateOrbitView(uint32_t frame) {
+		const float angle = static_cast<float>(frame) * 0.05f;
+		const Vector3 eye = { std::sin(angle) * 30.0f, 8.0f, -std::cos(angle) * 30.0f };
+		return Matrix::LookAt(eye, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f });
+	}
+
+	/// @brief ビュー空間の深度（ParticleDepthSorterと同じ計算）
+	float CalculateDepth(const Vector3& position, const Matrix4x4& view) {
+		return position.x * view.m[0][2] + position.y * view.m[1][2] + position.z * view.m[2][2];
+	}
+}
+
+std::vector<ParticleSortBenchmark::Result> ParticleSortBenchmark::Run(uint32_t frameCount) {
+	std::vector<Result> results;
+	for (uint32_t particleCount : kParticleCounts) {
+		results.push_back(Run(particleCount, frameCount));
+	}
+	return results;
+}
+
+ParticleSortBenchmark::Result ParticleSortBenchmark::Run(uint32_t particleCount, uint32_t frameCount) {
+	Result result;
+	result.particleCount = particleCount;
+	result.frameCount = frameCount;
+
+	if (particleCount == 0 || frameCount == 0) {
+		return result;
+	}
+
+	std::mt19937 engine(kSeed);
+	std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+	std::vector<Vector3> positions(particleCount);
+	for (auto& value : positions) {
+		value = { position(engine), position(engine), position(engine) };
+	}
+
+	// 比較ソート（深度をキャッシュしたうえでインデックスを並べ替える）
+	std::vector<float> depths(particleCount);
+	std::vector<uint32_t> indices(particleCount);
+	auto start = Clock::now();
+	for (uint32_t frame = 0; frame < frameCount; ++frame) {
+		const Matrix4x4 view = CreateOrbitView(frame);
+		for (uint32_t i = 0; i < particleCount; ++i) {
+			depths[i] = CalculateDepth(positions[i], view);
+		}
+		std::iota(indices.begin(), indices.end(), 0u);
+		std::sort(indices.begin(), indices.end(), [&](uint32_t a, uint32_t b) { return depths[a] > depths[b]; });
+	}
+	result.stdSortMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frameCount;
+
+	// 基数ソート（最初のフレームで作業バッファを確保するため、計測前に1回実行しておく）
+	ParticleDepthSorter sorter;
+	sorter.SortBackToFront(positions.data(), particleCount, CreateOrbitView(0));
+	start = Clock::now();
+	for (uint32_t frame = 0; frame < frameCount; ++frame) {
+		sorter.SortBackToFront(positions.data(), particleCount, CreateOrbitView(frame));
+	}
+	result.radixMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frameCount;
+
+	// 最終フレームの並びを安定ソートの結果と比較
+	const Matrix4x4 lastView = CreateOrbitView(frameCount - 1);
+	for (uint32_t i = 0; i < particleCount; ++i) {
+		depths[i] = CalculateDepth(positions[i], lastView);
+	}
+	std::iota(indices.begin(), indices.end(), 0u);
+	std::stable_sort(indices.begin(), indices.end(), [&](uint32_t a, uint32_t b) { return depths[a] > depths[b]; });
+	const uint32_t* sorted = sorter.SortBackToFront(positions.data(), particleCount, lastView);
+	result.ordersMatch = std::equal(indices.begin(), indices.end(), sorted);
+
+	Logger::GetInstance().Log(
+		std::format("ParticleSortBenchmark: {} particles x {} frames | std::sort {:.3f} ms/frame | radix {:.3f} ms/frame | x{:.2f} | order {}",
+			particleCount, frameCount, result.stdSortMilliseconds, result.radixMilliseconds, result.GetSpeedup(),
+			result.ordersMatch ? "match" : "MISMATCH"),
+		LogLevel::INFO, LogCategory::System);
+
+	return result;
+}
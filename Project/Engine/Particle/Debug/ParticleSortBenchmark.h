@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/// @brief 深度ソートのマイクロベンチマーク（GPU不要）
+/// 毎フレーム視点を回転させながら、std::sortによる比較ソートとParticleDepthSorterの基数ソートを比較する
+class ParticleSortBenchmark {
+public:
+	/// @brief 計測結果（パーティクル数ごと）
+	struct Result {
+		uint32_t particleCount = 0;    // パーティクル数
+		uint32_t frameCount = 0;       // 計測フレーム数
+		double stdSortMilliseconds = 0.0; // 1フレームあたりのソート時間（std::sort）
+		double radixMilliseconds = 0.0;   // 1フレームあたりのソート時間（基数ソート）
+		bool ordersMatch = false;      // 基数ソートの結果が安定ソート（std::stable_sort）と一致したか
+
+		/// @brief std::sort比の速度向上率を取得
+		double GetSpeedup() const { return radixMilliseconds > 0.0 ? stdSortMilliseconds / radixMilliseconds : 0.0; }
+	};
+
+	/// @brief 10k / 50k / 100k パーティクルでベンチマークを実行
+	/// @param frameCount 計測するフレーム数
+	/// @return パーティクル数ごとの計測結果（ログにも出力される）
+	static std::vector<Result> Run(uint32_t frameCount = 60);
+
+	/// @brief 指定したパーティクル数でベンチマークを実行
+	/// @param particleCount パーティクル数
+	/// @param frameCount 計測するフレーム数
+	/// @return 計測結果（ログにも出力される）
+	static Result Run(uint32_t particleCount, uint32_t frameCount);
+};
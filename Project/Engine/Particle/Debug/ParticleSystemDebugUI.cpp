@@ -3,8 +3,15 @@
 #ifdef _DEBUG
 
 #include "Engine/Particle/ParticleSystem.h"
+#include "Engine/Particle/Debug/ParticleUpdateBenchmark.h"
+#include "Engine/Particle/Debug/ParticleJobBenchmark.h"
+#include "Engine/Particle/Debug/ParticleRenderDataBenchmark.h"
+#include "Engine/Particle/Debug/ParticleSortBenchmark.h"
+#include "Engine/Particle/Debug/ParticleReplayTest.h"
+#include "Engine/Particle/Core/ParticleSimd.h"
 #include "Engine/Graphics/Model/ModelResource.h"
 #include "Engine/Utility/Debug/ImGui/ImguiManager.h"
+#include <algorithm>
 
 bool ParticleSystemDebugUI::ShowImGui(ParticleSystem* particleSystem) {
 	if (!particleSystem) return false;
@@ -28,9 +35,15 @@ bool ParticleSystemDebugUI::ShowImGui(ParticleSystem* particleSystem) {
 	// エミッター設定
 	ShowEmitterSettings(particleSystem);
 
+	// シミュレーション時計
+	ShowClockSettings(particleSystem);
+
 	// 統計情報
 	ShowStatistics(particleSystem);
 
+	// ベンチマーク
+	ShowBenchmark(particleSystem);
+
 	return changed;
 }
 
@@ -160,6 +173,65 @@ void ParticleSystemDebugUI::ShowEmitterSettings(ParticleSystem* particleSystem)
 	if (ImGui::Combo("ブレンドモード", &currentBlendMode, blendModeNames, IM_ARRAYSIZE(blendModeNames))) {
 		particleSystem->SetBlendMode(static_cast<BlendMode>(currentBlendMode));
 	}
+
+	// 描画順（通常ブレンドで前後関係を正しく描画する場合は奥から手前）
+	static const char* sortModeNames[] = {
+		"なし", "奥から手前"
+	};
+	int currentSortMode = static_cast<int>(particleSystem->GetSortMode());
+	if (ImGui::Combo("描画順", &currentSortMode, sortModeNames, IM_ARRAYSIZE(sortModeNames))) {
+		particleSystem->SetSortMode(static_cast<ParticleSortMode>(currentSortMode));
+	}
+	if (particleSystem->GetBlendMode() == BlendMode::kBlendModeNormal &&
+		particleSystem->GetSortMode() == ParticleSortMode::None) {
+		ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), "通常ブレンドは描画順のソートを推奨");
+	}
+}
+
+void ParticleSystemDebugUI::ShowClockSettings(ParticleSystem* particleSystem) {
+	if (!ImGui::CollapsingHeader("時間設定")) return;
+
+	ParticleClock::Settings settings = particleSystem->GetClockSettings();
+	bool changed = false;
+
+	static const char* timeModeNames[] = {
+		"実時間", "固定ステップ", "タイムスケール"
+	};
+	int currentTimeMode = static_cast<int>(settings.mode);
+	if (ImGui::Combo("時間モード", &currentTimeMode, timeModeNames, IM_ARRAYSIZE(timeModeNames))) {
+		settings.mode = static_cast<ParticleTimeMode>(currentTimeMode);
+		changed = true;
+	}
+
+	if (settings.mode == ParticleTimeMode::FixedStep) {
+		float stepRate = 1.0f / settings.fixedDeltaTime;
+		if (ImGui::DragFloat("ステップレート", &stepRate, 1.0f, 10.0f, 240.0f, "%.0f Hz")) {
+			settings.fixedDeltaTime = 1.0f / stepRate;
+			changed = true;
+		}
+		int maxSubsteps = static_cast<int>(settings.maxSubsteps);
+		if (ImGui::DragInt("最大ステップ数/フレーム", &maxSubsteps, 1, 1, 16)) {
+			settings.maxSubsteps = static_cast<uint32_t>(maxSubsteps);
+			changed = true;
+		}
+		ImGui::TextDisabled("描画レートによらず同じ結果になります（超過分のステップは破棄）");
+	}
+
+	if (settings.mode != ParticleTimeMode::Variable) {
+		changed |= ImGui::DragFloat("タイムスケール", &settings.timeScale, 0.01f, 0.0f, 4.0f, "%.2f");
+	}
+
+	changed |= ImGui::DragFloat("最大フレーム時間", &settings.maxDeltaTime, 0.01f, 0.01f, 1.0f, "%.2f秒");
+
+	if (changed) {
+		particleSystem->SetClockSettings(settings);
+	}
+
+	const auto& clock = particleSystem->GetClock();
+	ImGui::Text("直近フレーム: %u ステップ x %.4f秒", particleSystem->GetStatistics().lastStepCount, clock.GetStepDeltaTime());
+	if (settings.mode == ParticleTimeMode::FixedStep) {
+		ImGui::Text("破棄したステップ: %u", clock.GetDroppedStepCount());
+	}
 }
 
 void ParticleSystemDebugUI::ShowStatistics(ParticleSystem* particleSystem) {
@@ -172,10 +244,122 @@ void ParticleSystemDebugUI::ShowStatistics(ParticleSystem* particleSystem) {
 	ImGui::Text("最大同時パーティクル数: %u", stats.peakParticleCount);
 	ImGui::Text("平均ライフタイム: %.2f秒", stats.averageLifetime);
 	ImGui::Text("システム稼働時間: %.2f秒", stats.systemRuntime);
+	ImGui::Text("シミュレーション: %.3f ms / 描画データ構築: %.3f ms", stats.simulateMilliseconds, stats.renderDataMilliseconds);
+	ImGui::Text("プール容量: %u (未使用 %.1f KB)", stats.capacity, static_cast<float>(stats.wastedBytes) / 1024.0f);
+
+	const auto& allocator = ParticleInstanceAllocator::GetInstance();
+	ImGui::Text("共有インスタンシングバッファ: %u / %u", allocator.GetFrameUsage(), allocator.GetCapacity());
 
 	if (ImGui::Button("統計リセット")) {
 		particleSystem->ResetStatistics();
 	}
 }
 
+void ParticleSystemDebugUI::ShowBenchmark(ParticleSystem* particleSystem) {
+	if (!ImGui::CollapsingHeader("ベンチマーク")) return;
+
+	static ParticleUpdateBenchmark::Result updateResult;
+	static ParticleUpdateBenchmark::SimdResult simdResult;
+	static std::vector<ParticleJobBenchmark::Result> jobResults;
+	static ParticleRenderDataBenchmark::Result renderDataResult;
+	static std::vector<ParticleSortBenchmark::Result> sortResults;
+	static std::vector<ParticleReplayTest::Result> replayResults;
+
+	ImGui::TextDisabled("注意: Debugビルドでは最適化が無効のため参考値です");
+
+	if (ImGui::Button("更新ベンチマーク (100k)")) {
+		updateResult = ParticleUpdateBenchmark::Run(100000, 60);
+	}
+
+	if (updateResult.frameCount > 0) {
+		ImGui::Text("list: %.3f ms/frame", updateResult.listMilliseconds);
+		ImGui::Text("pool: %.3f ms/frame (x%.2f)", updateResult.poolMilliseconds, updateResult.GetSpeedup());
+		ImGui::Text("生存数: list %u / pool %u", updateResult.listSurvivors, updateResult.poolSurvivors);
+	}
+
+	ImGui::Separator();
+	ImGui::Text("SIMD: %s", CpuFeature::GetSimdLevelName(ParticleSimd::GetSimdLevel()));
+
+	if (ImGui::Button("SIMDベンチマーク (100k)")) {
+		simdResult = ParticleUpdateBenchmark::RunSimd(100000, 60);
+	}
+
+	if (simdResult.frameCount > 0) {
+		ImGui::Text("scalar: %.3f ms/frame", simdResult.scalarMilliseconds);
+		ImGui::Text("%s: %.3f ms/frame (x%.2f)", CpuFeature::GetSimdLevelName(simdResult.simdLevel),
+			simdResult.simdMilliseconds, simdResult.GetSpeedup());
+		if (simdResult.outputsMatch) {
+			ImGui::Text("結果: 一致");
+		} else {
+			ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "結果: 不一致");
+		}
+	}
+
+	ImGui::Separator();
+
+	if (ImGui::Button("並列ベンチマーク (8 x 50k, 1-16スレッド)")) {
+		jobResults = ParticleJobBenchmark::Run(8, 50000, 60, 16);
+	}
+
+	for (const auto& result : jobResults) {
+		double slowestSystem = 0.0;
+		for (double milliseconds : result.systemMilliseconds) {
+			slowestSystem = (std::max)(slowestSystem, milliseconds);
+		}
+
+		ImGui::Text("%2u threads: %.3f ms/frame (x%.2f) | 最遅システム %.3f ms", result.threadCount,
+			result.frameMilliseconds, result.speedup, slowestSystem);
+		if (!result.matchesSerial) {
+			ImGui::SameLine();
+			ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "[不一致]");
+		}
+	}
+
+	ImGui::Separator();
+
+	if (ImGui::Button("描画データベンチマーク (100k)")) {
+		renderDataResult = ParticleRenderDataBenchmark::Run(100000, 60);
+	}
+
+	if (renderDataResult.frameCount > 0) {
+		ImGui::Text("行列: %.3f ms/frame (%zu KB)", renderDataResult.matrixMilliseconds, renderDataResult.matrixBytes / 1024);
+		ImGui::Text("圧縮 scalar: %.3f ms/frame", renderDataResult.packedScalarMilliseconds);
+		ImGui::Text("圧縮 %s: %.3f ms/frame (%zu KB, x%.2f)", CpuFeature::GetSimdLevelName(renderDataResult.simdLevel),
+			renderDataResult.packedMilliseconds, renderDataResult.packedBytes / 1024, renderDataResult.GetSpeedup());
+		ImGui::Text("転送量: 1/%.1f | 最大位置誤差 %.2e", renderDataResult.GetBandwidthRatio(), renderDataResult.maxPositionError);
+	}
+
+	ImGui::Separator();
+
+	if (ImGui::Button("深度ソートベンチマーク (10k/50k/100k)")) {
+		sortResults = ParticleSortBenchmark::Run(60);
+	}
+
+	for (const auto& result : sortResults) {
+		ImGui::Text("%6u: std::sort %.3f ms | 基数ソート %.3f ms (x%.2f)", result.particleCount,
+			result.stdSortMilliseconds, result.radixMilliseconds, result.GetSpeedup());
+		if (!result.ordersMatch) {
+			ImGui::SameLine();
+			ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "[不一致]");
+		}
+	}
+
+	ImGui::Separator();
+
+	if (ImGui::Button("固定ステップ決定性テスト (60/30/120/144Hz)")) {
+		replayResults = ParticleReplayTest::Run(particleSystem->dxCommon_, particleSystem->resourceFactory_);
+	}
+
+	for (const auto& result : replayResults) {
+		ImGui::Text("%3u Hz: %u フレーム / %llu ステップ / %u 個", result.frameRate, result.frameCount,
+			static_cast<unsigned long long>(result.stepCount), result.particleCount);
+		ImGui::SameLine();
+		if (result.matchesReference) {
+			ImGui::Text("一致");
+		} else {
+			ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "[不一致]");
+		}
+	}
+}
+
 #endif // _DEBUG
@@ -35,8 +35,15 @@ private:
 	/// @brief エミッター設定UI表示
 	static void ShowEmitterSettings(ParticleSystem* particleSystem);
 
+	/// @brief シミュレーション時計の設定UI表示
+	static void ShowClockSettings(ParticleSystem* particleSystem);
+
 	/// @brief 統計情報表示
 	static void ShowStatistics(ParticleSystem* particleSystem);
+
+	/// @brief ベンチマーク実行UI表示
+	/// @param particleSystem 対象のパーティクルシステム（決定性テスト用システムの初期化に使用）
+	static void ShowBenchmark(ParticleSystem* particleSystem);
 };
 
 #endif // _DEBUG
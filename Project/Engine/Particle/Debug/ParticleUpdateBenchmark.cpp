@@ -0,0 +1,397 @@
+#include "ParticleUpdateBenchmark.h"
+#include "Engine/Particle/ParticleSystem.h"
+#include "Engine/Particle/Core/ParticlePool.h"
+#include "Engine/Particle/Core/ParticleUpdater.h"
+#include "Engine/Particle/Core/ParticleSimd.h"
+#include "Engine/Utility/Logger/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <list>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace {
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+	constexpr uint32_t kSeed = 12345;
+
+	/// @brief 計測用のパーティクルを生成（シード固定で毎回同じ内容）
+	std::vector<Particle> CreateParticles(uint32_t count) {
+		std::mt19937 engine(kSeed);
+		std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+		std::uniform_real_distribution<float> velocity(-2.0f, 2.0f);
+		std::uniform_real_distribution<float> lifeTime(0.5f, 3.0f);
+
+		std::vector<Particle> particles(count);
+		for (auto& particle : particles) {
+			particle.transform.translate = { position(engine), position(engine), position(engine) };
+			particle.transform.rotate = { 0.0f, 0.0f, 0.0f };
+			particle.transform.scale = { 1.0f, 1.0f, 1.0f };
+			particle.initialScale = particle.transform.scale;
+			particle.velocity = { velocity(engine), velocity(engine), velocity(engine) };
+			particle.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+			particle.initialColor = particle.color;
+			particle.lifeTime = lifeTime(engine);
+			particle.currentTime = 0.0f;
+			particle.rotationSpeed = { 0.0f, 0.0f, 1.0f };
+		}
+		return particles;
+	}
+
+	// ──────────────────────────────────────────────────────────
+	// 旧来の1パーティクルずつの更新（比較用のリファレンス実装）
+	// モジュールには一括更新しか無いので、旧実装の処理をここに残す
+	// ──────────────────────────────────────────────────────────
+
+	/// @brief ライフタイム係数を取得（寿命が0以下なら終了扱い）
+	float GetLifetimeRatio(const Particle& particle) {
+		if (particle.lifeTime <= 0.0f) {
+			return 1.0f;
+		}
+		return std::clamp(particle.currentTime / particle.lifeTime, 0.0f, 1.0f);
+	}
+
+	/// @brief 角度をラジアンに変換
+	float DegreesToRadians(float degrees) {
+		return degrees * std::numbers::pi_v<float> / 180.0f;
+	}
+
+	/// @brief 角度を正規化（-π〜πの範囲に）
+	float NormalizeAngle(float angle) {
+		while (angle > std::numbers::pi_v<float>) {
+			angle -= 2.0f * std::numbers::pi_v<float>;
+		}
+		while (angle < -std::numbers::pi_v<float>) {
+			angle += 2.0f * std::numbers::pi_v<float>;
+		}
+		return angle;
+	}
+
+	/// @brief 力を適用
+	void ApplyForces(const ForceModule& force, Particle& particle, float deltaTime, float gravityModifier) {
+		if (!force.IsEnabled()) {
+			return;
+		}
+		const ForceModule::ForceData& data = force.GetForceData();
+
+		particle.velocity.x += data.gravity.x * gravityModifier * deltaTime;
+		particle.velocity.y += data.gravity.y * gravityModifier * deltaTime;
+		particle.velocity.z += data.gravity.z * gravityModifier * deltaTime;
+
+		particle.velocity.x += data.wind.x * deltaTime;
+		particle.velocity.y += data.wind.y * deltaTime;
+		particle.velocity.z += data.wind.z * deltaTime;
+
+		if (data.drag > 0.0f) {
+			const float dragFactor = (std::max)(0.0f, 1.0f - data.drag * deltaTime);
+			particle.velocity.x *= dragFactor;
+			particle.velocity.y *= dragFactor;
+			particle.velocity.z *= dragFactor;
+		}
+
+		if (data.useAccelerationField && CollisionUtils::IsColliding(particle.transform.translate, data.area)) {
+			particle.velocity.x += data.acceleration.x * deltaTime;
+			particle.velocity.y += data.acceleration.y * deltaTime;
+			particle.velocity.z += data.acceleration.z * deltaTime;
+		}
+	}
+
+	/// @brief 色を更新
+	void UpdateColor(const ColorModule& color, Particle& particle) {
+		const ColorModule::ColorOverLifetime& data = color.GetColorData();
+		if (!color.IsEnabled() || !data.useGradient) {
+			return;
+		}
+
+		float t = particle.currentTime / particle.lifeTime;
+		t = (std::max)(0.0f, (std::min)(1.0f, t));
+
+		const Vector4& start = particle.initialColor;
+		particle.color = {
+			start.x + (data.endColor.x - start.x) * t,
+			start.y + (data.endColor.y - start.y) * t,
+			start.z + (data.endColor.z - start.z) * t,
+			start.w + (data.endColor.w - start.w) * t
+		};
+	}
+
+	/// @brief サイズのカーブを適用
+	float ApplySizeCurve(float t, SizeModule::SizeData::SizeCurve curve) {
+		switch (curve) {
+		case SizeModule::SizeData::SizeCurve::EaseIn:
+			return t * t;
+		case SizeModule::SizeData::SizeCurve::EaseOut:
+			return 1.0f - (1.0f - t) * (1.0f - t);
+		case SizeModule::SizeData::SizeCurve::EaseInOut:
+			return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
+		case SizeModule::SizeData::SizeCurve::Constant:
+			return 0.0f;
+		default:
+			return t;
+		}
+	}
+
+	/// @brief サイズを更新
+	void UpdateSize(const SizeModule& size, Particle& particle) {
+		const SizeModule::SizeData& data = size.GetSizeData();
+		if (!size.IsEnabled() || !data.sizeOverLifetime) {
+			return;
+		}
+
+		const float curveValue = ApplySizeCurve(GetLifetimeRatio(particle), data.sizeCurve);
+
+		if (data.use3DSize) {
+			const Vector3& start = particle.initialScale;
+			particle.transform.scale = {
+				std::clamp(start.x + (data.endSize3D.x - start.x) * curveValue, data.minSize, data.maxSize),
+				std::clamp(start.y + (data.endSize3D.y - start.y) * curveValue, data.minSize, data.maxSize),
+				std::clamp(start.z + (data.endSize3D.z - start.z) * curveValue, data.minSize, data.maxSize)
+			};
+		} else {
+			const float start = particle.initialScale.x;
+			const float current = std::clamp(start + (data.endSize - start) * curveValue, data.minSize, data.maxSize);
+			particle.transform.scale = { current, current, current };
+		}
+	}
+
+	/// @brief 回転を更新
+	void UpdateRotation(RotationModule& rotation, Particle& particle, float deltaTime) {
+		if (!rotation.IsEnabled()) {
+			return;
+		}
+		const RotationModule::RotationData& data = rotation.GetRotationData();
+
+		Vector3 speed = particle.rotationSpeed;
+
+		if (data.rotationOverLifetime) {
+			const float multiplier = data.startRotationSpeedMultiplier +
+				(data.endRotationSpeedMultiplier - data.startRotationSpeedMultiplier) * GetLifetimeRatio(particle);
+			speed.x *= multiplier;
+			speed.y *= multiplier;
+			speed.z *= multiplier;
+		}
+
+		if (data.alignToVelocity) {
+			const Vector3 alignment = rotation.CalculateVelocityAlignment(particle.velocity);
+			speed.x += alignment.x * data.velocityAlignmentStrength;
+			speed.y += alignment.y * data.velocityAlignmentStrength;
+			speed.z += alignment.z * data.velocityAlignmentStrength;
+		}
+
+		Vector3& rotate = particle.transform.rotate;
+		rotate.x += speed.x * deltaTime;
+		rotate.y += speed.y * deltaTime;
+		rotate.z += speed.z * deltaTime;
+
+		if (data.limitRotationRange) {
+			rotate.x = std::clamp(rotate.x, DegreesToRadians(data.minRotation.x), DegreesToRadians(data.maxRotation.x));
+			rotate.y = std::clamp(rotate.y, DegreesToRadians(data.minRotation.y), DegreesToRadians(data.maxRotation.y));
+			rotate.z = std::clamp(rotate.z, DegreesToRadians(data.minRotation.z), DegreesToRadians(data.maxRotation.z));
+		} else {
+			rotate.x = NormalizeAngle(rotate.x);
+			rotate.y = NormalizeAngle(rotate.y);
+			rotate.z = NormalizeAngle(rotate.z);
+		}
+	}
+
+	/// @brief ノイズを適用
+	void ApplyNoise(NoiseModule& noise, Particle& particle, float deltaTime) {
+		if (!noise.IsEnabled()) {
+			return;
+		}
+
+		const Vector3 offset = noise.CalculateNoiseOffset(particle.transform.translate, particle.currentTime, particle.lifeTime);
+		particle.transform.translate.x += offset.x * deltaTime;
+		particle.transform.translate.y += offset.y * deltaTime;
+		particle.transform.translate.z += offset.z * deltaTime;
+	}
+
+	/// @brief 旧来の std::list による逐次更新（比較用のリファレンス実装）
+	uint32_t UpdateListReference(
+		std::list<Particle>& particles,
+		ForceModule& force, ColorModule& color, SizeModule& size,
+		RotationModule& rotation, NoiseModule& noise,
+		float deltaTime
+	) {
+		uint32_t destroyedCount = 0;
+
+		for (auto it = particles.begin(); it != particles.end();) {
+			it->currentTime += deltaTime;
+			if (it->currentTime >= it->lifeTime) {
+				it = particles.erase(it);
+				++destroyedCount;
+				continue;
+			}
+
+			ApplyForces(force, *it, deltaTime, 1.0f);
+			it->transform.translate.x += it->velocity.x * deltaTime;
+			it->transform.translate.y += it->velocity.y * deltaTime;
+			it->transform.translate.z += it->velocity.z * deltaTime;
+			UpdateColor(color, *it);
+			UpdateSize(size, *it);
+			UpdateRotation(rotation, *it, deltaTime);
+			ApplyNoise(noise, *it, deltaTime);
+
+			++it;
+		}
+
+		return destroyedCount;
+	}
+
+	/// @brief 配列の内容がビット単位で一致するか
+	template<typename T>
+	bool IsSameBits(const T* a, const T* b, uint32_t count) {
+		return std::memcmp(a, b, sizeof(T) * count) == 0;
+	}
+
+	/// @brief 2つのプールの内容がビット単位で一致するか
+	bool IsSamePool(const ParticlePool& a, const ParticlePool& b) {
+		const uint32_t count = a.GetCount();
+		return count == b.GetCount() &&
+			IsSameBits(a.GetPositions(), b.GetPositions(), count) &&
+			IsSameBits(a.GetVelocities(), b.GetVelocities(), count) &&
+			IsSameBits(a.GetColors(), b.GetColors(), count) &&
+			IsSameBits(a.GetScales(), b.GetScales(), count) &&
+			IsSameBits(a.GetRotations(), b.GetRotations(), count) &&
+			IsSameBits(a.GetAges(), b.GetAges(), count);
+	}
+}
+
+ParticleUpdateBenchmark::Result ParticleUpdateBenchmark::Run(uint32_t particleCount, uint32_t frameCount) {
+	using Clock = std::chrono::steady_clock;
+
+	Result result;
+	result.particleCount = particleCount;
+	result.frameCount = frameCount;
+
+	if (particleCount == 0 || frameCount == 0) {
+		return result;
+	}
+
+	// 両方の経路で同じ設定のモジュールを使用
+	ForceModule forceModule;
+	ColorModule colorModule;
+	SizeModule sizeModule;
+	RotationModule rotationModule;
+	NoiseModule noiseModule;
+
+	const std::vector<Particle> source = CreateParticles(particleCount);
+
+	// ──────────────────────────────────────────────────────────
+	// std::list（旧実装）
+	// ──────────────────────────────────────────────────────────
+	{
+		std::list<Particle> particles(source.begin(), source.end());
+
+		auto start = Clock::now();
+		for (uint32_t frame = 0; frame < frameCount; ++frame) {
+			UpdateListReference(particles, forceModule, colorModule, sizeModule, rotationModule, noiseModule, kDeltaTime);
+		}
+		auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start);
+
+		result.listMilliseconds = elapsed.count() / frameCount;
+		result.listSurvivors = static_cast<uint32_t>(particles.size());
+	}
+
+	// ──────────────────────────────────────────────────────────
+	// ParticlePool（SoA + バッチ更新）
+	// ──────────────────────────────────────────────────────────
+	{
+		ParticlePool pool;
+		pool.Initialize(particleCount);
+		for (const auto& particle : source) {
+			pool.Push(particle);
+		}
+
+		ParticleUpdater updater;
+		updater.Initialize(&forceModule, &colorModule, &sizeModule, &rotationModule, &noiseModule);
+
+		auto start = Clock::now();
+		for (uint32_t frame = 0; frame < frameCount; ++frame) {
+			updater.UpdateParticles(pool, kDeltaTime, 1.0f);
+		}
+		auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start);
+
+		result.poolMilliseconds = elapsed.count() / frameCount;
+		result.poolSurvivors = pool.GetCount();
+	}
+
+	Logger::GetInstance().Log(
+		std::format("ParticleUpdateBenchmark: {} particles x {} frames | list {:.3f} ms/frame | pool {:.3f} ms/frame | x{:.2f}",
+			particleCount, frameCount, result.listMilliseconds, result.poolMilliseconds, result.GetSpeedup()),
+		LogLevel::INFO, LogCategory::System);
+
+	return result;
+}
+
+ParticleUpdateBenchmark::SimdResult ParticleUpdateBenchmark::RunSimd(uint32_t particleCount, uint32_t frameCount) {
+	using Clock = std::chrono::steady_clock;
+
+	SimdResult result;
+	result.particleCount = particleCount;
+	result.frameCount = frameCount;
+	result.simdLevel = CpuFeature::GetMaxSimdLevel();
+
+	if (particleCount == 0 || frameCount == 0) {
+		return result;
+	}
+
+	// 各カーネルを通る設定にする（抵抗・カーブ・角度正規化）
+	ForceModule forceModule;
+	ForceModule::ForceData forceData = forceModule.GetForceData();
+	forceData.drag = 0.1f;
+	forceModule.SetForceData(forceData);
+
+	ColorModule colorModule;
+
+	SizeModule sizeModule;
+	SizeModule::SizeData sizeData = sizeModule.GetSizeData();
+	sizeData.sizeCurve = SizeModule::SizeModule::SizeData::SizeCurve::EaseInOut;
+	sizeModule.SetSizeData(sizeData);
+
+	RotationModule rotationModule;
+
+	NoiseModule noiseModule;
+	noiseModule.SetEnabled(false);
+
+	const std::vector<Particle> source = CreateParticles(particleCount);
+	const CpuFeature::SimdLevel previousLevel = ParticleSimd::GetSimdLevel();
+
+	// 指定レベルでプールを更新し、1フレームあたりの平均時間を返す
+	auto measure = [&](CpuFeature::SimdLevel level, ParticlePool& pool) {
+		pool.Initialize(particleCount);
+		for (const auto& particle : source) {
+			pool.Push(particle);
+		}
+
+		ParticleUpdater updater;
+		updater.Initialize(&forceModule, &colorModule, &sizeModule, &rotationModule, &noiseModule);
+
+		ParticleSimd::SetSimdLevel(level);
+		auto start = Clock::now();
+		for (uint32_t frame = 0; frame < frameCount; ++frame) {
+			updater.UpdateParticles(pool, kDeltaTime, 1.0f);
+		}
+		auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start);
+		return elapsed.count() / frameCount;
+	};
+
+	ParticlePool scalarPool;
+	ParticlePool simdPool;
+	result.scalarMilliseconds = measure(CpuFeature::SimdLevel::Scalar, scalarPool);
+	result.simdMilliseconds = measure(result.simdLevel, simdPool);
+	result.outputsMatch = IsSamePool(scalarPool, simdPool);
+
+	ParticleSimd::SetSimdLevel(previousLevel);
+
+	Logger::GetInstance().Log(
+		std::format("ParticleUpdateBenchmark: {} particles x {} frames | scalar {:.3f} ms/frame | {} {:.3f} ms/frame | x{:.2f} | output {}",
+			particleCount, frameCount, result.scalarMilliseconds,
+			CpuFeature::GetSimdLevelName(result.simdLevel), result.simdMilliseconds, result.GetSpeedup(),
+			result.outputsMatch ? "match" : "MISMATCH"),
+		result.outputsMatch ? LogLevel::INFO : LogLevel::WARNING, LogCategory::System);
+
+	return result;
+}
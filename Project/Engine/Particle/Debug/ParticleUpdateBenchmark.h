@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include "Engine/Utility/CpuFeature/CpuFeature.h"
+
+/// @brief パーティクル更新処理のマイクロベンチマーク（GPU不要）
+/// 旧来の std::list<Particle> による逐次更新と、ParticlePool によるバッチ更新を同条件で計測する
+/// また、バッチ更新のSIMDカーネルをスカラー実装と比較する
+class ParticleUpdateBenchmark {
+public:
+	/// @brief 計測結果
+	struct Result {
+		uint32_t particleCount = 0;     // 初期パーティクル数
+		uint32_t frameCount = 0;        // 計測フレーム数
+		double listMilliseconds = 0.0;  // 1フレームあたりの平均更新時間（list）
+		double poolMilliseconds = 0.0;  // 1フレームあたりの平均更新時間（pool）
+		uint32_t listSurvivors = 0;     // 計測後の生存数（list）
+		uint32_t poolSurvivors = 0;     // 計測後の生存数（pool、listと一致するはず）
+
+		/// @brief list比の速度向上率を取得
+		double GetSpeedup() const { return poolMilliseconds > 0.0 ? listMilliseconds / poolMilliseconds : 0.0; }
+	};
+
+	/// @brief SIMD計測結果
+	struct SimdResult {
+		uint32_t particleCount = 0;       // 初期パーティクル数
+		uint32_t frameCount = 0;          // 計測フレーム数
+		CpuFeature::SimdLevel simdLevel = CpuFeature::SimdLevel::Scalar; // 計測に使用したSIMDレベル
+		double scalarMilliseconds = 0.0;  // 1フレームあたりの平均更新時間（スカラー）
+		double simdMilliseconds = 0.0;    // 1フレームあたりの平均更新時間（SIMD）
+		bool outputsMatch = false;        // 両者の結果がビット単位で一致したか
+
+		/// @brief スカラー比の速度向上率を取得
+		double GetSpeedup() const { return simdMilliseconds > 0.0 ? scalarMilliseconds / simdMilliseconds : 0.0; }
+	};
+
+	/// @brief ベンチマークを実行
+	/// @param particleCount パーティクル数
+	/// @param frameCount 計測するフレーム数
+	/// @return 計測結果（ログにも出力される）
+	static Result Run(uint32_t particleCount = 100000, uint32_t frameCount = 60);
+
+	/// @brief バッチ更新をスカラー実装と利用可能な最上位のSIMD実装で計測
+	/// ノイズはスカラー実装のみのため無効化し、SIMD化した処理だけを比較する
+	/// @param particleCount パーティクル数
+	/// @param frameCount 計測するフレーム数
+	/// @return 計測結果（ログにも出力される）
+	static SimdResult RunSimd(uint32_t particleCount = 100000, uint32_t frameCount = 60);
+};
@@ -1,5 +1,7 @@
 #include "ColorModule.h"
 #include "../ParticleSystem.h" // Particle構造体のために必要
+#include "../Core/ParticlePool.h"
+#include "../Core/ParticleSimd.h"
 #include <algorithm>
 
 // コンストラクタでデフォルトパラメータを設定
@@ -8,18 +10,18 @@ ColorModule::ColorModule() {
     colorData_.useGradient = true;
 }
 
-void ColorModule::UpdateColor(Particle& particle) {
+void ColorModule::UpdateColorBatch(ParticlePool& pool, const ParticleRange& range, const float* lifetimeRatios) {
     if (!enabled_ || !colorData_.useGradient) {
         return;
     }
 
-// ライフタイムに基づいて色を補間
-    // MainModuleで設定された初期色（initialColor）から終了色へ補間
-    float t = particle.currentTime / particle.lifeTime;
-    t = (std::max)(0.0f, (std::min)(1.0f, t)); // 0-1の範囲に制限
-
-    // particle.initialColorを開始色として使用
-    particle.color = LerpColor(particle.initialColor, colorData_.endColor, t);
+    // initialColorから終了色へ補間（係数はUpdater側で0-1に制限済み）
+    ParticleSimd::LerpColors(
+        pool.GetColors() + range.begin,
+        pool.GetInitialColors() + range.begin,
+        colorData_.endColor,
+        lifetimeRatios + range.begin,
+        range.GetCount());
 }
 
 #ifdef _DEBUG
@@ -49,11 +51,3 @@ bool ColorModule::ShowImGui() {
 }
 #endif
 
-Vector4 ColorModule::LerpColor(const Vector4& color1, const Vector4& color2, float t) {
-    return {
-        color1.x + (color2.x - color1.x) * t,
-     color1.y + (color2.y - color1.y) * t,
-        color1.z + (color2.z - color1.z) * t,
-        color1.w + (color2.w - color1.w) * t
-    };
-}
\ No newline at end of file
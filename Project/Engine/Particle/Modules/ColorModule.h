@@ -4,6 +4,8 @@
 #include "MathCore.h"
 
 struct Particle;
+class ParticlePool;
+struct ParticleRange;
 
 /// @brief パーティクルの色モジュール
 /// 注意: 初期色の設定はMainModuleで行います
@@ -26,9 +28,11 @@ public:
     /// @return 色データの参照
     const ColorOverLifetime& GetColorData() const { return colorData_; }
 
-    /// @brief パーティクルの色を更新
-    /// @param particle 対象のパーティクル
-    void UpdateColor(Particle& particle);
+    /// @brief プール内の指定区間のパーティクルの色を一括更新
+    /// @param pool パーティクルプール
+    /// @param range 処理する区間
+    /// @param lifetimeRatios 各パーティクルのライフタイム係数（0.0f - 1.0f、プールと同じ並び）
+    void UpdateColorBatch(ParticlePool& pool, const ParticleRange& range, const float* lifetimeRatios);
 
 #ifdef _DEBUG
     /// @brief ImGuiデバッグ表示
@@ -38,11 +42,4 @@ public:
 
 private:
     ColorOverLifetime colorData_;
-
-    /// @brief 2つの色を線形補間
-    /// @param color1 開始色
-    /// @param color2 終了色
-    /// @param t 補間係数 (0.0f - 1.0f)
-    /// @return 補間された色
-    Vector4 LerpColor(const Vector4& color1, const Vector4& color2, float t);
 };
\ No newline at end of file
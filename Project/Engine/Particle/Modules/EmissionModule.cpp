@@ -1,5 +1,6 @@
 #include "EmissionModule.h"
 #include "../ParticleSystem.h" // Particle構造体のために必要
+#include <algorithm>
 
 #ifdef _DEBUG
 #include "Engine/Utility/Debug/ImGui/ImguiManager.h"
@@ -12,29 +13,48 @@ EmissionModule::EmissionModule() {
 }
 
 uint32_t EmissionModule::CalculateEmissionCount(float deltaTime) {
-  if (!enabled_ || !isPlaying_) {
+    lastBurstCount_ = 0;
+    lastAccumulatorStart_ = emissionAccumulator_;
+
+    if (!enabled_ || !isPlaying_) {
         return 0;
     }
 
     uint32_t totalCount = 0;
 
-  // Rate over Time による放出
+    // Burst による放出（一度だけ）
+    // UpdateTimeで今ステップ分の時間が加算済みのため、ステップ開始時刻からの差がバーストの発生時刻になる
+    if (!hasBurst_ && emissionData_.burstCount > 0 && elapsedTime_ >= emissionData_.burstTime) {
+        totalCount += emissionData_.burstCount;
+        lastBurstCount_ = emissionData_.burstCount;
+        lastBurstTime_ = (std::min)((std::max)(emissionData_.burstTime - (elapsedTime_ - deltaTime), 0.0f), deltaTime);
+        hasBurst_ = true;
+    }
+
+    // Rate over Time による放出
     if (emissionData_.rateOverTime > 0) {
-     emissionAccumulator_ += static_cast<float>(emissionData_.rateOverTime) * deltaTime;
-  
-    if (emissionAccumulator_ >= 1.0f) {
+        emissionAccumulator_ += static_cast<float>(emissionData_.rateOverTime) * deltaTime;
+
+        if (emissionAccumulator_ >= 1.0f) {
             totalCount += static_cast<uint32_t>(emissionAccumulator_);
-        emissionAccumulator_ -= static_cast<float>(static_cast<uint32_t>(emissionAccumulator_));
+            emissionAccumulator_ -= static_cast<float>(static_cast<uint32_t>(emissionAccumulator_));
         }
     }
 
-    // Burst による放出（一度だけ）
-  if (!hasBurst_ && emissionData_.burstCount > 0 && elapsedTime_ >= emissionData_.burstTime) {
-  totalCount += emissionData_.burstCount;
-        hasBurst_ = true;
+    return totalCount;
+}
+
+float EmissionModule::GetSpawnTime(uint32_t index) const {
+    if (index < lastBurstCount_) {
+        return lastBurstTime_;
     }
 
-    return totalCount;
+    // 累積値が整数を跨いだ時刻が放出時刻（n番目は累積値が n に達した時点）
+    if (emissionData_.rateOverTime == 0) {
+        return 0.0f;
+    }
+    const float threshold = static_cast<float>(index - lastBurstCount_ + 1) - lastAccumulatorStart_;
+    return (std::max)(threshold, 0.0f) / static_cast<float>(emissionData_.rateOverTime);
 }
 
 void EmissionModule::UpdateTime(float deltaTime) {
@@ -93,7 +113,7 @@ bool EmissionModule::ShowImGui() {
     if (emissionData_.rateOverTime > 0) {
         float interval = 1.0f / static_cast<float>(emissionData_.rateOverTime);
         ImGui::Text("放出間隔: 約%.3f秒ごとに1個", interval);
-        ImGui::TextDisabled("注意: フレームレートにより多少ばらつきます（Unity準拠）");
+        ImGui::TextDisabled("フレーム内の放出時刻は補間されるため、フレームレートによらず等間隔に放出されます");
     }
 
     ImGui::Separator();
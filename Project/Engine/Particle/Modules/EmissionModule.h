@@ -34,6 +34,12 @@ public:
 	/// @return 放出すべきパーティクル数
 	uint32_t CalculateEmissionCount(float deltaTime);
 
+	/// @brief 直前のCalculateEmissionCountで放出したパーティクルの放出時刻を取得
+	/// 1ステップの中で放出タイミングを分散させ、ステップ幅によらず等間隔に放出されるようにする
+	/// @param index 放出したパーティクルの番号（バースト分が先、Rate over Time分が後）
+	/// @return ステップ開始からの経過時間（秒）
+	float GetSpawnTime(uint32_t index) const;
+
 	/// @brief モジュールの時間を更新
 	  /// @param deltaTime フレーム時間
 	void UpdateTime(float deltaTime);
@@ -64,4 +70,9 @@ private:
 
 	// Rate over Time用の累積時間
 	float emissionAccumulator_ = 0.0f;
+
+	// 直前のCalculateEmissionCountの内訳（放出時刻の計算用）
+	uint32_t lastBurstCount_ = 0;
+	float lastBurstTime_ = 0.0f;          // ステップ開始からバースト発生までの時間
+	float lastAccumulatorStart_ = 0.0f;   // ステップ開始時点の累積値
 };
\ No newline at end of file
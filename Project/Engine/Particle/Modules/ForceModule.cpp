@@ -1,5 +1,7 @@
 #include "ForceModule.h"
 #include "../ParticleSystem.h" // Particle構造体のために必要
+#include "../Core/ParticlePool.h"
+#include "../Core/ParticleSimd.h"
 #include <algorithm>
 
 // コンストラクタでデフォルトパラメータを設定
@@ -12,37 +14,53 @@ ForceModule::ForceModule() {
  forceData_.area = BoundingBox();
 }
 
-void ForceModule::ApplyForces(Particle& particle, float deltaTime, float gravityModifier) {
+void ForceModule::ApplyForcesBatch(ParticlePool& pool, const ParticleRange& range, float deltaTime, float gravityModifier) {
 	if (!enabled_) {
 		return;
 	}
 
-	// 重力を適用（gravityModifierを考慮）
-	particle.velocity.x += forceData_.gravity.x * gravityModifier * deltaTime;
-	particle.velocity.y += forceData_.gravity.y * gravityModifier * deltaTime;
-	particle.velocity.z += forceData_.gravity.z * gravityModifier * deltaTime;
+	const uint32_t count = range.GetCount();
+	Vector3* velocities = pool.GetVelocities() + range.begin;
 
-	// 風力を適用
-	particle.velocity.x += forceData_.wind.x * deltaTime;
-	particle.velocity.y += forceData_.wind.y * deltaTime;
-	particle.velocity.z += forceData_.wind.z * deltaTime;
+	// 重力・風は全パーティクル共通のため、加算量を事前に計算
+	const Vector3 gravityDelta = {
+		forceData_.gravity.x * gravityModifier * deltaTime,
+		forceData_.gravity.y * gravityModifier * deltaTime,
+		forceData_.gravity.z * gravityModifier * deltaTime
+	};
+	const Vector3 windDelta = {
+		forceData_.wind.x * deltaTime,
+		forceData_.wind.y * deltaTime,
+		forceData_.wind.z * deltaTime
+	};
+
+	// 逐次版と丸め結果を一致させるため、重力と風は別々に加算する
+	ParticleSimd::AddVector3(velocities, gravityDelta, count);
+	ParticleSimd::AddVector3(velocities, windDelta, count);
 
 	// 抵抗力を適用
 	if (forceData_.drag > 0.0f) {
 		float dragFactor = 1.0f - (forceData_.drag * deltaTime);
 		dragFactor = (std::max)(0.0f, dragFactor); // 負の値にならないように
 
-		particle.velocity.x *= dragFactor;
-		particle.velocity.y *= dragFactor;
-		particle.velocity.z *= dragFactor;
+		ParticleSimd::ScaleVector3(velocities, dragFactor, count);
 	}
 
 	// 加速度フィールドを適用
 	if (forceData_.useAccelerationField) {
-		if (CollisionUtils::IsColliding(particle.transform.translate, forceData_.area)) {
-			particle.velocity.x += forceData_.acceleration.x * deltaTime;
-			particle.velocity.y += forceData_.acceleration.y * deltaTime;
-			particle.velocity.z += forceData_.acceleration.z * deltaTime;
+		const Vector3* positions = pool.GetPositions() + range.begin;
+		const Vector3 accelerationDelta = {
+			forceData_.acceleration.x * deltaTime,
+			forceData_.acceleration.y * deltaTime,
+			forceData_.acceleration.z * deltaTime
+		};
+
+		for (uint32_t i = 0; i < count; ++i) {
+			if (CollisionUtils::IsColliding(positions[i], forceData_.area)) {
+				velocities[i].x += accelerationDelta.x;
+				velocities[i].y += accelerationDelta.y;
+				velocities[i].z += accelerationDelta.z;
+			}
 		}
 	}
 }
@@ -5,6 +5,8 @@
 #include "Engine/Utility/Collision/CollisionUtils.h"
 
 struct Particle;
+class ParticlePool;
+struct ParticleRange;
 
 /// @brief パーティクルの力場モジュール
 class ForceModule : public ParticleModule {
@@ -31,11 +33,12 @@ public:
     /// @return 力データの参照
     const ForceData& GetForceData() const { return forceData_; }
 
-    /// @brief パーティクルに力を適用（gravityModifier対応）
-    /// @param particle 対象のパーティクル
+    /// @brief プール内の指定区間のパーティクルに力を一括適用
+    /// @param pool パーティクルプール
+    /// @param range 処理する区間
     /// @param deltaTime フレーム時間
     /// @param gravityModifier 重力倍率（MainModuleから取得）
-    void ApplyForces(Particle& particle, float deltaTime, float gravityModifier);
+    void ApplyForcesBatch(ParticlePool& pool, const ParticleRange& range, float deltaTime, float gravityModifier);
 
 #ifdef _DEBUG
     /// @brief ImGuiデバッグ表示
@@ -150,7 +150,7 @@ bool MainModule::ShowImGui() {
 	
 	changed |= ImGui::Checkbox("起動時に再生", &mainData_.playOnAwake);
 	
-	changed |= ImGui::DragInt("最大パーティクル数", reinterpret_cast<int*>(&mainData_.maxParticles), 10, 1, 10000);
+	changed |= ImGui::DragInt("最大パーティクル数", reinterpret_cast<int*>(&mainData_.maxParticles), 10, 1, static_cast<int>(kMaxParticlesLimit));
 
 	// シミュレーション空間
 	{
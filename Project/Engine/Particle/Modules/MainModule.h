@@ -7,6 +7,9 @@
 /// Unityの「Main Module」に相当
 class MainModule : public ParticleModule {
 public:
+	// maxParticlesに設定できる上限（プール容量の絶対上限）
+	static constexpr uint32_t kMaxParticlesLimit = 262144;
+
 	/// @brief シミュレーション空間
 	enum class SimulationSpace {
 		Local,  // ローカル空間（エミッターに追従）
@@ -1,5 +1,6 @@
 #include "NoiseModule.h"
 #include "../ParticleSystem.h" // Particle構造体のために必要
+#include "../Core/ParticlePool.h"
 #include <cmath>
 
 using namespace MathCore;
@@ -12,13 +13,27 @@ NoiseModule::NoiseModule() {
 	noiseData_.positionAmount = { 1.0f, 1.0f, 1.0f };
 }
 
-void NoiseModule::ApplyNoise(Particle& particle, float deltaTime) {
+void NoiseModule::ApplyNoiseBatch(ParticlePool& pool, const ParticleRange& range, float deltaTime) {
 	if (!enabled_) {
 		return;
 	}
 
+	Vector3* positions = pool.GetPositions();
+	const float* ages = pool.GetAges();
+	const float* lifeTimes = pool.GetLifeTimes();
+
+	for (uint32_t i = range.begin; i < range.end; ++i) {
+		Vector3 noiseOffset = CalculateNoiseOffset(positions[i], ages[i], lifeTimes[i]);
+
+		positions[i].x += noiseOffset.x * deltaTime;
+		positions[i].y += noiseOffset.y * deltaTime;
+		positions[i].z += noiseOffset.z * deltaTime;
+	}
+}
+
+Vector3 NoiseModule::CalculateNoiseOffset(const Vector3& position, float currentTime, float lifeTime) {
 	// ライフタイムの進行度 (0.0 - 1.0)
-	float lifeRatio = particle.currentTime / particle.lifeTime;
+	float lifeRatio = currentTime / lifeTime;
 
 	// 減衰係数の計算
 	float dampingFactor = 1.0f;
@@ -28,13 +43,13 @@ void NoiseModule::ApplyNoise(Particle& particle, float deltaTime) {
 	}
 
 	// 時間ベースのオフセット（パーティクルの経過時間を使用）
-	float timeOffset = particle.currentTime * noiseData_.scrollSpeed;
+	float timeOffset = currentTime * noiseData_.scrollSpeed;
 
 	// ノイズ計算用の座標（パーティクルの位置と時間を使用）
 	Vector3 noiseCoord = {
-		(particle.transform.translate.x + timeOffset) * noiseData_.frequency,
-		(particle.transform.translate.y + timeOffset) * noiseData_.frequency,
-	  (particle.transform.translate.z + particle.currentTime) * noiseData_.frequency
+		(position.x + timeOffset) * noiseData_.frequency,
+		(position.y + timeOffset) * noiseData_.frequency,
+		(position.z + currentTime) * noiseData_.frequency
 	};
 
 	// 各軸のノイズを計算
@@ -43,16 +58,11 @@ void NoiseModule::ApplyNoise(Particle& particle, float deltaTime) {
 	float noiseZ = PerlinNoise3D(noiseCoord.x, noiseCoord.y + 100.0f, noiseCoord.z);
 
 	// ノイズによるオフセットを計算
-	Vector3 noiseOffset = {
+	return {
 		noiseX * noiseData_.positionAmount.x * noiseData_.strength * dampingFactor,
 		noiseY * noiseData_.positionAmount.y * noiseData_.strength * dampingFactor,
 		noiseZ * noiseData_.positionAmount.z * noiseData_.strength * dampingFactor
 	};
-
-	// パーティクルの位置にノイズを適用
-	particle.transform.translate.x += noiseOffset.x * deltaTime;
-	particle.transform.translate.y += noiseOffset.y * deltaTime;
-	particle.transform.translate.z += noiseOffset.z * deltaTime;
 }
 
 #ifdef _DEBUG
@@ -4,6 +4,8 @@
 #include "MathCore.h"
 
 struct Particle;
+class ParticlePool;
+struct ParticleRange;
 
 /// @brief パーティクルのノイズモジュール（Unity Noise Module相当）
 /// パーリンノイズによる位置の揺らぎを追加します
@@ -33,10 +35,18 @@ public:
 	/// @return ノイズデータの参照
 	NoiseData& GetNoiseData() { return noiseData_; }
 	
-	/// @brief パーティクルにノイズを適用
-	/// @param particle 対象のパーティクル
+	/// @brief プール内の指定区間のパーティクルにノイズを一括適用
+	/// @param pool パーティクルプール
+	/// @param range 処理する区間
 	/// @param deltaTime フレーム時間
-	void ApplyNoise(Particle& particle, float deltaTime);
+	void ApplyNoiseBatch(ParticlePool& pool, const ParticleRange& range, float deltaTime);
+
+	/// @brief ノイズによる速度オフセットを計算
+	/// @param position パーティクルの位置
+	/// @param currentTime パーティクルの経過時間
+	/// @param lifeTime パーティクルの寿命
+	/// @return 位置に加算するオフセット（秒あたり）
+	Vector3 CalculateNoiseOffset(const Vector3& position, float currentTime, float lifeTime);
 
 #ifdef _DEBUG
 	/// @brief ImGuiデバッグ表示
@@ -1,5 +1,7 @@
 #include "RotationModule.h"
 #include "../ParticleSystem.h"
+#include "../Core/ParticlePool.h"
+#include "../Core/ParticleSimd.h"
 #include <numbers>
 #include <algorithm>
 
@@ -55,56 +57,64 @@ void RotationModule::ApplyInitialRotation(Particle& particle)
     }
 }
 
-void RotationModule::UpdateRotation(Particle& particle, float deltaTime)
+void RotationModule::UpdateRotationBatch(ParticlePool& pool, const ParticleRange& range, const float* lifetimeRatios, float deltaTime)
 {
     if (!enabled_) {
         return;
     }
 
-    // 現在の回転速度を取得
-    Vector3 currentRotationSpeed = particle.rotationSpeed;
-    
-    // ライフタイムで回転速度を変化させる
-    if (rotationData_.rotationOverLifetime) {
-        float lifetimeRatio = GetLifetimeRatio(particle);
-        float speedMultiplier = rotationData_.startRotationSpeedMultiplier + 
-            (rotationData_.endRotationSpeedMultiplier - rotationData_.startRotationSpeedMultiplier) * lifetimeRatio;
-        currentRotationSpeed.x *= speedMultiplier;
-        currentRotationSpeed.y *= speedMultiplier;
-        currentRotationSpeed.z *= speedMultiplier;
-    }
-    
-    // 移動方向への整列
-    if (rotationData_.alignToVelocity) {
-        Vector3 velocityAlignment = CalculateVelocityAlignment(particle);
-        // 移動方向の回転を加算（強度で調整）
-        currentRotationSpeed.x += velocityAlignment.x * rotationData_.velocityAlignmentStrength;
-        currentRotationSpeed.y += velocityAlignment.y * rotationData_.velocityAlignmentStrength;
-        currentRotationSpeed.z += velocityAlignment.z * rotationData_.velocityAlignmentStrength;
+    const uint32_t count = range.GetCount();
+    Vector3* rotations = pool.GetRotations() + range.begin;
+    const Vector3* rotationSpeeds = pool.GetRotationSpeeds() + range.begin;
+    const Vector3* velocities = pool.GetVelocities() + range.begin;
+    lifetimeRatios += range.begin;
+
+    if (!rotationData_.rotationOverLifetime && !rotationData_.alignToVelocity) {
+        // 回転速度が一定なら単純な積分で済む
+        ParticleSimd::MultiplyAddVector3(rotations, rotationSpeeds, deltaTime, count);
+    } else {
+        for (uint32_t i = 0; i < count; ++i) {
+            Vector3 currentRotationSpeed = rotationSpeeds[i];
+
+            // ライフタイムで回転速度を変化させる
+            if (rotationData_.rotationOverLifetime) {
+                float speedMultiplier = rotationData_.startRotationSpeedMultiplier +
+                    (rotationData_.endRotationSpeedMultiplier - rotationData_.startRotationSpeedMultiplier) * lifetimeRatios[i];
+                currentRotationSpeed.x *= speedMultiplier;
+                currentRotationSpeed.y *= speedMultiplier;
+                currentRotationSpeed.z *= speedMultiplier;
+            }
+
+            // 移動方向への整列
+            if (rotationData_.alignToVelocity) {
+                Vector3 velocityAlignment = CalculateVelocityAlignment(velocities[i]);
+                currentRotationSpeed.x += velocityAlignment.x * rotationData_.velocityAlignmentStrength;
+                currentRotationSpeed.y += velocityAlignment.y * rotationData_.velocityAlignmentStrength;
+                currentRotationSpeed.z += velocityAlignment.z * rotationData_.velocityAlignmentStrength;
+            }
+
+            rotations[i].x += currentRotationSpeed.x * deltaTime;
+            rotations[i].y += currentRotationSpeed.y * deltaTime;
+            rotations[i].z += currentRotationSpeed.z * deltaTime;
+        }
     }
-    
-    // 回転を更新
-    particle.transform.rotate.x += currentRotationSpeed.x * deltaTime;
-    particle.transform.rotate.y += currentRotationSpeed.y * deltaTime;
-    particle.transform.rotate.z += currentRotationSpeed.z * deltaTime;
-    
-    // 角度制限を適用
+
     if (rotationData_.limitRotationRange) {
-        float minX = DegreesToRadians(rotationData_.minRotation.x);
-        float maxX = DegreesToRadians(rotationData_.maxRotation.x);
-        float minY = DegreesToRadians(rotationData_.minRotation.y);
-        float maxY = DegreesToRadians(rotationData_.maxRotation.y);
-        float minZ = DegreesToRadians(rotationData_.minRotation.z);
-        float maxZ = DegreesToRadians(rotationData_.maxRotation.z);
-        
-        particle.transform.rotate.x = std::clamp(particle.transform.rotate.x, minX, maxX);
-        particle.transform.rotate.y = std::clamp(particle.transform.rotate.y, minY, maxY);
-        particle.transform.rotate.z = std::clamp(particle.transform.rotate.z, minZ, maxZ);
+        // 角度制限はラジアンに変換してから一括適用
+        const Vector3 minRotation = {
+            DegreesToRadians(rotationData_.minRotation.x),
+            DegreesToRadians(rotationData_.minRotation.y),
+            DegreesToRadians(rotationData_.minRotation.z)
+        };
+        const Vector3 maxRotation = {
+            DegreesToRadians(rotationData_.maxRotation.x),
+            DegreesToRadians(rotationData_.maxRotation.y),
+            DegreesToRadians(rotationData_.maxRotation.z)
+        };
+        ParticleSimd::ClampVector3(rotations, minRotation, maxRotation, count);
     } else {
         // 角度を正規化（-π〜πの範囲に）
-        particle.transform.rotate.x = NormalizeAngle(particle.transform.rotate.x);
-        particle.transform.rotate.y = NormalizeAngle(particle.transform.rotate.y);
-        particle.transform.rotate.z = NormalizeAngle(particle.transform.rotate.z);
+        ParticleSimd::WrapAnglesVector3(rotations, count);
     }
 }
 
@@ -173,16 +183,6 @@ bool RotationModule::ShowImGui() {
 }
 #endif
 
-float RotationModule::GetLifetimeRatio(const Particle& particle)
-{
-    if (particle.lifeTime <= 0.0f) {
-        return 1.0f;
-    }
-    
-    float ratio = particle.currentTime / particle.lifeTime;
-    return std::clamp(ratio, 0.0f, 1.0f);
-}
-
 float RotationModule::GetRotationDirectionFactor(RotationData::RotationDirection direction)
 {
     switch (direction) {
@@ -206,21 +206,9 @@ float RotationModule::DegreesToRadians(float degrees)
     return degrees * std::numbers::pi_v<float> / 180.0f;
 }
 
-float RotationModule::NormalizeAngle(float angle)
-{
-    while (angle > std::numbers::pi_v<float>) {
-        angle -= 2.0f * std::numbers::pi_v<float>;
-    }
-    while (angle < -std::numbers::pi_v<float>) {
-        angle += 2.0f * std::numbers::pi_v<float>;
-    }
-    return angle;
-}
-
-Vector3 RotationModule::CalculateVelocityAlignment(const Particle& particle)
+Vector3 RotationModule::CalculateVelocityAlignment(const Vector3& velocity)
 {
     // 移動方向に基づく回転を計算
-    Vector3 velocity = particle.velocity;
     float velocityLength = sqrtf(velocity.x * velocity.x + velocity.y * velocity.y + velocity.z * velocity.z);
     
     if (velocityLength < 0.001f) {
@@ -228,16 +216,18 @@ Vector3 RotationModule::CalculateVelocityAlignment(const Particle& particle)
     }
     
     // 正規化された速度ベクトル
-    velocity.x /= velocityLength;
-    velocity.y /= velocityLength;
-    velocity.z /= velocityLength;
+    Vector3 direction = {
+        velocity.x / velocityLength,
+        velocity.y / velocityLength,
+        velocity.z / velocityLength
+    };
     
     // 移動方向に基づく回転角度を計算
     // これは簡易的な実装で、より複雑な計算が必要な場合は調整
     Vector3 alignment;
-    alignment.x = atan2f(velocity.y, velocity.z); // ピッチ
-    alignment.y = atan2f(velocity.x, velocity.z); // ヨー
-    alignment.z = atan2f(velocity.y, velocity.x); // ロール
+    alignment.x = atan2f(direction.y, direction.z); // ピッチ
+    alignment.y = atan2f(direction.x, direction.z); // ヨー
+    alignment.z = atan2f(direction.y, direction.x); // ロール
     
     return alignment;
 }
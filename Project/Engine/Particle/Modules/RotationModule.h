@@ -3,6 +3,9 @@
 #include "ParticleModule.h"
 #include "MathCore.h"
 
+class ParticlePool;
+struct ParticleRange;
+
 /// @brief パーティクルの回転制御モジュール
 /// 注意: 初期回転の設定はMainModuleで行います
 /// このモジュールは回転速度と回転の変化のみを担当します
@@ -56,10 +59,17 @@ public:
     /// @param particle 対象のパーティクル
     void ApplyInitialRotation(Particle& particle);
 
-    /// @brief パーティクルの回転を更新
-    /// @param particle 対象のパーティクル
+    /// @brief プール内の指定区間のパーティクルの回転を一括更新
+    /// @param pool パーティクルプール
+    /// @param range 処理する区間
+    /// @param lifetimeRatios 各パーティクルのライフタイム係数（0.0f - 1.0f、プールと同じ並び）
     /// @param deltaTime フレーム時間
-    void UpdateRotation(Particle& particle, float deltaTime);
+    void UpdateRotationBatch(ParticlePool& pool, const ParticleRange& range, const float* lifetimeRatios, float deltaTime);
+
+    /// @brief 移動方向に基づく回転を計算
+    /// @param velocity パーティクルの速度
+    /// @return 移動方向ベースの回転角度
+    Vector3 CalculateVelocityAlignment(const Vector3& velocity);
 
 #ifdef _DEBUG
     /// @brief ImGuiデバッグ表示
@@ -70,11 +80,6 @@ public:
 private:
     RotationData rotationData_;
     
-    /// @brief ライフタイム係数を取得
-    /// @param particle パーティクル
-    /// @return ライフタイム係数（0.0f - 1.0f）
-    float GetLifetimeRatio(const Particle& particle);
-
     /// @brief 回転方向を決定
     /// @param direction 回転方向設定
     /// @return 回転方向係数（1.0f: 正方向, -1.0f: 逆方向）
@@ -85,16 +90,6 @@ private:
     /// @return ラジアン
     float DegreesToRadians(float degrees);
 
-    /// @brief 角度を正規化（-π〜πの範囲に）
-    /// @param angle ラジアン
-    /// @return 正規化された角度
-    float NormalizeAngle(float angle);
-
-    /// @brief 移動方向に基づく回転を計算
-    /// @param particle パーティクル
-    /// @return 移動方向ベースの回転角度
-    Vector3 CalculateVelocityAlignment(const Particle& particle);
-
     /// @brief ランダム性を適用
     /// @param baseValue ベース値
     /// @param randomness ランダム性
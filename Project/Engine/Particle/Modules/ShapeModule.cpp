@@ -425,10 +425,9 @@ void ShapeModule::DrawEmitterShape(LineRendererPipeline* pipeline, const ICamera
 
 	case ShapeType::Hemisphere:
 	{
-		auto sphereLines = DebugLineDrawer::GenerateSphereLines(emitterPosition, shapeData_.radius, color, alpha, 16);
+		lines = DebugLineDrawer::GenerateSphereLines(emitterPosition, shapeData_.radius, color, alpha, 16);
 		auto circleLines = DebugLineDrawer::GenerateCircleLines(emitterPosition, shapeData_.radius,
 			{ 0.0f, 1.0f, 0.0f }, color, alpha);
-		lines.insert(lines.end(), sphereLines.begin(), sphereLines.end());
 		lines.insert(lines.end(), circleLines.begin(), circleLines.end());
 	}
 	break;
@@ -1,5 +1,7 @@
 #include "SizeModule.h"
 #include "../ParticleSystem.h"
+#include "../Core/ParticlePool.h"
+#include "../Core/ParticleSimd.h"
 #include <algorithm>
 
 // コンストラクタでデフォルトパラメータを設定
@@ -13,37 +15,35 @@ SizeModule::SizeModule() {
     sizeData_.maxSize = 100.0f;
 }
 
-void SizeModule::UpdateSize(Particle& particle)
+void SizeModule::UpdateSizeBatch(ParticlePool& pool, const ParticleRange& range, const float* lifetimeRatios, float* scratch)
 {
     if (!enabled_ || !sizeData_.sizeOverLifetime) {
         return;
     }
 
-    // ライフタイム係数を取得
-  float lifetimeRatio = GetLifetimeRatio(particle);
-    
-    // カーブを適用
-    float curveValue = ApplyCurve(lifetimeRatio, sizeData_.sizeCurve);
+    const uint32_t count = range.GetCount();
+    Vector3* scales = pool.GetScales() + range.begin;
+    const Vector3* initialScales = pool.GetInitialScales() + range.begin;
+
+    // カーブ値を先にまとめて評価
+    float* curveValues = scratch + range.begin;
+    ParticleSimd::EvaluateSizeCurve(curveValues, lifetimeRatios + range.begin, sizeData_.sizeCurve, count);
 
     if (sizeData_.use3DSize) {
         // 3Dサイズでの補間
-        // MainModuleで設定された初期サイズを使用
-        Vector3 startSize = particle.initialScale;
-        Vector3 currentSize = LerpVector3(startSize, sizeData_.endSize3D, curveValue);
-        
-      // サイズ制限を適用
-        currentSize.x = std::clamp(currentSize.x, sizeData_.minSize, sizeData_.maxSize);
-        currentSize.y = std::clamp(currentSize.y, sizeData_.minSize, sizeData_.maxSize);
-      currentSize.z = std::clamp(currentSize.z, sizeData_.minSize, sizeData_.maxSize);
-        
-        particle.transform.scale = currentSize;
+        for (uint32_t i = 0; i < count; ++i) {
+            scales[i] = LerpVector3(initialScales[i], sizeData_.endSize3D, curveValues[i]);
+        }
+
+        // サイズ制限を適用
+        const Vector3 minSize = { sizeData_.minSize, sizeData_.minSize, sizeData_.minSize };
+        const Vector3 maxSize = { sizeData_.maxSize, sizeData_.maxSize, sizeData_.maxSize };
+        ParticleSimd::ClampVector3(scales, minSize, maxSize, count);
     } else {
-        // 1Dサイズでの補間（線形補間）
-        // MainModuleで設定された初期サイズを使用（均等スケーリング想定）
-        float startSize = particle.initialScale.x;
-   float currentSize = startSize + (sizeData_.endSize - startSize) * curveValue;
-      currentSize = std::clamp(currentSize, sizeData_.minSize, sizeData_.maxSize);
-        particle.transform.scale = {currentSize, currentSize, currentSize};
+        // 1Dサイズでの補間（初期サイズのxを基準とした均等スケーリング）
+        ParticleSimd::LerpUniformScales(
+            scales, initialScales, sizeData_.endSize, curveValues,
+            sizeData_.minSize, sizeData_.maxSize, count);
     }
 }
 
@@ -97,43 +97,6 @@ bool SizeModule::ShowImGui() {
 }
 #endif
 
-float SizeModule::GetLifetimeRatio(const Particle& particle)
-{
-    if (particle.lifeTime <= 0.0f) {
-        return 1.0f; // ライフタイムが0以下の場合は終了扱い
-    }
-    
-    float ratio = particle.currentTime / particle.lifeTime;
-    return std::clamp(ratio, 0.0f, 1.0f);
-}
-
-float SizeModule::ApplyCurve(float t, SizeData::SizeCurve curve)
-{
-    switch (curve) {
-        case SizeData::SizeCurve::Linear:
-            return t;
-            
-        case SizeData::SizeCurve::EaseIn:
-            return t * t; // 二次関数（加速）
-            
-        case SizeData::SizeCurve::EaseOut:
-            return 1.0f - (1.0f - t) * (1.0f - t); // 減速
-            
-        case SizeData::SizeCurve::EaseInOut:
-            if (t < 0.5f) {
-                return 2.0f * t * t; // 前半は加速
-            } else {
-                return 1.0f - 2.0f * (1.0f - t) * (1.0f - t); // 後半は減速
-            }
-            
-        case SizeData::SizeCurve::Constant:
-            return 0.0f; // 変化なし（開始サイズを維持）
-            
-        default:
-            return t;
-    }
-}
-
 Vector3 SizeModule::LerpVector3(const Vector3& start, const Vector3& end, float t)
 {
     return {
@@ -2,6 +2,10 @@
 
 #include "ParticleModule.h"
 #include "MathCore.h"
+
+class ParticlePool;
+struct ParticleRange;
+
 /// @brief パーティクルのサイズ制御モジュール
 /// 注意: 初期サイズの設定はMainModuleで行います
 /// このモジュールはサイズの変化（Over Lifetime）のみを担当します
@@ -40,9 +44,12 @@ public:
     /// @return サイズデータの参照
     const SizeData& GetSizeData() const { return sizeData_; }
 
-    /// @brief パーティクルのサイズを更新
-  /// @param particle 対象のパーティクル
-    void UpdateSize(Particle& particle);
+    /// @brief プール内の指定区間のパーティクルのサイズを一括更新
+    /// @param pool パーティクルプール
+    /// @param range 処理する区間
+    /// @param lifetimeRatios 各パーティクルのライフタイム係数（0.0f - 1.0f、プールと同じ並び）
+    /// @param scratch 作業用バッファ（プール容量以上の要素数、プールと同じ並び）
+    void UpdateSizeBatch(ParticlePool& pool, const ParticleRange& range, const float* lifetimeRatios, float* scratch);
 
 #ifdef _DEBUG
     /// @brief ImGuiデバッグ表示
@@ -53,17 +60,6 @@ bool ShowImGui() override;
 private:
     SizeData sizeData_;
 
-    /// @brief ライフタイム係数を取得
-    /// @param particle パーティクル
-    /// @return ライフタイム係数（0.0f - 1.0f）
-    float GetLifetimeRatio(const Particle& particle);
-
-    /// @brief カーブに基づいて値を補間
-    /// @param t 補間係数（0.0f - 1.0f）
-    /// @param curve カーブタイプ
-    /// @return 補間された値（0.0f - 1.0f）
-    float ApplyCurve(float t, SizeData::SizeCurve curve);
-
     /// @brief 2つのベクトルを線形補間
     /// @param start 開始ベクトル
     /// @param end 終了ベクトル
@@ -25,6 +25,17 @@ bool ParticlePresetManager::SavePreset(const ParticleSystem* particleSystem, con
 	// ビルボードタイプとブレンドモードの保存
 	presetData["billboardType"] = static_cast<int>(particleSystem->GetBillboardType());
 	presetData["blendMode"] = static_cast<int>(particleSystem->GetBlendMode());
+	presetData["sortMode"] = static_cast<int>(particleSystem->GetSortMode());
+
+	// シミュレーション時計の保存
+	const auto& clockSettings = particleSystem->GetClockSettings();
+	json clockJson;
+	clockJson["mode"] = static_cast<int>(clockSettings.mode);
+	clockJson["fixedDeltaTime"] = clockSettings.fixedDeltaTime;
+	clockJson["maxSubsteps"] = clockSettings.maxSubsteps;
+	clockJson["timeScale"] = clockSettings.timeScale;
+	clockJson["maxDeltaTime"] = clockSettings.maxDeltaTime;
+	presetData["clock"] = clockJson;
 
 	// MainModuleの保存
 	auto& mainModule = const_cast<ParticleSystem*>(particleSystem)->GetMainModule();
@@ -202,6 +213,21 @@ if (presetData.contains("version")) {
 	if (presetData.contains("blendMode")) {
 		particleSystem->SetBlendMode(static_cast<BlendMode>(presetData["blendMode"].get<int>()));
 	}
+	if (presetData.contains("sortMode")) {
+		particleSystem->SetSortMode(static_cast<ParticleSortMode>(presetData["sortMode"].get<int>()));
+	}
+
+	// シミュレーション時計の読み込み
+	if (presetData.contains("clock")) {
+		auto clockJson = presetData["clock"];
+		ParticleClock::Settings clockSettings;
+		clockSettings.mode = static_cast<ParticleTimeMode>(JsonManager::SafeGet(clockJson, "mode", 0));
+		clockSettings.fixedDeltaTime = JsonManager::SafeGet(clockJson, "fixedDeltaTime", clockSettings.fixedDeltaTime);
+		clockSettings.maxSubsteps = JsonManager::SafeGet(clockJson, "maxSubsteps", clockSettings.maxSubsteps);
+		clockSettings.timeScale = JsonManager::SafeGet(clockJson, "timeScale", clockSettings.timeScale);
+		clockSettings.maxDeltaTime = JsonManager::SafeGet(clockJson, "maxDeltaTime", clockSettings.maxDeltaTime);
+		particleSystem->SetClockSettings(clockSettings);
+	}
 
 	// MainModuleの読み込み
 	if (presetData.contains("main")) {
@@ -4,6 +4,9 @@
 #include "Engine/Camera/CameraManager.h"
 #include "Engine/EngineSystem/EngineSystem.h"
 #include "Engine/Graphics/Model/ModelResource.h"
+#include "Engine/Utility/Job/JobSystem.h"
+#include "Engine/Utility/FrameRate/FrameRateController.h"
+#include <chrono>
 #include <iostream>
 #include <cstdio>
 #ifdef _DEBUG
@@ -15,6 +18,20 @@
 
 using namespace MathCore;
 
+namespace {
+	// FrameRateControllerを取得できない場合のフレーム時間
+	constexpr float kFallbackDeltaTime = 1.0f / 60.0f;
+	// 最大数が容量のこの割合以下に下がった場合のみ縮小する（拡張・縮小の繰り返しを防ぐ）
+	constexpr uint32_t kShrinkRatio = 4;
+
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief 計測開始時刻からの経過時間（ミリ秒）
+	float ElapsedMilliseconds(Clock::time_point start) {
+		return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+	}
+}
+
 // 初期化関数
 void ParticleSystem::Initialize(DirectXCommon* dxCommon, ResourceFactory* resourceFactory, const std::string& name)
 {
@@ -40,12 +57,12 @@ void ParticleSystem::Initialize(DirectXCommon* dxCommon, ResourceFactory* resour
 	rotationModule_ = std::make_unique<RotationModule>();
 	noiseModule_ = std::make_unique<NoiseModule>();
 
-	// リソースマネージャーの初期化
-	resourceManager_ = std::make_unique<ParticleResourceManager>();
-	resourceManager_->Initialize(dxCommon, resourceFactory, kNumMaxInstance);
+	// パーティクルプールの初期化（MainModuleの最大パーティクル数分を確保）
+	particlePool_.Initialize(GetMaxParticleCount());
+	UpdateCapacity();
 
-	// インスタンシングデータのポインタを取得
-	instancingData_ = resourceManager_->GetInstancingData();
+	// リソースマネージャーの初期化（インスタンシング領域は描画データ構築時に共有リングバッファから確保）
+	resourceManager_ = std::make_unique<ParticleResourceManager>();
 
 	// 描画データビルダーの初期化
 	renderDataBuilder_ = std::make_unique<ParticleRenderDataBuilder>();
@@ -84,19 +101,52 @@ void ParticleSystem::Initialize(DirectXCommon* dxCommon, ResourceFactory* resour
 // 更新処理関数（他のオブジェクトと統一）
 void ParticleSystem::Update()
 {
-	const float kDeltaTime = 1.0f / 60.0f;
+	UpdateEmission();
+	Simulate();
+}
+
+void ParticleSystem::UpdateEmission()
+{
+	float frameDeltaTime = kFallbackDeltaTime;
+	if (auto* engine = GetEngineSystem()) {
+		if (auto* frameRateController = engine->GetComponent<FrameRateController>()) {
+			frameDeltaTime = frameRateController->GetDeltaTime();
+		}
+	}
+	UpdateEmission(frameDeltaTime);
+}
+
+void ParticleSystem::UpdateEmission(float frameDeltaTime)
+{
+	pendingParticles_.clear();
+	pendingStepCounts_.clear();
 
 	// MainModuleが無効の場合、パーティクルシステム全体を停止
 	if (!mainModule_->IsEnabled()) {
 		return;
 	}
 
+	// プリセットやエディタで最大数が変わった場合に容量を合わせる
+	UpdateCapacity();
+
+	// このフレームで実行するステップを決め、ステップごとに放出するパーティクルを生成しておく
+	// （プールへの追加は Simulate で各ステップの更新直前に行う）
+	clock_.Advance(frameDeltaTime);
+	for (uint32_t step = 0; step < clock_.GetStepCount(); ++step) {
+		const size_t pendingBefore = pendingParticles_.size();
+		EmitStep(clock_.GetStepDeltaTime());
+		pendingStepCounts_.push_back(static_cast<uint32_t>(pendingParticles_.size() - pendingBefore));
+	}
+}
+
+void ParticleSystem::EmitStep(float deltaTime)
+{
 	// 統計情報の更新
-	statistics_.systemRuntime += kDeltaTime;
-	deltaTimeAccumulator_ += kDeltaTime;
+	statistics_.systemRuntime += deltaTime;
+	deltaTimeAccumulator_ += deltaTime;
 
 	// MainModuleの時間更新
-	mainModule_->UpdateTime(kDeltaTime);
+	mainModule_->UpdateTime(deltaTime);
 
 	// MainModuleの時間とループ設定を取得
 	float elapsedTime = mainModule_->GetElapsedTime();
@@ -104,7 +154,7 @@ void ParticleSystem::Update()
 	bool looping = mainModule_->GetMainData().looping;
 
 	// EmissionModuleの時間更新（バースト用）
-	emissionModule_->UpdateTime(kDeltaTime);
+	emissionModule_->UpdateTime(deltaTime);
 
 	// MainModuleがループでリセットされた場合、EmissionModuleもリセット
 	if (mainModule_->IsPlaying() && looping && elapsedTime < lastElapsedTime_) {
@@ -113,6 +163,9 @@ void ParticleSystem::Update()
 	}
 	lastElapsedTime_ = elapsedTime;
 
+	// 1ステップで生成する数は最大数まで（ステップ単位で制限し、フレームのまとめ方に結果が依存しないようにする）
+	const uint32_t maxParticles = GetMaxParticleCount();
+
 	// ループしない場合、duration超過でEmissionを停止
 	bool shouldEmit = emissionModule_->IsPlaying() && emissionModule_->IsEnabled();
 	if (!looping && elapsedTime >= duration) {
@@ -120,15 +173,9 @@ void ParticleSystem::Update()
 		const auto& emissionData = emissionModule_->GetEmissionData();
 		if (emissionData.burstCount > 0 && emissionData.burstTime >= duration) {
 			// バーストタイミングがduration以降の場合、duration到達時に強制発生
-			uint32_t burstCount = emissionModule_->CalculateEmissionCount(kDeltaTime);
+			uint32_t burstCount = emissionModule_->CalculateEmissionCount(deltaTime);
 			if (burstCount > 0) {
-				uint32_t emittedCount = particleEmitter_->EmitParticles(
-					burstCount,
-					emitterTransform_,
-					GetMaxParticleCount(),
-					particles_
-				);
-				statistics_.totalParticlesCreated += emittedCount;
+				particleEmitter_->GenerateParticles((std::min)(burstCount, maxParticles), emitterTransform_, pendingParticles_);
 			}
 		}
 		shouldEmit = false;
@@ -136,25 +183,48 @@ void ParticleSystem::Update()
 	}
 
 	// 放出処理
-	uint32_t emissionCount = 0;
 	if (shouldEmit) {
-		emissionCount = emissionModule_->CalculateEmissionCount(kDeltaTime);
+		uint32_t emissionCount = emissionModule_->CalculateEmissionCount(deltaTime);
 		if (emissionCount > 0) {
-			uint32_t emittedCount = particleEmitter_->EmitParticles(
-				emissionCount,
-				emitterTransform_,
-				GetMaxParticleCount(),
-				particles_
-			);
-			statistics_.totalParticlesCreated += emittedCount;
+			particleEmitter_->GenerateParticles((std::min)(emissionCount, maxParticles), emitterTransform_, pendingParticles_);
 		}
 	}
+}
+
+void ParticleSystem::Simulate(JobSystem* jobSystem)
+{
+	if (!mainModule_->IsEnabled()) {
+		return;
+	}
+
+	auto start = Clock::now();
 
 	// MainModuleからgravityModifierを取得
 	float gravityModifier = mainModule_->GetMainData().gravityModifier;
+	const float stepDeltaTime = clock_.GetStepDeltaTime();
+	const uint32_t maxParticles = GetMaxParticleCount();
+
+	// ステップごとに「放出 → 更新」を繰り返す（描画レートによらず同じ順序で処理される）
+	uint32_t destroyedCountFromUpdate = 0;
+	size_t pendingIndex = 0;
+	for (uint32_t stepCount : pendingStepCounts_) {
+		const size_t pendingEnd = pendingIndex + stepCount;
+		for (; pendingIndex < pendingEnd; ++pendingIndex) {
+			if (particlePool_.GetCount() >= maxParticles || !particlePool_.Push(pendingParticles_[pendingIndex])) {
+				break;
+			}
+			++statistics_.totalParticlesCreated;
+		}
+		pendingIndex = pendingEnd;
+
+		// パーティクルの更新（ParticleUpdaterに委譲）
+		destroyedCountFromUpdate += particleUpdater_->UpdateParticles(particlePool_, stepDeltaTime, gravityModifier, jobSystem);
+	}
+	statistics_.lastStepCount = static_cast<uint32_t>(pendingStepCounts_.size());
 
-	// パーティクルの更新（ParticleUpdaterに委譲）
-	uint32_t destroyedCountFromUpdate = particleUpdater_->UpdateParticles(particles_, kDeltaTime, gravityModifier);
+	// 同じステップを二重に処理しないよう消費済みにする
+	pendingParticles_.clear();
+	pendingStepCounts_.clear();
 
 	// パーティクルの更新後の統計情報を更新
 	uint32_t currentParticleCount = GetParticleCount();
@@ -164,6 +234,7 @@ void ParticleSystem::Update()
 
 	// 破棄されたパーティクル数を統計に反映
 	statistics_.totalParticlesDestroyed += destroyedCountFromUpdate;
+	UpdateWastedBytes();
 
 	// 平均ライフタイムの計算（1秒ごとに更新）
 	if (deltaTimeAccumulator_ >= 1.0f) {
@@ -173,22 +244,106 @@ void ParticleSystem::Update()
 		}
 		deltaTimeAccumulator_ = 0.0f;
 	}
+
+	statistics_.simulateMilliseconds = ElapsedMilliseconds(start);
 }
 
-// 描画関数（Object3dと同じインターフェース）
-void ParticleSystem::Draw(const ICamera* camera)
+void ParticleSystem::PrepareRenderData(const ICamera* camera, JobSystem* jobSystem)
 {
 	if (!camera) return;
 
-	// 描画データを準備（ビルボード計算などを担当）
+	auto start = Clock::now();
+
+	// 生存数ぶんのインスタンシング領域を共有リングバッファから確保
+	ParticleForGPU* instancingData = resourceManager_->AcquireInstancingData(particlePool_.GetCount());
+
+	// 描画データを準備（行列の展開は頂点シェーダーで行うため、インスタンスごとには圧縮した姿勢のみを書き込む）
 	instanceCount_ = renderDataBuilder_->BuildRenderData(
-		particles_,
-		camera,
-		billboardType_,
-		renderMode_,
-		instancingData_,
-		kNumMaxInstance
+		particlePool_,
+		instancingData,
+		resourceManager_->GetAllocatedCount(),
+		sortMode_,
+		camera->GetViewMatrix(),
+		jobSystem
 	);
+	drawConstants_ = renderDataBuilder_->BuildDrawConstants(camera, billboardType_);
+
+	statistics_.renderDataMilliseconds = ElapsedMilliseconds(start);
+	preparedCamera_ = camera;
+}
+
+void ParticleSystem::UpdateCapacity()
+{
+	const uint32_t required = GetMaxParticleCount();
+	const uint32_t capacity = particlePool_.GetCapacity();
+
+	uint32_t newCapacity = capacity;
+	if (required > capacity) {
+		// エディタでの調整中に毎フレーム再確保しないよう倍々で拡張する
+		newCapacity = (std::min)((std::max)(required, capacity * 2), kNumMaxInstance);
+	} else if (required <= capacity / kShrinkRatio) {
+		newCapacity = required;
+	}
+
+	if (newCapacity != capacity) {
+		particlePool_.SetCapacity(newCapacity);
+	}
+
+	statistics_.capacity = particlePool_.GetCapacity();
+	UpdateWastedBytes();
+}
+
+void ParticleSystem::UpdateWastedBytes()
+{
+	// インスタンシング領域は毎フレーム生存数ちょうどを確保するため、無駄はプールの空き容量のみ
+	const uint32_t unused = particlePool_.GetCapacity() - particlePool_.GetCount();
+	statistics_.wastedBytes = static_cast<size_t>(unused) * ParticlePool::kBytesPerParticle;
+}
+
+void ParticleSystem::SimulateAll(const std::vector<ParticleSystem*>& systems, JobSystem* jobSystem)
+{
+	if (!jobSystem) {
+		for (auto* system : systems) {
+			system->Simulate();
+		}
+		return;
+	}
+
+	// システム単位でジョブに分散し、大規模なプールは各システム内でさらに区間分割する
+	// 各システムは自身のプールのみを書き換えるため、実行順序によらず結果は同じになる
+	jobSystem->ParallelFor(static_cast<uint32_t>(systems.size()), 1, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			systems[i]->Simulate(jobSystem);
+		}
+	});
+}
+
+void ParticleSystem::PrepareRenderDataAll(const std::vector<ParticleSystem*>& systems, const ICamera* camera, JobSystem* jobSystem)
+{
+	if (!jobSystem) {
+		for (auto* system : systems) {
+			system->PrepareRenderData(camera);
+		}
+		return;
+	}
+
+	jobSystem->ParallelFor(static_cast<uint32_t>(systems.size()), 1, [&](uint32_t begin, uint32_t end) {
+		for (uint32_t i = begin; i < end; ++i) {
+			systems[i]->PrepareRenderData(camera, jobSystem);
+		}
+	});
+}
+
+// 描画関数（Object3dと同じインターフェース）
+void ParticleSystem::Draw(const ICamera* camera)
+{
+	if (!camera) return;
+
+	// 事前構築されていないか、別のカメラで構築されていればここで構築する（次フレームに持ち越さないよう毎回戻す）
+	if (preparedCamera_ != camera) {
+		PrepareRenderData(camera);
+	}
+	preparedCamera_ = nullptr;
 
 #ifdef _DEBUG
 	// デバッグ描画もDrawメソッド内で実行
@@ -230,14 +385,16 @@ bool ParticleSystem::IsPlaying() const
 
 void ParticleSystem::Clear()
 {
-	particles_.clear();
+	particlePool_.Clear();
+	pendingParticles_.clear();
+	pendingStepCounts_.clear();
 	instanceCount_ = 0;  
 }
 
 bool ParticleSystem::IsFinished() const
 {
 	// 再生が停止していて、かつパーティクルが0個の場合は終了
-	return !emissionModule_->IsPlaying() && particles_.empty();
+	return !emissionModule_->IsPlaying() && particlePool_.IsEmpty();
 }
 
 void ParticleSystem::SetTexture(const std::string& texturePath)
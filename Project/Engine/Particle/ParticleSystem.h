@@ -5,7 +5,6 @@
 #include <dxgi1_6.h>
 #include <memory>
 #include <vector>
-#include <list>
 #include <string>
 
 #ifdef _DEBUG
@@ -37,10 +36,12 @@
 #include "Modules/NoiseModule.h"
 
 // Core関連
+#include "Core/ParticlePool.h"
 #include "Core/ParticleResourceManager.h"
 #include "Core/ParticleRenderDataBuilder.h"
 #include "Core/ParticleUpdater.h"
 #include "Core/ParticleEmitter.h"
+#include "Core/ParticleClock.h"
 
 // プリセット管理
 #include "ParticlePresetManager.h"
@@ -50,8 +51,9 @@ using namespace MathCore;
 // 前方宣言
 class ICamera;
 class ModelResource;
+class JobSystem;
 
-// パーティクルのパラメータ
+// パーティクルのパラメータ（生成時の一時データ。生成後はParticlePoolのSoA配列で保持）
 struct Particle {
 	EulerTransform transform;
 	Vector3 velocity;
@@ -66,9 +68,9 @@ struct Particle {
 /// @brief パーティクルシステムクラス
 class ParticleSystem : public GameObject {
 public:
-	// GPU用の絶対的な最大インスタンス数（メモリ確保用）
-	// 実際の最大パーティクル数はMainModule.maxParticlesで制御
-	static constexpr uint32_t kNumMaxInstance = 1028; // パーティクルの最大数
+	// パーティクル数の絶対上限
+	// プール容量はMainModule.maxParticlesに合わせて拡張・縮小し、インスタンシング領域は毎フレーム生存数だけ確保する
+	static constexpr uint32_t kNumMaxInstance = MainModule::kMaxParticlesLimit;
 
 	ParticleSystem() = default;
 	~ParticleSystem() override = default;
@@ -80,12 +82,47 @@ public:
 	void Initialize(DirectXCommon* dxCommon, ResourceFactory* resourceFactory, const std::string& name = "");
 
 	/// @brief 更新処理（他のオブジェクトと統一）
+	/// UpdateEmission と Simulate を続けて実行する
 	void Update() override;
 
 	/// @brief 描画（3D専用 - カメラ必須、Object3dと同じインターフェース）
+	/// 同じカメラで PrepareRenderData 済みの場合は描画データの構築を省略する
 	/// @param camera カメラオブジェクト
 	void Draw(const ICamera* camera) override;
 
+	// ──────────────────────────────────────────────────────────
+	// ジョブ分割用の更新・描画準備
+	// ──────────────────────────────────────────────────────────
+
+	/// @brief 時間更新と放出処理（共有乱数を使用するためメインスレッドで逐次実行する）
+	/// フレーム時間はFrameRateControllerの実測値を使用する
+	void UpdateEmission();
+
+	/// @brief 指定したフレーム時間で時間更新と放出処理を行う（リプレイ・検証用）
+	/// 時計の設定に従ってこのフレームのステップ数を決め、ステップごとに放出するパーティクルを生成する
+	/// @param frameDeltaTime 前フレームからの実経過時間（秒）
+	void UpdateEmission(float frameDeltaTime);
+
+	/// @brief UpdateEmissionで決めたステップ数だけ放出と更新を繰り返す（他のシステムと並列実行可能）
+	/// @param jobSystem 大規模なプールを区間分割する場合のジョブシステム（nullptrの場合は逐次）
+	void Simulate(JobSystem* jobSystem = nullptr);
+
+	/// @brief 描画データを事前に構築（他のシステムと並列実行可能）
+	/// @param camera 描画に使用するカメラ
+	/// @param jobSystem 大規模なプールを区間分割する場合のジョブシステム（nullptrの場合は逐次）
+	void PrepareRenderData(const ICamera* camera, JobSystem* jobSystem = nullptr);
+
+	/// @brief 複数システムのシミュレーションをジョブに分散して実行し、全完了まで待機
+	/// @param systems 対象のパーティクルシステム（UpdateEmission済み）
+	/// @param jobSystem ジョブシステム（nullptrの場合は逐次）
+	static void SimulateAll(const std::vector<ParticleSystem*>& systems, JobSystem* jobSystem);
+
+	/// @brief 複数システムの描画データ構築をジョブに分散して実行し、全完了まで待機
+	/// @param systems 対象のパーティクルシステム
+	/// @param camera 描画に使用するカメラ
+	/// @param jobSystem ジョブシステム（nullptrの場合は逐次）
+	static void PrepareRenderDataAll(const std::vector<ParticleSystem*>& systems, const ICamera* camera, JobSystem* jobSystem);
+
 	// ──────────────────────────────────────────────────────────
 	// GameObjectインターフェース実装
 	// ──────────────────────────────────────────────────────────
@@ -184,6 +221,26 @@ public:
 	/// @return ビルボードタイプ
 	BillboardType GetBillboardType() const { return billboardType_; }
 
+	/// @brief 描画順のソートモードを設定
+	/// 通常のアルファブレンドでは BackToFront にすると前後関係が正しく描画される
+	/// @param mode ソートモード
+	void SetSortMode(ParticleSortMode mode) { sortMode_ = mode; }
+
+	/// @brief 描画順のソートモードを取得
+	/// @return ソートモード
+	ParticleSortMode GetSortMode() const { return sortMode_; }
+
+	/// @brief シミュレーション時計の設定を変更（可変・固定ステップ・タイムスケール）
+	/// @param settings 時計の設定
+	void SetClockSettings(const ParticleClock::Settings& settings) { clock_.SetSettings(settings); }
+
+	/// @brief シミュレーション時計の設定を取得
+	/// @return 時計の設定
+	const ParticleClock::Settings& GetClockSettings() const { return clock_.GetSettings(); }
+
+	/// @brief シミュレーション時計を取得
+	const ParticleClock& GetClock() const { return clock_; }
+
 	// ──────────────────────────────────────────────────────────
 	// レンダラーがアクセスするためのゲッター
 	// ──────────────────────────────────────────────────────────
@@ -191,11 +248,14 @@ public:
 	/// @brief インスタンス数を取得
 	uint32_t GetInstanceCount() const { return instanceCount_; }
 
-	/// @brief インスタンシングSRVのGPUハンドルを取得
-	D3D12_GPU_DESCRIPTOR_HANDLE GetInstancingSrvHandleGPU() const {
-		return resourceManager_->GetSrvHandleGPU();
+	/// @brief インスタンシングデータのGPU仮想アドレスを取得（ルートSRV用）
+	D3D12_GPU_VIRTUAL_ADDRESS GetInstancingGpuAddress() const {
+		return resourceManager_->GetInstancingGpuAddress();
 	}
 
+	/// @brief 描画定数（ビュープロジェクション・ビルボード行列）を取得
+	const ParticleDrawConstants& GetDrawConstants() const { return drawConstants_; }
+
 	// ──────────────────────────────────────────────────────────
 	// モジュールアクセッサ
 	// ──────────────────────────────────────────────────────────
@@ -242,7 +302,11 @@ public:
 
 	/// @brief 現在のパーティクル数を取得
 	/// @return パーティクル数
-	uint32_t GetParticleCount() const { return static_cast<uint32_t>(particles_.size()); }
+	uint32_t GetParticleCount() const { return particlePool_.GetCount(); }
+
+	/// @brief パーティクルプールを取得（検証・デバッグ用の読み取り専用）
+	/// @return パーティクルプールの参照
+	const ParticlePool& GetParticlePool() const { return particlePool_; }
 
 	/// @brief 最大パーティクル数を取得（MainModuleの設定を反映）
 	/// @return 最大パーティクル数
@@ -257,6 +321,11 @@ public:
 		uint32_t peakParticleCount = 0;
 		float averageLifetime = 0.0f;
 		float systemRuntime = 0.0f;
+		float simulateMilliseconds = 0.0f;   // 直近フレームのシミュレーション時間
+		float renderDataMilliseconds = 0.0f; // 直近フレームの描画データ構築時間
+		uint32_t capacity = 0;               // プール容量（MainModule.maxParticlesから決定）
+		size_t wastedBytes = 0;              // プールの未使用領域（容量 - 生存数）のバイト数
+		uint32_t lastStepCount = 0;          // 直近フレームに実行したシミュレーションステップ数
 	};
 
 	/// @brief 統計情報を取得
@@ -266,9 +335,22 @@ public:
 	void ResetStatistics() {
 		statistics_ = Statistics();
 		statistics_.systemRuntime = 0.0f;
+		statistics_.capacity = particlePool_.GetCapacity();
+		UpdateWastedBytes();
 	}
 
 private:
+	/// @brief プール容量をMainModule.maxParticlesに合わせる
+	/// 上限が引き上げられた場合は倍々で拡張し、大きく引き下げられた場合のみ縮小する
+	void UpdateCapacity();
+
+	/// @brief 未使用領域の統計を更新
+	void UpdateWastedBytes();
+
+	/// @brief 1ステップ分の時間更新と放出パーティクルの生成
+	/// @param deltaTime ステップの時間（秒）
+	void EmitStep(float deltaTime);
+
 	// ──────────────────────────────────────────────────────────
 	// パーティクルシステムのコア
 	// ──────────────────────────────────────────────────────────
@@ -276,14 +358,16 @@ private:
 	DirectXCommon* dxCommon_ = nullptr;
 	ResourceFactory* resourceFactory_ = nullptr;
 
-	// パーティクルデータ
-	std::list<Particle> particles_;
+	// パーティクルデータ（SoA形式のプール。容量はUpdateCapacityで調整）
+	ParticlePool particlePool_;
 	uint32_t instanceCount_ = 0;
+	ParticleDrawConstants drawConstants_{};
 
 	// エミッター設定
 	EulerTransform emitterTransform_;
 	BillboardType billboardType_ = BillboardType::ViewFacing;
 	BlendMode blendMode_ = BlendMode::kBlendModeAdd;
+	ParticleSortMode sortMode_ = ParticleSortMode::None;
 
 	// 描画モード
 	ParticleRenderMode renderMode_ = ParticleRenderMode::Billboard;
@@ -299,6 +383,16 @@ private:
 	float deltaTimeAccumulator_ = 0.0f;
 	float lastElapsedTime_ = 0.0f;  // ループ検出用（インスタンスごと）
 
+	// シミュレーション時計
+	ParticleClock clock_;
+
+	// UpdateEmissionで生成し、Simulateで各ステップの更新前にプールへ追加するパーティクル
+	std::vector<Particle> pendingParticles_;
+	std::vector<uint32_t> pendingStepCounts_;   // ステップごとの生成数
+
+	// PrepareRenderDataで今フレームの描画データを構築したカメラ（未構築ならnullptr）
+	const ICamera* preparedCamera_ = nullptr;
+
 	// ──────────────────────────────────────────────────────────
 	// モジュール
 	// ──────────────────────────────────────────────────────────
@@ -324,12 +418,6 @@ private:
 	std::unique_ptr<ParticleUpdater> particleUpdater_;
 	std::unique_ptr<ParticleEmitter> particleEmitter_;
 
-	// ──────────────────────────────────────────────────────────
-	// GPU関連リソース（resourceManager_で管理）
-	// ──────────────────────────────────────────────────────────
-
-	ParticleForGPU* instancingData_ = nullptr; // resourceManager_から取得したポインタ
-
 #ifdef _DEBUG
 	// ──────────────────────────────────────────────────────────
 	// デバッグUI（friend宣言）
@@ -80,7 +80,8 @@ void BaseScene::Update()
 #endif
 
 	// ゲームオブジェクトの更新（新システム）
-	gameObjectManager_.UpdateAll();
+	// パーティクルのシミュレーションはジョブシステムで並列化される
+	gameObjectManager_.UpdateAll(engine_->GetComponent<JobSystem>());
 
 	// フレーム終了時に削除マークされたオブジェクトをクリーンアップ
 	// （派生クラスのUpdate後に実行することで、派生クラスが保持する生ポインタが無効化される前に処理できる）
@@ -104,6 +105,9 @@ void BaseScene::Draw()
 	renderManager->SetCameraManager(cameraManager_.get());
 	renderManager->SetCommandList(cmdList);
 
+	// パーティクルの描画データをジョブで並列構築（DrawAllより前に全システムの完了を待つ）
+	gameObjectManager_.PrepareRenderData(activeCamera3D, engine_->GetComponent<JobSystem>());
+
 	// 全てのゲームオブジェクトを描画キューに追加
 	gameObjectManager_.RegisterAllToRender(renderManager);
 
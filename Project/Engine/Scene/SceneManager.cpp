@@ -105,6 +105,10 @@ void SceneManager::SkipTransition() {
 	}
 }
 
+float SceneManager::GetLoadingProgress() const {
+	return sceneTransition_ ? sceneTransition_->GetLoadingProgress() : 1.0f;
+}
+
 void SceneManager::RegisterSceneBGMCallback(std::function<void(float)> callback) {
 	if (sceneTransition_) {
 		sceneTransition_->SetBGMVolumeCallback(callback);
@@ -67,6 +67,10 @@ public:
 	/// @brief トランジションをスキップ（デバッグ用）
 	void SkipTransition();
 
+	/// @brief シーンの非同期読み込みの進捗を取得（ロード画面の表示用）
+	/// @return 進捗（0.0 ～ 1.0。読み込み中でなければ1.0）
+	float GetLoadingProgress() const;
+
 	/// @brief 現在のシーンのBGM音量コールバックを登録
 	/// @param callback 音量倍率(0.0～1.0)を受け取るコールバック関数
 	void RegisterSceneBGMCallback(std::function<void(float)> callback);
@@ -5,6 +5,7 @@
 #include "Engine/Graphics/PostEffect/PostEffectNames.h"
 #include "Engine/Utility/FrameRate/FrameRateController.h"
 #include "Engine/Audio/SoundManager.h"
+#include "Engine/Graphics/Resource/AsyncLoader.h"
 
 void SceneTransition::Initialize(EngineSystem* engine) {
     engine_ = engine;
@@ -18,6 +19,9 @@ void SceneTransition::Initialize(EngineSystem* engine) {
     // SoundManagerを取得
     soundManager_ = engine_->GetComponent<SoundManager>();
 
+    // AsyncLoaderを取得（シーンの非同期読み込みの完了待ち用）
+    asyncLoader_ = engine_->GetComponent<AsyncLoader>();
+
     // 初期状態：完全に透明（フェードなし）
     fadeEffect_->SetFadeAlpha(0.0f);
     fadeEffect_->SetFadeType(FadeEffect::FadeType::BlackFade);
@@ -68,6 +72,13 @@ void SceneTransition::Update(float deltaTime) {
         // シーン切り替え待機中（完全に黒のまま維持）
         break;
 
+    case TransitionPhase::Loading:
+        // 非同期読み込みが全て完了したらフェードイン開始
+        if (!asyncLoader_ || !asyncLoader_->IsLoading()) {
+            BeginFadeIn();
+        }
+        break;
+
     default:
         break;
     }
@@ -110,6 +121,18 @@ void SceneTransition::OnSceneChanged() {
         return;
     }
 
+    // 新しいシーンが非同期読み込みを開始していれば、暗転したまま完了を待つ
+    if (asyncLoader_ && asyncLoader_->IsLoading()) {
+        phase_ = TransitionPhase::Loading;
+        timer_ = 0.0f;
+        waitFrameCounter_ = 0;
+        return;
+    }
+
+    BeginFadeIn();
+}
+
+void SceneTransition::BeginFadeIn() {
     if (type_ == TransitionType::None) {
         // トランジション無し → 即座に待機状態へ
         phase_ = TransitionPhase::Idle;
@@ -131,8 +154,12 @@ bool SceneTransition::IsTransitioning() const {
 }
 
 bool SceneTransition::IsBlocking() const {
-    // フェードアウト中とChanging中はシーン更新をブロック
-    return phase_ == TransitionPhase::FadeOut || phase_ == TransitionPhase::Changing;
+    // フェードアウト中・Changing中・Loading中はシーン更新をブロック
+    return phase_ == TransitionPhase::FadeOut || phase_ == TransitionPhase::Changing || phase_ == TransitionPhase::Loading;
+}
+
+float SceneTransition::GetLoadingProgress() const {
+    return asyncLoader_ ? asyncLoader_->GetProgress().GetRatio() : 1.0f;
 }
 
 void SceneTransition::SkipTransition() {
@@ -152,7 +179,7 @@ float SceneTransition::CalculateFadeAlpha() const {
         return 0.0f;
     }
 
-    if (phase_ == TransitionPhase::Changing) {
+    if (phase_ == TransitionPhase::Changing || phase_ == TransitionPhase::Loading) {
         return 1.0f; // 完全に黒
     }
 
@@ -208,7 +235,8 @@ void SceneTransition::ApplyBGMVolume() {
         break;
 
     case TransitionPhase::Changing:
-        // シーン切替中：完全に無音
+    case TransitionPhase::Loading:
+        // シーン切替中・読み込み中：完全に無音
         volumeMultiplier = 0.0f;
         break;
 
@@ -7,6 +7,7 @@ class EngineSystem;
 class PostEffectManager;
 class FadeEffect;
 class SoundManager;
+class AsyncLoader;
 
 /// @brief シーントランジション管理クラス
 /// @details シーン遷移時のフェードイン・フェードアウトなどの演出を管理（ポストエフェクトベース）
@@ -25,6 +26,7 @@ public:
         Idle,       // 待機中（トランジション無し）
         FadeOut,    // フェードアウト中
         Changing,   // シーン切り替え準備完了
+        Loading,    // 新しいシーンの非同期読み込みの完了待ち（暗転したまま）
         FadeIn      // フェードイン中
     };
 
@@ -50,6 +52,7 @@ public:
     bool IsReadyToChangeScene() const;
 
     /// @brief シーン切り替え完了通知（フェードイン開始）
+    /// 新しいシーンの初期化で非同期読み込みを開始していれば、完了するまで Loading フェーズで待ってからフェードインする
     void OnSceneChanged();
 
     /// @brief トランジション中か確認
@@ -64,6 +67,10 @@ public:
     /// @return 現在のトランジションフェーズ
     TransitionPhase GetCurrentPhase() const { return phase_; }
 
+    /// @brief 非同期読み込みの進捗を取得（ロード画面の表示用）
+    /// @return 進捗（0.0 ～ 1.0。読み込み中でなければ1.0）
+    float GetLoadingProgress() const;
+
     /// @brief トランジションをスキップ（デバッグ用）
     void SkipTransition();
 
@@ -75,6 +82,9 @@ public:
     void ClearBGMVolumeCallback();
 
 private:
+    /// @brief フェードインを開始（トランジション無しの場合は待機状態へ）
+    void BeginFadeIn();
+
     /// @brief フェードアルファ値を計算
     /// @return アルファ値（0.0 = 透明, 1.0 = 不透明）
     float CalculateFadeAlpha() const;
@@ -90,6 +100,7 @@ private:
     PostEffectManager* postEffectManager_ = nullptr;
     FadeEffect* fadeEffect_ = nullptr;
     SoundManager* soundManager_ = nullptr;
+    AsyncLoader* asyncLoader_ = nullptr;
 
     TransitionPhase phase_ = TransitionPhase::Idle;
     TransitionType type_ = TransitionType::None;
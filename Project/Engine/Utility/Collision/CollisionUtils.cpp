@@ -378,17 +378,12 @@ namespace CollisionUtils {
     }
 
     BoundingBox CreateAABBFromPoints(const Vector3* points, size_t count) {
-        if (count == 0) {
+        Vector3 minPoint, maxPoint;
+        if (!Batch::ComputeBounds(std::span<const Vector3>(points, count), minPoint, maxPoint)) {
             return BoundingBox();
         }
         
-        BoundingBox result(points[0], points[0]);
-        
-        for (size_t i = 1; i < count; ++i) {
-            result = ExpandAABBWithPoint(result, points[i]);
-        }
-        
-        return result;
+        return BoundingBox(minPoint, maxPoint);
     }
 
 } // namespace CollisionUtils
\ No newline at end of file
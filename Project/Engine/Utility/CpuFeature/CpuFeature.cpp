@@ -0,0 +1,52 @@
+#include "CpuFeature.h"
+#include <intrin.h>
+
+namespace {
+	bool DetectAVX2() {
+		int info[4] = {};
+
+		__cpuid(info, 0);
+		if (info[0] < 7) {
+			return false;
+		}
+
+		// CPUID.1:ECX - OSXSAVE(27), AVX(28)
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		if (!osxsave || !avx) {
+			return false;
+		}
+
+		// OSがXMM/YMMレジスタの状態を保存しているか
+		if ((_xgetbv(0) & 0x6) != 0x6) {
+			return false;
+		}
+
+		// CPUID.7.0:EBX - AVX2(5)
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+	}
+}
+
+namespace CpuFeature {
+
+bool HasAVX2() {
+	static const bool hasAVX2 = DetectAVX2();
+	return hasAVX2;
+}
+
+SimdLevel GetMaxSimdLevel() {
+	return HasAVX2() ? SimdLevel::AVX2 : SimdLevel::SSE2;
+}
+
+const char* GetSimdLevelName(SimdLevel level) {
+	switch (level) {
+	case SimdLevel::Scalar: return "Scalar";
+	case SimdLevel::SSE2:   return "SSE2";
+	case SimdLevel::AVX2:   return "AVX2";
+	default:                return "Unknown";
+	}
+}
+
+} // namespace CpuFeature
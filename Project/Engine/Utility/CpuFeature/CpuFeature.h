@@ -0,0 +1,23 @@
+#pragma once
+
+/// @brief 実行環境のCPU拡張命令セット判定
+/// 初回呼び出し時にCPUIDで判定し、結果をキャッシュする
+namespace CpuFeature {
+
+/// @brief SIMD命令セットのレベル
+enum class SimdLevel {
+	Scalar, // SIMDを使用しない
+	SSE2,   // 128bit（x64では常に利用可能）
+	AVX2    // 256bit
+};
+
+/// @brief AVX2が利用可能か（OSによるYMMレジスタ保存のサポートも含めて判定）
+bool HasAVX2();
+
+/// @brief 利用可能な最上位のSIMDレベルを取得
+SimdLevel GetMaxSimdLevel();
+
+/// @brief SIMDレベルの表示名を取得
+const char* GetSimdLevelName(SimdLevel level);
+
+} // namespace CpuFeature
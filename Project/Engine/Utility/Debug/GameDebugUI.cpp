@@ -4,6 +4,11 @@
 #include <EngineSystem.h>
 #include "Engine/Utility/FrameRate/FrameRateController.h"
 #include "Engine/Scene/SceneManager.h"
+#include "Engine/Collider/Debug/CollisionBenchmark.h"
+#include "Engine/Math/Debug/MathBenchmark.h"
+#include "Engine/Graphics/Model/Animation/Debug/AnimationBenchmark.h"
+#include "Engine/Graphics/Model/Debug/ModelLoadBenchmark.h"
+#include "Engine/Graphics/Resource/Debug/TextureCookBenchmark.h"
 
 #include <Psapi.h>
 #include <algorithm>
@@ -158,6 +163,36 @@ void GameDebugUI::ShowEngineInfoUI()
 			ImGui::EndTabItem();
 		}
 		
+		// ========== タブ4: 衝突判定 ==========
+		if (ImGui::BeginTabItem("衝突判定")) {
+			ShowCollisionTab();
+			ImGui::EndTabItem();
+		}
+		
+		// ========== タブ5: 数学ライブラリ ==========
+		if (ImGui::BeginTabItem("数学")) {
+			ShowMathTab();
+			ImGui::EndTabItem();
+		}
+		
+		// ========== タブ6: アニメーション ==========
+		if (ImGui::BeginTabItem("アニメーション")) {
+			ShowAnimationTab();
+			ImGui::EndTabItem();
+		}
+		
+		// ========== タブ7: モデル読み込み ==========
+		if (ImGui::BeginTabItem("モデル読み込み")) {
+			ShowModelLoadTab();
+			ImGui::EndTabItem();
+		}
+		
+		// ========== タブ8: テクスチャ焼き込み ==========
+		if (ImGui::BeginTabItem("テクスチャ焼き込み")) {
+			ShowTextureCookTab();
+			ImGui::EndTabItem();
+		}
+		
 		ImGui::EndTabBar();
 	}
 }
@@ -411,6 +446,384 @@ void GameDebugUI::ShowSystemStatusTab()
 		"利用可能なコンポーネント: %d / %d", availableCount, (int)components.size());
 }
 
+void GameDebugUI::ShowCollisionTab()
+{
+	static std::vector<CollisionBenchmark::Result> results;
+	static std::vector<CollisionBenchmark::RaycastResult> raycastResults;
+
+	ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[ブロードフェーズ ベンチマーク]");
+	ImGui::Spacing();
+
+	// 20kの総当たりは1フレームでも数秒かかるため、実行中は画面が止まる
+	if (ImGui::Button("ベンチマーク実行 (1k / 5k / 20k)")) {
+		results = CollisionBenchmark::Run();
+	}
+	ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "※ 実行中は数秒間応答しなくなります");
+	ImGui::Spacing();
+
+	if (ImGui::Button("レイキャスト ベンチマーク実行 (1000本)")) {
+		raycastResults.clear();
+		for (uint32_t colliderCount : { 1000u, 5000u, 20000u }) {
+			raycastResults.push_back(CollisionBenchmark::RunRaycast(colliderCount, 1000));
+		}
+	}
+
+	if (!raycastResults.empty()) {
+		ImGui::Spacing();
+		for (const auto& result : raycastResults) {
+			ImGui::Text("%u コライダー: 総当たり %.3f ms | Raycast %.3f ms | 一括 %.3f ms | 一括 x%u スレッド %.3f ms",
+				result.colliderCount, result.bruteForceMilliseconds, result.singleMilliseconds,
+				result.batchMilliseconds, result.threadCount, result.parallelBatchMilliseconds);
+			ImGui::SameLine();
+			if (result.resultsMatch) {
+				ImGui::TextColored(ImVec4(0.0f, 1.0f, 0.0f, 1.0f), "OK");
+			} else {
+				ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "NG");
+			}
+		}
+	}
+
+	if (results.empty()) {
+		return;
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	if (ImGui::BeginTable("CollisionBenchmarkTable", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		ImGui::TableSetupColumn("コライダー数");
+		ImGui::TableSetupColumn("総当たり (ms)");
+		ImGui::TableSetupColumn("空間ハッシュ (ms)");
+		ImGui::TableSetupColumn("Sweep and Prune (ms)");
+		ImGui::TableSetupColumn("動的AABBツリー (ms)");
+		ImGui::TableSetupColumn("候補 / 衝突");
+		ImGui::TableSetupColumn("Assimp との比較");
+		ImGui::TableHeadersRow();
+
+		for (const auto& result : results) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", result.colliderCount);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.legacyMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.spatialHashMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.sweepAndPruneMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.dynamicTreeMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%u / %u", result.candidatePairCount, result.collidingPairCount);
+			ImGui::TableNextColumn();
+			if (result.resultsMatch) {
+				ImGui::TextColored(ImVec4(0.0f, 1.0f, 0.0f, 1.0f), "OK");
+			} else {
+				ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "NG");
+			}
+		}
+		ImGui::EndTable();
+	}
+}
+
+void GameDebugUI::ShowMathTab()
+{
+	static std::vector<MathBenchmark::Result> results;
+
+	ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[MathCore ベンチマーク]");
+	ImGui::Text("実装: %s", MathBenchmark::IsSimdEnabled() ? "SSE" : "スカラー");
+	ImGui::Spacing();
+
+	if (ImGui::Button("ベンチマーク実行 (各100万回)")) {
+		results = MathBenchmark::Run();
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("スキニング パレット (200体 x 100ジョイント)")) {
+		results = MathBenchmark::RunSkinningPalette();
+	}
+
+	if (results.empty()) {
+		return;
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	if (ImGui::BeginTable("MathBenchmarkTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		ImGui::TableSetupColumn("演算");
+		ImGui::TableSetupColumn("変更前 (ns)");
+		ImGui::TableSetupColumn("現在 (ns)");
+		ImGui::TableSetupColumn("倍率");
+		ImGui::TableSetupColumn("最大誤差");
+		ImGui::TableHeadersRow();
+
+		for (const auto& result : results) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", result.name.c_str());
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f", result.scalarNanoseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f", result.currentNanoseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("x%.2f", result.currentNanoseconds > 0.0 ? result.scalarNanoseconds / result.currentNanoseconds : 0.0);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2e", result.maxError);
+		}
+		ImGui::EndTable();
+	}
+}
+
+void GameDebugUI::ShowAnimationTab()
+{
+	static std::vector<AnimationBenchmark::Result> results;
+	static std::vector<AnimationBenchmark::CompressionResult> compressionResults;
+
+	// 直前のフレームでスケルトンを更新したモデルの数（アニメーションLODで間引いた数を含む）
+	const Model::AnimationStatistics& statistics = Model::GetAnimationStatistics();
+	ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[スケルトンの更新数 (前フレーム)]");
+	ImGui::Text("更新: %u (評価 %u / 補間 %u)", statistics.GetUpdatedCount(), statistics.evaluatedCount, statistics.interpolatedCount);
+	ImGui::Text("省略: %u / 画面外で停止: %u", statistics.skippedCount, statistics.frozenCount);
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[アニメーション ベンチマーク]");
+	ImGui::Spacing();
+
+	if (ImGui::Button("チャンネル対応付け (500体)")) {
+		results = { AnimationBenchmark::RunChannelBinding() };
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("キーフレーム カーソル (120秒のクリップ)")) {
+		results = AnimationBenchmark::RunKeyframeCursor();
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("ポーズのブレンド (200体)")) {
+		results = AnimationBenchmark::RunPoseBlend();
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("アニメーションLOD (200体)")) {
+		results = { AnimationBenchmark::RunAnimationLod() };
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("並列評価 (50/200/1000体)")) {
+		results = AnimationBenchmark::RunParallelEvaluation();
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("ジョイントの配置 (200体)")) {
+		results = { AnimationBenchmark::RunSkeletonLayout() };
+	}
+	if (ImGui::Button("圧縮クリップ (200体)")) {
+		compressionResults = AnimationBenchmark::RunCompression();
+	}
+
+	if (!compressionResults.empty()) {
+		ImGui::Spacing();
+		ImGui::Separator();
+		ImGui::Spacing();
+
+		if (ImGui::BeginTable("AnimationCompressionTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+			ImGui::TableSetupColumn("クリップ");
+			ImGui::TableSetupColumn("キーフレーム数");
+			ImGui::TableSetupColumn("サイズ (KB)");
+			ImGui::TableSetupColumn("最大誤差 (移動/回転°/拡縮)");
+			ImGui::TableSetupColumn("再生 (ms/frame)");
+			ImGui::TableSetupColumn("行列の最大誤差");
+			ImGui::TableHeadersRow();
+
+			for (const auto& result : compressionResults) {
+				const auto& report = result.report;
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::Text("%s", result.name.c_str());
+				ImGui::TableNextColumn();
+				ImGui::Text("%zu -> %zu", report.sourceKeyCount, report.compressedKeyCount);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f -> %.1f (%.1f%%)", report.sourceBytes / 1024.0, report.compressedBytes / 1024.0,
+					report.sourceBytes > 0 ? 100.0 * report.compressedBytes / report.sourceBytes : 0.0);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1e / %.3f / %.1e", report.maxTranslateError, report.maxRotateErrorDegrees, report.maxScaleError);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f -> %.3f", result.sourceMilliseconds, result.compressedMilliseconds);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2e", result.maxMatrixError);
+			}
+			ImGui::EndTable();
+		}
+	}
+
+	if (results.empty()) {
+		return;
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	if (ImGui::BeginTable("AnimationBenchmarkTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		ImGui::TableSetupColumn("計測内容");
+		ImGui::TableSetupColumn("変更前 (ms/frame)");
+		ImGui::TableSetupColumn("現在 (ms/frame)");
+		ImGui::TableSetupColumn("倍率");
+		ImGui::TableSetupColumn("最大誤差");
+		ImGui::TableHeadersRow();
+
+		for (const auto& result : results) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", result.name.c_str());
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.legacyMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.currentMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("x%.2f", result.currentMilliseconds > 0.0 ? result.legacyMilliseconds / result.currentMilliseconds : 0.0);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2e", result.maxError);
+		}
+		ImGui::EndTable();
+	}
+}
+
+void GameDebugUI::ShowModelLoadTab()
+{
+	static std::vector<ModelLoadBenchmark::Result> results;
+
+	// 非同期読み込みの進捗（シーン切り替え時のロード画面と同じ値）
+	if (auto* asyncLoader = engine_->GetComponent<AsyncLoader>()) {
+		const AsyncLoader::Progress& progress = asyncLoader->GetProgress();
+		ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[非同期読み込み]");
+		ImGui::Text("%s: %u / %u", asyncLoader->IsLoading() ? "読み込み中" : "完了", progress.completedCount, progress.totalCount);
+		ImGui::ProgressBar(progress.GetRatio());
+		ImGui::Spacing();
+		ImGui::Separator();
+		ImGui::Spacing();
+	}
+
+	ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[モデル読み込み ベンチマーク]");
+	ImGui::TextWrapped("SampleAssets のモデルを Assimp と焼き込みファイル (.cooked) で読み込み、ファイルキャッシュが冷えた状態 (初回) と温まった状態の時間を比較します");
+	ImGui::Spacing();
+
+	if (ImGui::Button("SampleAssets を読み込み")) {
+		results = ModelLoadBenchmark::Run();
+	}
+
+	if (results.empty()) {
+		return;
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	if (ImGui::BeginTable("ModelLoadBenchmarkTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		ImGui::TableSetupColumn("モデル");
+		ImGui::TableSetupColumn("Assimp 冷/温 (ms)");
+		ImGui::TableSetupColumn("焼き込み (ms)");
+		ImGui::TableSetupColumn("焼き込みファイル 冷/温 (ms)");
+		ImGui::TableSetupColumn("サイズ (KB)");
+		ImGui::TableSetupColumn("Assimp との比較");
+		ImGui::TableHeadersRow();
+
+		for (const auto& result : results) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", result.name.c_str());
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f / %.3f", result.assimpColdMilliseconds, result.assimpWarmMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.cookMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f / %.3f", result.cookedColdMilliseconds, result.cookedWarmMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f -> %.1f", result.sourceBytes / 1024.0, result.cookedBytes / 1024.0);
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", result.identical ? "一致" : "不一致");
+		}
+		ImGui::EndTable();
+	}
+
+	ImGui::Spacing();
+	ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[メッシュ最適化]");
+	ImGui::Text("頂点キャッシュ (FIFO %u) のシミュレーションによる、読み込み時の最適化の前 -> 後", MeshOptimizer::kCacheSize);
+
+	if (ImGui::BeginTable("MeshOptimizeTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		ImGui::TableSetupColumn("モデル");
+		ImGui::TableSetupColumn("頂点数");
+		ImGui::TableSetupColumn("ACMR");
+		ImGui::TableSetupColumn("ATVR");
+		ImGui::TableSetupColumn("クラスタ数");
+		ImGui::TableHeadersRow();
+
+		for (const auto& result : results) {
+			const MeshOptimizer::Report& report = result.meshOptimizeReport;
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", result.name.c_str());
+			ImGui::TableNextColumn();
+			ImGui::Text("%llu -> %llu", static_cast<unsigned long long>(report.source.vertexCount), static_cast<unsigned long long>(report.optimized.vertexCount));
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f -> %.3f", report.source.GetAcmr(), report.optimized.GetAcmr());
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f -> %.3f", report.source.GetAtvr(), report.optimized.GetAtvr());
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", report.clusterCount);
+		}
+		ImGui::EndTable();
+	}
+}
+
+void GameDebugUI::ShowTextureCookTab()
+{
+	static std::vector<TextureCookBenchmark::Result> results;
+
+	ImGui::TextColored(ImVec4(0.2f, 0.8f, 1.0f, 1.0f), "[テクスチャ焼き込み ベンチマーク]");
+	ImGui::TextWrapped("Assets 以下の画像を焼き込みファイル (.cooked.dds、ミップマップ付き・BC圧縮) に変換し、WIC でのデコード＋ミップマップ生成との読み込み時間と、GPU に置くサイズを比較します");
+	ImGui::Spacing();
+
+	if (ImGui::Button("Assets を焼き込み")) {
+		results = TextureCookBenchmark::Run();
+	}
+
+	if (results.empty()) {
+		return;
+	}
+
+	ImGui::Spacing();
+	ImGui::Separator();
+	ImGui::Spacing();
+
+	if (ImGui::BeginTable("TextureCookBenchmarkTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		ImGui::TableSetupColumn("テクスチャ");
+		ImGui::TableSetupColumn("形式");
+		ImGui::TableSetupColumn("デコード＋ミップ (ms)");
+		ImGui::TableSetupColumn("焼き込み (ms)");
+		ImGui::TableSetupColumn("焼き込みファイル (ms)");
+		ImGui::TableSetupColumn("サイズ (KB)");
+		ImGui::TableHeadersRow();
+
+		for (const auto& result : results) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", result.name.c_str());
+			ImGui::TableNextColumn();
+			ImGui::Text("%s", result.cooked ? result.format.c_str() : "失敗");
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.sourceMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.cookMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", result.cookedMilliseconds);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f -> %.1f", result.sourceBytes / 1024.0, result.cookedBytes / 1024.0);
+		}
+		ImGui::EndTable();
+	}
+}
+
 void GameDebugUI::RegisterWindowsForDocking()
 {
 	if (!dockingUI_) return;
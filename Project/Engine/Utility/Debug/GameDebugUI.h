@@ -77,6 +77,21 @@ private: // デバッグ用のUIを表示するためのメソッド
     /// @brief システム状態タブを表示
     void ShowSystemStatusTab();
 
+    /// @brief 衝突判定タブを表示（ブロードフェーズのベンチマーク）
+    void ShowCollisionTab();
+
+    /// @brief 数学タブを表示（MathCore のベンチマーク）
+    void ShowMathTab();
+
+    /// @brief アニメーションタブを表示（スケルトンアニメーションのベンチマーク）
+    void ShowAnimationTab();
+
+    /// @brief モデル読み込みタブを表示（Assimp と焼き込みファイルの読み込み時間のベンチマーク）
+    void ShowModelLoadTab();
+
+    /// @brief テクスチャ焼き込みタブを表示（デコード＋ミップマップ生成と焼き込みファイルの読み込み時間・サイズのベンチマーク）
+    void ShowTextureCookTab();
+
     /// @brief ライティングデバッグUIを表示（独立ウィンドウ）
     void ShowLightingDebugUI();
 
@@ -0,0 +1,156 @@
+#include "JobSystem.h"
+#include <algorithm>
+#include <atomic>
+
+struct JobSystem::Batch {
+	const RangeFunction* function = nullptr;
+	uint32_t count = 0;
+	uint32_t grainSize = 1;
+	uint32_t chunkCount = 0;
+
+	std::atomic<uint32_t> nextChunk = 0;       // 次に取り出す区間
+	std::atomic<uint32_t> completedChunks = 0; // 完了した区間数
+
+	RangeFunction ownedFunction; // Scheduleで投入したジョブ（functionはこれを指す）
+
+	std::mutex mutex;
+	std::condition_variable completed;
+};
+
+JobSystem::~JobSystem() {
+	Finalize();
+}
+
+void JobSystem::Initialize(uint32_t threadCount) {
+	Finalize();
+
+	if (threadCount == 0) {
+		threadCount = (std::max)(1u, std::thread::hardware_concurrency());
+	}
+
+	// 呼び出し元スレッドも処理に参加するため、ワーカーは1つ少なく起動する
+	stopRequested_ = false;
+	workers_.reserve(threadCount - 1);
+	for (uint32_t i = 1; i < threadCount; ++i) {
+		workers_.emplace_back(&JobSystem::WorkerLoop, this);
+	}
+}
+
+void JobSystem::Finalize() {
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		stopRequested_ = true;
+	}
+	queueCondition_.notify_all();
+
+	for (auto& worker : workers_) {
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+	workers_.clear();
+	queue_.clear();
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const RangeFunction& function) {
+	if (count == 0) {
+		return;
+	}
+
+	grainSize = (std::max)(1u, grainSize);
+	const uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+
+	// ワーカーがいない、または分割不要なら呼び出し元で直接実行
+	if (workers_.empty() || chunkCount == 1) {
+		for (uint32_t begin = 0; begin < count; begin += grainSize) {
+			function(begin, (std::min)(begin + grainSize, count));
+		}
+		return;
+	}
+
+	auto batch = std::make_shared<Batch>();
+	batch->function = &function;
+	batch->count = count;
+	batch->grainSize = grainSize;
+	batch->chunkCount = chunkCount;
+
+	// 区間数を超えるワーカーを起こしても仕事がないため、必要数だけ投入する
+	const uint32_t helperCount = (std::min)(static_cast<uint32_t>(workers_.size()), chunkCount - 1);
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		for (uint32_t i = 0; i < helperCount; ++i) {
+			queue_.push_back(batch);
+		}
+	}
+	if (helperCount == 1) {
+		queueCondition_.notify_one();
+	} else {
+		queueCondition_.notify_all();
+	}
+
+	// 呼び出し元も区間を処理し、残りはワーカーの完了を待つ
+	ExecuteBatch(*batch);
+
+	std::unique_lock<std::mutex> lock(batch->mutex);
+	batch->completed.wait(lock, [&batch]() {
+		return batch->completedChunks.load() == batch->chunkCount;
+	});
+}
+
+void JobSystem::Schedule(std::function<void()> job) {
+	if (workers_.empty()) {
+		job();
+		return;
+	}
+
+	// 1区間だけのバッチとして投入する（完了を待つ呼び出し元はいない）
+	auto batch = std::make_shared<Batch>();
+	batch->ownedFunction = [job = std::move(job)](uint32_t, uint32_t) { job(); };
+	batch->function = &batch->ownedFunction;
+	batch->count = 1;
+	batch->chunkCount = 1;
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		queue_.push_back(std::move(batch));
+	}
+	queueCondition_.notify_one();
+}
+
+void JobSystem::ExecuteBatch(Batch& batch) {
+	for (;;) {
+		const uint32_t chunk = batch.nextChunk.fetch_add(1);
+		if (chunk >= batch.chunkCount) {
+			return;
+		}
+
+		const uint32_t begin = chunk * batch.grainSize;
+		const uint32_t end = (std::min)(begin + batch.grainSize, batch.count);
+		(*batch.function)(begin, end);
+
+		// 最後の区間を終えたスレッドが待機中の呼び出し元を起こす
+		if (batch.completedChunks.fetch_add(1) + 1 == batch.chunkCount) {
+			{
+				std::lock_guard<std::mutex> lock(batch.mutex);
+			}
+			batch.completed.notify_all();
+		}
+	}
+}
+
+void JobSystem::WorkerLoop() {
+	for (;;) {
+		std::shared_ptr<Batch> batch;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex_);
+			queueCondition_.wait(lock, [this]() { return stopRequested_ || !queue_.empty(); });
+			if (stopRequested_ && queue_.empty()) {
+				return;
+			}
+			batch = std::move(queue_.front());
+			queue_.pop_front();
+		}
+
+		// 呼び出し元が先に全区間を処理し終えていた場合は何もせず戻る
+		ExecuteBatch(*batch);
+	}
+}
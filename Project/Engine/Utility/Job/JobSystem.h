@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief ワーカースレッドプールによるジョブシステム
+/// ParallelForで範囲を分割して実行し、全区間の完了まで呼び出し元をブロックする
+/// 呼び出し元スレッドも区間の処理に参加するため、ジョブ内から入れ子でParallelForを呼んでもデッドロックしない
+/// Scheduleで完了を待たないジョブ（ファイルの読み込みなど）も投入できる。実行中はそのワーカーが埋まるが、
+/// ParallelForは呼び出し元が残りの区間を処理するため、完了が遅れることはあっても止まることはない
+class JobSystem {
+public:
+	/// @brief 分割された区間を処理する関数（[begin, end)）
+	using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+	JobSystem() = default;
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	/// @brief 初期化（ワーカースレッドを起動）
+	/// @param threadCount 呼び出し元を含むスレッド数（0の場合はハードウェアスレッド数）
+	void Initialize(uint32_t threadCount = 0);
+
+	/// @brief 終了処理（ワーカースレッドを停止して合流）
+	void Finalize();
+
+	/// @brief 呼び出し元を含むスレッド数を取得
+	uint32_t GetThreadCount() const { return static_cast<uint32_t>(workers_.size()) + 1; }
+
+	/// @brief [0, count) をgrainSize単位に分割して並列実行し、全区間の完了を待つ
+	/// @param count 要素数
+	/// @param grainSize 1ジョブあたりの要素数（0の場合は1）
+	/// @param function 区間ごとに呼ばれる関数（区間同士は重ならない）
+	void ParallelFor(uint32_t count, uint32_t grainSize, const RangeFunction& function);
+
+	/// @brief ジョブをワーカースレッドで実行する（完了を待たずに戻る）
+	/// ワーカーがいない場合は呼び出し元で直ちに実行する。Finalize時に未実行のジョブは実行してから停止する
+	/// @param job 実行する関数
+	void Schedule(std::function<void()> job);
+
+private:
+	/// @brief 1回のParallelForで共有される状態
+	struct Batch;
+
+	/// @brief 未処理の区間を取り出して実行
+	static void ExecuteBatch(Batch& batch);
+
+	/// @brief ワーカースレッドのメインループ
+	void WorkerLoop();
+
+	std::vector<std::thread> workers_;
+	std::deque<std::shared_ptr<Batch>> queue_;
+	std::mutex queueMutex_;
+	std::condition_variable queueCondition_;
+	bool stopRequested_ = false;
+};
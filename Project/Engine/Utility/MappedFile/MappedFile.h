@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/// @brief 読み取り専用のメモリマップドファイル
+/// ファイル全体をアドレス空間にマップし、読み込みやコピーをせずに内容へアクセスする
+/// ページはアクセスした時にOSが読み込むため、開くだけならファイルサイズに関係なく軽い
+class MappedFile {
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/// @brief ファイルを開いてマップする（既に開いている場合は閉じてから開く）
+	/// @param filePath ファイルパス
+	/// @return 成功したらtrue（ファイルがない、空のファイルの場合はfalse）
+	bool Open(const std::string& filePath);
+
+	/// @brief マップを解除してファイルを閉じる
+	void Close();
+
+	/// @brief ファイルが開いているか
+	bool IsOpen() const { return data_ != nullptr; }
+
+	/// @brief マップしたファイルの先頭
+	const std::byte* GetData() const { return data_; }
+
+	/// @brief ファイルサイズ（バイト）
+	size_t GetSize() const { return size_; }
+
+private:
+	void* fileHandle_ = nullptr;    // ファイルのハンドル
+	void* mappingHandle_ = nullptr; // ファイルマッピングオブジェクトのハンドル
+	const std::byte* data_ = nullptr;
+	size_t size_ = 0;
+};